@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include "cla3p/dense.hpp"
+#include "cla3p/support.hpp"
 
 int main()
 {
@@ -26,5 +27,26 @@ int main()
 
 	std::cout << B.info("B") << B;
 
+	/* 
+	 * (4x2) double precision general real matrix 
+	 * with normally distributed values (mean 0, standard deviation 1)
+	 */
+
+	cla3p::dns::RdMatrix C = cla3p::dns::RdMatrix::randomNormal(4, 2);
+
+	std::cout << C.info("C") << C;
+
+	/* 
+	 * Resetting the seed reproduces the same sequence of random objects
+	 */
+
+	cla3p::setRandomSeed(7);
+	cla3p::dns::RdMatrix D1 = cla3p::dns::RdMatrix::random(3, 3);
+
+	cla3p::setRandomSeed(7);
+	cla3p::dns::RdMatrix D2 = cla3p::dns::RdMatrix::random(3, 3);
+
+	std::cout << "D1:\n" << D1 << "D2:\n" << D2;
+
 	return 0;
 }
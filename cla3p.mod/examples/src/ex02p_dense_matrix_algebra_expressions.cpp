@@ -0,0 +1,39 @@
+/**
+ * @example ex02p_dense_matrix_algebra_expressions.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	cla3p::dns::CdMatrix A = cla3p::dns::CdMatrix::random(3,3);
+	cla3p::dns::CdMatrix B = cla3p::dns::CdMatrix::random(3,3);
+	cla3p::dns::CdMatrix C = cla3p::dns::CdMatrix::random(3,3);
+	cla3p::dns::CdMatrix D = cla3p::dns::CdMatrix::random(3,3);
+
+	std::cout << "A:\n" << A;
+	std::cout << "B:\n" << B;
+	std::cout << "C:\n" << C;
+	std::cout << "D:\n" << D << "\n";
+
+	/*
+	 * Sums of products are evaluated on assignment
+	 * The result is created from the first term, the rest are accumulated in-place
+	 */
+
+	cla3p::complex_t alpha(2,1);
+
+	cla3p::dns::CdMatrix E = alpha * A * B + C * D.ctranspose() - A;
+	std::cout << "E = alpha * A * B + C * D^H - A:\n" << E << "\n";
+
+	/*
+	 * Conjugated operands are folded into the multiplication, no copies are created
+	 */
+
+	E += A.conjugate() * B.conjugate() + C.transpose() * D.conjugate();
+	std::cout << "E += conj(A) * conj(B) + C^T * conj(D):\n" << E;
+
+	return 0;
+}
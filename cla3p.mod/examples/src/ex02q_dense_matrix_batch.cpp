@@ -0,0 +1,52 @@
+/**
+ * @example ex02q_dense_matrix_batch.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	const cla3p::uint_t n = 4;
+	const cla3p::uint_t count = 1000;
+
+	/*
+	 * A batch of 1000 (4x4) matrices in the interleaved (Compact) layout
+	 */
+
+	cla3p::dns::RdMatrixBatch A = cla3p::dns::RdMatrixBatch::random(n, n, count, cla3p::layout_t::Compact);
+	cla3p::dns::RdMatrixBatch X = cla3p::dns::RdMatrixBatch::random(n, 1, count, cla3p::layout_t::Compact);
+
+	std::cout << A.info("A");
+
+	/*
+	 * Batched matrix-matrix product: B[k] = A[k] * X[k]
+	 */
+
+	cla3p::dns::RdMatrixBatch B(n, 1, count, cla3p::layout_t::Compact);
+	B = 0;
+	cla3p::ops::mult(1., cla3p::op_t::N, A, cla3p::op_t::N, X, B);
+
+	/*
+	 * Batched LU decomposition & solution, overwrites B with A[k]^{-1} * B[k]
+	 */
+
+	cla3p::dns::LSolverBatchLU<cla3p::dns::RdMatrix> luSolver;
+	luSolver.decompose(A);
+	luSolver.solve(B);
+
+	/*
+	 * Individual matrices are accessed by copy (any layout) or by reference (Strided layout)
+	 */
+
+	cla3p::dns::RdMatrixBatch Xs = X.convert(cla3p::layout_t::Strided);
+	cla3p::dns::RdMatrixBatch Bs = B.convert(cla3p::layout_t::Strided);
+
+	std::cout << "Solution of system 10:" << std::endl << Bs.get(10) << std::endl;
+	std::cout << "Absolute Error of system 10: " 
+		<< cla3p::dns::RdMatrix(Bs.matrix(10) - Xs.matrix(10)).normOne() << std::endl;
+
+	return 0;
+}
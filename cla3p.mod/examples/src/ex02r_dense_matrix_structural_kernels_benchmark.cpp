@@ -0,0 +1,94 @@
+/**
+ * @example ex02r_dense_matrix_structural_kernels_benchmark.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include "cla3p/dense.hpp"
+
+/*
+ * Returns the elapsed time in seconds since t0
+ */
+static double elapsed(std::chrono::steady_clock::time_point t0)
+{
+	auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+/*
+ * Prints the achieved bandwidth, nbytes is the memory traffic of a single call
+ */
+static void report(const std::string& name, double nbytes, cla3p::uint_t ncalls, double sec)
+{
+	std::cout << "  " << name << " " << sec / ncalls << " sec/call, " << nbytes * ncalls / sec * 1.e-9 << " GB/s\n";
+}
+
+/*
+ * Times the triangular-to-full expansion & the norms of a (n x n) matrix with property pr
+ */
+template <typename T_Matrix>
+static void run(const std::string& label, cla3p::uint_t n, cla3p::uint_t ncalls, const cla3p::Property& pr)
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	T_Matrix A = T_Matrix::random(n, n, pr);
+
+	/*
+	 * The expansion reads the stored triangle & writes the other one
+	 */
+
+	double texpand = 0;
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		T_Matrix B = A.copy();
+		auto t0 = std::chrono::steady_clock::now();
+		B.igeneral();
+		texpand += elapsed(t0);
+	} // l
+
+	/*
+	 * The norms read the stored triangle only
+	 */
+
+	double tnorms[3] = {0, 0, 0};
+	double checksum = 0;
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		auto t0 = std::chrono::steady_clock::now();
+		checksum += A.normFro();
+		tnorms[0] += elapsed(t0);
+		t0 = std::chrono::steady_clock::now();
+		checksum += A.normOne();
+		tnorms[1] += elapsed(t0);
+		t0 = std::chrono::steady_clock::now();
+		checksum += A.normMax();
+		tnorms[2] += elapsed(t0);
+	} // l
+
+	double halfBytes = 0.5 * static_cast<double>(n) * n * sizeof(T_Scalar);
+
+	std::cout << label << " (" << n << " x " << n << "), checksum: " << checksum << "\n";
+	report("Expansion........", 2. * halfBytes, ncalls, texpand);
+	report("Frobenius norm...", halfBytes, ncalls, tnorms[0]);
+	report("One norm.........", halfBytes, ncalls, tnorms[1]);
+	report("Max norm.........", halfBytes, ncalls, tnorms[2]);
+}
+
+int main()
+{
+	const cla3p::uint_t n = 8000;
+	const cla3p::uint_t ncalls = 10;
+
+	/*
+	 * Large matrices (far beyond the last level cache), kernels should run close to memory bandwidth
+	 * Control the number of threads via OMP_NUM_THREADS
+	 */
+
+	run<cla3p::dns::RdMatrix>("Symmetric (real)", n, ncalls, cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower));
+	run<cla3p::dns::RdMatrix>("Skew (real)", n, ncalls, cla3p::Property(cla3p::prop_t::Skew, cla3p::uplo_t::Lower));
+	run<cla3p::dns::CdMatrix>("Hermitian (complex)", n, ncalls, cla3p::Property(cla3p::prop_t::Hermitian, cla3p::uplo_t::Upper));
+	run<cla3p::dns::CdMatrix>("Skew (complex)", n, ncalls, cla3p::Property(cla3p::prop_t::Skew, cla3p::uplo_t::Upper));
+
+	return 0;
+}
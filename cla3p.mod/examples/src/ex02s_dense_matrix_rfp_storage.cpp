@@ -0,0 +1,60 @@
+/**
+ * @example ex02s_dense_matrix_rfp_storage.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	const cla3p::uint_t n = 500;
+
+	/*
+	 * A symmetric positive definite matrix (lower part referenced)
+	 */
+
+	cla3p::Property pr(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower);
+
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(n, n, pr);
+	for(cla3p::uint_t i = 0; i < n; i++) A(i,i) += n;
+
+	/*
+	 * Pack the lower part in RFP storage (n * (n + 1) / 2 values)
+	 */
+
+	cla3p::dns::RdRfpMatrix Arfp = cla3p::dns::RdRfpMatrix::fromDense(A);
+
+	std::cout << Arfp.info("Arfp");
+	std::cout << "Norm (one) difference: " << (Arfp.normOne() - A.normOne()) << std::endl;
+	std::cout << "Norm (fro) difference: " << (Arfp.normFro() - A.normFro()) << std::endl;
+
+	/*
+	 * Products with the packed matrix
+	 */
+
+	const cla3p::dns::RdMatrix X = cla3p::dns::RdMatrix::random(n, 3);
+	cla3p::dns::RdMatrix B(n, 3);
+	B = 0;
+
+	cla3p::ops::mult(1., cla3p::op_t::N, Arfp, X, B);
+
+	std::cout << "Product difference: " << cla3p::dns::RdMatrix(B - A * X).normOne() << std::endl;
+
+	/*
+	 * Cholesky decomposition & solution in RFP storage
+	 */
+
+	cla3p::dns::LSolverRfpLLt<cla3p::dns::RdMatrix> rfpSolver;
+
+	rfpSolver.decompose(Arfp);
+
+	cla3p::dns::RdMatrix Y = B.copy();
+
+	rfpSolver.solve(Y);
+
+	std::cout << "Absolute Error: " << cla3p::dns::RdMatrix(X - Y).normOne() << std::endl;
+
+	return 0;
+}
@@ -32,7 +32,7 @@ int main()
 		luSolver.solve(X);
 
 		std::cout << "Dense Vector rhs::Absolute Error: "
-			<< (B1 - A * X).normOne() << std::endl;
+			<< cla3p::dns::RdVector(B1 - A * X).normOne() << std::endl;
 	}
 
 	{
@@ -46,7 +46,7 @@ int main()
 		luSolver.solve(X);
 
 		std::cout << "Dense Matrix rhs::Absolute Error: "
-			<< (B2 - A * X).normOne() << std::endl;
+			<< cla3p::dns::RdMatrix(B2 - A * X).normOne() << std::endl;
 	}
 
 	return 0;
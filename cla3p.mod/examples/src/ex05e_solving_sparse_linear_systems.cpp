@@ -0,0 +1,119 @@
+/**
+ * @example ex05e_solving_sparse_linear_systems.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+/*
+ * Creates the lower part of a (N x N) 2D Laplacian with a diagonal shift (symmetric positive definite)
+ */
+static cla3p::csc::RdMatrix laplacian(cla3p::int_t n, double shift)
+{
+	cla3p::int_t N = n * n;
+	cla3p::Property pr(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower);
+	cla3p::coo::RdMatrix Acoo(N, N, 3 * N, pr);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4. + shift);
+			if(i < n - 1) Acoo.insert(k + 1, k, -1.);
+			if(j < n - 1) Acoo.insert(k + n, k, -1.);
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+int main()
+{
+	const cla3p::int_t n = 100;
+
+	cla3p::csc::RdMatrix A = laplacian(n, 0.);
+
+	const cla3p::dns::RdVector B1 = cla3p::dns::RdVector::random(A.nrows());
+	const cla3p::dns::RdMatrix B2 = cla3p::dns::RdMatrix::random(A.nrows(), 4);
+
+	cla3p::csc::LSolverLLt<cla3p::csc::RdMatrix> lltSolver;
+
+	/*
+	 * Symbolic analysis (ordering & symbolic factorization) followed by the numerical decomposition
+	 */
+
+	lltSolver.decompose(A);
+
+	std::cout << "Factor non-zeros: " << lltSolver.factorNnz() << std::endl;
+
+	{
+		/*
+		 * Single column (vector) rhs
+		 */
+
+		cla3p::dns::RdVector X = B1.copy();
+
+		lltSolver.solve(X);
+
+		std::cout << "Vector rhs::Absolute Error: "
+			<< cla3p::dns::RdVector(B1 - A * X).normInf() << std::endl;
+	}
+
+	{
+		/*
+		 * Multiple column (matrix) rhs, solved in a single call
+		 */
+
+		cla3p::dns::RdMatrix X = B2.copy();
+
+		lltSolver.solve(X);
+
+		std::cout << "Matrix rhs::Absolute Error: "
+			<< cla3p::dns::RdMatrix(B2 - A * X).normOne() << std::endl;
+	}
+
+	{
+		/*
+		 * Same sparsity pattern, new values
+		 * The symbolic analysis is reused, only the numerical decomposition is performed
+		 */
+
+		cla3p::csc::RdMatrix A2 = laplacian(n, 0.5);
+
+		lltSolver.decompose(A2);
+
+		cla3p::dns::RdVector X = B1.copy();
+
+		lltSolver.solve(X);
+
+		std::cout << "Refactorization::Absolute Error: "
+			<< cla3p::dns::RdVector(B1 - A2 * X).normInf() << std::endl;
+	}
+
+	{
+		/*
+		 * Indefinite (LDL') & general (LU) solvers share the same interface
+		 */
+
+		cla3p::csc::LSolverLDLt<cla3p::csc::RdMatrix> ldltSolver;
+		cla3p::csc::LSolverLU<cla3p::csc::RdMatrix> luSolver;
+
+		ldltSolver.decompose(A);
+		luSolver.decompose(A);
+
+		cla3p::dns::RdVector X1 = B1.copy();
+		cla3p::dns::RdVector X2 = B1.copy();
+
+		ldltSolver.solve(X1);
+		luSolver.solve(X2);
+
+		std::cout << "LDLt::Absolute Error: "
+			<< cla3p::dns::RdVector(B1 - A * X1).normInf() << std::endl;
+		std::cout << "LU::Absolute Error: "
+			<< cla3p::dns::RdVector(B1 - A * X2).normInf() << std::endl;
+	}
+
+	return 0;
+}
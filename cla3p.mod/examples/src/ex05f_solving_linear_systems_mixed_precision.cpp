@@ -0,0 +1,41 @@
+/**
+ * @example ex05f_solving_linear_systems_mixed_precision.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	const cla3p::uint_t n = 500;
+
+	/*
+	 * A well conditioned (diagonally dominant) system
+	 */
+
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(n,n);
+	for(cla3p::uint_t i = 0; i < n; i++) A(i,i) += n;
+
+	const cla3p::dns::RdMatrix B = cla3p::dns::RdMatrix::random(n,3);
+
+	/*
+	 * Decompose a single precision copy of A (LU)
+	 * The solution stage refines the double precision solution
+	 */
+
+	cla3p::dns::LSolverMixed<cla3p::dns::RdMatrix> mixedSolver(cla3p::decomp_t::LU);
+
+	mixedSolver.decompose(A);
+
+	cla3p::dns::RdMatrix X = B.copy();
+
+	mixedSolver.solve(X);
+
+	std::cout << "Refinement steps: " << mixedSolver.iterations() << std::endl;
+	std::cout << "Double precision fallback: " << (mixedSolver.fallback() ? "yes" : "no") << std::endl;
+	std::cout << "Absolute Error: " << cla3p::dns::RdMatrix(B - A * X).normOne() << std::endl;
+
+	return 0;
+}
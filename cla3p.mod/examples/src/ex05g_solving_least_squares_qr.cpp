@@ -0,0 +1,64 @@
+/**
+ * @example ex05g_solving_least_squares_qr.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	/*
+	 * Overdetermined (tall-skinny) system, fitted in the least squares sense
+	 */
+
+	const cla3p::uint_t m = 100000;
+	const cla3p::uint_t n = 8;
+
+	const cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(m,n);
+	const cla3p::dns::RdMatrix B = cla3p::dns::RdMatrix::random(m,2);
+
+	/*
+	 * Decompose A into QR product (TSQR is selected automatically for tall-skinny matrices)
+	 */
+
+	cla3p::dns::LSolverQR<cla3p::dns::RdMatrix> qrSolver;
+
+	qrSolver.decompose(A);
+
+	std::cout << "TSQR variant: " << (qrSolver.tsqr() ? "yes" : "no") << std::endl;
+
+	/*
+	 * Overwrite the first n rows of X with the solution of min ||A * X - B||
+	 */
+
+	cla3p::dns::RdMatrix X = B.copy();
+
+	qrSolver.solve(X);
+
+	cla3p::dns::RdMatrix Xls = X.block(0, 0, n, X.ncols());
+
+	/*
+	 * The residual is orthogonal to the columns of A
+	 */
+
+	cla3p::dns::RdMatrix R = B - A * Xls;
+
+	std::cout << "Optimality ||A' * (B - A * X)||: " << cla3p::dns::RdMatrix(A.transpose() * R).normOne() << std::endl;
+
+	/*
+	 * Rank deficient matrices require column pivoting
+	 */
+
+	cla3p::dns::RdMatrix C = A.copy();
+	C.setBlock(0, n - 1, A.block(0, 0, m, 1));
+
+	cla3p::dns::LSolverQR<cla3p::dns::RdMatrix> qrpSolver(true);
+
+	qrpSolver.decompose(C);
+
+	std::cout << "Numerical rank: " << qrpSolver.rank() << std::endl;
+
+	return 0;
+}
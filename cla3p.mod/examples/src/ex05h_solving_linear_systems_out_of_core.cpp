@@ -0,0 +1,47 @@
+/**
+ * @example ex05h_solving_linear_systems_out_of_core.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/io.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	const cla3p::uint_t n = 1000;
+	const cla3p::uint_t nb = 128;
+
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(n,n);
+	const cla3p::dns::RdMatrix B = cla3p::dns::RdMatrix::random(n,3);
+
+	/*
+	 * Fill a file-backed tiled matrix tile by tile
+	 * (for matrices larger than memory the tiles are generated/loaded piecewise)
+	 */
+
+	cla3p::io::TileStore<cla3p::real_t> store("A.tiles", n, n, nb, true);
+
+	for(cla3p::uint_t j = 0; j < store.tileCols(); j++) {
+		for(cla3p::uint_t i = 0; i < store.tileRows(); i++) {
+			store.write(i, j, A.values() + i * nb + j * nb * A.ld(), A.ld());
+		} // i
+	} // j
+
+	/*
+	 * Factorize in place (LU), tiles are streamed from/to the file
+	 */
+
+	cla3p::dns::LSolverOutOfCore<cla3p::dns::RdMatrix> oocSolver(cla3p::decomp_t::LU);
+
+	oocSolver.decompose(store);
+
+	cla3p::dns::RdMatrix X = B.copy();
+
+	oocSolver.solve(X);
+
+	std::cout << "Absolute Error: " << cla3p::dns::RdMatrix(B - A * X).normOne() << std::endl;
+
+	return 0;
+}
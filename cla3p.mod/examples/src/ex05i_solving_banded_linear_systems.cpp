@@ -0,0 +1,105 @@
+/**
+ * @example ex05i_solving_banded_linear_systems.cpp
+ */
+
+#include <vector>
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	const cla3p::uint_t n = 1000;
+
+	/*
+	 * The 1D Laplacian, stored as a Symmetric tridiagonal matrix (lower part)
+	 */
+
+	cla3p::dns::RdTridiagonalMatrix L(n, cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower));
+
+	for(cla3p::uint_t i = 0; i < n; i++) {
+		L.set(i, i, 2.);
+		if(i + 1 < n) L.set(i + 1, i, -1.);
+	} // i
+
+	cla3p::dns::RdMatrix B = cla3p::dns::RdMatrix::random(n, 2);
+	cla3p::dns::RdMatrix X = B.copy();
+
+	cla3p::dns::LSolverTridiagonal<cla3p::dns::RdMatrix> triSolver;
+
+	triSolver.decompose(L);
+	triSolver.solve(X);
+
+	cla3p::dns::RdMatrix R = B.copy();
+	cla3p::ops::mult(-1., cla3p::op_t::N, L, X, R);
+
+	std::cout << "Tridiagonal (LDL') Absolute Error: " << R.normOne() << std::endl;
+
+	/*
+	 * A convection-diffusion operator, stored as a General band matrix (2 sub/super-diagonals)
+	 */
+
+	cla3p::dns::RdBandMatrix A(n, n, 2, 2);
+
+	for(cla3p::uint_t j = 0; j < n; j++) {
+		if(j >= 2) A.set(j - 2, j, -0.1);
+		if(j >= 1) A.set(j - 1, j, -1.2);
+		A.set(j, j, 3.);
+		if(j + 1 < n) A.set(j + 1, j, -0.8);
+		if(j + 2 < n) A.set(j + 2, j, -0.1);
+	} // j
+
+	cla3p::dns::LSolverBand<cla3p::dns::RdMatrix> bandSolver;
+
+	X = B.copy();
+
+	bandSolver.decompose(A);
+	bandSolver.solve(X);
+
+	R = B.copy();
+	cla3p::ops::mult(-1., cla3p::op_t::N, A, X, R);
+
+	std::cout << "Band (LU) Absolute Error: " << R.normOne() << std::endl;
+
+	/*
+	 * A batch of small independent tridiagonal systems, decomposed & solved in parallel
+	 */
+
+	const cla3p::uint_t m = 16;
+	const cla3p::uint_t count = 1000;
+
+	std::vector<cla3p::dns::RdTridiagonalMatrix> T;
+
+	for(cla3p::uint_t k = 0; k < count; k++) {
+		cla3p::dns::RdTridiagonalMatrix Tk(m);
+		for(cla3p::uint_t i = 0; i < m; i++) {
+			Tk.set(i, i, 4. + k % 3);
+			if(i + 1 < m) {
+				Tk.set(i + 1, i, -1.);
+				Tk.set(i, i + 1, -2.);
+			} // i + 1 < m
+		} // i
+		T.push_back(std::move(Tk));
+	} // k
+
+	cla3p::dns::RdMatrixBatch Bb = cla3p::dns::RdMatrixBatch::random(m, 1, count, cla3p::layout_t::Strided);
+	cla3p::dns::RdMatrixBatch Xb = Bb.copy();
+
+	cla3p::dns::LSolverBatchTridiagonal<cla3p::dns::RdMatrix> batchSolver;
+
+	batchSolver.decompose(T);
+	batchSolver.solve(Xb);
+
+	cla3p::real_t maxErr = 0;
+
+	for(cla3p::uint_t k = 0; k < count; k++) {
+		cla3p::dns::RdMatrix Rk = Bb.get(k);
+		cla3p::ops::mult(-1., cla3p::op_t::N, T[k], Xb.get(k), Rk);
+		maxErr = std::max(maxErr, Rk.normOne());
+	} // k
+
+	std::cout << "Batched tridiagonal (LU) Max Absolute Error: " << maxErr << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @example ex06o_sparse_matrix_optimized_vmult.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+
+/*
+ * Creates the 5-point laplacian on a (n x n) grid
+ */
+static cla3p::csc::RdMatrix laplacian(cla3p::int_t n)
+{
+	cla3p::int_t N = n * n;
+	cla3p::coo::RdMatrix Acoo(N, N, 5 * N);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4.);
+			if(i > 0    ) Acoo.insert(k, k - 1, -1.);
+			if(i < n - 1) Acoo.insert(k, k + 1, -1.);
+			if(j > 0    ) Acoo.insert(k, k - n, -1.);
+			if(j < n - 1) Acoo.insert(k, k + n, -1.);
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+/*
+ * Performs ncalls products Y += A * X, returns the elapsed time in seconds
+ */
+static double run(cla3p::uint_t ncalls, const cla3p::csc::RdMatrix& A, const cla3p::dns::RdVector& X, cla3p::dns::RdVector& Y)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		cla3p::ops::mult(1., cla3p::op_t::N, A, X, Y);
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+	const cla3p::int_t n = 500;
+	const cla3p::uint_t ncalls = 1000;
+
+	cla3p::csc::RdMatrix A = laplacian(n);
+	cla3p::dns::RdVector X(A.ncols());
+	cla3p::dns::RdVector Y(A.nrows());
+
+	X = 1.;
+	Y = 0.;
+
+	/*
+	 * Default behaviour, a temporary backend handle is created for each product
+	 */
+
+	double tdefault = run(ncalls, A, X, Y);
+
+	/*
+	 * Persistent handle, created & optimized on the first product and reused afterwards
+	 */
+
+	A.optimize(ncalls);
+	double toptimized = run(ncalls, A, X, Y);
+
+	std::cout << "Matrix size.......... " << A.nrows() << " x " << A.ncols() << " (" << A.nnz() << " non zeros)\n";
+	std::cout << "Number of products... " << ncalls << "\n";
+	std::cout << "Default (sec)........ " << tdefault << "\n";
+	std::cout << "Optimized (sec)...... " << toptimized << "\n";
+	std::cout << "Speedup.............. " << tdefault / toptimized << "\n";
+
+	return 0;
+}
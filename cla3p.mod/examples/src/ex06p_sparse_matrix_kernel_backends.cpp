@@ -0,0 +1,87 @@
+/**
+ * @example ex06p_sparse_matrix_kernel_backends.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/support.hpp"
+
+/*
+ * Creates the 5-point laplacian on a (n x n) grid (lower part only if pr is symmetric)
+ */
+static cla3p::csc::RdMatrix laplacian(cla3p::int_t n, const cla3p::Property& pr)
+{
+	cla3p::int_t N = n * n;
+	cla3p::coo::RdMatrix Acoo(N, N, 5 * N, pr);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4.);
+			if(i < n - 1) Acoo.insert(k + 1, k, -1.);
+			if(j < n - 1) Acoo.insert(k + n, k, -1.);
+			if(pr.isGeneral() && i > 0) Acoo.insert(k - 1, k, -1.);
+			if(pr.isGeneral() && j > 0) Acoo.insert(k - n, k, -1.);
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+/*
+ * Performs ncalls products Y += opA(A) * X, returns the elapsed time in seconds
+ */
+static double run(cla3p::uint_t ncalls, cla3p::op_t opA, const cla3p::csc::RdMatrix& A, const cla3p::dns::RdVector& X, cla3p::dns::RdVector& Y)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		cla3p::ops::mult(1., opA, A, X, Y);
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+static void compare(const std::string& title, cla3p::uint_t ncalls, cla3p::op_t opA, const cla3p::csc::RdMatrix& A)
+{
+	cla3p::dns::RdVector X(A.ncols());
+	cla3p::dns::RdVector Y1(A.nrows());
+	cla3p::dns::RdVector Y2(A.nrows());
+
+	X = 1.;
+	Y1 = 0.;
+	Y2 = 0.;
+
+	cla3p::setSparseKernel(cla3p::kernel_t::Mkl);
+	double tmkl = run(ncalls, opA, A, X, Y1);
+
+	cla3p::setSparseKernel(cla3p::kernel_t::Native);
+	double tnative = run(ncalls, opA, A, X, Y2);
+
+	std::cout << title << "\n";
+	std::cout << "  Mkl (sec).......... " << tmkl << "\n";
+	std::cout << "  Native (sec)....... " << tnative << "\n";
+	std::cout << "  Difference......... " << cla3p::dns::RdVector(Y1 - Y2).normInf() << "\n";
+}
+
+int main()
+{
+	const cla3p::int_t n = 500;
+	const cla3p::uint_t ncalls = 200;
+
+	cla3p::csc::RdMatrix Age = laplacian(n, cla3p::Property(cla3p::prop_t::General, cla3p::uplo_t::Full));
+	cla3p::csc::RdMatrix Asy = laplacian(n, cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower));
+
+	compare("General, Y += A * X"  , ncalls, cla3p::op_t::N, Age);
+	compare("General, Y += A^T * X", ncalls, cla3p::op_t::T, Age);
+	compare("Symmetric, Y += A * X", ncalls, cla3p::op_t::N, Asy);
+
+	cla3p::setSparseKernel(cla3p::kernel_t::Mkl);
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @example ex06q_sparse_matrix_csr.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+
+/*
+ * Creates a (N x N) matrix with a 5-point stencil & an upwind convection term (non-symmetric)
+ */
+static cla3p::csc::RdMatrix convection(cla3p::int_t n)
+{
+	cla3p::int_t N = n * n;
+	cla3p::coo::RdMatrix Acoo(N, N, 5 * N);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4.5);
+			if(i > 0    ) Acoo.insert(k, k - 1, -1.5);
+			if(i < n - 1) Acoo.insert(k, k + 1, -1.);
+			if(j > 0    ) Acoo.insert(k, k - n, -1.);
+			if(j < n - 1) Acoo.insert(k, k + n, -1.);
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+template <typename T_Matrix>
+static double run(cla3p::uint_t ncalls, const T_Matrix& A, const cla3p::dns::RdVector& X, cla3p::dns::RdVector& Y)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		cla3p::ops::mult(1., cla3p::op_t::N, A, X, Y);
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+	const cla3p::int_t n = 500;
+	const cla3p::uint_t ncalls = 200;
+
+	cla3p::csc::RdMatrix Acsc = convection(n);
+
+	/*
+	 * Deep copy conversion to csr format
+	 */
+	cla3p::csr::RdMatrix Acsr = Acsc.toCsr();
+
+	/*
+	 * Zero-copy views, the csr arrays of A^T are the csc arrays of A and vice versa
+	 */
+	cla3p::csr::RdMatrix AtCsr = Acsc.rtranspose();
+	cla3p::csc::RdMatrix AtCsc = Acsr.rtranspose();
+
+	cla3p::dns::RdVector X(Acsc.ncols());
+	cla3p::dns::RdVector Y(Acsc.nrows());
+
+	for(cla3p::uint_t i = 0; i < X.size(); i++) X(i) = 1. + (i % 7);
+	Y = 0.;
+
+	double tcsc = run(ncalls, Acsc, X, Y);
+	double tcsr = run(ncalls, Acsr, X, Y);
+
+	cla3p::dns::RdVector Y1 = cla3p::ops::mult(1., cla3p::op_t::N, Acsc, X);
+	cla3p::dns::RdVector Y2 = cla3p::ops::mult(1., cla3p::op_t::N, Acsr, X);
+	cla3p::dns::RdVector Y3 = cla3p::ops::mult(1., cla3p::op_t::T, AtCsr, X);
+	cla3p::dns::RdVector Y4 = cla3p::ops::mult(1., cla3p::op_t::T, AtCsc, X);
+
+	std::cout << "Y += A * X\n";
+	std::cout << "  csc (sec).......... " << tcsc << "\n";
+	std::cout << "  csr (sec).......... " << tcsr << "\n";
+	std::cout << "  Difference......... " << cla3p::dns::RdVector(Y1 - Y2).normInf() << "\n";
+	std::cout << "  View (csr) diff.... " << cla3p::dns::RdVector(Y1 - Y3).normInf() << "\n";
+	std::cout << "  View (csc) diff.... " << cla3p::dns::RdVector(Y1 - Y4).normInf() << "\n";
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @example ex06r_sparse_matrix_virtual_operands.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/perms.hpp"
+#include "cla3p/algebra.hpp"
+
+int main()
+{
+	cla3p::coo::RdMatrix Acoo(4, 3, 6);
+
+	Acoo.insert(0,0,1.0);
+	Acoo.insert(1,1,2.0);
+	Acoo.insert(2,1,3.0);
+	Acoo.insert(3,2,4.0);
+	Acoo.insert(0,2,5.0);
+	Acoo.insert(2,0,6.0);
+
+	cla3p::csc::RdMatrix A = Acoo;
+
+	cla3p::prm::PiMatrix P = cla3p::prm::PiMatrix::random(4);
+	cla3p::prm::PiMatrix Q = cla3p::prm::PiMatrix::random(3);
+
+	cla3p::dns::RdVector X(3);
+	cla3p::dns::RdVector Y(4);
+
+	X = 1.;
+	Y = 1.;
+
+	std::cout << "A:\n" << A << "\n";
+	std::cout << "P:\n" << P << "\n";
+	std::cout << "Q:\n" << Q << "\n";
+
+	/*
+	 * Transpositions, scalings & permutations of sparse matrices are virtual
+	 * Products with dense operands are applied without materializing the sparse matrix
+	 */
+
+	cla3p::dns::RdVector Y1 = A.transpose() * Y;
+	std::cout << "Y1 = A^T * Y:\n" << Y1 << "\n";
+
+	cla3p::dns::RdVector Y2 = P * (2. * A) * Q * X;
+	std::cout << "Y2 = P * (2 * A) * Q * X:\n" << Y2 << "\n";
+
+	cla3p::dns::RdVector Y3 = (P * A * Q).transpose() * Y;
+	std::cout << "Y3 = (P * A * Q)^T * Y:\n" << Y3 << "\n";
+
+	/*
+	 * Virtual sparse matrices are materialized on assignment
+	 */
+
+	cla3p::csc::RdMatrix B = P * A * Q;
+	std::cout << "B = P * A * Q:\n" << B << "\n";
+
+	cla3p::dns::RdVector Y4 = B * X;
+	std::cout << "Y4 = B * X:\n" << Y4 << "\n";
+
+	return 0;
+}
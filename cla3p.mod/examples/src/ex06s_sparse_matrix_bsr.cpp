@@ -0,0 +1,110 @@
+/**
+ * @example ex06s_sparse_matrix_bsr.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/itsol.hpp"
+
+/*
+ * Creates a (3N x 3N) matrix on an (n x n) grid with 3 degrees of freedom per node
+ * Every node couples all its dofs with those of its 4 neighbours (lower symmetric part)
+ */
+static cla3p::csc::RdMatrix elasticity(cla3p::int_t n)
+{
+	const cla3p::int_t dofs = 3;
+
+	cla3p::int_t N = n * n;
+
+	cla3p::coo::RdMatrix Acoo(dofs * N, dofs * N, 3 * dofs * dofs * N, cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower));
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			for(cla3p::int_t c = 0; c < dofs; c++) {
+				for(cla3p::int_t r = c; r < dofs; r++) {
+					Acoo.insert(dofs * k + r, dofs * k + c, (r == c ? 8.5 : 0.5));
+				} // r
+				for(cla3p::int_t r = 0; r < dofs; r++) {
+					if(i < n - 1) Acoo.insert(dofs * (k + 1) + r, dofs * k + c, (r == c ? -1. : -0.25));
+					if(j < n - 1) Acoo.insert(dofs * (k + n) + r, dofs * k + c, (r == c ? -1. : -0.25));
+				} // r
+			} // c
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+template <typename T_Matrix>
+static double run(cla3p::uint_t ncalls, const T_Matrix& A, const cla3p::dns::RdVector& X, cla3p::dns::RdVector& Y)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		cla3p::ops::mult(1., cla3p::op_t::N, A, X, Y);
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+	const cla3p::int_t n = 300;
+	const cla3p::uint_t ncalls = 200;
+
+	cla3p::csc::RdMatrix Acsc = elasticity(n);
+
+	/*
+	 * Conversion to block sparse row format with (3 x 3) blocks, one per node coupling
+	 */
+	cla3p::bsr::RdMatrix Absr = Acsc.toBsr(3);
+
+	std::cout << Absr.info("A (bsr)");
+
+	cla3p::dns::RdVector X(Acsc.ncols());
+	cla3p::dns::RdVector Y(Acsc.nrows());
+
+	for(cla3p::uint_t i = 0; i < X.size(); i++) X(i) = 1. + (i % 7);
+	Y = 0.;
+
+	double tcsc = run(ncalls, Acsc, X, Y);
+	double tbsr = run(ncalls, Absr, X, Y);
+
+	cla3p::dns::RdVector Y1 = Acsc * X;
+	cla3p::dns::RdVector Y2 = Absr * X;
+
+	std::cout << "Y += A * X\n";
+	std::cout << "  csc (sec).......... " << tcsc << "\n";
+	std::cout << "  bsr (sec).......... " << tbsr << "\n";
+	std::cout << "  Difference......... " << cla3p::dns::RdVector(Y1 - Y2).normInf() << "\n";
+
+	/*
+	 * Block sparse matrices are valid iterative solver operators
+	 */
+	cla3p::itsol::MatrixOperator<cla3p::bsr::RdMatrix> Aop(Absr);
+	cla3p::itsol::ISolverCG<cla3p::dns::RdVector> cg;
+
+	cg.setTolerance(1e-10);
+
+	cla3p::dns::RdVector Z;
+	cg.solve(Aop, Y1, Z);
+
+	std::cout << "CG converged: " << cg.converged() << " iterations: " << cg.iterations() << "\n";
+	std::cout << "  Solution error..... " << cla3p::dns::RdVector(Z - X).normInf() << "\n";
+
+	/*
+	 * Back to csc, explicit zeros inside the stored blocks are kept
+	 */
+	cla3p::csc::RdMatrix Bcsc = Absr.toCsc();
+
+	std::cout << "  nnz (csc).......... " << Acsc.nnz() << "\n";
+	std::cout << "  nnz (bsr -> csc)... " << Bcsc.nnz() << "\n";
+
+	return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @example ex06t_sparse_matrix_sell.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/itsol.hpp"
+
+/*
+ * Creates an (N x N) 5-point laplacian on an (n x n) grid 
+ * Every 10th node is also coupled with a far node, so that row lengths vary
+ */
+static cla3p::csc::RdMatrix laplacian(cla3p::int_t n)
+{
+	cla3p::int_t N = n * n;
+
+	cla3p::coo::RdMatrix Acoo(N, N, 6 * N);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4.5);
+			if(i > 0    ) Acoo.insert(k, k - 1, -1.);
+			if(i < n - 1) Acoo.insert(k, k + 1, -1.);
+			if(j > 0    ) Acoo.insert(k, k - n, -1.);
+			if(j < n - 1) Acoo.insert(k, k + n, -1.);
+			if(k % 10 == 0) {
+				Acoo.insert(k, N - 1 - k, -0.25);
+				Acoo.insert(N - 1 - k, k, -0.25);
+			} // far coupling
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+template <typename T_Matrix>
+static double run(cla3p::uint_t ncalls, const T_Matrix& A, const cla3p::dns::RdVector& X, cla3p::dns::RdVector& Y)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < ncalls; l++) {
+		cla3p::ops::mult(1., cla3p::op_t::N, A, X, Y);
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+	const cla3p::int_t n = 500;
+	const cla3p::uint_t ncalls = 200;
+
+	cla3p::csc::RdMatrix Acsc = laplacian(n);
+
+	/*
+	 * Conversion to SELL-C-sigma format with the default chunk size (one 512-bit register) 
+	 * and sorting window (32 chunks)
+	 */
+	cla3p::csc::RdSellMatrix Asell = cla3p::csc::RdSellMatrix::fromCsc(Acsc);
+
+	std::cout << Asell.info("A (sell)");
+
+	/*
+	 * P(i) is the stored position of row i
+	 */
+	const cla3p::prm::PiMatrix& P = Asell.rowPermutation();
+	std::cout << "Row 0 is stored at position " << P(0) << "\n";
+
+	cla3p::dns::RdVector X(Acsc.ncols());
+	cla3p::dns::RdVector Y(Acsc.nrows());
+
+	for(cla3p::uint_t i = 0; i < X.size(); i++) X(i) = 1. + (i % 7);
+	Y = 0.;
+
+	double tcsc = run(ncalls, Acsc, X, Y);
+	double tsell = run(ncalls, Asell, X, Y);
+
+	/*
+	 * Products take & return vectors in the original row ordering
+	 */
+	cla3p::dns::RdVector Y1 = Acsc * X;
+	cla3p::dns::RdVector Y2(Acsc.nrows());
+	Y2 = 0.;
+	cla3p::ops::mult(1., cla3p::op_t::N, Asell, X, Y2);
+
+	std::cout << "Y += A * X\n";
+	std::cout << "  csc (sec).......... " << tcsc << "\n";
+	std::cout << "  sell (sec)......... " << tsell << "\n";
+	std::cout << "  Difference......... " << cla3p::dns::RdVector(Y1 - Y2).normInf() << "\n";
+
+	/*
+	 * SELL-C-sigma matrices are valid iterative solver operators
+	 */
+	cla3p::itsol::MatrixOperator<cla3p::csc::RdSellMatrix> Aop(Asell);
+	cla3p::itsol::ISolverCG<cla3p::dns::RdVector> cg;
+
+	cg.setTolerance(1e-10);
+
+	cla3p::dns::RdVector Z;
+	cg.solve(Aop, Y1, Z);
+
+	std::cout << "CG converged: " << cg.converged() << " iterations: " << cg.iterations() << "\n";
+	std::cout << "  Solution error..... " << cla3p::dns::RdVector(Z - X).normInf() << "\n";
+
+	return 0;
+}
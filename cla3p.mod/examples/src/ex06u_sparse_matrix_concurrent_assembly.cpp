@@ -0,0 +1,54 @@
+/**
+ * @example ex06u_sparse_matrix_concurrent_assembly.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/sparse.hpp"
+
+int main()
+{
+	const cla3p::int_t n = 1000;
+	const cla3p::int_t N = n * n;
+
+	cla3p::coo::RdMatrix A(N, N, 0);
+
+	/*
+	 * Assemble a 5-point laplacian element by element (one (2 x 2) element per grid edge), 
+	 * all threads insert into A concurrently, every thread appends to its own bucket
+	 */
+	auto t0 = std::chrono::steady_clock::now();
+
+	#pragma omp parallel for schedule(static)
+	for(cla3p::int_t k = 0; k < N; k++) {
+
+		cla3p::int_t i = k % n;
+		cla3p::int_t j = k / n;
+
+		cla3p::int_t nbr[2] = { (i < n - 1 ? k + 1 : -1), (j < n - 1 ? k + n : -1) };
+
+		for(cla3p::int_t l : nbr) {
+			if(l < 0) continue;
+			A.insertConcurrent(k, k,  1.);
+			A.insertConcurrent(l, l,  1.);
+			A.insertConcurrent(k, l, -1.);
+			A.insertConcurrent(l, k, -1.);
+		} // l
+
+	} // k
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	/*
+	 * Parallel conversion, duplicate entries are added together during the column bucket sort
+	 */
+	cla3p::csc::RdMatrix B = A.toCsc();
+
+	auto t2 = std::chrono::steady_clock::now();
+
+	std::cout << A.info("A") << B.info("B");
+	std::cout << "  Insertion (sec)..... " << std::chrono::duration<double>(t1 - t0).count() << "\n";
+	std::cout << "  Conversion (sec).... " << std::chrono::duration<double>(t2 - t1).count() << "\n";
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @example ex06v_sparse_matrix_element_assembly.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include "cla3p/sparse.hpp"
+
+int main()
+{
+	const cla3p::int_t n = 500;
+	const cla3p::int_t nsteps = 10;
+
+	const cla3p::int_t nv = n + 1;
+	const cla3p::int_t N = nv * nv;
+	const cla3p::int_t ne = n * n;
+
+	/*
+	 * Connectivity of an (n x n) grid of bilinear quadrilaterals, one dof per grid vertex
+	 */
+	std::vector<cla3p::int_t> eptr(ne + 1);
+	std::vector<cla3p::int_t> eind(4 * ne);
+
+	for(cla3p::int_t e = 0; e < ne; e++) {
+		cla3p::int_t v = (e % n) + (e / n) * nv;
+		eptr[e] = 4 * e;
+		eind[4 * e + 0] = v;
+		eind[4 * e + 1] = v + 1;
+		eind[4 * e + 2] = v + 1 + nv;
+		eind[4 * e + 3] = v + nv;
+	} // e
+	eptr[ne] = 4 * ne;
+
+	/*
+	 * Symbolic phase, done once: pattern, contribution map & element coloring
+	 */
+	auto t0 = std::chrono::steady_clock::now();
+
+	cla3p::csc::RdAssembler assembler(N, ne, eptr.data(), eind.data(), cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower));
+
+	cla3p::csc::RdMatrix A = assembler.matrix();
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	std::cout << assembler.info("assembler");
+
+	/*
+	 * Numeric phase, every time step: (4 x 4) mass + stiffness element matrices scattered into A.values()
+	 */
+	const double stiff[4] = { 2. / 3., -1. / 6., -1. / 3., -1. / 6. };
+	const double mass[4] = { 4. / 36., 2. / 36., 1. / 36., 2. / 36. };
+
+	for(cla3p::int_t s = 0; s < nsteps; s++) {
+
+		double dt = 1. / (s + 1);
+
+		assembler.assemble(A, [&](cla3p::uint_t, double *ke) 
+				{
+				for(cla3p::int_t b = 0; b < 4; b++) {
+					for(cla3p::int_t a = 0; a < 4; a++) {
+						ke[a + b * 4] = mass[(a - b + 4) % 4] / dt + stiff[(a - b + 4) % 4];
+					} // a
+				} // b
+				});
+
+	} // s
+
+	auto t2 = std::chrono::steady_clock::now();
+
+	std::cout << A.info("A");
+	std::cout << "  Symbolic (sec)........... " << std::chrono::duration<double>(t1 - t0).count() << "\n";
+	std::cout << "  Numeric per step (sec)... " << std::chrono::duration<double>(t2 - t1).count() / nsteps << "\n";
+
+	return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @example ex07a_iterative_solvers.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/itsol.hpp"
+
+/*
+ * Creates a (N x N) matrix with a 5-point stencil & variable coefficients
+ * Lower symmetric part if convection is zero, general otherwise
+ */
+static cla3p::csc::RdMatrix stencil(cla3p::int_t n, double convection)
+{
+	cla3p::int_t N = n * n;
+
+	bool symmetric = (convection == 0.);
+	cla3p::Property pr = (symmetric ? 
+			cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower) : 
+			cla3p::Property(cla3p::prop_t::General, cla3p::uplo_t::Full));
+
+	cla3p::coo::RdMatrix Acoo(N, N, 5 * N, pr);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4. * (1 + (k % 10)) + 0.1);
+			if(i < n - 1) Acoo.insert(k + 1, k, -1. - convection);
+			if(j < n - 1) Acoo.insert(k + n, k, -1.);
+			if(!symmetric) {
+				if(i > 0    ) Acoo.insert(k - 1, k, -1. + convection);
+				if(j > 0    ) Acoo.insert(k - n, k, -1.);
+			} // upper part
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+template <typename T_Solver>
+static void report(const std::string& name, const T_Solver& solver, 
+		const cla3p::csc::RdMatrix& A, const cla3p::dns::RdVector& B, const cla3p::dns::RdVector& X)
+{
+	cla3p::dns::RdVector R = B - A * X;
+	std::cout << name 
+		<< " converged: " << solver.converged() 
+		<< " iterations: " << solver.iterations() 
+		<< " residual: " << solver.residual() 
+		<< " true residual: " << R.normEuc() / B.normEuc() << "\n";
+}
+
+int main()
+{
+	const cla3p::int_t n = 100;
+
+	{
+		/*
+		 * Symmetric positive definite system
+		 */
+
+		cla3p::csc::RdMatrix A = stencil(n, 0.);
+		cla3p::dns::RdVector B = cla3p::dns::RdVector::random(A.nrows());
+
+		cla3p::itsol::MatrixOperator<cla3p::csc::RdMatrix> Aop(A);
+		cla3p::itsol::JacobiPreconditioner<cla3p::csc::RdMatrix> M(A);
+
+		cla3p::itsol::ISolverCG<cla3p::dns::RdVector> cg;
+		cla3p::itsol::ISolverMINRES<cla3p::dns::RdVector> minres;
+
+		cg.setTolerance(1e-10);
+		minres.setTolerance(1e-10);
+
+		cla3p::dns::RdVector X1;
+		cg.solve(Aop, B, X1);
+		report("CG (no preconditioner)", cg, A, B, X1);
+
+		/*
+		 * Workspace is reused by subsequent solves
+		 */
+		cla3p::dns::RdVector X2;
+		cg.setPreconditioner(M);
+		cg.solve(Aop, B, X2);
+		report("CG (Jacobi)           ", cg, A, B, X2);
+
+		cla3p::dns::RdVector X3;
+		minres.setPreconditioner(M);
+		minres.solve(Aop, B, X3);
+		report("MINRES (Jacobi)       ", minres, A, B, X3);
+	}
+
+	{
+		/*
+		 * Non-symmetric system
+		 */
+
+		cla3p::csc::RdMatrix A = stencil(n, 0.5);
+		cla3p::dns::RdVector B = cla3p::dns::RdVector::random(A.nrows());
+
+		cla3p::itsol::MatrixOperator<cla3p::csc::RdMatrix> Aop(A);
+		cla3p::itsol::JacobiPreconditioner<cla3p::csc::RdMatrix> M(A);
+
+		cla3p::itsol::ISolverGMRES<cla3p::dns::RdVector> gmres;
+		cla3p::itsol::ISolverBiCGStab<cla3p::dns::RdVector> bicgstab;
+
+		gmres.setRestart(50);
+		gmres.setTolerance(1e-10);
+		gmres.setPreconditioner(M);
+
+		bicgstab.setTolerance(1e-10);
+		bicgstab.setPreconditioner(M);
+
+		cla3p::dns::RdVector X1;
+		gmres.solve(Aop, B, X1);
+		report("GMRES(50) (Jacobi)    ", gmres, A, B, X1);
+
+		cla3p::dns::RdVector X2;
+		bicgstab.solve(Aop, B, X2);
+		report("BiCGStab (Jacobi)     ", bicgstab, A, B, X2);
+
+		/*
+		 * Matrix-free operator through a user callback
+		 */
+		cla3p::itsol::FunctionOperator<cla3p::dns::RdVector> Fop(A.nrows(), 
+				[&A](const cla3p::dns::RdVector& x, cla3p::dns::RdVector& y) {
+					y = 0.;
+					cla3p::ops::mult(1., cla3p::op_t::N, A, x, y);
+				});
+
+		cla3p::dns::RdVector X3;
+		bicgstab.solve(Fop, B, X3);
+		report("BiCGStab (callback)   ", bicgstab, A, B, X3);
+
+		/*
+		 * Convergence history
+		 */
+		std::cout << "BiCGStab residual history:";
+		for(cla3p::uint_t i = 0; i < bicgstab.history().size(); i += 10) {
+			std::cout << " " << bicgstab.history()[i];
+		} // i
+		std::cout << "\n";
+	}
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @example ex07b_incomplete_factorization_preconditioners.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/itsol.hpp"
+
+/*
+ * Creates a (N x N) matrix with a 5-point stencil & variable coefficients
+ * Lower symmetric part if convection is zero, general otherwise
+ */
+static cla3p::csc::RdMatrix stencil(cla3p::int_t n, double convection)
+{
+	cla3p::int_t N = n * n;
+
+	bool symmetric = (convection == 0.);
+	cla3p::Property pr = (symmetric ? 
+			cla3p::Property(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower) : 
+			cla3p::Property(cla3p::prop_t::General, cla3p::uplo_t::Full));
+
+	cla3p::coo::RdMatrix Acoo(N, N, 5 * N, pr);
+
+	for(cla3p::int_t j = 0; j < n; j++) {
+		for(cla3p::int_t i = 0; i < n; i++) {
+			cla3p::int_t k = i + j * n;
+			Acoo.insert(k, k, 4. + 0.01 * (k % 10));
+			if(i < n - 1) Acoo.insert(k + 1, k, -1. - convection);
+			if(j < n - 1) Acoo.insert(k + n, k, -1.);
+			if(!symmetric) {
+				if(i > 0    ) Acoo.insert(k - 1, k, -1. + convection);
+				if(j > 0    ) Acoo.insert(k - n, k, -1.);
+			} // upper part
+		} // i
+	} // j
+
+	return Acoo.toCsc();
+}
+
+template <typename T_Solver>
+static void report(const std::string& name, const T_Solver& solver)
+{
+	std::cout << name 
+		<< " converged: " << solver.converged() 
+		<< " iterations: " << solver.iterations() 
+		<< " residual: " << solver.residual() << "\n";
+}
+
+int main()
+{
+	const cla3p::int_t n = 100;
+
+	{
+		/*
+		 * Symmetric positive definite system, CG with Jacobi & IC(0)
+		 */
+
+		cla3p::csc::RdMatrix A = stencil(n, 0.);
+		cla3p::dns::RdVector B = cla3p::dns::RdVector::random(A.nrows());
+
+		cla3p::itsol::MatrixOperator<cla3p::csc::RdMatrix> Aop(A);
+		cla3p::itsol::JacobiPreconditioner<cla3p::csc::RdMatrix> Mj(A);
+		cla3p::itsol::IC0Preconditioner<cla3p::csc::RdMatrix> Mic(A);
+
+		cla3p::itsol::ISolverCG<cla3p::dns::RdVector> cg;
+		cg.setTolerance(1e-10);
+
+		cla3p::dns::RdVector X1;
+		cg.setPreconditioner(Mj);
+		cg.solve(Aop, B, X1);
+		report("CG (Jacobi)           ", cg);
+
+		cla3p::dns::RdVector X2;
+		cg.setPreconditioner(Mic);
+		cg.solve(Aop, B, X2);
+		report("CG (IC0)              ", cg);
+	}
+
+	{
+		/*
+		 * Non-symmetric system, GMRES & BiCGStab with ILU(0) & ILUT
+		 */
+
+		cla3p::csc::RdMatrix A = stencil(n, 0.5);
+		cla3p::dns::RdVector B = cla3p::dns::RdVector::random(A.nrows());
+
+		cla3p::itsol::MatrixOperator<cla3p::csc::RdMatrix> Aop(A);
+		cla3p::itsol::JacobiPreconditioner<cla3p::csc::RdMatrix> Mj(A);
+		cla3p::itsol::ILU0Preconditioner<cla3p::csc::RdMatrix> Milu0(A);
+		cla3p::itsol::ILUTPreconditioner<cla3p::csc::RdMatrix> Milut(A, 1e-4, 10);
+
+		std::cout << "ILUT factor non-zeros: " << Milut.lower().nnz() + Milut.upper().nnz() 
+			<< " (matrix non-zeros: " << A.nnz() << ")\n";
+
+		cla3p::itsol::ISolverGMRES<cla3p::dns::RdVector> gmres;
+		cla3p::itsol::ISolverBiCGStab<cla3p::dns::RdVector> bicgstab;
+
+		gmres.setRestart(50);
+		gmres.setTolerance(1e-10);
+		bicgstab.setTolerance(1e-10);
+
+		cla3p::dns::RdVector X;
+
+		gmres.setPreconditioner(Mj);
+		gmres.solve(Aop, B, X);
+		report("GMRES(50) (Jacobi)    ", gmres);
+
+		X.clear();
+		gmres.setPreconditioner(Milu0);
+		gmres.solve(Aop, B, X);
+		report("GMRES(50) (ILU0)      ", gmres);
+
+		X.clear();
+		gmres.setPreconditioner(Milut);
+		gmres.solve(Aop, B, X);
+		report("GMRES(50) (ILUT)      ", gmres);
+
+		X.clear();
+		bicgstab.setPreconditioner(Milu0);
+		bicgstab.solve(Aop, B, X);
+		report("BiCGStab (ILU0)       ", bicgstab);
+
+		/*
+		 * Refactorize after a change of values, the sparsity pattern is the same
+		 */
+		A.iscale(2.);
+		Milu0.compute(A);
+
+		X.clear();
+		bicgstab.solve(Aop, B, X);
+		report("BiCGStab (ILU0, 2A)   ", bicgstab);
+	}
+
+	return 0;
+}
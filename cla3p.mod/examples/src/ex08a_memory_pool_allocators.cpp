@@ -0,0 +1,89 @@
+/**
+ * @example ex08a_memory_pool_allocators.cpp
+ */
+
+#include <iostream>
+#include <chrono>
+#include "cla3p/dense.hpp"
+#include "cla3p/algebra.hpp"
+#include "cla3p/support.hpp"
+
+/*
+ * Evaluates expressions that create temporaries in a loop, returns the elapsed time in seconds
+ */
+static double run(cla3p::uint_t niters, const cla3p::dns::RdMatrix& A, const cla3p::dns::RdVector& X, double& checksum)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	for(cla3p::uint_t l = 0; l < niters; l++) {
+		cla3p::dns::RdVector Y = A * X;
+		cla3p::dns::RdVector Z = Y + X;
+		checksum += Z(l % Z.size());
+	} // l
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+static void report(const std::string& title, double t, double checksum)
+{
+	cla3p::AllocStats stats = cla3p::allocStats();
+
+	std::cout << title << "\n";
+	std::cout << "  Time (sec)............. " << t << "\n";
+	std::cout << "  Checksum............... " << checksum << "\n";
+	std::cout << "  Allocations............ " << stats.allocations << "\n";
+	std::cout << "  System allocations..... " << stats.systemAllocations << "\n";
+	std::cout << "  Pool hits.............. " << stats.poolHits << "\n";
+	std::cout << "  Arena allocations...... " << stats.arenaAllocations << "\n";
+	std::cout << "  Peak bytes in use...... " << stats.peakBytesInUse << "\n";
+	std::cout << "  Bytes cached........... " << stats.bytesCached << "\n";
+}
+
+int main()
+{
+	const cla3p::uint_t n = 64;
+	const cla3p::uint_t niters = 100000;
+
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(n, n);
+	cla3p::dns::RdVector X = cla3p::dns::RdVector::random(n);
+
+	{
+		/*
+		 * Every temporary reaches the system allocator
+		 */
+		double checksum = 0.;
+		cla3p::setAllocator(cla3p::alloc_t::System);
+		cla3p::resetAllocStats();
+		double t = run(niters, A, X, checksum);
+		report("System allocator", t, checksum);
+	}
+
+	{
+		/*
+		 * Temporaries are recycled through the per-thread free lists
+		 */
+		double checksum = 0.;
+		cla3p::setAllocator(cla3p::alloc_t::Pool);
+		cla3p::resetAllocStats();
+		double t = run(niters, A, X, checksum);
+		report("Pool allocator", t, checksum);
+		cla3p::setAllocator(cla3p::alloc_t::System);
+		cla3p::releasePoolMemory();
+	}
+
+	{
+		/*
+		 * Temporaries are carved from a scoped arena, released at the end of the scope
+		 */
+		double checksum = 0.;
+		cla3p::resetAllocStats();
+		cla3p::ScopedArena arena;
+		double t = run(niters, A, X, checksum);
+		report("Scoped arena", t, checksum);
+		std::cout << "  Arena bytes reserved... " << arena.bytesReserved() << "\n";
+	}
+
+	return 0;
+}
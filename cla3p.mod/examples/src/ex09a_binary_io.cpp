@@ -0,0 +1,46 @@
+/**
+ * @example ex09a_binary_io.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/io.hpp"
+
+int main()
+{
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(4, 3);
+
+	/*
+	 * Save & load (deep copy, checksums are verified)
+	 */
+	cla3p::io::save("A.bin", A);
+	cla3p::dns::RdMatrix B = cla3p::io::load<cla3p::dns::RdMatrix>("A.bin");
+
+	std::cout << "A:\n" << A << "\n";
+	std::cout << "B (loaded):\n" << B << "\n";
+
+	/*
+	 * Map the file, C wraps the mapped data (no copy)
+	 */
+	{
+		cla3p::io::MappedFile file("A.bin");
+		cla3p::dns::RdMatrix C = file.get<cla3p::dns::RdMatrix>();
+		std::cout << "C (mapped):\n" << C << "\n";
+	}
+
+	/*
+	 * Stream a matrix to file in column blocks
+	 */
+	{
+		cla3p::io::MatrixWriter<cla3p::dns::RdMatrix> writer("D.bin", 4, 6);
+		writer.write(A);
+		writer.write(B);
+		writer.close();
+	}
+
+	cla3p::io::MappedFile file("D.bin");
+	cla3p::dns::RdMatrix D = file.get<cla3p::dns::RdMatrix>();
+	std::cout << "D (streamed):\n" << D << "\n";
+
+	return 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * @example ex09b_matrix_market.cpp
+ */
+
+#include <iostream>
+#include "cla3p/sparse.hpp"
+#include "cla3p/io.hpp"
+
+int main()
+{
+	cla3p::Property pr(cla3p::prop_t::Symmetric, cla3p::uplo_t::Lower);
+	cla3p::coo::RdMatrix A(4, 4, 5, pr);
+
+	A.insert(0, 0, 2.0);
+	A.insert(1, 0, -1.0);
+	A.insert(2, 0, 4.0);
+	A.insert(2, 2, 7.0);
+	A.insert(3, 3, 1.0);
+
+	/*
+	 * Write in Matrix Market format, the symmetric header is deduced from the property
+	 */
+	cla3p::io::writeMatrixMarket("A.mtx", A);
+
+	/*
+	 * Read directly to compressed sparse column format
+	 */
+	cla3p::csc::RdMatrix B = cla3p::io::readMatrixMarket<cla3p::csc::RdMatrix>("A.mtx");
+
+	std::cout << B.info("B") << B << "\n";
+
+	return 0;
+}
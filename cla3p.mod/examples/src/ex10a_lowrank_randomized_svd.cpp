@@ -0,0 +1,51 @@
+/**
+ * @example ex10a_lowrank_randomized_svd.cpp
+ */
+
+#include <iostream>
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/lowrank.hpp"
+
+int main()
+{
+	/*
+	 * Top 5 singular triplets of a dense matrix
+	 */
+
+	cla3p::dns::RdMatrix A = cla3p::dns::RdMatrix::random(2000, 500);
+
+	cla3p::lowrank::RandomizedSvd<cla3p::dns::RdMatrix> svd(5);
+
+	svd.setOversampling(10);
+	svd.setPowerIterations(3);
+	svd.compute(A);
+
+	std::cout << "Leading singular values:\n" << svd.S() << std::endl;
+
+	/*
+	 * Sparse matrices are accessed only through sparse-dense products
+	 * The rank is truncated at singular values smaller than 1% of the largest one
+	 */
+
+	cla3p::coo::RdMatrix Acoo(1000, 1000, 3000);
+
+	for(cla3p::int_t i = 0; i < 1000; i++) {
+		Acoo.insert(i, i, 1. / (i + 1));
+		Acoo.insert(i, (7 * i) % 1000, 1. / (i + 1));
+		Acoo.insert((3 * i) % 1000, i, 1. / (i + 1));
+	} // i
+
+	cla3p::csc::RdMatrix Acsc = Acoo.toCsc();
+
+	cla3p::lowrank::RandomizedSvd<cla3p::csc::RdMatrix> ssvd(50);
+
+	ssvd.setTolerance(0.01);
+	ssvd.compute(Acsc);
+
+	std::cout << "Sparse matrix numerical rank (tol 1%): " << ssvd.rank() << std::endl;
+	std::cout << "U: " << ssvd.U().nrows() << " x " << ssvd.U().ncols() << std::endl;
+	std::cout << "V: " << ssvd.V().nrows() << " x " << ssvd.V().ncols() << std::endl;
+
+	return 0;
+}
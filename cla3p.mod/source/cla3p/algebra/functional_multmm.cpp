@@ -28,7 +28,12 @@
 #include "cla3p/checks/hermitian_coeff_checks.hpp"
 #include "cla3p/proxies/blas_proxy.hpp"
 #include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/bulk/dns_batch.hpp"
+#include "cla3p/bulk/dns_rfp.hpp"
+#include "cla3p/bulk/dns_band.hpp"
 #include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/bsr.hpp"
+#include "cla3p/bulk/sell.hpp"
 #include "cla3p/algebra/functional_update.hpp"
 
 /*-------------------------------------------------*/
@@ -237,6 +242,164 @@ instantiate_mult(dns::CfMatrix);
 #undef instantiate_mult
 /*-------------------------------------------------*/
 template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::MatrixBatch<T_Matrix>& A,
+    op_t opB, const dns::MatrixBatch<T_Matrix>& B,
+    dns::MatrixBatch<T_Matrix>& C)
+{
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+	opB = (TypeTraits<T_Matrix>::is_real() && opB == op_t::C ? op_t::T : opB);
+
+	Operation _opA(opA);
+	Operation _opB(opB);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(A.size() != C.size() || B.size() != C.size()) {
+		throw err::NoConsistency("Batches of different size");
+	} // size
+
+	if(A.layout() != C.layout() || B.layout() != C.layout()) {
+		throw err::NoConsistency("Batches of different layout");
+	} // layout
+
+	uint_t k = (_opA.isTranspose() ? A.nrows() : A.ncols());
+
+	if(C.layout() == layout_t::Strided) {
+
+		bulk::dns::batch_gemm(opA, opB, 
+				C.nrows(), C.ncols(), k, C.size(), alpha, 
+				A.values(), A.ld(), A.stride(), 
+				B.values(), B.ld(), B.stride(), 
+				C.values(), C.ld(), C.stride());
+
+	} else {
+
+		bulk::dns::batch_gemm_compact(opA, opB, 
+				C.nrows(), C.ncols(), k, C.size(), alpha, 
+				A.values(), A.ld(), 
+				B.values(), B.ld(), 
+				C.values(), C.ld());
+
+	} // layout
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Mat) \
+template void mult(typename T_Mat::value_type, \
+    op_t, const dns::MatrixBatch<T_Mat>&, \
+    op_t, const dns::MatrixBatch<T_Mat>&, \
+    dns::MatrixBatch<T_Mat>&)
+instantiate_mult(dns::RdMatrix);
+instantiate_mult(dns::RfMatrix);
+instantiate_mult(dns::CdMatrix);
+instantiate_mult(dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::RfpMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C)
+{
+	Operation _opA(opA);
+	Operation _opB(op_t::N);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(A.prop().isTriangular() || !B.prop().isGeneral() || !C.prop().isGeneral()) {
+		throw_prop_compatibility_error(A, B, C);
+	} // props
+
+	bulk::dns::rfp_x_mat(A.prop().uplo(), A.ncols(), C.ncols(), alpha, A.values(), 
+			B.values(), B.ld(), C.values(), C.ld());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Mat) \
+template void mult(typename T_Mat::value_type, \
+    op_t, const dns::RfpMatrix<T_Mat>&, \
+    const dns::XxMatrix<typename T_Mat::value_type,T_Mat>&, \
+    dns::XxMatrix<typename T_Mat::value_type,T_Mat>&)
+instantiate_mult(dns::RdMatrix);
+instantiate_mult(dns::RfMatrix);
+instantiate_mult(dns::CdMatrix);
+instantiate_mult(dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::BandMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C)
+{
+	if(!A.prop().isGeneral()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	Operation _opB(op_t::N);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(!B.prop().isGeneral() || !C.prop().isGeneral()) {
+		throw_prop_compatibility_error(A, B, C);
+	} // props
+
+	bulk::dns::band_x_mat(A.prop().type(), A.prop().uplo(), opA, 
+			A.nrows(), A.ncols(), A.kl(), A.ku(), 
+			alpha, A.values(), A.ld(), 
+			C.ncols(), B.values(), B.ld(), C.values(), C.ld());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::TridiagonalMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C)
+{
+	if(!A.prop().isGeneral()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	Operation _opB(op_t::N);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(!B.prop().isGeneral() || !C.prop().isGeneral()) {
+		throw_prop_compatibility_error(A, B, C);
+	} // props
+
+	bulk::dns::tri_x_mat(opA, A.ncols(), alpha, 
+			A.subdiagonal(), A.diagonal(), A.superdiagonal(), 
+			C.ncols(), B.values(), B.ld(), C.values(), C.ld());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Mat) \
+template void mult(typename T_Mat::value_type, \
+    op_t, const dns::BandMatrix<T_Mat>&, \
+    const dns::XxMatrix<typename T_Mat::value_type,T_Mat>&, \
+    dns::XxMatrix<typename T_Mat::value_type,T_Mat>&); \
+template void mult(typename T_Mat::value_type, \
+    op_t, const dns::TridiagonalMatrix<T_Mat>&, \
+    const dns::XxMatrix<typename T_Mat::value_type,T_Mat>&, \
+    dns::XxMatrix<typename T_Mat::value_type,T_Mat>&)
+instantiate_mult(dns::RdMatrix);
+instantiate_mult(dns::RfMatrix);
+instantiate_mult(dns::CdMatrix);
+instantiate_mult(dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Matrix>
 static void trimult(typename T_Matrix::value_type alpha, side_t sideA, 
 		op_t opA, const  dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& A,
 		dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B)
@@ -377,7 +540,7 @@ void mult(typename T_CscMatrix::value_type alpha, op_t opA,
 					A.colptr(), A.rowidx(), A.values(),
 					B.values(), B.ld(), 
 					T_Scalar(1), 
-					C.values(), C.ld());
+					C.values(), C.ld(), A.handle());
 
 	} else if(A.prop().isSymmetric() && B.prop().isGeneral() && C.prop().isGeneral()) {
 
@@ -388,7 +551,7 @@ void mult(typename T_CscMatrix::value_type alpha, op_t opA,
 				A.colptr(), A.rowidx(), A.values(),
 				B.values(), B.ld(), 
 				T_Scalar(1), 
-				C.values(), C.ld());
+				C.values(), C.ld(), A.handle());
 
 	} else if(A.prop().isHermitian() && B.prop().isGeneral() && C.prop().isGeneral()) {
 
@@ -399,7 +562,7 @@ void mult(typename T_CscMatrix::value_type alpha, op_t opA,
 				A.colptr(), A.rowidx(), A.values(),
 				B.values(), B.ld(), 
 				T_Scalar(1), 
-				C.values(), C.ld());
+				C.values(), C.ld(), A.handle());
 
 	} else {
 
@@ -441,6 +604,154 @@ instantiate_mult(csc::CdMatrix, dns::CdMatrix);
 instantiate_mult(csc::CfMatrix, dns::CfMatrix);
 #undef instantiate_mult
 /*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+void mult(typename T_BsrMatrix::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B,
+    dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& C)
+{
+	using T_Scalar = typename T_BsrMatrix::value_type;
+
+	if(A.prop().isSymmetric() || A.prop().isHermitian()) opA = op_t::N;
+
+	opA = (TypeTraits<T_BsrMatrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	Operation _opB(op_t::N);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(A.empty()) return;
+
+	if(A.prop().isGeneral() && B.prop().isGeneral() && C.prop().isGeneral()) {
+
+		bulk::bsr::gem_x_gem(opA, 
+				A.nbrows(), 
+				A.nbcols(), 
+				A.bsize(), 
+				C.ncols(), 
+				alpha,
+				A.rowptr(), A.colidx(), A.values(),
+				B.values(), B.ld(), 
+				T_Scalar(1), 
+				C.values(), C.ld());
+
+	} else if(A.prop().isSymmetric() && B.prop().isGeneral() && C.prop().isGeneral()) {
+
+		bulk::bsr::sym_x_gem(A.prop().uplo(),
+				A.nbcols(), 
+				A.bsize(), 
+				C.ncols(),
+				alpha,
+				A.rowptr(), A.colidx(), A.values(),
+				B.values(), B.ld(), 
+				T_Scalar(1), 
+				C.values(), C.ld());
+
+	} else if(A.prop().isHermitian() && B.prop().isGeneral() && C.prop().isGeneral()) {
+
+		bulk::bsr::hem_x_gem(A.prop().uplo(),
+				A.nbcols(), 
+				A.bsize(), 
+				C.ncols(),
+				alpha,
+				A.rowptr(), A.colidx(), A.values(),
+				B.values(), B.ld(), 
+				T_Scalar(1), 
+				C.values(), C.ld());
+
+	} else {
+
+		throw_prop_compatibility_error(A, B, C);
+
+	} // property combos
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Bsr, T_Dns) \
+template void mult(typename T_Bsr::value_type, op_t, \
+    const bsr::XxMatrix<typename T_Bsr::index_type,typename T_Bsr::value_type,T_Bsr>&, \
+    const dns::XxMatrix<typename T_Dns::value_type,T_Dns>&, \
+    dns::XxMatrix<typename T_Dns::value_type,T_Dns>&)
+instantiate_mult(bsr::RdMatrix, dns::RdMatrix);
+instantiate_mult(bsr::RfMatrix, dns::RfMatrix);
+instantiate_mult(bsr::CdMatrix, dns::CdMatrix);
+instantiate_mult(bsr::CfMatrix, dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+T_DnsMatrix mult(typename T_BsrMatrix::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B)
+{
+	Operation _opA(opA);
+  T_DnsMatrix ret(_opA.isTranspose() ? A.ncols() : A.nrows(), B.ncols());
+  ret = 0;
+  mult(alpha, opA, A, B, ret);
+  return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Bsr, T_Dns) \
+template T_Dns mult(typename T_Bsr::value_type, op_t, \
+    const bsr::XxMatrix<typename T_Bsr::index_type,typename T_Bsr::value_type,T_Bsr>&, \
+    const dns::XxMatrix<typename T_Dns::value_type,T_Dns>&)
+instantiate_mult(bsr::RdMatrix, dns::RdMatrix);
+instantiate_mult(bsr::RfMatrix, dns::RfMatrix);
+instantiate_mult(bsr::CdMatrix, dns::CdMatrix);
+instantiate_mult(bsr::CfMatrix, dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Matrix, typename T_DnsMatrix>
+void mult(typename T_DnsMatrix::value_type alpha,
+    op_t opA, const csc::SellMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B,
+    dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& C)
+{
+	using T_Scalar = typename T_DnsMatrix::value_type;
+
+	if(A.prop().isSymmetric() || A.prop().isHermitian()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	Operation _opB(op_t::N);
+
+	mult_dim_check(
+			A.nrows(), A.ncols(), _opA, 
+			B.nrows(), B.ncols(), _opB, 
+			C.nrows(), C.ncols());
+
+	if(!B.prop().isGeneral() || !C.prop().isGeneral()) {
+		throw_prop_compatibility_error(A, B, C);
+	} // props
+
+	if(A.empty()) return;
+
+	bulk::sell::gem_x_gem(opA, 
+			A.nrows(), 
+			A.ncols(), 
+			A.chunkSize(), 
+			C.ncols(), 
+			alpha, 
+			A.rowidx(), A.chunkptr(), A.colidx(), A.values(), 
+			B.values(), B.ld(), 
+			T_Scalar(1), 
+			C.values(), C.ld());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Mat, T_Dns) \
+template void mult(typename T_Dns::value_type, \
+    op_t, const csc::SellMatrix<T_Mat>&, \
+    const dns::XxMatrix<typename T_Dns::value_type,T_Dns>&, \
+    dns::XxMatrix<typename T_Dns::value_type,T_Dns>&)
+instantiate_mult(csc::RdMatrix, dns::RdMatrix);
+instantiate_mult(csc::RfMatrix, dns::RfMatrix);
+instantiate_mult(csc::CdMatrix, dns::CdMatrix);
+instantiate_mult(csc::CfMatrix, dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
 template <typename T_CscMatrix, typename T_DnsMatrix>
 void mult(typename T_CscMatrix::value_type alpha,
     op_t opA, const csc::XxMatrix<typename T_CscMatrix::index_type,typename T_CscMatrix::value_type,T_CscMatrix>& A,
@@ -96,6 +96,80 @@ T_Matrix mult(typename T_Matrix::value_type alpha,
     op_t opB, const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
     const Property& pr = defaultProperty());
 
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a matrix batch with the matrix-matrix products of two batches.
+ *
+ * Performs the operation <b>C[k] = C[k] + alpha * opA(A[k]) * opB(B[k])</b> for every matrix of the batches.@n
+ * All batches must have the same size & layout, the products are computed in parallel across the batch.
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for the matrices of A.
+ * @param[in] A The input batch.
+ * @param[in] opB The operation to be performed for the matrices of B.
+ * @param[in] B The input batch.
+ * @param[in,out] C The batch to be updated.
+ */
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::MatrixBatch<T_Matrix>& A,
+    op_t opB, const dns::MatrixBatch<T_Matrix>& B,
+    dns::MatrixBatch<T_Matrix>& C);
+
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a general matrix with a matrix-matrix product, the left matrix in RFP storage.
+ *
+ * Performs the operation <b>C = C + alpha * A * B</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored since A is symmetric or hermitian.
+ * @param[in] A The input Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] B The input general matrix.
+ * @param[in,out] C The general matrix to be updated.
+ */
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::RfpMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C);
+
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a general matrix with a matrix-matrix product, the left matrix in band storage.
+ *
+ * Performs the operation <b>C = C + alpha * op(A) * B</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input General, Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] B The input general matrix.
+ * @param[in,out] C The general matrix to be updated.
+ */
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::BandMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C);
+
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a general matrix with a matrix-matrix product, the left matrix tridiagonal.
+ *
+ * Performs the operation <b>C = C + alpha * op(A) * B</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input General, Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] B The input general matrix.
+ * @param[in,out] C The general matrix to be updated.
+ */
+template <typename T_Matrix>
+void mult(typename T_Matrix::value_type alpha,
+    op_t opA, const dns::TridiagonalMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& B,
+    dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& C);
+
 /**
  * @ingroup module_index_math_op_matmat
  * @brief Replaces a matrix with a scaled triangular matrix-matrix product.
@@ -211,6 +285,73 @@ T_DnsMatrix mult(typename T_CscMatrix::value_type alpha, op_t opA,
 		const csc::XxMatrix<typename T_CscMatrix::index_type,typename T_CscMatrix::value_type,T_CscMatrix>& A,
     const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B);
 
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a general dense matrix with a block sparse-dense matrix-matrix product.
+ *
+ * Performs the operation <b>C = C + alpha * opA(A) * B</b>@n
+ *
+ * Valid combinations are the following:
+ @verbatim
+  A: General     B: General     opA: unconstrained      C: General
+  A: Symmetric   B: General     opA: ignored            C: General
+  A: Hermitian   B: General     opA: ignored            C: General
+ @endverbatim
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input block sparse matrix.
+ * @param[in] B The input dense matrix.
+ * @param[in,out] C The dense matrix to be updated.
+ */
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+void mult(typename T_BsrMatrix::value_type alpha, op_t opA, 
+		const bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B,
+    dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& C);
+
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Creates a general matrix from a block sparse-dense matrix-matrix product.
+ *
+ * Performs the operation <b>alpha * opA(A) * B</b>@n
+ *
+ * Valid combinations are the following:
+ @verbatim
+  A: General     B: General     opA: unconstrained
+  A: Symmetric   B: General     opA: ignored      
+  A: Hermitian   B: General     opA: ignored      
+ @endverbatim
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A.
+ * @param[in] A The input block sparse matrix.
+ * @param[in] B The input dense matrix.
+ * @return The matrix <b>(alpha * opA(A) * B)</b>.
+ */
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+T_DnsMatrix mult(typename T_BsrMatrix::value_type alpha, op_t opA, 
+		const bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B);
+
+/**
+ * @ingroup module_index_math_op_matmat
+ * @brief Updates a general matrix with a matrix-matrix product, the left matrix in SELL-C-sigma storage.
+ *
+ * Performs the operation <b>C = C + alpha * op(A) * B</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input matrix.
+ * @param[in] B The input general matrix, rows in the original ordering.
+ * @param[in,out] C The general matrix to be updated, rows in the original ordering.
+ */
+template <typename T_Matrix, typename T_DnsMatrix>
+void mult(typename T_DnsMatrix::value_type alpha,
+    op_t opA, const csc::SellMatrix<T_Matrix>& A,
+    const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B,
+    dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& C);
+
 /**
  * @ingroup module_index_math_op_matmat
  * @brief Updates a dense matrix with a sparse-sparse matrix-matrix product.
@@ -26,7 +26,11 @@
 #include "cla3p/checks/matrix_math_checks.hpp"
 #include "cla3p/proxies/blas_proxy.hpp"
 #include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/bulk/dns_rfp.hpp"
+#include "cla3p/bulk/dns_band.hpp"
 #include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/bsr.hpp"
+#include "cla3p/bulk/sell.hpp"
 #include "cla3p/algebra/functional_update.hpp"
 
 /*-------------------------------------------------*/
@@ -144,6 +148,83 @@ instantiate_trisol(dns::CdVector, dns::CdMatrix);
 instantiate_trisol(dns::CfVector, dns::CfMatrix);
 #undef instantiate_trisol
 /*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::RfpMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	if(A.prop().isTriangular()) {
+		throw err::InvalidOp(A.prop().name() + " matrices in RFP storage are not supported in products");
+	} // triangular
+
+	bulk::dns::rfp_x_vec(A.prop().uplo(), A.ncols(), alpha, A.values(), X.values(), Y.values());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template void mult(typename T_Vec::value_type, op_t, \
+    const dns::RfpMatrix<T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, dns::RdMatrix);
+instantiate_mult(dns::RfVector, dns::RfMatrix);
+instantiate_mult(dns::CdVector, dns::CdMatrix);
+instantiate_mult(dns::CfVector, dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::BandMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	if(!A.prop().isGeneral()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	bulk::dns::band_x_mat(A.prop().type(), A.prop().uplo(), opA, 
+			A.nrows(), A.ncols(), A.kl(), A.ku(), 
+			alpha, A.values(), A.ld(), 
+			1, X.values(), X.size(), Y.values(), Y.size());
+}
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::TridiagonalMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	if(!A.prop().isGeneral()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	bulk::dns::tri_x_mat(opA, A.ncols(), alpha, 
+			A.subdiagonal(), A.diagonal(), A.superdiagonal(), 
+			1, X.values(), X.size(), Y.values(), Y.size());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template void mult(typename T_Vec::value_type, op_t, \
+    const dns::BandMatrix<T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&); \
+template void mult(typename T_Vec::value_type, op_t, \
+    const dns::TridiagonalMatrix<T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, dns::RdMatrix);
+instantiate_mult(dns::RfVector, dns::RfMatrix);
+instantiate_mult(dns::CdVector, dns::CdMatrix);
+instantiate_mult(dns::CfVector, dns::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Vector, typename T_Matrix>
@@ -161,19 +242,19 @@ void mult(typename T_Vector::value_type alpha, op_t opA,
 
 		bulk::csc::gem_x_vec(opA, A.nrows(), A.ncols(), alpha, 
 				A.colptr(), A.rowidx(), A.values(), 
-				X.values(), beta, Y.values());
+				X.values(), beta, Y.values(), A.handle());
 
 	} else if(A.prop().isSymmetric()) {
 
 		bulk::csc::sym_x_vec(A.prop().uplo(), A.ncols(), alpha, 
 				A.colptr(), A.rowidx(), A.values(), 
-				X.values(), beta, Y.values());
+				X.values(), beta, Y.values(), A.handle());
 
 	} else if(A.prop().isHermitian()) {
 
 		bulk::csc::hem_x_vec(A.prop().uplo(), A.ncols(), alpha, 
 				A.colptr(), A.rowidx(), A.values(), 
-				X.values(), beta, Y.values());
+				X.values(), beta, Y.values(), A.handle());
 
 	} else {
 
@@ -215,6 +296,225 @@ instantiate_mult(dns::CdVector, csc::CdMatrix);
 instantiate_mult(dns::CfVector, csc::CfMatrix);
 #undef instantiate_mult
 /*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+//
+// The csr arrays of A are the csc arrays of B = A^T, so products run on the csc kernels of B:
+//   A * X = B^T * X (row-wise gather) and A^T * X = B * X
+// Only conj(B) * X is not covered by an op flag, it is evaluated as conj(B * conj(X))
+//
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	using T_Scalar = typename T_Vector::value_type;
+	using T_CscMatrix = typename TypeTraits<T_Matrix>::csc_type;
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	Guard<T_CscMatrix> Bg = A.rtranspose();
+	const T_CscMatrix& B = Bg.get();
+
+	bool mirror = (B.prop().isSymmetric() || B.prop().isHermitian());
+	bool conjop = (TypeTraits<T_Scalar>::is_complex() && (mirror ? B.prop().isHermitian() : opA == op_t::C));
+
+	T_Scalar beta = 1;
+
+	if(!conjop) {
+
+		op_t opB = (opA == op_t::N ? op_t::T : op_t::N);
+
+		if(B.prop().isGeneral() || B.prop().isTriangular()) {
+
+			bulk::csc::gem_x_vec(opB, B.nrows(), B.ncols(), alpha, 
+					B.colptr(), B.rowidx(), B.values(), 
+					X.values(), beta, Y.values());
+
+		} else if(B.prop().isSymmetric()) {
+
+			bulk::csc::sym_x_vec(B.prop().uplo(), B.ncols(), alpha, 
+					B.colptr(), B.rowidx(), B.values(), 
+					X.values(), beta, Y.values());
+
+		} else {
+
+			throw err::Exception();
+
+		} // property 
+
+	} else {
+
+		T_Vector Xc = X.copy();
+		Xc.iconjugate();
+
+		T_Vector W(Y.size());
+		W = 0;
+
+		if(B.prop().isGeneral() || B.prop().isTriangular()) {
+
+			bulk::csc::gem_x_vec(op_t::N, B.nrows(), B.ncols(), arith::conj(alpha), 
+					B.colptr(), B.rowidx(), B.values(), 
+					Xc.values(), beta, W.values());
+
+		} else if(B.prop().isHermitian()) {
+
+			bulk::csc::hem_x_vec(B.prop().uplo(), B.ncols(), arith::conj(alpha), 
+					B.colptr(), B.rowidx(), B.values(), 
+					Xc.values(), beta, W.values());
+
+		} else {
+
+			throw err::Exception();
+
+		} // property 
+
+		W.iconjugate();
+		update(T_Scalar(1), W, Y);
+
+	} // conjop
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template void mult(typename T_Vec::value_type, op_t, \
+    const csr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, csr::RdMatrix);
+instantiate_mult(dns::RfVector, csr::RfMatrix);
+instantiate_mult(dns::CdVector, csr::CdMatrix);
+instantiate_mult(dns::CfVector, csr::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+T_Vector mult(typename T_Vector::value_type alpha, op_t opA,
+    const csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X)
+{
+  Operation _opA(opA);
+  T_Vector ret(_opA.isTranspose() ? A.ncols() : A.nrows());
+  ret = 0;
+  mult(alpha, opA, A, X, ret);
+  return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template T_Vec mult(typename T_Vec::value_type, op_t, \
+		const csr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+		const dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, csr::RdMatrix);
+instantiate_mult(dns::RfVector, csr::RfMatrix);
+instantiate_mult(dns::CdVector, csr::CdMatrix);
+instantiate_mult(dns::CfVector, csr::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	if(A.empty()) return;
+
+	typename T_Vector::value_type beta = 1;
+
+	if(A.prop().isGeneral()) {
+
+		bulk::bsr::gem_x_vec(opA, A.nbrows(), A.nbcols(), A.bsize(), alpha, 
+				A.rowptr(), A.colidx(), A.values(), 
+				X.values(), beta, Y.values());
+
+	} else if(A.prop().isSymmetric()) {
+
+		bulk::bsr::sym_x_vec(A.prop().uplo(), A.nbcols(), A.bsize(), alpha, 
+				A.rowptr(), A.colidx(), A.values(), 
+				X.values(), beta, Y.values());
+
+	} else if(A.prop().isHermitian()) {
+
+		bulk::bsr::hem_x_vec(A.prop().uplo(), A.nbcols(), A.bsize(), alpha, 
+				A.rowptr(), A.colidx(), A.values(), 
+				X.values(), beta, Y.values());
+
+	} else {
+
+		throw err::Exception();
+
+	} // property 
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template void mult(typename T_Vec::value_type, op_t, \
+    const bsr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, bsr::RdMatrix);
+instantiate_mult(dns::RfVector, bsr::RfMatrix);
+instantiate_mult(dns::CdVector, bsr::CdMatrix);
+instantiate_mult(dns::CfVector, bsr::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+T_Vector mult(typename T_Vector::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X)
+{
+  Operation _opA(opA);
+  T_Vector ret(_opA.isTranspose() ? A.ncols() : A.nrows());
+  ret = 0;
+  mult(alpha, opA, A, X, ret);
+  return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template T_Vec mult(typename T_Vec::value_type, op_t, \
+		const bsr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+		const dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, bsr::RdMatrix);
+instantiate_mult(dns::RfVector, bsr::RfMatrix);
+instantiate_mult(dns::CdVector, bsr::CdMatrix);
+instantiate_mult(dns::CfVector, bsr::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const csc::SellMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	if(A.prop().isSymmetric() || A.prop().isHermitian()) opA = op_t::N;
+	opA = (TypeTraits<T_Matrix>::is_real() && opA == op_t::C ? op_t::T : opA);
+
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+
+	if(A.empty()) return;
+
+	bulk::sell::gem_x_vec(opA, A.nrows(), A.ncols(), A.chunkSize(), alpha, 
+			A.rowidx(), A.chunkptr(), A.colidx(), A.values(), 
+			X.values(), typename T_Vector::value_type(1), Y.values());
+}
+/*-------------------------------------------------*/
+#define instantiate_mult(T_Vec, T_Mat) \
+template void mult(typename T_Vec::value_type, op_t, \
+    const csc::SellMatrix<T_Mat>&, \
+    const dns::XxVector<typename T_Vec::value_type,T_Vec>&, \
+    dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_mult(dns::RdVector, csc::RdMatrix);
+instantiate_mult(dns::RfVector, csc::RfMatrix);
+instantiate_mult(dns::CdVector, csc::CdMatrix);
+instantiate_mult(dns::CfVector, csc::CfMatrix);
+#undef instantiate_mult
+/*-------------------------------------------------*/
 } // namespace ops
 } // namespace cla3p
 /*-------------------------------------------------*/
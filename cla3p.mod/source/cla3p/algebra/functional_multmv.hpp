@@ -95,6 +95,60 @@ void trisol(op_t opA,
     const dns::XxMatrix<typename T_Matrix::value_type,T_Matrix>& A,
     dns::XxVector<typename T_Vector::value_type,T_Vector>& B);
 
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a matrix-vector product, the matrix in RFP storage.
+ *
+ * Performs the operation <b>Y = Y + alpha * A * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored since A is symmetric or hermitian.
+ * @param[in] A The input Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] X The input vector.
+ * @param[in,out] Y The vector to be updated.
+ */
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::RfpMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a matrix-vector product, the matrix in band storage.
+ *
+ * Performs the operation <b>Y = Y + alpha * op(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input General, Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] X The input vector.
+ * @param[in,out] Y The vector to be updated.
+ */
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::BandMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a tridiagonal matrix-vector product.
+ *
+ * Performs the operation <b>Y = Y + alpha * op(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input General, Symmetric (real) or Hermitian (complex) matrix.
+ * @param[in] X The input vector.
+ * @param[in,out] Y The vector to be updated.
+ */
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const dns::TridiagonalMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
@@ -135,6 +189,104 @@ T_Vector mult(typename T_Vector::value_type alpha, op_t opA,
     const csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
     const dns::XxVector<typename T_Vector::value_type,T_Vector>& X);
 
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a matrix-vector product.
+ *
+ * Performs the operation <b>Y = Y + alpha * opA(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A. If A is symmetric or hermitian, opA is ignored.
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @param[in,out] Y The vector to be updated.
+ */
+
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Creates a vector from a matrix-vector product.
+ *
+ * Performs the operation <b>alpha * opA(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A. If A is symmetric or hermitian, opA is ignored.
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @return The vector <b>(alpha * opA(A) * X)</b>.
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector mult(typename T_Vector::value_type alpha, op_t opA,
+    const csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X);
+
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a block sparse matrix-vector product.
+ *
+ * Performs the operation <b>Y = Y + alpha * opA(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A. If A is symmetric or hermitian, opA is ignored.
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @param[in,out] Y The vector to be updated.
+ */
+
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Creates a vector from a block sparse matrix-vector product.
+ *
+ * Performs the operation <b>alpha * opA(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A. If A is symmetric or hermitian, opA is ignored.
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @return The vector <b>(alpha * opA(A) * X)</b>.
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector mult(typename T_Vector::value_type alpha, op_t opA,
+    const bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X);
+
+/**
+ * @ingroup module_index_math_op_matvec
+ * @brief Updates a vector with a matrix-vector product, the matrix in SELL-C-sigma storage.
+ *
+ * Performs the operation <b>Y = Y + alpha * op(A) * X</b>
+ *
+ * @param[in] alpha The scaling coefficient.
+ * @param[in] opA The operation to be performed for matrix A, ignored if A is symmetric or hermitian.
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector, in the original ordering.
+ * @param[in,out] Y The vector to be updated, in the original ordering.
+ */
+template <typename T_Vector, typename T_Matrix>
+void mult(typename T_Vector::value_type alpha, op_t opA,
+    const csc::SellMatrix<T_Matrix>& A,
+    const dns::XxVector<typename T_Vector::value_type,T_Vector>& X,
+    dns::XxVector<typename T_Vector::value_type,T_Vector>& Y);
+
 /*-------------------------------------------------*/
 } // namespace ops
 } // namespace cla3p
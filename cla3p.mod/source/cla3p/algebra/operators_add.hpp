@@ -37,14 +37,22 @@ namespace csc { template <typename T_Int, typename T_Scalar, typename T_Matrix>
  * XxObject + XxObject           | YES      | T_Object
  * XxObject - XxObject           | YES      | T_Object
  *                               |          |
- * XxObject + VirtualEntity      | YES      | T_Object
- * XxObject - VirtualEntity      | YES      | T_Object
+ * XxObject + VirtualEntity      | YES      | VirtualSum
+ * XxObject - VirtualEntity      | YES      | VirtualSum
  *                               |          |
- * VirtualEntity + XxObject      | YES      | T_Object
- * VirtualEntity - XxObject      | YES      | T_Object
+ * VirtualEntity + XxObject      | YES      | VirtualSum
+ * VirtualEntity - XxObject      | YES      | VirtualSum
  *                               |          |
- * VirtualEntity + VirtualEntity | YES      | T_Object
- * VirtualEntity - VirtualEntity | YES      | T_Object
+ * VirtualEntity + VirtualEntity | YES      | VirtualSum
+ * VirtualEntity - VirtualEntity | YES      | VirtualSum
+ *                               |          |
+ * XxMatrix +/- VirtualCscMatrix | YES      | T_Matrix (csc)
+ * VirtualCscMatrix +/- XxMatrix | YES      | T_Matrix (csc)
+ * VirtualCscMatrix +/- VirtualCscMatrix | YES | T_Matrix (csc)
+ *
+ * Sums are evaluated on assignment, the result is created from the first term
+ * and the remaining terms are accumulated in-place (see VirtualSum)
+ * Sparse sums are evaluated immediately
  */
 
 /**
@@ -111,16 +119,76 @@ T_Matrix operator-(
 
 /*-------------------------------------------------*/
 
+/*
+ * csc::XxMatrix +/- VirtualCscMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator+(
+		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+		const cla3p::VirtualCscMatrix<T_Matrix>& vB)
+{
+	return (A + vB.evaluate());
+}
+
+template <typename T_Matrix>
+T_Matrix operator-(
+		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+		const cla3p::VirtualCscMatrix<T_Matrix>& vB)
+{
+	return (A - vB.evaluate());
+}
+
+/*
+ * VirtualCscMatrix +/- csc::XxMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator+(
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA,
+		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& B)
+{
+	return (vA.evaluate() + B);
+}
+
+template <typename T_Matrix>
+T_Matrix operator-(
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA,
+		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& B)
+{
+	return (vA.evaluate() - B);
+}
+
+/*
+ * VirtualCscMatrix +/- VirtualCscMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator+(
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA,
+		const cla3p::VirtualCscMatrix<T_Matrix>& vB)
+{
+	return (vA.evaluate() + vB.evaluate());
+}
+
+template <typename T_Matrix>
+T_Matrix operator-(
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA,
+		const cla3p::VirtualCscMatrix<T_Matrix>& vB)
+{
+	return (vA.evaluate() - vB.evaluate());
+}
+
+/*-------------------------------------------------*/
+
 /*
  * XxObject + VirtualEntity
  */
 template <typename T_Object, typename T_Virtual> 
-T_Object operator+(
+typename cla3p::VirtualTerms<T_Object>::sum_type operator+(
 		const T_Object& A,
 		const cla3p::VirtualEntity<T_Object,T_Virtual>& vB)
 {
-	T_Object ret = A.copy();
-	ret += vB;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(typename cla3p::VirtualTerms<T_Object>::leaf_type(A));
+	ret.append(vB.self());
 	return ret;
 }
 
@@ -128,12 +196,13 @@ T_Object operator+(
  * XxObject - VirtualEntity
  */
 template <typename T_Object, typename T_Virtual> 
-T_Object operator-(
+typename cla3p::VirtualTerms<T_Object>::sum_type operator-(
 		const T_Object& A,
 		const cla3p::VirtualEntity<T_Object,T_Virtual>& vB)
 {
-	T_Object ret = A.copy();
-	ret -= vB;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(typename cla3p::VirtualTerms<T_Object>::leaf_type(A));
+	ret.append(-vB);
 	return ret;
 }
 
@@ -143,12 +212,13 @@ T_Object operator-(
  * VirtualEntity + XxObject
  */
 template <typename T_Object, typename T_Virtual>
-T_Object operator+(
+typename cla3p::VirtualTerms<T_Object>::sum_type operator+(
 		const cla3p::VirtualEntity<T_Object,T_Virtual>& vA,
 		const T_Object& B)
 {
-	T_Object ret = vA.evaluate();
-	ret += B;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(vA.self());
+	ret.append(typename cla3p::VirtualTerms<T_Object>::leaf_type(B));
 	return ret;
 }
 
@@ -156,12 +226,13 @@ T_Object operator+(
  * VirtualEntity - XxObject
  */
 template <typename T_Object, typename T_Virtual> 
-T_Object operator-(
+typename cla3p::VirtualTerms<T_Object>::sum_type operator-(
 		const cla3p::VirtualEntity<T_Object,T_Virtual>& vA,
 		const T_Object& B)
 {
-	T_Object ret = vA.evaluate();
-	ret -= B;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(vA.self());
+	ret.append(-typename cla3p::VirtualTerms<T_Object>::leaf_type(B));
 	return ret;
 }
 
@@ -170,26 +241,28 @@ T_Object operator-(
 /*
  * VirtualEntity + VirtualEntity
  */
-template <typename T_Object, typename T_Virtual> 
-T_Object operator+(
-		const cla3p::VirtualEntity<T_Object,T_Virtual>& vA,
-		const cla3p::VirtualEntity<T_Object,T_Virtual>& vB)
+template <typename T_Object, typename T_VirtualA, typename T_VirtualB> 
+typename cla3p::VirtualTerms<T_Object>::sum_type operator+(
+		const cla3p::VirtualEntity<T_Object,T_VirtualA>& vA,
+		const cla3p::VirtualEntity<T_Object,T_VirtualB>& vB)
 {
-	T_Object ret = vA.evaluate();
-	ret += vB;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(vA.self());
+	ret.append(vB.self());
 	return ret;
 }
 
 /*
  * VirtualEntity - VirtualEntity
  */
-template <typename T_Object, typename T_Virtual> 
-T_Object operator-(
-		const cla3p::VirtualEntity<T_Object,T_Virtual>& vA,
-		const cla3p::VirtualEntity<T_Object,T_Virtual>& vB)
+template <typename T_Object, typename T_VirtualA, typename T_VirtualB> 
+typename cla3p::VirtualTerms<T_Object>::sum_type operator-(
+		const cla3p::VirtualEntity<T_Object,T_VirtualA>& vA,
+		const cla3p::VirtualEntity<T_Object,T_VirtualB>& vB)
 {
-	T_Object ret = vA.evaluate();
-	ret -= vB;
+	cla3p::VirtualSum<T_Object> ret;
+	ret.append(vA.self());
+	ret.append(-vB);
 	return ret;
 }
 
@@ -46,6 +46,25 @@ instantiate_op_mm(cla3p::csc::CdMatrix, cla3p::dns::CdMatrix);
 instantiate_op_mm(cla3p::csc::CfMatrix, cla3p::dns::CfMatrix);
 #undef instantiate_op_mm
 /*-------------------------------------------------*/
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+T_DnsMatrix operator*(
+  const cla3p::bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A,
+  const cla3p::dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B)
+{
+  using T_Scalar = typename T_BsrMatrix::value_type;
+  return cla3p::ops::mult(T_Scalar(1), cla3p::op_t::N, A, B);
+}
+/*-------------------------------------------------*/
+#define instantiate_op_mm(T_Bsr, T_Dns) \
+template T_Dns operator*( \
+  const cla3p::bsr::XxMatrix<typename T_Bsr::index_type,typename T_Bsr::value_type,T_Bsr>&, \
+  const cla3p::dns::XxMatrix<typename T_Dns::value_type,T_Dns>&)
+instantiate_op_mm(cla3p::bsr::RdMatrix, cla3p::dns::RdMatrix);
+instantiate_op_mm(cla3p::bsr::RfMatrix, cla3p::dns::RfMatrix);
+instantiate_op_mm(cla3p::bsr::CdMatrix, cla3p::dns::CdMatrix);
+instantiate_op_mm(cla3p::bsr::CfMatrix, cla3p::dns::CfMatrix);
+#undef instantiate_op_mm
+/*-------------------------------------------------*/
 template <typename T_Matrix>
 T_Matrix operator*(
   const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
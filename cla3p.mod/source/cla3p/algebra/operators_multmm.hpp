@@ -28,6 +28,7 @@
 namespace cla3p {
 namespace dns { template <typename T_Scalar, typename T_Matrix> class XxMatrix; } 
 namespace csc { template <typename T_Int, typename T_Scalar, typename T_Matrix> class XxMatrix; } 
+namespace bsr { template <typename T_Int, typename T_Scalar, typename T_Matrix> class XxMatrix; } 
 } // namespace cla3p
 /*-------------------------------------------------*/
 
@@ -141,6 +142,23 @@ T_Matrix operator*(
 
 /*-------------------------------------------------*/
 
+/**
+ * @ingroup module_index_math_operators_mult
+ * @brief Multiplies a block sparse matrix with a dense matrix.
+ *
+ * Performs the operation <b>A * B</b>
+ *
+ * @param[in] A The lhs input matrix.
+ * @param[in] B The rhs input matrix.
+ * @return The resulting dense matrix.
+ */
+template <typename T_BsrMatrix, typename T_DnsMatrix>
+T_DnsMatrix operator*(
+	const cla3p::bsr::XxMatrix<typename T_BsrMatrix::index_type,typename T_BsrMatrix::value_type,T_BsrMatrix>& A, 
+	const cla3p::dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B); 
+
+/*-------------------------------------------------*/
+
 /**
  * @ingroup module_index_math_operators_mult
  * @brief Multiplies a sparse matrix with a sparse matrix.
@@ -158,6 +176,66 @@ T_Matrix operator*(
 
 /*-------------------------------------------------*/
 
+/**
+ * @ingroup module_index_math_operators_mult
+ * @brief Multiplies a virtual sparse matrix with a dense matrix.
+ *
+ * Performs the operation <b>vA * B</b>, 
+ * the scaling, transposition, conjugation & permutations of vA are applied on the fly.
+ *
+ * @param[in] vA The lhs input virtual matrix.
+ * @param[in] B The rhs input matrix.
+ * @return The resulting dense matrix.
+ */
+template <typename T_CscMatrix, typename T_DnsMatrix>
+T_DnsMatrix operator*(
+	const cla3p::VirtualCscMatrix<T_CscMatrix>& vA, 
+	const cla3p::dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& B) 
+{
+	return vA.evaluateProd(B.self());
+}
+
+/*-------------------------------------------------*/
+
+/*
+ * XxMatrix * VirtualCscMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator*(
+	const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
+	const cla3p::VirtualCscMatrix<T_Matrix>& vB) 
+{ 
+	return (A * vB.evaluate());
+}
+
+/*-------------------------------------------------*/
+
+/*
+ * VirtualCscMatrix * XxMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator*(
+	const cla3p::VirtualCscMatrix<T_Matrix>& vA, 
+	const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& B) 
+{ 
+	return (vA.evaluate() * B);
+}
+
+/*-------------------------------------------------*/
+
+/*
+ * VirtualCscMatrix * VirtualCscMatrix
+ */
+template <typename T_Matrix>
+T_Matrix operator*(
+	const cla3p::VirtualCscMatrix<T_Matrix>& vA, 
+	const cla3p::VirtualCscMatrix<T_Matrix>& vB) 
+{ 
+	return (vA.evaluate() * vB.evaluate());
+}
+
+/*-------------------------------------------------*/
+
 /*
  * VirtualMatrix * XxMatrix
  */
@@ -46,3 +46,41 @@ instantiate_op_mv(cla3p::csc::CdMatrix, cla3p::dns::CdVector);
 instantiate_op_mv(cla3p::csc::CfMatrix, cla3p::dns::CfVector);
 #undef instantiate_op_mv
 /*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+  const cla3p::csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+  const cla3p::dns::XxVector<typename T_Vector::value_type,T_Vector>& X)
+{
+  using T_Scalar = typename T_Matrix::value_type;
+  return cla3p::ops::mult(T_Scalar(1), cla3p::op_t::N, A, X);
+}
+/*-------------------------------------------------*/
+#define instantiate_op_mv(T_Mat, T_Vec) \
+template T_Vec operator*( \
+		const cla3p::csr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+		const cla3p::dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_op_mv(cla3p::csr::RdMatrix, cla3p::dns::RdVector);
+instantiate_op_mv(cla3p::csr::RfMatrix, cla3p::dns::RfVector);
+instantiate_op_mv(cla3p::csr::CdMatrix, cla3p::dns::CdVector);
+instantiate_op_mv(cla3p::csr::CfMatrix, cla3p::dns::CfVector);
+#undef instantiate_op_mv
+/*-------------------------------------------------*/
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+  const cla3p::bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
+  const cla3p::dns::XxVector<typename T_Vector::value_type,T_Vector>& X)
+{
+  using T_Scalar = typename T_Matrix::value_type;
+  return cla3p::ops::mult(T_Scalar(1), cla3p::op_t::N, A, X);
+}
+/*-------------------------------------------------*/
+#define instantiate_op_mv(T_Mat, T_Vec) \
+template T_Vec operator*( \
+		const cla3p::bsr::XxMatrix<typename T_Mat::index_type,typename T_Mat::value_type,T_Mat>&, \
+		const cla3p::dns::XxVector<typename T_Vec::value_type,T_Vec>&)
+instantiate_op_mv(cla3p::bsr::RdMatrix, cla3p::dns::RdVector);
+instantiate_op_mv(cla3p::bsr::RfMatrix, cla3p::dns::RfVector);
+instantiate_op_mv(cla3p::bsr::CdMatrix, cla3p::dns::CdVector);
+instantiate_op_mv(cla3p::bsr::CfMatrix, cla3p::dns::CfVector);
+#undef instantiate_op_mv
+/*-------------------------------------------------*/
@@ -29,6 +29,8 @@ namespace cla3p {
 namespace dns { template <typename T_Scalar, typename T_Vector> class XxVector; }
 namespace dns { template <typename T_Scalar, typename T_Matrix> class XxMatrix; }
 namespace csc { template <typename T_Int, typename T_Scalar, typename T_Matrix> class XxMatrix; }
+namespace csr { template <typename T_Int, typename T_Scalar, typename T_Matrix> class XxMatrix; }
+namespace bsr { template <typename T_Int, typename T_Scalar, typename T_Matrix> class XxMatrix; }
 } // namespace cla3p
 /*-------------------------------------------------*/
 
@@ -142,6 +144,113 @@ T_Vector operator*(
 
 /*-------------------------------------------------*/
 
+/**
+ * @ingroup module_index_math_operators_mult
+ * @brief Multiplies a virtual sparse matrix with a vector.
+ *
+ * Performs the operation <b>vA * X</b>, 
+ * the scaling, transposition, conjugation & permutations of vA are applied on the fly.
+ *
+ * @param[in] vA The input virtual matrix.
+ * @param[in] X The input vector.
+ * @return The resulting vector.
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::VirtualCscMatrix<T_Matrix>& vA, 
+	const cla3p::dns::XxVector<typename T_Vector::value_type,T_Vector>& X)
+{
+	return vA.evaluateProd(X.self());
+}
+
+/*-------------------------------------------------*/
+
+/*
+ * VirtualCscMatrix * VirtualVector
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::VirtualCscMatrix<T_Matrix>& vA, 
+	const cla3p::VirtualVector<T_Vector>& vX) 
+{ 
+	return (vA * vX.evaluate());
+}
+
+/*-------------------------------------------------*/
+
+/*
+ * VirtualCscMatrix * VirtualProdMv
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::VirtualCscMatrix<T_Matrix>& vA, 
+	const cla3p::VirtualProdMv<T_Vector>& vX) 
+{ 
+	return (vA * vX.evaluate());
+}
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_math_operators_mult
+ * @brief Multiplies a sparse matrix with a vector.
+ *
+ * Performs the operation <b>A * X</b>
+ *
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @return The virtual product.
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
+	const cla3p::dns::XxVector<typename T_Vector::value_type,T_Vector>& X);
+
+/*-------------------------------------------------*/
+
+/*
+ * XxMatrix * VirtualVector
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::csr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
+	const cla3p::VirtualVector<T_Vector>& vX) 
+{ 
+	return (A * vX.evaluate());
+}
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_math_operators_mult
+ * @brief Multiplies a block sparse matrix with a vector.
+ *
+ * Performs the operation <b>A * X</b>
+ *
+ * @param[in] A The input matrix.
+ * @param[in] X The input vector.
+ * @return The virtual product.
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
+	const cla3p::dns::XxVector<typename T_Vector::value_type,T_Vector>& X);
+
+/*-------------------------------------------------*/
+
+/*
+ * XxMatrix * VirtualVector
+ */
+template <typename T_Vector, typename T_Matrix>
+T_Vector operator*(
+	const cla3p::bsr::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
+	const cla3p::VirtualVector<T_Vector>& vX) 
+{ 
+	return (A * vX.evaluate());
+}
+
+/*-------------------------------------------------*/
+
 /*
  * VirtualMatrix * XxVector
  */
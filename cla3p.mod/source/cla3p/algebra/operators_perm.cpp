@@ -64,15 +64,17 @@ instantiate_perm(cla3p::prm::PiMatrix, cla3p::dns::CfMatrix);
 #undef instantiate_perm
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		const cla3p::prm::PxMatrix<T_Int>& P,
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A)
 {
-	return A.permuteLeft(P);
+	cla3p::VirtualCscMatrix<T_Matrix> ret(A.self());
+	ret.ipermuteLeft(P);
+	return ret;
 }
 /*-------------------------------------------------*/
 #define instantiate_perm(T_Prm, T_Mat) \
-template T_Mat operator*( \
+template cla3p::VirtualCscMatrix<T_Mat> operator*( \
 		const cla3p::prm::PxMatrix<T_Prm::value_type>&, \
 		const cla3p::csc::XxMatrix<T_Mat::index_type,T_Mat::value_type,T_Mat>&)
 instantiate_perm(cla3p::prm::PiMatrix, cla3p::csc::RdMatrix);
@@ -100,15 +102,17 @@ instantiate_perm(cla3p::prm::PiMatrix, cla3p::dns::CfMatrix);
 #undef instantiate_perm
 /*-------------------------------------------------*/
 template <typename T_Int, typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A,
 		const cla3p::prm::PxMatrix<T_Int>& P)
 {
-	return A.permuteRight(P);
+	cla3p::VirtualCscMatrix<T_Matrix> ret(A.self());
+	ret.ipermuteRight(P);
+	return ret;
 }
 /*-------------------------------------------------*/
 #define instantiate_perm(T_Prm, T_Mat) \
-template T_Mat operator*( \
+template cla3p::VirtualCscMatrix<T_Mat> operator*( \
 		const cla3p::csc::XxMatrix<T_Mat::index_type,T_Mat::value_type,T_Mat>&, \
 		const cla3p::prm::PxMatrix<T_Prm::value_type>&)
 instantiate_perm(cla3p::prm::PiMatrix, cla3p::csc::RdMatrix);
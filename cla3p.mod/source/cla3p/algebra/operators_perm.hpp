@@ -115,15 +115,25 @@ T_Matrix operator*(
  *
  * @param[in] P The input permutation matrix.
  * @param[in] A The input general matrix.
- * @return The permuted matrix.
+ * @return The virtually permuted matrix.
  */
 template <typename T_Int, typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		const cla3p::prm::PxMatrix<T_Int>& P, 
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A);
 
 /*-------------------------------------------------*/
 
+template <typename T_Int, typename T_Matrix>
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
+		const cla3p::prm::PxMatrix<T_Int>& P, 
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA)
+{
+	return vA.permuteLeft(P);
+}
+
+/*-------------------------------------------------*/
+
 /**
  * @ingroup module_index_math_operators_perm
  * @brief Multiplies general dense matrix with a permutation matrix.
@@ -170,16 +180,26 @@ T_Matrix operator*(
  *
  * @param[in] A The input general matrix.
  * @param[in] P The input permutation matrix.
- * @return The permuted matrix.
+ * @return The virtually permuted matrix.
  */
 
 template <typename T_Int, typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
 		const cla3p::prm::PxMatrix<T_Int>& P);
 
 /*-------------------------------------------------*/
 
+template <typename T_Int, typename T_Matrix>
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
+		const cla3p::VirtualCscMatrix<T_Matrix>& vA,
+		const cla3p::prm::PxMatrix<T_Int>& P)
+{
+	return vA.permuteRight(P);
+}
+
+/*-------------------------------------------------*/
+
 /**
  * @ingroup module_index_math_operators_perm
  * @brief Multiplies a permutation matrix with a permutation matrix.
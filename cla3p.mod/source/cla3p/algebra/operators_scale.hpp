@@ -38,14 +38,17 @@ namespace csc { template <typename T_Int, typename T_Scalar, typename T_Matrix>
  * ------------------------------------------------------
  * T_Scalar      * XxVector      | YES      | VirtualVector
  * T_Scalar      * XxMatrix      | YES      | VirtualMatrix
+ * T_Scalar      * csc::XxMatrix | YES      | VirtualCscMatrix
  * T_Scalar      * VirtualEntity | YES      | T_Virtual
  *                               |          |
  * XxVector      * T_Scalar      | YES      | VirtualVector
  * XxMatrix      * T_Scalar      | YES      | VirtualMatrix
+ * csc::XxMatrix * T_Scalar      | YES      | VirtualCscMatrix
  * VirtualEntity * T_Scalar      | YES      | T_Virtual
  *                               |          |
  * XxVector      / T_Scalar      | YES      | VirtualVector
  * XxMatrix      / T_Scalar      | YES      | VirtualMatrix
+ * csc::XxMatrix / T_Scalar      | YES      | VirtualCscMatrix
  * VirtualEntity / T_Scalar      | YES      | T_Virtual
  *                               |          |
  * XxVector      *= T_Scalar     | YES      | void
@@ -103,16 +106,15 @@ cla3p::VirtualMatrix<T_Matrix> operator*(
  *
  * @param[in] val The coefficient value.
  * @param[in] A The input matrix.
- * @return The scaled matrix copy.
+ * @return The virtually scaled matrix.
  */
 template <typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		typename T_Matrix::value_type val, 
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A) 
 { 
-	T_Matrix ret = A.copy();
-	ret.iscale(val);
-	return ret;
+	cla3p::VirtualCscMatrix<T_Matrix> sm(A.self());
+	return sm.scale(val);
 }
 
 /*-------------------------------------------------*/
@@ -176,10 +178,10 @@ cla3p::VirtualMatrix<T_Matrix> operator*(
  *
  * @param[in] A The input matrix.
  * @param[in] val The coefficient value.
- * @return The scaled matrix copy.
+ * @return The virtually scaled matrix.
  */
 template <typename T_Matrix>
-T_Matrix operator*(
+cla3p::VirtualCscMatrix<T_Matrix> operator*(
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
 		typename T_Matrix::value_type val) 
 { 
@@ -245,10 +247,10 @@ cla3p::VirtualMatrix<T_Matrix> operator/(
  *
  * @param[in] A The input matrix.
  * @param[in] val The non-zero coefficient value.
- * @return The scaled matrix copy.
+ * @return The virtually scaled matrix.
  */
 template <typename T_Matrix>
-T_Matrix operator/(
+cla3p::VirtualCscMatrix<T_Matrix> operator/(
 		const cla3p::csc::XxMatrix<typename T_Matrix::index_type,typename T_Matrix::value_type,T_Matrix>& A, 
 		typename T_Matrix::value_type val) 
 { 
@@ -0,0 +1,751 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/bsr.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace bsr {
+/*-------------------------------------------------*/
+static bulk_t parallel_min_nnz()
+{
+	return 16384;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static bool use_parallel(uint_t mb, uint_t bs, const T_Int *rowptr)
+{
+	return (max_threads() > 1 && static_cast<bulk_t>(rowptr[mb]) * bs * bs >= parallel_min_nnz());
+}
+/*-------------------------------------------------*/
+//
+// Block kernels are instantiated for fixed block sizes (BS > 0) so that the loops
+// are fully unrolled & vectorized by the compiler, BS = 0 is the run-time block size fallback
+//
+template <uint_t BS>
+inline uint_t fixed_bs(uint_t bs)
+{
+	return (BS ? BS : bs);
+}
+/*-------------------------------------------------*/
+template <uint_t BS, typename T_Scalar>
+class BlockWork {
+	public:
+		explicit BlockWork(uint_t) {}
+		T_Scalar *data() { return m_data; }
+	private:
+		T_Scalar m_data[BS];
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+class BlockWork<0,T_Scalar> {
+	public:
+		explicit BlockWork(uint_t bs) : m_data(bs) {}
+		T_Scalar *data() { return m_data.data(); }
+	private:
+		std::vector<T_Scalar> m_data;
+};
+/*-------------------------------------------------*/
+//
+// y += alpha * a * x
+//
+template <uint_t BS, typename T_Scalar>
+inline void block_x_vec(uint_t bs, T_Scalar alpha, const T_Scalar *a, const T_Scalar *x, T_Scalar *y)
+{
+	const uint_t nb = fixed_bs<BS>(bs);
+
+	for(uint_t j = 0; j < nb; j++) {
+		const T_Scalar axj = alpha * x[j];
+		for(uint_t i = 0; i < nb; i++) {
+			y[i] += a[i + j * nb] * axj;
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// y += a^T * x (conjop = false) or y += a^H * x (conjop = true)
+//
+template <uint_t BS, typename T_Scalar>
+inline void block_t_x_vec(bool conjop, uint_t bs, const T_Scalar *a, const T_Scalar *x, T_Scalar *y)
+{
+	const uint_t nb = fixed_bs<BS>(bs);
+
+	if(conjop) {
+
+		for(uint_t j = 0; j < nb; j++) {
+			T_Scalar acc = 0;
+			for(uint_t i = 0; i < nb; i++) {
+				acc += arith::conj(a[i + j * nb]) * x[i];
+			} // i
+			y[j] += acc;
+		} // j
+
+	} else {
+
+		for(uint_t j = 0; j < nb; j++) {
+			T_Scalar acc = 0;
+			for(uint_t i = 0; i < nb; i++) {
+				acc += a[i + j * nb] * x[i];
+			} // i
+			y[j] += acc;
+		} // j
+
+	} // conjop
+}
+/*-------------------------------------------------*/
+//
+// yI = beta * yI + alpha * sum_J A(I,J) * xJ
+//
+template <uint_t BS, typename T_Int, typename T_Scalar>
+inline void gather_block_row(uint_t I, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, T_Scalar *w)
+{
+	const uint_t nb = fixed_bs<BS>(bs);
+	const uint_t nb2 = nb * nb;
+
+	for(uint_t r = 0; r < nb; r++) {
+		w[r] = 0;
+	} // r
+
+	for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+		block_x_vec<BS>(bs, T_Scalar(1), values + jblk * nb2, x + colidx[jblk] * nb, w);
+	} // jblk
+
+	T_Scalar *yI = y + I * nb;
+
+	for(uint_t r = 0; r < nb; r++) {
+		yI[r] = beta_scaled(beta, yI[r]) + alpha * w[r];
+	} // r
+}
+/*-------------------------------------------------*/
+//
+// zJ += op(A(I,J))^T * (alpha * xI), diagonal blocks are skipped for mirrored types
+//
+template <uint_t BS, typename T_Int, typename T_Scalar>
+inline void scatter_block_row(bool mirror, bool conjop, uint_t I, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar *z, T_Scalar *w)
+{
+	const uint_t nb = fixed_bs<BS>(bs);
+	const uint_t nb2 = nb * nb;
+
+	const T_Scalar *xI = x + I * nb;
+
+	for(uint_t r = 0; r < nb; r++) {
+		w[r] = alpha * xI[r];
+	} // r
+
+	for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+		T_Int J = colidx[jblk];
+		if(mirror && J == static_cast<T_Int>(I)) continue;
+		block_t_x_vec<BS>(conjop, bs, values + jblk * nb2, w, z + J * nb);
+	} // jblk
+}
+/*-------------------------------------------------*/
+//
+// op(A) = A (General): independent block row gathers
+// op(A) = A^T/A^H (General): scatter
+// Symmetric/Hermitian (mirror): gather the stored part & scatter its (conjugate) transpose
+//
+// Scatters are performed in nnz-balanced block row parts, each part scatters into a private buffer 
+// that spans only the block column range touched by the part. Buffers are reduced row-wise.
+//
+template <uint_t BS, typename T_Int, typename T_Scalar>
+static void bsr_x_vec_tmpl(bool parallel, prop_t ptype, op_t opA, uint_t mb, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+	bool conjop = (mirror ? ptype == prop_t::Hermitian : opA == op_t::C);
+	bool gather = (mirror || opA == op_t::N);
+
+	int_t np = (parallel ? max_threads() : 1);
+	int_t nbr = static_cast<int_t>(mb);
+
+	if(!mirror && opA == op_t::N) {
+
+#pragma omp parallel num_threads(np)
+		{
+			BlockWork<BS,T_Scalar> w(bs);
+
+#pragma omp for schedule(dynamic, 64)
+			for(int_t I = 0; I < nbr; I++) {
+				gather_block_row<BS>(I, bs, alpha, rowptr, colidx, values, x, beta, y, w.data());
+			} // I
+		}
+
+		return;
+
+	} // gather only
+
+	const uint_t nbs = fixed_bs<BS>(bs);
+	T_Int nzb = rowptr[mb];
+
+	if(np == 1) {
+
+		//
+		// Single part, scatter directly to y after it is scaled
+		//
+		uint_t ny = (gather ? mb : nb) * nbs;
+		for(uint_t i = 0; i < ny; i++) {
+			y[i] = beta_scaled(beta, y[i]);
+		} // i
+
+		BlockWork<BS,T_Scalar> w(bs);
+
+		for(uint_t I = 0; I < mb; I++) {
+			if(gather) gather_block_row<BS>(I, bs, alpha, rowptr, colidx, values, x, T_Scalar(1), y, w.data());
+			scatter_block_row<BS>(mirror, conjop, I, bs, alpha, rowptr, colidx, values, x, y, w.data());
+		} // I
+
+		return;
+
+	} // np = 1
+
+	std::vector<uint_t> isplit(np + 1);
+	std::vector<T_Int> blo(np, 0);
+	std::vector<T_Int> bhi(np, 0);
+	std::vector<T_Scalar*> buf(np, nullptr);
+
+	for(int_t p = 0; p < np; p++) {
+		T_Int target = static_cast<T_Int>((static_cast<bulk_t>(nzb) * p) / np);
+		isplit[p] = std::lower_bound(rowptr, rowptr + mb + 1, target) - rowptr;
+	} // p
+	isplit[np] = mb;
+
+#pragma omp parallel for schedule(static, 1) num_threads(np)
+	for(int_t p = 0; p < np; p++) {
+
+		uint_t ibgn = isplit[p];
+		uint_t iend = std::max(ibgn, isplit[p+1]);
+
+		T_Int lo = static_cast<T_Int>(nb);
+		T_Int hi = 0;
+		for(T_Int jblk = rowptr[ibgn]; jblk < rowptr[iend]; jblk++) {
+			lo = std::min(lo, colidx[jblk]);
+			hi = std::max(hi, colidx[jblk] + 1);
+		} // jblk
+
+		T_Scalar *z = nullptr;
+		if(hi > lo) {
+			z = i_calloc<T_Scalar>((hi - lo) * nbs);
+		} // hi > lo
+
+		BlockWork<BS,T_Scalar> w(bs);
+
+		for(uint_t I = ibgn; I < iend; I++) {
+			//
+			// Each block row (& block column for square) is owned by exactly one part
+			//
+			if(gather) gather_block_row<BS>(I, bs, alpha, rowptr, colidx, values, x, beta, y, w.data());
+			scatter_block_row<BS>(mirror, conjop, I, bs, alpha, rowptr, colidx, values, x, z - lo * nbs, w.data());
+		} // I
+
+		blo[p] = lo;
+		bhi[p] = hi;
+		buf[p] = z;
+
+	} // p
+
+	int_t ny = static_cast<int_t>(nb * nbs);
+
+#pragma omp parallel for schedule(static) num_threads(np)
+	for(int_t i = 0; i < ny; i++) {
+
+		T_Scalar acc = 0;
+		T_Int ib = static_cast<T_Int>(i / nbs);
+
+		for(int_t p = 0; p < np; p++) {
+			if(blo[p] <= ib && ib < bhi[p]) acc += buf[p][i - blo[p] * nbs];
+		} // p
+
+		y[i] = (gather ? y[i] : beta_scaled(beta, y[i])) + acc;
+
+	} // i
+
+	for(int_t p = 0; p < np; p++) {
+		i_free(buf[p]);
+	} // p
+}
+/*-------------------------------------------------*/
+//
+// General op(A) = A: each block is loaded once & applied to all columns of the block row panel,
+// otherwise columns of B/C are processed in parallel if there are enough of them, 
+// else each column product is parallel
+//
+template <uint_t BS, typename T_Int, typename T_Scalar>
+static void bsr_x_gem_tmpl(prop_t ptype, op_t opA, uint_t mb, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+	bool parallel = use_parallel(mb, bs, rowptr);
+
+	int_t nt = max_threads();
+	int_t nk = static_cast<int_t>(k);
+
+	if(!mirror && opA == op_t::N) {
+
+		const uint_t nbs = fixed_bs<BS>(bs);
+		const uint_t nb2 = nbs * nbs;
+		int_t nbr = static_cast<int_t>(mb);
+
+#pragma omp parallel for schedule(dynamic, 16) if(parallel || (nt > 1 && static_cast<bulk_t>(rowptr[mb]) * nb2 * k >= parallel_min_nnz()))
+		for(int_t I = 0; I < nbr; I++) {
+
+			for(int_t l = 0; l < nk; l++) {
+				T_Scalar *cIl = dns::ptrmv(ldc, c, I * nbs, l);
+				for(uint_t r = 0; r < nbs; r++) {
+					cIl[r] = beta_scaled(beta, cIl[r]);
+				} // r
+			} // l
+
+			for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+				const T_Scalar *a = values + jblk * nb2;
+				uint_t J = colidx[jblk];
+				for(int_t l = 0; l < nk; l++) {
+					block_x_vec<BS>(bs, alpha, a, dns::ptrmv(ldb, b, J * nbs, l), dns::ptrmv(ldc, c, I * nbs, l));
+				} // l
+			} // jblk
+
+		} // I
+
+	} else if(nt > 1 && nk >= nt) {
+
+#pragma omp parallel for schedule(dynamic, 1)
+		for(int_t l = 0; l < nk; l++) {
+			bsr_x_vec_tmpl<BS>(false, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, dns::ptrmv(ldb,b,0,l), beta, dns::ptrmv(ldc,c,0,l));
+		} // l
+
+	} else {
+
+		for(int_t l = 0; l < nk; l++) {
+			bsr_x_vec_tmpl<BS>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, dns::ptrmv(ldb,b,0,l), beta, dns::ptrmv(ldc,c,0,l));
+		} // l
+
+	} // parallel
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void bsr_x_vec(prop_t ptype, op_t opA, uint_t mb, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool parallel = use_parallel(mb, bs, rowptr);
+
+	switch(bs) {
+		case 1: bsr_x_vec_tmpl<1>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y); break;
+		case 2: bsr_x_vec_tmpl<2>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y); break;
+		case 3: bsr_x_vec_tmpl<3>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y); break;
+		case 4: bsr_x_vec_tmpl<4>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y); break;
+		case 6: bsr_x_vec_tmpl<6>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y); break;
+		default: bsr_x_vec_tmpl<0>(parallel, ptype, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y);
+	} // bs
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void bsr_x_gem(prop_t ptype, op_t opA, uint_t mb, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	switch(bs) {
+		case 1: bsr_x_gem_tmpl<1>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc); break;
+		case 2: bsr_x_gem_tmpl<2>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc); break;
+		case 3: bsr_x_gem_tmpl<3>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc); break;
+		case 4: bsr_x_gem_tmpl<4>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc); break;
+		case 6: bsr_x_gem_tmpl<6>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc); break;
+		default: bsr_x_gem_tmpl<0>(ptype, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc);
+	} // bs
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::string print_to_string(uint_t mb, uint_t bs, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd)
+{
+	if(!mb) return "";
+
+#define BUFFER_LEN 1024
+
+	std::string ret;
+	ret.reserve(rowptr[mb] * bs * bs * 128);
+	char cbuff[BUFFER_LEN];
+
+	std::snprintf(cbuff, BUFFER_LEN, "     #blk        row     column  value          \n"); ret.append(cbuff);
+	std::snprintf(cbuff, BUFFER_LEN, "-------------------------------------------------\n"); ret.append(cbuff);
+
+	for(uint_t I = 0; I < mb; I++) {
+
+		for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+
+			const T_Scalar *a = values + jblk * bs * bs;
+
+			for(uint_t r = 0; r < bs; r++) {
+				for(uint_t s = 0; s < bs; s++) {
+					val2char(cbuff, BUFFER_LEN,  10, jblk                  ); ret.append(cbuff); ret.append(" ");
+					val2char(cbuff, BUFFER_LEN,  10, I * bs + r            ); ret.append(cbuff); ret.append(" ");
+					val2char(cbuff, BUFFER_LEN,  10, colidx[jblk] * bs + s ); ret.append(cbuff); ret.append(" ");
+					val2char(cbuff, BUFFER_LEN, nsd, a[r + s * bs]         ); ret.append(cbuff); ret.append("\n");
+				} // s
+			} // r
+
+		} // jblk
+
+	} // I
+
+	return ret;
+
+#undef BUFFER_LEN
+}
+/*-------------------------------------------------*/
+#define instantiate_print_to_string(T_Int, T_Scl) \
+template std::string print_to_string(uint_t, uint_t, const T_Int*, const T_Int*, const T_Scl*, uint_t)
+instantiate_print_to_string(int_t, real_t);
+instantiate_print_to_string(int_t, real4_t);
+instantiate_print_to_string(int_t, complex_t);
+instantiate_print_to_string(int_t, complex8_t);
+#undef instantiate_print_to_string
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void gem_x_vec(op_t opA, uint_t mb, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bsr_x_vec(prop_t::General, opA, mb, nb, bs, alpha, rowptr, colidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_vec(T_Int, T_Scl) \
+template void gem_x_vec(op_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, T_Scl, T_Scl*)
+instantiate_gem_x_vec(int_t, real_t);
+instantiate_gem_x_vec(int_t, real4_t);
+instantiate_gem_x_vec(int_t, complex_t);
+instantiate_gem_x_vec(int_t, complex8_t);
+#undef instantiate_gem_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void sym_x_vec(uplo_t, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bsr_x_vec(prop_t::Symmetric, op_t::N, nb, nb, bs, alpha, rowptr, colidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_sym_x_vec(T_Int, T_Scl) \
+template void sym_x_vec(uplo_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, T_Scl, T_Scl*)
+instantiate_sym_x_vec(int_t, real_t);
+instantiate_sym_x_vec(int_t, real4_t);
+instantiate_sym_x_vec(int_t, complex_t);
+instantiate_sym_x_vec(int_t, complex8_t);
+#undef instantiate_sym_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void hem_x_vec(uplo_t, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bsr_x_vec(prop_t::Hermitian, op_t::N, nb, nb, bs, alpha, rowptr, colidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_hem_x_vec(T_Int, T_Scl) \
+template void hem_x_vec(uplo_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, T_Scl, T_Scl*)
+instantiate_hem_x_vec(int_t, real_t);
+instantiate_hem_x_vec(int_t, real4_t);
+instantiate_hem_x_vec(int_t, complex_t);
+instantiate_hem_x_vec(int_t, complex8_t);
+#undef instantiate_hem_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void gem_x_gem(op_t opA, uint_t mb, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	bsr_x_gem(prop_t::General, opA, mb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_gem(T_Int, T_Scl) \
+template void gem_x_gem(op_t, uint_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_gem_x_gem(int_t, real_t);
+instantiate_gem_x_gem(int_t, real4_t);
+instantiate_gem_x_gem(int_t, complex_t);
+instantiate_gem_x_gem(int_t, complex8_t);
+#undef instantiate_gem_x_gem
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void sym_x_gem(uplo_t, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	bsr_x_gem(prop_t::Symmetric, op_t::N, nb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_sym_x_gem(T_Int, T_Scl) \
+template void sym_x_gem(uplo_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_sym_x_gem(int_t, real_t);
+instantiate_sym_x_gem(int_t, real4_t);
+instantiate_sym_x_gem(int_t, complex_t);
+instantiate_sym_x_gem(int_t, complex8_t);
+#undef instantiate_sym_x_gem
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void hem_x_gem(uplo_t, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	bsr_x_gem(prop_t::Hermitian, op_t::N, nb, nb, bs, k, alpha, rowptr, colidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_hem_x_gem(T_Int, T_Scl) \
+template void hem_x_gem(uplo_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_hem_x_gem(int_t, real_t);
+instantiate_hem_x_gem(int_t, real4_t);
+instantiate_hem_x_gem(int_t, complex_t);
+instantiate_hem_x_gem(int_t, complex8_t);
+#undef instantiate_hem_x_gem
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Int>
+void csr2bsr_rowptr(uint_t m, uint_t n, uint_t bs, const T_Int *rowptr, const T_Int *colidx, T_Int *rowptr_out)
+{
+	int_t mb = static_cast<int_t>(m / bs);
+	uint_t nb = n / bs;
+
+	rowptr_out[0] = 0;
+
+#pragma omp parallel if(static_cast<bulk_t>(rowptr[m]) >= parallel_min_nnz())
+	{
+		std::vector<T_Int> marker(nb, -1);
+
+#pragma omp for schedule(dynamic, 64)
+		for(int_t I = 0; I < mb; I++) {
+
+			T_Int cnt = 0;
+
+			for(uint_t i = I * bs; i < (I + 1) * bs; i++) {
+				for(T_Int jcol = rowptr[i]; jcol < rowptr[i+1]; jcol++) {
+					T_Int J = colidx[jcol] / bs;
+					if(marker[J] != I) {
+						marker[J] = I;
+						cnt++;
+					} // new block
+				} // jcol
+			} // i
+
+			rowptr_out[I+1] = cnt;
+
+		} // I
+	}
+
+	bulk::csc::roll(mb, rowptr_out);
+}
+/*-------------------------------------------------*/
+template void csr2bsr_rowptr(uint_t, uint_t, uint_t, const int_t*, const int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void csr2bsr(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, uint_t bs, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowptr_out, T_Int *colidx_out, T_Scalar *values_out)
+{
+	int_t mb = static_cast<int_t>(m / bs);
+	uint_t nb = n / bs;
+	uint_t bs2 = bs * bs;
+
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+	bool conjop = (ptype == prop_t::Hermitian);
+
+#pragma omp parallel if(static_cast<bulk_t>(rowptr[m]) >= parallel_min_nnz())
+	{
+		std::vector<T_Int> pos(nb, -1);
+
+#pragma omp for schedule(dynamic, 64)
+		for(int_t I = 0; I < mb; I++) {
+
+			T_Int *cidx = colidx_out + rowptr_out[I];
+			T_Int cnt = 0;
+
+			for(uint_t i = I * bs; i < (I + 1) * bs; i++) {
+				for(T_Int jcol = rowptr[i]; jcol < rowptr[i+1]; jcol++) {
+					T_Int J = colidx[jcol] / bs;
+					if(pos[J] < 0) {
+						pos[J] = 0;
+						cidx[cnt++] = J;
+					} // new block
+				} // jcol
+			} // i
+
+			std::sort(cidx, cidx + cnt);
+
+			for(T_Int k = 0; k < cnt; k++) {
+				pos[cidx[k]] = rowptr_out[I] + k;
+			} // k
+
+			std::fill(values_out + rowptr_out[I] * bs2, values_out + rowptr_out[I+1] * bs2, T_Scalar(0));
+
+			for(uint_t i = I * bs; i < (I + 1) * bs; i++) {
+				for(T_Int jcol = rowptr[i]; jcol < rowptr[i+1]; jcol++) {
+					T_Int j = colidx[jcol];
+					values_out[pos[j / bs] * bs2 + (i % bs) + (j % bs) * bs] = values[jcol];
+				} // jcol
+			} // i
+
+			if(mirror && pos[I] >= 0) {
+				T_Scalar *a = values_out + pos[I] * bs2;
+				for(uint_t c = 0; c < bs; c++) {
+					for(uint_t r = c + 1; r < bs; r++) {
+						if(uplo == uplo_t::Lower) {
+							a[c + r * bs] = (conjop ? arith::conj(a[r + c * bs]) : a[r + c * bs]);
+						} else {
+							a[r + c * bs] = (conjop ? arith::conj(a[c + r * bs]) : a[c + r * bs]);
+						} // uplo
+					} // r
+				} // c
+			} // diagonal block
+
+			for(T_Int k = 0; k < cnt; k++) {
+				pos[cidx[k]] = -1;
+			} // k
+
+		} // I
+	}
+}
+/*-------------------------------------------------*/
+#define instantiate_csr2bsr(T_Int, T_Scl) \
+template void csr2bsr(prop_t, uplo_t, uint_t, uint_t, uint_t, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Int*, T_Int*, T_Scl*)
+instantiate_csr2bsr(int_t, real_t);
+instantiate_csr2bsr(int_t, real4_t);
+instantiate_csr2bsr(int_t, complex_t);
+instantiate_csr2bsr(int_t, complex8_t);
+#undef instantiate_csr2bsr
+/*-------------------------------------------------*/
+//
+// For Symmetric/Hermitian types, row r of a diagonal block keeps 
+// columns [0,r] (Lower) or [r,bs) (Upper)
+//
+inline uint_t diag_block_cbgn(uplo_t uplo, uint_t r)
+{
+	return (uplo == uplo_t::Lower ? 0 : r);
+}
+/*-------------------------------------------------*/
+inline uint_t diag_block_cend(uplo_t uplo, uint_t r, uint_t bs)
+{
+	return (uplo == uplo_t::Lower ? r + 1 : bs);
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+void bsr2csr_rowptr(prop_t ptype, uplo_t uplo, uint_t mb, uint_t bs, const T_Int *rowptr, const T_Int *colidx, T_Int *rowptr_out)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+
+	int_t nbr = static_cast<int_t>(mb);
+
+	rowptr_out[0] = 0;
+
+#pragma omp parallel for schedule(static) if(use_parallel(mb, bs, rowptr))
+	for(int_t I = 0; I < nbr; I++) {
+		for(uint_t r = 0; r < bs; r++) {
+
+			T_Int cnt = 0;
+
+			for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+				if(mirror && colidx[jblk] == I) {
+					cnt += diag_block_cend(uplo, r, bs) - diag_block_cbgn(uplo, r);
+				} else {
+					cnt += bs;
+				} // diagonal block
+			} // jblk
+
+			rowptr_out[I * bs + r + 1] = cnt;
+
+		} // r
+	} // I
+
+	bulk::csc::roll(mb * bs, rowptr_out);
+}
+/*-------------------------------------------------*/
+template void bsr2csr_rowptr(prop_t, uplo_t, uint_t, uint_t, const int_t*, const int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void bsr2csr(prop_t ptype, uplo_t uplo, uint_t mb, uint_t bs, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowptr_out, T_Int *colidx_out, T_Scalar *values_out)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+
+	int_t nbr = static_cast<int_t>(mb);
+	uint_t bs2 = bs * bs;
+
+#pragma omp parallel for schedule(static) if(use_parallel(mb, bs, rowptr))
+	for(int_t I = 0; I < nbr; I++) {
+		for(uint_t r = 0; r < bs; r++) {
+
+			T_Int cnt = rowptr_out[I * bs + r];
+
+			for(T_Int jblk = rowptr[I]; jblk < rowptr[I+1]; jblk++) {
+
+				T_Int J = colidx[jblk];
+				const T_Scalar *a = values + jblk * bs2;
+
+				bool diag = (mirror && J == I);
+				uint_t cbgn = (diag ? diag_block_cbgn(uplo, r) : 0);
+				uint_t cend = (diag ? diag_block_cend(uplo, r, bs) : bs);
+
+				for(uint_t c = cbgn; c < cend; c++) {
+					colidx_out[cnt] = J * bs + c;
+					values_out[cnt] = a[r + c * bs];
+					cnt++;
+				} // c
+
+			} // jblk
+
+		} // r
+	} // I
+}
+/*-------------------------------------------------*/
+#define instantiate_bsr2csr(T_Int, T_Scl) \
+template void bsr2csr(prop_t, uplo_t, uint_t, uint_t, \
+		const T_Int*, const T_Int*, const T_Scl*, const T_Int*, T_Int*, T_Scl*)
+instantiate_bsr2csr(int_t, real_t);
+instantiate_bsr2csr(int_t, real4_t);
+instantiate_bsr2csr(int_t, complex_t);
+instantiate_bsr2csr(int_t, complex8_t);
+#undef instantiate_bsr2csr
+/*-------------------------------------------------*/
+} // namespace bsr
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_BSR_HPP_
+#define CLA3P_BULK_BSR_HPP_
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace bsr {
+/*-------------------------------------------------*/
+
+//
+// Block sparse row arrays of a (mb*bs x nb*bs) matrix:
+//   rowptr (mb+1): the block row pointers
+//   colidx (nnzb): the block column indexes
+//   values (nnzb*bs*bs): the blocks, each one (bs x bs) in column-major order
+// Symmetric/Hermitian matrices store the uplo block triangle, diagonal blocks in full
+//
+
+template <typename T_Int, typename T_Scalar>
+std::string print_to_string(uint_t mb, uint_t bs, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd = 3);
+
+//
+// Update: dnsY = beta * dnsY + alpha * op(bsrA) * dnsX
+// A(mb*bs x nb*bs)
+//
+template <typename T_Int, typename T_Scalar>
+void gem_x_vec(op_t opA, uint_t mb, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * bsrA * dnsX
+// A(nb*bs x nb*bs), only the uplo block triangle of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void sym_x_vec(uplo_t uplo, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * bsrA * dnsX
+// A(nb*bs x nb*bs), only the uplo block triangle of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void hem_x_vec(uplo_t uplo, uint_t nb, uint_t bs, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsC = beta * dnsC + alpha * op(bsrA) * dnsB
+// A(mb*bs x nb*bs), C(op(A) rows x k)
+//
+template <typename T_Int, typename T_Scalar>
+void gem_x_gem(op_t opA, uint_t mb, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+//
+// Update: dnsC = beta * dnsC + alpha * bsrA * dnsB
+// A(nb*bs x nb*bs), C(nb*bs x k), only the uplo block triangle of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void sym_x_gem(uplo_t uplo, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+//
+// Update: dnsC = beta * dnsC + alpha * bsrA * dnsB
+// A(nb*bs x nb*bs), C(nb*bs x k), only the uplo block triangle of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void hem_x_gem(uplo_t uplo, uint_t nb, uint_t bs, uint_t k, T_Scalar alpha, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+//
+// Conversion csr(m x n) -> bsr(m/bs x n/bs blocks), m & n multiples of bs
+// First pass fills the block row pointers (mb+1), second pass fills the sorted block column indexes & the blocks
+// For Symmetric/Hermitian types the missing triangle of the diagonal blocks is mirrored
+//
+template <typename T_Int>
+void csr2bsr_rowptr(uint_t m, uint_t n, uint_t bs, const T_Int *rowptr, const T_Int *colidx, T_Int *rowptr_out);
+
+template <typename T_Int, typename T_Scalar>
+void csr2bsr(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, uint_t bs, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowptr_out, T_Int *colidx_out, T_Scalar *values_out);
+
+//
+// Conversion bsr(mb x nb blocks) -> csr(mb*bs x nb*bs)
+// All block entries are kept, for Symmetric/Hermitian types only the uplo part of the diagonal blocks
+//
+template <typename T_Int>
+void bsr2csr_rowptr(prop_t ptype, uplo_t uplo, uint_t mb, uint_t bs, const T_Int *rowptr, const T_Int *colidx, T_Int *rowptr_out);
+
+template <typename T_Int, typename T_Scalar>
+void bsr2csr(prop_t ptype, uplo_t uplo, uint_t mb, uint_t bs, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowptr_out, T_Int *colidx_out, T_Scalar *values_out);
+
+/*-------------------------------------------------*/
+} // namespace bsr
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_BSR_HPP_
@@ -0,0 +1,305 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/coo.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace coo {
+/*-------------------------------------------------*/
+static bulk_t parallel_min_nnz()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+//
+// Columns are bucketed in up to 1024 blocks, few enough for the scatter streams to stay cache/TLB resident, 
+// blocks are at most 65536 columns wide so that the in-block column of every triplet fits in 16 bits
+//
+static uint_t block_width(uint_t n)
+{
+	const uint_t max_blocks = 1024;
+	const uint_t max_width = 65536;
+
+	return std::min(max_width, std::max<uint_t>(1, (n + max_blocks - 1) / max_blocks));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+struct RowValuePair {
+	T_Int    i;
+	T_Scalar v;
+};
+/*-------------------------------------------------*/
+static bulk_t insertion_sort_max_len()
+{
+	return 32;
+}
+/*-------------------------------------------------*/
+template <typename T_Iterator, typename T_Compare>
+static void insertion_sort(T_Iterator first, T_Iterator last, T_Compare comp)
+{
+	if(first == last) return;
+
+	for(T_Iterator it = first + 1; it != last; ++it) {
+
+		auto val = *it;
+		T_Iterator pos = it;
+
+		for(; pos != first && comp(val, *(pos - 1)); --pos) {
+			*pos = *(pos - 1);
+		} // pos
+
+		*pos = val;
+
+	} // it
+}
+/*-------------------------------------------------*/
+//
+// Visits the triplets [kbgn, kend) of the concatenated buckets in insertion order
+//
+template <typename T_Int, typename T_Scalar, typename T_Func>
+static void for_each_triplet(uint_t nb, const bulk_t *boff, 
+		const T_Int *const *brow, const T_Int *const *bcol, const T_Scalar *const *bval, 
+		bulk_t kbgn, bulk_t kend, T_Func func)
+{
+	uint_t b = static_cast<uint_t>(std::upper_bound(boff, boff + nb + 1, kbgn) - boff) - 1;
+
+	for(bulk_t k = kbgn; k < kend; b++) {
+
+		bulk_t ibgn = k - boff[b];
+		bulk_t iend = std::min(kend, boff[b+1]) - boff[b];
+
+		for(bulk_t i = ibgn; i < iend; i++, k++) {
+			func(k, brow[b][i], bcol[b][i], bval[b][i]);
+		} // i
+
+	} // b
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void coo2csc(uint_t /*m*/, uint_t n, uint_t nb, const bulk_t *bsize, 
+		const T_Int *const *brow, const T_Int *const *bcol, const T_Scalar *const *bval, dup_t op, 
+		T_Int *colptr, T_Int **rowidx, T_Scalar **values)
+{
+	std::fill(colptr, colptr + n + 1, 0);
+
+	*rowidx = nullptr;
+	*values = nullptr;
+
+	std::vector<bulk_t> boff(nb + 1, 0);
+	for(uint_t b = 0; b < nb; b++) {
+		boff[b+1] = boff[b] + bsize[b];
+	} // b
+
+	bulk_t nz = boff[nb];
+
+	if(!n || !nz) return;
+
+	const uint_t bw = block_width(n);
+	const uint_t nblk = (n + bw - 1) / bw;
+
+	int_t np = (max_threads() > 1 && nz >= parallel_min_nnz() ? max_threads() : 1);
+
+	T_Int    *ri = static_cast<T_Int   *>(i_malloc(nz, sizeof(T_Int   )));
+	T_Scalar *vi = static_cast<T_Scalar*>(i_malloc(nz, sizeof(T_Scalar)));
+	uint16_t *ci = static_cast<uint16_t*>(i_malloc(nz, sizeof(uint16_t)));
+
+	std::vector<bulk_t> pcnt(static_cast<bulk_t>(np) * nblk, 0);
+	std::vector<bulk_t> blkptr(nblk + 1, 0);
+	std::vector<bulk_t> blklen(nblk, 0);
+
+	//
+	// Pass 1: every thread counts the triplets of its slice per column block
+	//
+	#pragma omp parallel for schedule(static, 1) num_threads(np)
+	for(int_t p = 0; p < np; p++) {
+
+		bulk_t kbgn = (nz * p) / np;
+		bulk_t kend = (nz * (p + 1)) / np;
+		bulk_t *cnt = pcnt.data() + static_cast<bulk_t>(p) * nblk;
+
+		for_each_triplet(nb, boff.data(), brow, bcol, bval, kbgn, kend, 
+				[&](bulk_t, T_Int, T_Int j, const T_Scalar&) { cnt[j / bw]++; });
+
+	} // p
+
+	bulk_t off = 0;
+	for(uint_t blk = 0; blk < nblk; blk++) {
+		blkptr[blk] = off;
+		for(int_t p = 0; p < np; p++) {
+			bulk_t c = pcnt[static_cast<bulk_t>(p) * nblk + blk];
+			pcnt[static_cast<bulk_t>(p) * nblk + blk] = off;
+			off += c;
+		} // p
+	} // blk
+	blkptr[nblk] = off;
+
+	//
+	// Pass 2: stable scatter of the triplets to their column block
+	//
+	#pragma omp parallel for schedule(static, 1) num_threads(np)
+	for(int_t p = 0; p < np; p++) {
+
+		bulk_t kbgn = (nz * p) / np;
+		bulk_t kend = (nz * (p + 1)) / np;
+		bulk_t *pos = pcnt.data() + static_cast<bulk_t>(p) * nblk;
+
+		for_each_triplet(nb, boff.data(), brow, bcol, bval, kbgn, kend, 
+				[&](bulk_t, T_Int i, T_Int j, const T_Scalar& v) 
+				{ 
+				bulk_t k = pos[j / bw]++;
+				ri[k] = i;
+				vi[k] = v;
+				ci[k] = static_cast<uint16_t>(j % bw);
+				});
+
+	} // p
+
+	std::vector<bulk_t>().swap(pcnt);
+
+	//
+	// Pass 3: per block, stable counting sort by column, row sort & duplicate merge, 
+	// merged entries are compacted to the start of the block range
+	//
+	#pragma omp parallel num_threads(np)
+	{
+		std::vector<bulk_t> ccnt(bw + 1);
+		std::vector<RowValuePair<T_Int,T_Scalar>> work;
+
+		#pragma omp for schedule(dynamic, 4)
+		for(int_t blk = 0; blk < static_cast<int_t>(nblk); blk++) {
+
+			bulk_t kbgn = blkptr[blk];
+			bulk_t kend = blkptr[blk+1];
+
+			uint_t jbgn = static_cast<uint_t>(blk) * bw;
+			uint_t jw = std::min(bw, n - jbgn);
+
+			if(kbgn == kend) continue;
+
+			std::fill(ccnt.begin(), ccnt.end(), 0);
+			for(bulk_t k = kbgn; k < kend; k++) {
+				ccnt[ci[k] + 1]++;
+			} // k
+
+			for(uint_t c = 0; c < jw; c++) {
+				ccnt[c+1] += ccnt[c];
+			} // c
+
+			work.resize(kend - kbgn);
+			for(bulk_t k = kbgn; k < kend; k++) {
+				bulk_t w = ccnt[ci[k]]++;
+				work[w].i = ri[k];
+				work[w].v = vi[k];
+			} // k
+
+			bulk_t kout = kbgn;
+			bulk_t wbgn = 0;
+
+			for(uint_t c = 0; c < jw; c++) {
+
+				bulk_t wend = ccnt[c];
+
+				auto first = work.begin() + wbgn;
+				auto last  = work.begin() + wend;
+				auto byrow = [](const RowValuePair<T_Int,T_Scalar>& a, const RowValuePair<T_Int,T_Scalar>& b) { return a.i < b.i; };
+
+				if(wend - wbgn <= insertion_sort_max_len()) {
+					insertion_sort(first, last, byrow);
+				} else if(!std::is_sorted(first, last, byrow)) {
+					std::stable_sort(first, last, byrow);
+				} // sort
+
+				bulk_t kcol = kout;
+
+				for(bulk_t w = wbgn; w < wend; w++) {
+					if(kout > kcol && ri[kout-1] == work[w].i) {
+						csc::apply_dup_op(vi[kout-1], work[w].v, op);
+					} else {
+						ri[kout] = work[w].i;
+						vi[kout] = work[w].v;
+						kout++;
+					} // dup check
+				} // w
+
+				colptr[jbgn + c + 1] = static_cast<T_Int>(kout - kcol);
+				wbgn = wend;
+
+			} // c
+
+			blklen[blk] = kout - kbgn;
+
+		} // blk
+	}
+
+	i_free(ci);
+
+	csc::roll(n, colptr);
+
+	//
+	// Blocks are moved left in order, destinations never overtake unread sources
+	//
+	for(uint_t blk = 0; blk < nblk; blk++) {
+
+		bulk_t src = blkptr[blk];
+		bulk_t dst = static_cast<bulk_t>(colptr[blk * bw]);
+
+		if(src != dst) {
+			std::copy(ri + src, ri + src + blklen[blk], ri + dst);
+			std::copy(vi + src, vi + src + blklen[blk], vi + dst);
+		} // move
+
+	} // blk
+
+	bulk_t nzout = static_cast<bulk_t>(colptr[n]);
+
+	if(nzout < nz) {
+		ri = static_cast<T_Int   *>(i_realloc(ri, nzout, sizeof(T_Int   )));
+		vi = static_cast<T_Scalar*>(i_realloc(vi, nzout, sizeof(T_Scalar)));
+	} // shrink
+
+	*rowidx = ri;
+	*values = vi;
+}
+/*-------------------------------------------------*/
+#define instantiate_coo2csc(T_Int, T_Scl) \
+template void coo2csc(uint_t, uint_t, uint_t, const bulk_t*, \
+		const T_Int *const *, const T_Int *const *, const T_Scl *const *, dup_t, \
+		T_Int*, T_Int**, T_Scl**)
+instantiate_coo2csc(int_t, real_t);
+instantiate_coo2csc(int_t, real4_t);
+instantiate_coo2csc(int_t, complex_t);
+instantiate_coo2csc(int_t, complex8_t);
+#undef instantiate_coo2csc
+/*-------------------------------------------------*/
+} // namespace coo
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_COO_HPP_
+#define CLA3P_BULK_COO_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace coo {
+/*-------------------------------------------------*/
+
+//
+// Conversion coo(m x n) -> csc
+// The triplets are given in nb buckets of struct-of-arrays storage (bucket b: bsize[b] entries in brow[b], bcol[b], bval[b]), 
+// bucket order followed by in-bucket order is the insertion order
+// Fills colptr (n+1) & allocates *rowidx, *values (colptr[n]), sorted rows, duplicates merged using op in insertion order
+//
+template <typename T_Int, typename T_Scalar>
+void coo2csc(uint_t m, uint_t n, uint_t nb, const bulk_t *bsize, 
+		const T_Int *const *brow, const T_Int *const *bcol, const T_Scalar *const *bval, dup_t op, 
+		T_Int *colptr, T_Int **rowidx, T_Scalar **values);
+
+/*-------------------------------------------------*/
+} // namespace coo
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_COO_HPP_
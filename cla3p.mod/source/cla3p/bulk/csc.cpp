@@ -313,10 +313,96 @@ static void transpose_colptr(uint_t m, uint_t n, const T_Int *colptr, const T_In
 	roll(m, colptr_out);
 }
 /*-------------------------------------------------*/
+static int transpose_num_parts(uint_t m, bulk_t nz)
+{
+	int np = max_threads();
+	return ((np > 1 && nz >= 65536 && m <= nz) ? np : 1);
+}
+/*-------------------------------------------------*/
+//
+// Columns are split in nnz-balanced parts, each part counts its entries per output column.
+// The per part counts are turned to write offsets, so each part fills its own slots in
+// column order and the output row indexes come out sorted, same as the serial version.
+//
+template <typename T_Int, typename T_Scalar>
+static void parallel_transpose_tmpl(int_t np, uint_t m, uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		T_Int *colptr_out, T_Int *rowidx_out, T_Scalar *values_out, T_Scalar coeff, bool conjop) 
+{
+	T_Int nz = colptr[n];
+
+	std::vector<uint_t> jsplit(np + 1);
+	std::vector<T_Int> offsets(static_cast<bulk_t>(np) * m, 0);
+
+	for(int_t p = 0; p < np; p++) {
+		T_Int target = static_cast<T_Int>((static_cast<bulk_t>(nz) * p) / np);
+		jsplit[p] = std::lower_bound(colptr, colptr + n + 1, target) - colptr;
+	} // p
+	jsplit[np] = n;
+
+#pragma omp parallel for schedule(static, 1)
+	for(int_t p = 0; p < np; p++) {
+		T_Int *cnt = offsets.data() + static_cast<bulk_t>(p) * m;
+		uint_t jend = std::max(jsplit[p], jsplit[p+1]);
+		for(T_Int irow = colptr[jsplit[p]]; irow < colptr[jend]; irow++) {
+			cnt[rowidx[irow]]++;
+		} // irow
+	} // p
+
+	int_t mr = static_cast<int_t>(m);
+
+#pragma omp parallel for schedule(static)
+	for(int_t i = 0; i < mr; i++) {
+		T_Int sum = 0;
+		for(int_t p = 0; p < np; p++) {
+			sum += offsets[static_cast<bulk_t>(p) * m + i];
+		} // p
+		colptr_out[i+1] = sum;
+	} // i
+
+	colptr_out[0] = 0;
+	roll(m, colptr_out);
+
+#pragma omp parallel for schedule(static)
+	for(int_t i = 0; i < mr; i++) {
+		T_Int off = colptr_out[i];
+		for(int_t p = 0; p < np; p++) {
+			T_Int& cnt = offsets[static_cast<bulk_t>(p) * m + i];
+			T_Int c = cnt;
+			cnt = off;
+			off += c;
+		} // p
+	} // i
+
+#pragma omp parallel for schedule(static, 1)
+	for(int_t p = 0; p < np; p++) {
+
+		T_Int *pos = offsets.data() + static_cast<bulk_t>(p) * m;
+		uint_t jend = std::max(jsplit[p], jsplit[p+1]);
+
+		for(uint_t j = jsplit[p]; j < jend; j++) {
+			for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+				T_Int    i = rowidx[irow];
+				T_Scalar v = values[irow];
+				rowidx_out[pos[i]] = j;
+				values_out[pos[i]] = coeff * (conjop ? arith::conj(v) : v);
+				pos[i]++;
+			} // irow
+		} // j
+
+	} // p
+}
+/*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
 static void hybrid_transpose_tmpl(uint_t m, uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
 		T_Int *colptr_out, T_Int *rowidx_out, T_Scalar *values_out, T_Scalar coeff, bool conjop) 
 {
+	int_t np = transpose_num_parts(m, colptr[n]);
+
+	if(np > 1) {
+		parallel_transpose_tmpl(np, m, n, colptr, rowidx, values, colptr_out, rowidx_out, values_out, coeff, conjop);
+		return;
+	} // parallel
+
 	transpose_colptr(m, n, colptr, rowidx, colptr_out);
 
 	for(uint_t j = 0; j < n; j++) {
@@ -489,15 +575,6 @@ template void he2ge(uplo_t, uint_t, const uint_t*, const uint_t*, const real4_t
 template void he2ge(uplo_t, uint_t, const uint_t*, const uint_t*, const complex_t *, uint_t*, uint_t*, complex_t *);
 template void he2ge(uplo_t, uint_t, const uint_t*, const uint_t*, const complex8_t*, uint_t*, uint_t*, complex8_t*);
 /*-------------------------------------------------*/
-template <typename T_Scalar>
-static inline void apply_op(T_Scalar& v, const T_Scalar& u, dup_t op)
-{
-	/**/ if(op == dup_t::Sum ) v += u;
-	else if(op == dup_t::Prod) v *= u;
-	else if(op == dup_t::Amax) v = std::max(std::abs(v), std::abs(u));
-	else if(op == dup_t::Amin) v = std::max(std::abs(v), std::abs(u));
-}
-/*-------------------------------------------------*/
 template <typename T_Int, typename T_Scalar>
 void remove_duplicates(uint_t n, T_Int *colptr, T_Int *rowidx, T_Scalar *values, dup_t op)
 {
@@ -523,7 +600,7 @@ void remove_duplicates(uint_t n, T_Int *colptr, T_Int *rowidx, T_Scalar *values,
 			T_Scalar v = values[irow];
 
 			if(i == iref) {
-				apply_op<T_Scalar>(values[colptr[j]-1], v, op);
+				apply_dup_op<T_Scalar>(values[colptr[j]-1], v, op);
 			} else {
 				rowidx[colptr[j]] = i;
 				values[colptr[j]] = v;
@@ -18,6 +18,8 @@
 #define CLA3P_BULK_CSC_HPP_
 
 #include <string>
+#include <algorithm>
+#include <cmath>
 
 #include "cla3p/types.hpp"
 
@@ -70,6 +72,18 @@ template <typename T_Int, typename T_Scalar>
 void he2ge(uplo_t uplo, uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
 		T_Int *colptr_out, T_Int *rowidx_out, T_Scalar *values_out);
 
+//
+// Merges the duplicate u into the entry v
+//
+template <typename T_Scalar>
+inline void apply_dup_op(T_Scalar& v, const T_Scalar& u, dup_t op)
+{
+	/**/ if(op == dup_t::Sum ) v += u;
+	else if(op == dup_t::Prod) v *= u;
+	else if(op == dup_t::Amax) v = std::max(std::abs(v), std::abs(u));
+	else if(op == dup_t::Amin) v = std::max(std::abs(v), std::abs(u));
+}
+
 template <typename T_Int, typename T_Scalar>
 void remove_duplicates(uint_t n, T_Int *colptr, T_Int *rowidx, T_Scalar *values, dup_t op);
 
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_ilu.hpp"
+
+// system
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <string>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ilu0(uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		std::vector<T_Int>& lcolptr, std::vector<T_Int>& lrowidx, std::vector<T_Scalar>& lvalues, 
+		std::vector<T_Int>& ucolptr, std::vector<T_Int>& urowidx, std::vector<T_Scalar>& uvalues)
+{
+	std::vector<T_Scalar> w(values, values + colptr[n]);
+	std::vector<T_Int> pos(n, -1);
+	std::vector<T_Int> dpos(n, -1);
+
+	//
+	// Left-looking (column) variant, the pattern of A is preserved
+	//
+	for(uint_t j = 0; j < n; j++) {
+
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			pos[rowidx[irow]] = irow;
+		} // irow
+
+		T_Int p = colptr[j];
+
+		for(; p < colptr[j+1] && rowidx[p] < static_cast<T_Int>(j); p++) {
+			T_Int k = rowidx[p];
+			T_Scalar ukj = w[p];
+			if(ukj == T_Scalar(0)) continue;
+			for(T_Int q = dpos[k] + 1; q < colptr[k+1]; q++) {
+				T_Int i = rowidx[q];
+				if(pos[i] >= 0) w[pos[i]] -= w[q] * ukj;
+			} // q
+		} // p
+
+		if(p == colptr[j+1] || rowidx[p] != static_cast<T_Int>(j)) {
+			throw err::InvalidOp("Missing diagonal element in column " + std::to_string(j));
+		} // diagonal
+
+		if(w[p] == T_Scalar(0)) {
+			throw err::InvalidOp("Zero pivot in column " + std::to_string(j));
+		} // pivot
+
+		dpos[j] = p;
+
+		for(T_Int q = p + 1; q < colptr[j+1]; q++) {
+			w[q] /= w[p];
+		} // q
+
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			pos[rowidx[irow]] = -1;
+		} // irow
+
+	} // j
+
+	lcolptr.assign(n + 1, 0);
+	ucolptr.assign(n + 1, 0);
+
+	for(uint_t j = 0; j < n; j++) {
+		lcolptr[j+1] = lcolptr[j] + (colptr[j+1] - dpos[j]);
+		ucolptr[j+1] = ucolptr[j] + (dpos[j] - colptr[j] + 1);
+	} // j
+
+	lrowidx.resize(lcolptr[n]);
+	lvalues.resize(lcolptr[n]);
+	urowidx.resize(ucolptr[n]);
+	uvalues.resize(ucolptr[n]);
+
+	for(uint_t j = 0; j < n; j++) {
+
+		T_Int kl = lcolptr[j];
+		lrowidx[kl] = j;
+		lvalues[kl] = 1;
+		std::copy(rowidx + dpos[j] + 1, rowidx + colptr[j+1], lrowidx.begin() + kl + 1);
+		std::copy(w.begin() + dpos[j] + 1, w.begin() + colptr[j+1], lvalues.begin() + kl + 1);
+
+		T_Int ku = ucolptr[j];
+		std::copy(rowidx + colptr[j], rowidx + dpos[j] + 1, urowidx.begin() + ku);
+		std::copy(w.begin() + colptr[j], w.begin() + dpos[j] + 1, uvalues.begin() + ku);
+
+	} // j
+}
+/*-------------------------------------------------*/
+#define instantiate_ilu0(T_Int, T_Scl) \
+template void ilu0(uint_t, const T_Int*, const T_Int*, const T_Scl*, \
+		std::vector<T_Int>&, std::vector<T_Int>&, std::vector<T_Scl>&, \
+		std::vector<T_Int>&, std::vector<T_Int>&, std::vector<T_Scl>&)
+instantiate_ilu0(int_t, real_t);
+instantiate_ilu0(int_t, real4_t);
+instantiate_ilu0(int_t, complex_t);
+instantiate_ilu0(int_t, complex8_t);
+#undef instantiate_ilu0
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void ilut_keep_largest(std::vector<T_Int>& idx, const std::vector<T_Scalar>& w, uint_t fill)
+{
+	if(idx.size() > fill) {
+		std::nth_element(idx.begin(), idx.begin() + fill, idx.end(), 
+				[&w](T_Int a, T_Int b) { return std::abs(w[a]) > std::abs(w[b]); });
+		idx.resize(fill);
+	} // drop smallest
+
+	std::sort(idx.begin(), idx.end());
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ilut(uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		typename TypeTraits<T_Scalar>::real_type droptol, uint_t fill, 
+		std::vector<T_Int>& lcolptr, std::vector<T_Int>& lrowidx, std::vector<T_Scalar>& lvalues, 
+		std::vector<T_Int>& ucolptr, std::vector<T_Int>& urowidx, std::vector<T_Scalar>& uvalues)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	std::vector<T_Scalar> w(n, T_Scalar(0));
+	std::vector<char> mark(n, 0);
+	std::vector<T_Int> nzlist;
+	std::vector<T_Int> lkeep;
+	std::vector<T_Int> ukeep;
+	std::priority_queue<T_Int, std::vector<T_Int>, std::greater<T_Int>> upper;
+
+	lcolptr.assign(1, 0);
+	ucolptr.assign(1, 0);
+	lrowidx.clear();
+	lvalues.clear();
+	urowidx.clear();
+	uvalues.clear();
+
+	//
+	// Left-looking (column) variant
+	// Column j of U is eliminated in ascending row order using the already computed columns of L
+	//
+	for(uint_t j = 0; j < n; j++) {
+
+		T_Int jj = static_cast<T_Int>(j);
+		T_RScalar tnorm = 0;
+
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			T_Int i = rowidx[irow];
+			w[i] = values[irow];
+			mark[i] = 1;
+			nzlist.push_back(i);
+			if(i < jj) upper.push(i);
+			tnorm += std::norm(values[irow]);
+		} // irow
+
+		tnorm = std::sqrt(tnorm);
+		T_RScalar tau = droptol * tnorm;
+
+		if(!mark[j]) {
+			w[j] = 0;
+			mark[j] = 1;
+			nzlist.push_back(jj);
+		} // diagonal
+
+		while(!upper.empty()) {
+
+			T_Int k = upper.top();
+			upper.pop();
+
+			T_Scalar wk = w[k];
+
+			if(std::abs(wk) <= tau) {
+				w[k] = 0;
+				continue;
+			} // drop
+
+			for(T_Int q = lcolptr[k] + 1; q < lcolptr[k+1]; q++) {
+				T_Int i = lrowidx[q];
+				if(!mark[i]) {
+					w[i] = 0;
+					mark[i] = 1;
+					nzlist.push_back(i);
+					if(i < jj) upper.push(i);
+				} // fill-in
+				w[i] -= lvalues[q] * wk;
+			} // q
+
+		} // upper
+
+		for(T_Int i : nzlist) {
+			if(i == jj || std::abs(w[i]) <= tau) continue;
+			if(i < jj) ukeep.push_back(i);
+			else       lkeep.push_back(i);
+		} // i
+
+		ilut_keep_largest(ukeep, w, fill);
+		ilut_keep_largest(lkeep, w, fill);
+
+		T_Scalar d = w[j];
+		if(d == T_Scalar(0)) {
+			d = (T_RScalar(1.e-4) + droptol) * tnorm;
+			if(d == T_Scalar(0)) d = 1;
+		} // zero pivot
+
+		for(T_Int i : ukeep) {
+			urowidx.push_back(i);
+			uvalues.push_back(w[i]);
+		} // i
+		urowidx.push_back(jj);
+		uvalues.push_back(d);
+		ucolptr.push_back(urowidx.size());
+
+		lrowidx.push_back(jj);
+		lvalues.push_back(1);
+		for(T_Int i : lkeep) {
+			lrowidx.push_back(i);
+			lvalues.push_back(w[i] / d);
+		} // i
+		lcolptr.push_back(lrowidx.size());
+
+		for(T_Int i : nzlist) {
+			w[i] = 0;
+			mark[i] = 0;
+		} // i
+
+		nzlist.clear();
+		ukeep.clear();
+		lkeep.clear();
+
+	} // j
+}
+/*-------------------------------------------------*/
+#define instantiate_ilut(T_Int, T_Scl) \
+template void ilut(uint_t, const T_Int*, const T_Int*, const T_Scl*, \
+		typename TypeTraits<T_Scl>::real_type, uint_t, \
+		std::vector<T_Int>&, std::vector<T_Int>&, std::vector<T_Scl>&, \
+		std::vector<T_Int>&, std::vector<T_Int>&, std::vector<T_Scl>&)
+instantiate_ilut(int_t, real_t);
+instantiate_ilut(int_t, real4_t);
+instantiate_ilut(int_t, complex_t);
+instantiate_ilut(int_t, complex8_t);
+#undef instantiate_ilut
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void ic0(uint_t n, const T_Int *colptr, const T_Int *rowidx, T_Scalar *values)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	//
+	// Right-looking variant, updates of column j are located with a merge walk on the sorted row indexes
+	//
+	for(uint_t k = 0; k < n; k++) {
+
+		T_Int dk = colptr[k];
+
+		if(dk == colptr[k+1] || rowidx[dk] != static_cast<T_Int>(k)) {
+			throw err::InvalidOp("Missing diagonal element in column " + std::to_string(k));
+		} // diagonal
+
+		T_RScalar d = arith::getRe(values[dk]);
+
+		if(d <= T_RScalar(0)) {
+			throw err::InvalidOp("Non-positive pivot in column " + std::to_string(k));
+		} // pivot
+
+		d = std::sqrt(d);
+		values[dk] = d;
+
+		for(T_Int q = dk + 1; q < colptr[k+1]; q++) {
+			values[q] /= d;
+		} // q
+
+		for(T_Int q = dk + 1; q < colptr[k+1]; q++) {
+
+			T_Int j = rowidx[q];
+			T_Scalar ljk = arith::conj(values[q]);
+
+			T_Int t = colptr[j];
+			T_Int tend = colptr[j+1];
+
+			for(T_Int r = q; r < colptr[k+1]; r++) {
+				T_Int i = rowidx[r];
+				while(t < tend && rowidx[t] < i) t++;
+				if(t == tend) break;
+				if(rowidx[t] == i) values[t] -= values[r] * ljk;
+			} // r
+
+		} // q
+
+	} // k
+}
+/*-------------------------------------------------*/
+template void ic0(uint_t, const int_t*, const int_t*, real_t    *);
+template void ic0(uint_t, const int_t*, const int_t*, real4_t   *);
+template void ic0(uint_t, const int_t*, const int_t*, complex_t *);
+template void ic0(uint_t, const int_t*, const int_t*, complex8_t*);
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
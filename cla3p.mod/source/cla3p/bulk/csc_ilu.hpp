@@ -0,0 +1,68 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_ILU_HPP_
+#define CLA3P_BULK_CSC_ILU_HPP_
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Incomplete factorizations, input csc matrices must have sorted row indexes
+// L factors are stored with an explicit (first) unit diagonal, U factors with the diagonal last
+//
+
+//
+// Incomplete LU with zero fill-in: A ~ L * U
+// A(n x n) general
+//
+template <typename T_Int, typename T_Scalar>
+void ilu0(uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		std::vector<T_Int>& lcolptr, std::vector<T_Int>& lrowidx, std::vector<T_Scalar>& lvalues, 
+		std::vector<T_Int>& ucolptr, std::vector<T_Int>& urowidx, std::vector<T_Scalar>& uvalues);
+
+//
+// Incomplete LU with threshold dropping: A ~ L * U
+// Entries below droptol * ||A(:,j)|| are dropped, at most fill entries are kept in each column of L & U
+// A(n x n) general
+//
+template <typename T_Int, typename T_Scalar>
+void ilut(uint_t n, const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		typename TypeTraits<T_Scalar>::real_type droptol, uint_t fill, 
+		std::vector<T_Int>& lcolptr, std::vector<T_Int>& lrowidx, std::vector<T_Scalar>& lvalues, 
+		std::vector<T_Int>& ucolptr, std::vector<T_Int>& urowidx, std::vector<T_Scalar>& uvalues);
+
+//
+// Incomplete Cholesky with zero fill-in (in-place): A ~ L * L^H
+// A(n x n) lower part of a symmetric/hermitian matrix, overwritten by L
+//
+template <typename T_Int, typename T_Scalar>
+void ic0(uint_t n, const T_Int *colptr, const T_Int *rowidx, T_Scalar *values);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_ILU_HPP_
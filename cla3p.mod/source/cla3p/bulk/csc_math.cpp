@@ -22,6 +22,8 @@
 // 3rd
 
 // cla3p
+#include "cla3p/bulk/csc_native.hpp"
+#include "cla3p/support/settings.hpp"
 #include "cla3p/proxies/mkl_sparse_proxy.hpp"
 
 /*-------------------------------------------------*/
@@ -55,16 +57,23 @@ instantiate_add(complex8_t);
 template <typename T_Scalar>
 void gem_x_vec(op_t opA, uint_t m, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle)
 {
 	Property pr = Property(prop_t::General, uplo_t::Full);
-	mkl::csc_mv(pr.type(), pr.uplo(), m, n, alpha, opA, colptr, rowidx, values, x, beta, y);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_gem_x_vec(opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+	} else if(handle) {
+		handle->mv(pr.type(), pr.uplo(), m, n, alpha, opA, colptr, rowidx, values, x, beta, y);
+	} else {
+		mkl::csc_mv(pr.type(), pr.uplo(), m, n, alpha, opA, colptr, rowidx, values, x, beta, y);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_gem_x_vec(T_Scl) \
 template void gem_x_vec(op_t, uint_t, uint_t, T_Scl, \
 		const int_t*, const int_t*, const T_Scl*, \
-		const T_Scl*, T_Scl, T_Scl*)
+		const T_Scl*, T_Scl, T_Scl*, mkl::CscHandle<T_Scl>*)
 instantiate_gem_x_vec(real_t);
 instantiate_gem_x_vec(real4_t);
 instantiate_gem_x_vec(complex_t);
@@ -74,16 +83,23 @@ instantiate_gem_x_vec(complex8_t);
 template <typename T_Scalar>
 void sym_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle)
 {
 	Property pr = Property(prop_t::Symmetric, uplo);
-	mkl::csc_mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_sym_x_vec(uplo, n, alpha, colptr, rowidx, values, x, beta, y);
+	} else if(handle) {
+		handle->mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+	} else {
+		mkl::csc_mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_sym_x_vec(T_Scl) \
 template void sym_x_vec(uplo_t, uint_t, T_Scl, \
 		const int_t*, const int_t*, const T_Scl*, \
-		const T_Scl*, T_Scl, T_Scl*)
+		const T_Scl*, T_Scl, T_Scl*, mkl::CscHandle<T_Scl>*)
 instantiate_sym_x_vec(real_t);
 instantiate_sym_x_vec(real4_t);
 instantiate_sym_x_vec(complex_t);
@@ -93,16 +109,23 @@ instantiate_sym_x_vec(complex8_t);
 template <typename T_Scalar>
 void hem_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle)
 {
 	Property pr = sanitizeProperty<T_Scalar>(Property(prop_t::Hermitian, uplo));
-	mkl::csc_mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_hem_x_vec(uplo, n, alpha, colptr, rowidx, values, x, beta, y);
+	} else if(handle) {
+		handle->mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+	} else {
+		mkl::csc_mv(pr.type(), pr.uplo(), n, n, alpha, op_t::N, colptr, rowidx, values, x, beta, y);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_hem_x_vec(T_Scl) \
 template void hem_x_vec(uplo_t, uint_t, T_Scl, \
 		const int_t*, const int_t*, const T_Scl*, \
-		const T_Scl*, T_Scl, T_Scl*)
+		const T_Scl*, T_Scl, T_Scl*, mkl::CscHandle<T_Scl>*)
 instantiate_hem_x_vec(real_t);
 instantiate_hem_x_vec(real4_t);
 instantiate_hem_x_vec(complex_t);
@@ -112,18 +135,25 @@ instantiate_hem_x_vec(complex8_t);
 template <typename T_Scalar>
 void gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t k, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle)
 {
 	uint_t mA = (opA == op_t::N ? m : k);
 	uint_t nA = (opA == op_t::N ? k : m);
 	Property pr = Property(prop_t::General, uplo_t::Full);
-	mkl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_gem_x_gem(opA, m, n, k, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+	} else if(handle) {
+		handle->mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} else {
+		mkl::csc_mm(pr.type(), pr.uplo(), mA, nA, alpha, opA, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_gem_x_gem(T_Scl) \
 template void gem_x_gem(op_t, uint_t, uint_t, uint_t, T_Scl, \
 		const int_t*, const int_t*, const T_Scl*, \
-		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t )
+		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t, mkl::CscHandle<T_Scl>*)
 instantiate_gem_x_gem(real_t);
 instantiate_gem_x_gem(real4_t);
 instantiate_gem_x_gem(complex_t);
@@ -133,16 +163,23 @@ instantiate_gem_x_gem(complex8_t);
 template <typename T_Scalar>
 void sym_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle)
 {
 	Property pr = Property(prop_t::Symmetric, uplo);
-	mkl::csc_mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_sym_x_gem(uplo, m, n, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+	} else if(handle) {
+		handle->mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} else {
+		mkl::csc_mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_sym_x_gem(T_Scl) \
 	template void sym_x_gem(uplo_t, uint_t, uint_t, T_Scl, \
 			const int_t*, const int_t*, const T_Scl*, \
-			const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+			const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t, mkl::CscHandle<T_Scl>*)
 instantiate_sym_x_gem(real_t);
 instantiate_sym_x_gem(real4_t);
 instantiate_sym_x_gem(complex_t);
@@ -152,16 +189,23 @@ instantiate_sym_x_gem(complex8_t);
 template <typename T_Scalar>
 void hem_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values,
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle)
 {
 	Property pr = sanitizeProperty<T_Scalar>(Property(prop_t::Hermitian, uplo));
-	mkl::csc_mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+
+	if(sparseKernel() == kernel_t::Native) {
+		native_hem_x_gem(uplo, m, n, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+	} else if(handle) {
+		handle->mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} else {
+		mkl::csc_mm(pr.type(), pr.uplo(), m, m, alpha, op_t::N, colptr, rowidx, values, n, b, ldb, beta, c, ldc);
+	} // kernel
 }
 /*-------------------------------------------------*/
 #define instantiate_hem_x_gem(T_Scl) \
 template void hem_x_gem(uplo_t, uint_t, uint_t, T_Scl, \
 		const int_t*, const int_t*, const T_Scl*, \
-		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t, mkl::CscHandle<T_Scl>*)
 instantiate_hem_x_gem(real_t);
 instantiate_hem_x_gem(real4_t);
 instantiate_hem_x_gem(complex_t);
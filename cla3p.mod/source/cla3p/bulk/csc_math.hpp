@@ -21,6 +21,9 @@
 
 /*-------------------------------------------------*/
 namespace cla3p {
+/*-------------------------------------------------*/
+namespace mkl { template <typename T_Scalar> class CscHandle; }
+/*-------------------------------------------------*/
 namespace bulk {
 namespace csc {
 /*-------------------------------------------------*/
@@ -38,11 +41,12 @@ void add(uint_t m, uint_t n, T_Scalar alpha,
 //
 // Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
 // A(m x n)
+// If handle is not null, it is (lazily) initialized with cscA & reused
 //
 template <typename T_Scalar>
 void gem_x_vec(op_t opA, uint_t m, uint_t n, T_Scalar alpha, 
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsY = beta * dnsY + alpha * cscA * dnsX
@@ -51,7 +55,7 @@ void gem_x_vec(op_t opA, uint_t m, uint_t n, T_Scalar alpha,
 template <typename T_Scalar>
 void sym_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, 
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsY = beta * dnsY + alpha * cscA * dnsX
@@ -60,7 +64,7 @@ void sym_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha,
 template <typename T_Scalar>
 void hem_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, 
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsC = beta * dnsC + alpha * opA(cscA) * dnsB
@@ -69,7 +73,7 @@ void hem_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha,
 template <typename T_Scalar>
 void gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t k, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsC = beta * dnsC + alpha * cscA * dnsB
@@ -78,7 +82,7 @@ void gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t k, T_Scalar alpha,
 template <typename T_Scalar>
 void sym_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsC = beta * dnsC + alpha * cscA * dnsB
@@ -87,7 +91,7 @@ void sym_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
 template <typename T_Scalar>
 void hem_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
 		const int_t *colptr, const int_t *rowidx, const T_Scalar *values, 
-		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc, mkl::CscHandle<T_Scalar> *handle = nullptr);
 
 //
 // Update: dnsC = beta * dnsC + alpha * pA(cscA) * opB(cscB)
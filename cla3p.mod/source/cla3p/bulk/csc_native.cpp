@@ -0,0 +1,367 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_native.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+static uint_t parallel_min_nnz()
+{
+	return 16384;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+inline T_Scalar column_dot(bool conjop, uint_t j, 
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, const T_Scalar *x)
+{
+	T_Scalar ret = 0;
+
+	for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+		ret += opval(conjop, values[irow]) * x[rowidx[irow]];
+	} // irow
+
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// General op(A) = A: scatter
+// General op(A) = A^T/A^H: gather
+// Symmetric/Hermitian (mirror): scatter the stored part & gather its (conjugate) transpose
+//
+template <typename T_Int, typename T_Scalar>
+static void serial_x_vec(prop_t ptype, op_t opA, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+	bool conjop = (mirror ? ptype == prop_t::Hermitian : opA == op_t::C);
+
+	if(!mirror && opA != op_t::N) {
+
+		for(uint_t j = 0; j < n; j++) {
+			y[j] = beta_scaled(beta, y[j]) + alpha * column_dot(conjop, j, colptr, rowidx, values, x);
+		} // j
+
+		return;
+
+	} // gather
+
+	for(uint_t i = 0; i < m; i++) {
+		y[i] = beta_scaled(beta, y[i]);
+	} // i
+
+	for(uint_t j = 0; j < n; j++) {
+
+		T_Scalar axj = alpha * x[j];
+		T_Scalar acc = 0;
+
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			T_Int i = rowidx[irow];
+			y[i] += values[irow] * axj;
+			if(mirror && i != static_cast<T_Int>(j)) acc += opval(conjop, values[irow]) * x[i];
+		} // irow
+
+		if(mirror) y[j] += alpha * acc;
+
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void parallel_gather_x_vec(bool conjop, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	int_t nc = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(dynamic, 256)
+	for(int_t j = 0; j < nc; j++) {
+		y[j] = beta_scaled(beta, y[j]) + alpha * column_dot(conjop, j, colptr, rowidx, values, x);
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// Columns are split in nnz-balanced parts, each part scatters into a private buffer
+// that spans only the row range touched by the part. Buffers are reduced row-wise.
+//
+template <typename T_Int, typename T_Scalar>
+static void parallel_scatter_x_vec(bool mirror, bool conjop, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	int_t np = max_threads();
+	T_Int nz = colptr[n];
+
+	std::vector<uint_t> jsplit(np + 1);
+	std::vector<T_Int> rlo(np, 0);
+	std::vector<T_Int> rhi(np, 0);
+	std::vector<T_Scalar*> buf(np, nullptr);
+
+	for(int_t p = 0; p < np; p++) {
+		T_Int target = static_cast<T_Int>((static_cast<bulk_t>(nz) * p) / np);
+		jsplit[p] = std::lower_bound(colptr, colptr + n + 1, target) - colptr;
+	} // p
+	jsplit[np] = n;
+
+#pragma omp parallel for schedule(static, 1)
+	for(int_t p = 0; p < np; p++) {
+
+		uint_t jbgn = jsplit[p];
+		uint_t jend = std::max(jbgn, jsplit[p+1]);
+
+		T_Int lo = static_cast<T_Int>(m);
+		T_Int hi = 0;
+		for(T_Int irow = colptr[jbgn]; irow < colptr[jend]; irow++) {
+			lo = std::min(lo, rowidx[irow]);
+			hi = std::max(hi, rowidx[irow] + 1);
+		} // irow
+
+		T_Scalar *w = nullptr;
+		if(hi > lo) {
+			w = i_calloc<T_Scalar>(hi - lo);
+		} // hi > lo
+
+		for(uint_t j = jbgn; j < jend; j++) {
+
+			T_Scalar axj = alpha * x[j];
+			T_Scalar acc = 0;
+
+			for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+				T_Int i = rowidx[irow];
+				w[i - lo] += values[irow] * axj;
+				if(mirror && i != static_cast<T_Int>(j)) acc += opval(conjop, values[irow]) * x[i];
+			} // irow
+
+			//
+			// Each column (& row for square) is owned by exactly one part
+			//
+			if(mirror) y[j] = beta_scaled(beta, y[j]) + alpha * acc;
+
+		} // j
+
+		rlo[p] = lo;
+		rhi[p] = hi;
+		buf[p] = w;
+
+	} // p
+
+	int_t mr = static_cast<int_t>(m);
+
+#pragma omp parallel for schedule(static)
+	for(int_t i = 0; i < mr; i++) {
+
+		T_Scalar acc = 0;
+		T_Int ii = static_cast<T_Int>(i);
+
+		for(int_t p = 0; p < np; p++) {
+			if(rlo[p] <= ii && ii < rhi[p]) acc += buf[p][ii - rlo[p]];
+		} // p
+
+		y[i] = (mirror ? y[i] : beta_scaled(beta, y[i])) + acc;
+
+	} // i
+
+	for(int_t p = 0; p < np; p++) {
+		i_free(buf[p]);
+	} // p
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void parallel_x_vec(prop_t ptype, op_t opA, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	bool mirror = (ptype == prop_t::Symmetric || ptype == prop_t::Hermitian);
+	bool conjop = (mirror ? ptype == prop_t::Hermitian : opA == op_t::C);
+
+	if(!mirror && opA != op_t::N) {
+		parallel_gather_x_vec(conjop, n, alpha, colptr, rowidx, values, x, beta, y);
+	} else {
+		parallel_scatter_x_vec(mirror, conjop, m, n, alpha, colptr, rowidx, values, x, beta, y);
+	} // op
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static void csc_x_vec(prop_t ptype, op_t opA, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	if(max_threads() > 1 && static_cast<uint_t>(colptr[n]) >= parallel_min_nnz()) {
+		parallel_x_vec(ptype, opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+	} else {
+		serial_x_vec(ptype, opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+	} // parallel
+}
+/*-------------------------------------------------*/
+//
+// A(mA x nA)
+// Columns of B/C are processed in parallel if there are enough of them, 
+// otherwise each column product is parallel
+//
+template <typename T_Int, typename T_Scalar>
+static void csc_x_gem(prop_t ptype, op_t opA, uint_t mA, uint_t nA, uint_t k, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	int_t nt = max_threads();
+	int_t nk = static_cast<int_t>(k);
+
+	if(nt > 1 && nk >= nt) {
+
+#pragma omp parallel for schedule(dynamic, 1)
+		for(int_t l = 0; l < nk; l++) {
+			serial_x_vec(ptype, opA, mA, nA, alpha, colptr, rowidx, values, dns::ptrmv(ldb,b,0,l), beta, dns::ptrmv(ldc,c,0,l));
+		} // l
+
+	} else {
+
+		for(int_t l = 0; l < nk; l++) {
+			csc_x_vec(ptype, opA, mA, nA, alpha, colptr, rowidx, values, dns::ptrmv(ldb,b,0,l), beta, dns::ptrmv(ldc,c,0,l));
+		} // l
+
+	} // parallel
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_gem_x_vec(op_t opA, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	csc_x_vec(prop_t::General, opA, m, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_gem_x_vec(T_Int, T_Scl) \
+template void native_gem_x_vec(op_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_native_gem_x_vec(int_t, real_t);
+instantiate_native_gem_x_vec(int_t, real4_t);
+instantiate_native_gem_x_vec(int_t, complex_t);
+instantiate_native_gem_x_vec(int_t, complex8_t);
+#undef instantiate_native_gem_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_sym_x_vec(uplo_t, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	csc_x_vec(prop_t::Symmetric, op_t::N, n, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_sym_x_vec(T_Int, T_Scl) \
+template void native_sym_x_vec(uplo_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_native_sym_x_vec(int_t, real_t);
+instantiate_native_sym_x_vec(int_t, real4_t);
+instantiate_native_sym_x_vec(int_t, complex_t);
+instantiate_native_sym_x_vec(int_t, complex8_t);
+#undef instantiate_native_sym_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_hem_x_vec(uplo_t, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	csc_x_vec(prop_t::Hermitian, op_t::N, n, n, alpha, colptr, rowidx, values, x, beta, y);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_hem_x_vec(T_Int, T_Scl) \
+template void native_hem_x_vec(uplo_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, T_Scl, T_Scl*)
+instantiate_native_hem_x_vec(int_t, real_t);
+instantiate_native_hem_x_vec(int_t, real4_t);
+instantiate_native_hem_x_vec(int_t, complex_t);
+instantiate_native_hem_x_vec(int_t, complex8_t);
+#undef instantiate_native_hem_x_vec
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t k, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	uint_t mA = (opA == op_t::N ? m : k);
+	uint_t nA = (opA == op_t::N ? k : m);
+	csc_x_gem(prop_t::General, opA, mA, nA, n, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_gem_x_gem(T_Int, T_Scl) \
+template void native_gem_x_gem(op_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_native_gem_x_gem(int_t, real_t);
+instantiate_native_gem_x_gem(int_t, real4_t);
+instantiate_native_gem_x_gem(int_t, complex_t);
+instantiate_native_gem_x_gem(int_t, complex8_t);
+#undef instantiate_native_gem_x_gem
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_sym_x_gem(uplo_t, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	csc_x_gem(prop_t::Symmetric, op_t::N, m, m, n, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_sym_x_gem(T_Int, T_Scl) \
+template void native_sym_x_gem(uplo_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_native_sym_x_gem(int_t, real_t);
+instantiate_native_sym_x_gem(int_t, real4_t);
+instantiate_native_sym_x_gem(int_t, complex_t);
+instantiate_native_sym_x_gem(int_t, complex8_t);
+#undef instantiate_native_sym_x_gem
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void native_hem_x_gem(uplo_t, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values,
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	csc_x_gem(prop_t::Hermitian, op_t::N, m, m, n, alpha, colptr, rowidx, values, b, ldb, beta, c, ldc);
+}
+/*-------------------------------------------------*/
+#define instantiate_native_hem_x_gem(T_Int, T_Scl) \
+template void native_hem_x_gem(uplo_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_native_hem_x_gem(int_t, real_t);
+instantiate_native_hem_x_gem(int_t, real4_t);
+instantiate_native_hem_x_gem(int_t, complex_t);
+instantiate_native_hem_x_gem(int_t, complex8_t);
+#undef instantiate_native_hem_x_gem
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_NATIVE_HPP_
+#define CLA3P_BULK_CSC_NATIVE_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Built-in (OpenMP) kernels, independent of the MKL integer model
+//
+
+//
+// Update: dnsY = beta * dnsY + alpha * op(cscA) * dnsX
+// A(m x n)
+//
+template <typename T_Int, typename T_Scalar>
+void native_gem_x_vec(op_t opA, uint_t m, uint_t n, T_Scalar alpha, 
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * cscA * dnsX
+// A(n x n), only the uplo part of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void native_sym_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, 
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsY = beta * dnsY + alpha * cscA * dnsX
+// A(n x n), only the uplo part of A is stored
+//
+template <typename T_Int, typename T_Scalar>
+void native_hem_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, 
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsC = beta * dnsC + alpha * opA(cscA) * dnsB
+// C(m x n)
+//
+template <typename T_Int, typename T_Scalar>
+void native_gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t k, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+//
+// Update: dnsC = beta * dnsC + alpha * cscA * dnsB
+// C(m x n)
+//
+template <typename T_Int, typename T_Scalar>
+void native_sym_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+//
+// Update: dnsC = beta * dnsC + alpha * cscA * dnsB
+// C(m x n)
+//
+template <typename T_Int, typename T_Scalar>
+void native_hem_x_gem(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha,
+		const T_Int *colptr, const T_Int *rowidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_NATIVE_HPP_
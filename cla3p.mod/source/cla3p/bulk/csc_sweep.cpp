@@ -0,0 +1,178 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csc_sweep.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+
+// 3rd
+
+// cla3p
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+//
+// Levels with fewer rows are swept by a single thread
+//
+static uint_t parallel_min_level_size()
+{
+	return 256;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+void row_map(uint_t m, uint_t n, const T_Int *colptr, const T_Int *rowidx, T_Int *rptr, T_Int *cidx, T_Int *vpos)
+{
+	std::fill_n(rptr, m + 1, 0);
+
+	for(uint_t j = 0; j < n; j++) {
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			rptr[rowidx[irow] + 1]++;
+		} // irow
+	} // j
+
+	for(uint_t i = 0; i < m; i++) {
+		rptr[i+1] += rptr[i];
+	} // i
+
+	std::vector<T_Int> next(rptr, rptr + m);
+
+	for(uint_t j = 0; j < n; j++) {
+		for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+			T_Int k = next[rowidx[irow]]++;
+			cidx[k] = j;
+			vpos[k] = irow;
+		} // irow
+	} // j
+}
+/*-------------------------------------------------*/
+template void row_map(uint_t, uint_t, const int_t*, const int_t*, int_t*, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int>
+uint_t level_sets(uplo_t uplo, uint_t n, const T_Int *rptr, const T_Int *cidx, T_Int *levptr, T_Int *levrow)
+{
+	std::vector<T_Int> level(n, 0);
+	T_Int nlev = 0;
+
+	bool forward = (uplo == uplo_t::Lower);
+
+	for(uint_t ii = 0; ii < n; ii++) {
+		uint_t i = (forward ? ii : n - 1 - ii);
+		T_Int lev = 0;
+		for(T_Int jcol = rptr[i]; jcol < rptr[i+1]; jcol++) {
+			T_Int j = cidx[jcol];
+			if(j != static_cast<T_Int>(i)) lev = std::max(lev, level[j] + 1);
+		} // jcol
+		level[i] = lev;
+		nlev = std::max(nlev, lev + 1);
+	} // ii
+
+	std::fill_n(levptr, nlev + 1, 0);
+
+	for(uint_t i = 0; i < n; i++) {
+		levptr[level[i] + 1]++;
+	} // i
+
+	for(T_Int l = 0; l < nlev; l++) {
+		levptr[l+1] += levptr[l];
+	} // l
+
+	std::vector<T_Int> next(levptr, levptr + nlev);
+
+	for(uint_t i = 0; i < n; i++) {
+		levrow[next[level[i]]++] = i;
+	} // i
+
+	return nlev;
+}
+/*-------------------------------------------------*/
+template uint_t level_sets(uplo_t, uint_t, const int_t*, const int_t*, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+static inline void sweep_row(T_Int i, const T_Int *rptr, const T_Int *cidx, const T_Int *vpos, 
+		const T_Scalar *values, const T_Int *dpos, bool conjop, T_Scalar *x)
+{
+	T_Scalar sum = x[i];
+
+	for(T_Int jcol = rptr[i]; jcol < rptr[i+1]; jcol++) {
+		T_Int j = cidx[jcol];
+		if(j == i) continue;
+		T_Scalar v = values[vpos ? vpos[jcol] : jcol];
+		sum -= (conjop ? arith::conj(v) : v) * x[j];
+	} // jcol
+
+	if(dpos) {
+		T_Scalar d = values[dpos[i]];
+		sum /= (conjop ? arith::conj(d) : d);
+	} // non-unit diagonal
+
+	x[i] = sum;
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void level_sweep(uint_t nlev, const T_Int *levptr, const T_Int *levrow, 
+		const T_Int *rptr, const T_Int *cidx, const T_Int *vpos, 
+		const T_Scalar *values, const T_Int *dpos, bool conjop, T_Scalar *x)
+{
+	T_Int nrows = (nlev ? levptr[nlev] : 0);
+	bool parallel = (nlev && static_cast<uint_t>(nrows) / nlev >= parallel_min_level_size());
+
+#pragma omp parallel if(parallel)
+	{
+		for(uint_t l = 0; l < nlev; l++) {
+
+			T_Int lbgn = levptr[l];
+			T_Int lend = levptr[l+1];
+
+			if(static_cast<uint_t>(lend - lbgn) < parallel_min_level_size()) {
+
+#pragma omp single
+				for(T_Int k = lbgn; k < lend; k++) {
+					sweep_row(levrow[k], rptr, cidx, vpos, values, dpos, conjop, x);
+				} // k
+
+			} else {
+
+#pragma omp for schedule(static)
+				for(T_Int k = lbgn; k < lend; k++) {
+					sweep_row(levrow[k], rptr, cidx, vpos, values, dpos, conjop, x);
+				} // k
+
+			} // level size
+
+		} // l
+	} // omp parallel
+}
+/*-------------------------------------------------*/
+#define instantiate_level_sweep(T_Int, T_Scl) \
+template void level_sweep(uint_t, const T_Int*, const T_Int*, \
+		const T_Int*, const T_Int*, const T_Int*, \
+		const T_Scl*, const T_Int*, bool, T_Scl*)
+instantiate_level_sweep(int_t, real_t);
+instantiate_level_sweep(int_t, real4_t);
+instantiate_level_sweep(int_t, complex_t);
+instantiate_level_sweep(int_t, complex8_t);
+#undef instantiate_level_sweep
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
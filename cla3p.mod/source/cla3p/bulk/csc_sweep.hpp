@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSC_SWEEP_HPP_
+#define CLA3P_BULK_CSC_SWEEP_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csc {
+/*-------------------------------------------------*/
+
+//
+// Level-scheduled triangular sweeps
+// A triangular matrix is accessed by rows (rptr, cidx), with values read through 
+// the positions vpos (identity if null) of a csc values array
+//
+
+//
+// Row structure of a csc matrix, rows with ascending columns
+// rptr(n+1), cidx(nnz), vpos(nnz): position of each entry in the csc arrays
+//
+template <typename T_Int>
+void row_map(uint_t m, uint_t n, const T_Int *colptr, const T_Int *rowidx, T_Int *rptr, T_Int *cidx, T_Int *vpos);
+
+//
+// Level sets of a triangular sweep (uplo Lower: forward, uplo Upper: backward)
+// Rows in the same level are independent
+// levptr(n+1), levrow(n)
+// Return: the number of levels
+//
+template <typename T_Int>
+uint_t level_sets(uplo_t uplo, uint_t n, const T_Int *rptr, const T_Int *cidx, T_Int *levptr, T_Int *levrow);
+
+//
+// Update: x := inv(T) * x
+// dpos: positions of the diagonal elements (unit diagonal if null)
+// Off-diagonal entries only are read from the row structure
+//
+template <typename T_Int, typename T_Scalar>
+void level_sweep(uint_t nlev, const T_Int *levptr, const T_Int *levrow, 
+		const T_Int *rptr, const T_Int *cidx, const T_Int *vpos, 
+		const T_Scalar *values, const T_Int *dpos, bool conjop, T_Scalar *x);
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSC_SWEEP_HPP_
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/csr.hpp"
+
+// system
+#include <iostream>
+#include <cstdio>
+
+// 3rd
+
+// cla3p
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csr {
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+std::string print_to_string(uint_t m, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd)
+{
+	if(!m) return "";
+
+#define BUFFER_LEN 1024
+
+	std::string ret;
+	ret.reserve(rowptr[m] * 128);
+	char cbuff[BUFFER_LEN];
+
+	std::snprintf(cbuff, BUFFER_LEN, "       #nz        row     column  value          \n"); ret.append(cbuff);
+	std::snprintf(cbuff, BUFFER_LEN, "-------------------------------------------------\n"); ret.append(cbuff);
+
+	uint_t icnt = 0;
+	for(uint_t i = 0; i < m; i++) {
+
+		T_Int jbgn = rowptr[i];
+		T_Int jend = rowptr[i+1];
+
+		for(T_Int jcol = jbgn; jcol < jend; jcol++) {
+
+			T_Int    j = colidx[jcol];
+			T_Scalar v = values[jcol];
+
+			val2char(cbuff, BUFFER_LEN,  10, icnt++); ret.append(cbuff); ret.append(" ");
+			val2char(cbuff, BUFFER_LEN,  10, i     ); ret.append(cbuff); ret.append(" ");
+			val2char(cbuff, BUFFER_LEN,  10, j     ); ret.append(cbuff); ret.append(" ");
+			val2char(cbuff, BUFFER_LEN, nsd, v     ); ret.append(cbuff); ret.append("\n");
+
+		} // jcol
+
+	} // i
+
+	return ret;
+
+#undef BUFFER_LEN
+}
+/*-------------------------------------------------*/
+template std::string print_to_string(uint_t m, const int_t *, const int_t *, const real_t    *, uint_t);
+template std::string print_to_string(uint_t m, const int_t *, const int_t *, const real4_t   *, uint_t);
+template std::string print_to_string(uint_t m, const int_t *, const int_t *, const complex_t *, uint_t);
+template std::string print_to_string(uint_t m, const int_t *, const int_t *, const complex8_t*, uint_t);
+template std::string print_to_string(uint_t m, const uint_t*, const uint_t*, const real_t    *, uint_t);
+template std::string print_to_string(uint_t m, const uint_t*, const uint_t*, const real4_t   *, uint_t);
+template std::string print_to_string(uint_t m, const uint_t*, const uint_t*, const complex_t *, uint_t);
+template std::string print_to_string(uint_t m, const uint_t*, const uint_t*, const complex8_t*, uint_t);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void print(uint_t m, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd)
+{
+	std::string tmp = print_to_string(m, rowptr, colidx, values, nsd);
+	std::cout << tmp;
+}
+/*-------------------------------------------------*/
+template void print(uint_t, const int_t *, const int_t *, const real_t    *, uint_t);
+template void print(uint_t, const int_t *, const int_t *, const real4_t   *, uint_t);
+template void print(uint_t, const int_t *, const int_t *, const complex_t *, uint_t);
+template void print(uint_t, const int_t *, const int_t *, const complex8_t*, uint_t);
+template void print(uint_t, const uint_t*, const uint_t*, const real_t    *, uint_t);
+template void print(uint_t, const uint_t*, const uint_t*, const real4_t   *, uint_t);
+template void print(uint_t, const uint_t*, const uint_t*, const complex_t *, uint_t);
+template void print(uint_t, const uint_t*, const uint_t*, const complex8_t*, uint_t);
+/*-------------------------------------------------*/
+} // namespace csr
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_CSR_HPP_
+#define CLA3P_BULK_CSR_HPP_
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace csr {
+/*-------------------------------------------------*/
+
+template <typename T_Int, typename T_Scalar>
+std::string print_to_string(uint_t m, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd = 3);
+
+template <typename T_Int, typename T_Scalar>
+void print(uint_t m, const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, uint_t nsd = 3);
+
+/*-------------------------------------------------*/
+} // namespace csr
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_CSR_HPP_
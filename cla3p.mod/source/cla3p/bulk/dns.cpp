@@ -19,11 +19,14 @@
 
 // system
 #include <functional>
+#include <algorithm>
+#include <vector>
 
 // 3rd
 
 // cla3p
 #include "cla3p/types.hpp"
+#include "cla3p/bulk/dns_ssq.hpp"
 
 #include "cla3p/proxies/blas_proxy.hpp"
 #include "cla3p/proxies/lapack_proxy.hpp"
@@ -31,6 +34,7 @@
 #include "cla3p/error/exceptions.hpp"
 #include "cla3p/error/literals.hpp"
 #include "cla3p/support/utils.hpp"
+#include "cla3p/support/random_engine.hpp"
 #include "cla3p/checks/basic_checks.hpp"
 
 /*-------------------------------------------------*/
@@ -115,6 +119,35 @@ template <> void fill(uplo_t uplo, uint_t m, uint_t n, complex8_t *a, uint_t lda
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
+//
+// Elements are split in (column, row chunk) tasks, the value of each element depends only on 
+// its linear index (i + j * m), so results are independent of lda & the number of threads
+//
+template <typename T_Scalar, typename T_Fill>
+static void rand_tmpl(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda, T_Fill fill)
+{
+	const uint_t chunk = 4096;
+
+	int_t nch = static_cast<int_t>((m + chunk - 1) / chunk);
+	int_t ntasks = nch * static_cast<int_t>(n);
+
+	#pragma omp parallel for schedule(static) if(static_cast<bulk_t>(m) * n >= 65536)
+	for(int_t t = 0; t < ntasks; t++) {
+
+		uint_t j = static_cast<uint_t>(t / nch);
+		uint_t c = static_cast<uint_t>(t % nch);
+
+		RowRange ir = irange(uplo, m, j);
+		uint_t ibgn = std::max(ir.ibgn, c * chunk);
+		uint_t iend = std::min(ir.iend, c * chunk + chunk);
+
+		if(ibgn < iend) {
+			fill(static_cast<uint64_t>(j) * m + ibgn, iend - ibgn, ptrmv(lda, a, ibgn, j));
+		} // non-empty
+
+	} // t
+}
+/*-------------------------------------------------*/
 template <typename T_Scalar>
 void rand(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda, 
 		typename TypeTraits<T_Scalar>::real_type lo, 
@@ -122,12 +155,15 @@ void rand(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda,
 {
 	if(!m || !n) return;
 
-	for(uint_t j = 0; j < n; j++) {
-		RowRange ir = irange(uplo, m, j);
-		for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-			entry(lda,a,i,j) = cla3p::rand<T_Scalar>(lo, hi);
-		} // i
-	} // j
+	if(lo > hi) {
+		throw err::Exception("Need low <= high");
+	} // error
+
+	uint64_t seed = rng::seed();
+	uint64_t stream = rng::next_stream();
+
+	rand_tmpl(uplo, m, n, a, lda, 
+			[=](uint64_t first, uint_t len, T_Scalar *x) { rng::uniform(seed, stream, first, len, x, lo, hi); });
 }
 /*-------------------------------------------------*/
 template void rand(uplo_t, uint_t, uint_t, int_t     *, uint_t, int_t  , int_t  );
@@ -137,6 +173,25 @@ template void rand(uplo_t, uint_t, uint_t, real4_t   *, uint_t, real4_t, real4_t
 template void rand(uplo_t, uint_t, uint_t, complex_t *, uint_t, real_t , real_t );
 template void rand(uplo_t, uint_t, uint_t, complex8_t*, uint_t, real4_t, real4_t);
 /*-------------------------------------------------*/
+template <typename T_Scalar>
+void randn(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda, 
+		typename TypeTraits<T_Scalar>::real_type mu, 
+		typename TypeTraits<T_Scalar>::real_type sigma) 
+{
+	if(!m || !n) return;
+
+	uint64_t seed = rng::seed();
+	uint64_t stream = rng::next_stream();
+
+	rand_tmpl(uplo, m, n, a, lda, 
+			[=](uint64_t first, uint_t len, T_Scalar *x) { rng::normal(seed, stream, first, len, x, mu, sigma); });
+}
+/*-------------------------------------------------*/
+template void randn(uplo_t, uint_t, uint_t, real_t    *, uint_t, real_t , real_t );
+template void randn(uplo_t, uint_t, uint_t, real4_t   *, uint_t, real4_t, real4_t);
+template void randn(uplo_t, uint_t, uint_t, complex_t *, uint_t, real_t , real_t );
+template void randn(uplo_t, uint_t, uint_t, complex8_t*, uint_t, real4_t, real4_t);
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -458,60 +513,92 @@ template void conjugate(uplo_t, uint_t, uint_t, complex8_t*, uint_t, complex8_t)
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
-template <typename T_Scalar>
-static void xx2ge_recursive(uplo_t uplo, uint_t n, T_Scalar *a, uint_t lda, prop_t ptype)
+//
+// Tile dimension & parallel threshold of the structural kernels (mirroring, norms), 
+// a tile & its mirror stay in cache while being transposed
+//
+static inline uint_t structural_tile_dim()
 {
-	if(!n) return;
+	return 64;
+}
+/*-------------------------------------------------*/
+static inline bulk_t structural_parallel_min_size()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+//
+// Fills the (m x n) block b with op(a^T), writes are sequential, a is read across a cached tile
+//
+template <typename T_Scalar, typename T_Op>
+static void mirror_block(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, T_Op op)
+{
+	for(uint_t j = 0; j < n; j++) {
+		T_Scalar *bj = ptrmv(ldb,b,0,j);
+		for(uint_t i = 0; i < m; i++) {
+			bj[i] = op(entry(lda,a,j,i));
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// Each task handles a tile column of the stored part & mirrors it to the corresponding tile row
+//
+template <typename T_Scalar, typename T_Op>
+static void xx2ge_tiled(uplo_t uplo, uint_t n, T_Scalar *a, uint_t lda, T_Op op)
+{
+	const uint_t tb = structural_tile_dim();
 
-	if(n < recursive_min_dim()) {
+	int_t nt = static_cast<int_t>((n + tb - 1) / tb);
 
-		for(uint_t j = 0; j < n; j++) {
-			RowRange ir = irange(uplo, n, j);
+	#pragma omp parallel for schedule(dynamic) if(static_cast<bulk_t>(n) * n >= structural_parallel_min_size())
+	for(int_t tj = 0; tj < nt; tj++) {
+
+		uint_t jbgn = static_cast<uint_t>(tj) * tb;
+		uint_t jlen = std::min(tb, n - jbgn);
+
+		for(uint_t j = 0; j < jlen; j++) {
+			RowRange ir = irange_strict(uplo, jlen, j);
 			for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-				if(i != j) {
-					entry(lda,a,j,i) = opposite_element(entry(lda,a,i,j),ptype);
-				} // off diagonals
+				entry(lda,a,jbgn+j,jbgn+i) = op(entry(lda,a,jbgn+i,jbgn+j));
 			} // i
 		} // j
 
-		set_diag_zeros(ptype, n, a, lda);
-
-	} else {
+		uint_t ibgn = (uplo == uplo_t::Lower ? jbgn + jlen : 0);
+		uint_t iend = (uplo == uplo_t::Lower ? n : jbgn);
 
-		uint_t n0 = n/2;
-		uint_t n1 = n - n0;
+		for(uint_t it = ibgn; it < iend; it += tb) {
+			uint_t ilen = std::min(tb, iend - it);
+			mirror_block(jlen, ilen, ptrmv(lda,a,it,jbgn), lda, ptrmv(lda,a,jbgn,it), lda, op);
+		} // it
 
-		xx2ge_recursive(uplo, n0, ptrmv(lda,a, 0, 0), lda, ptype);
-		xx2ge_recursive(uplo, n1, ptrmv(lda,a,n0,n0), lda, ptype);
+	} // tj
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void xx2ge(uplo_t uplo, uint_t n, T_Scalar *a, uint_t lda, prop_t ptype)
+{
+	if(!n) return;
 
-		if(ptype == prop_t::Symmetric) {
+	if(ptype == prop_t::Symmetric) {
 
-			/**/ if(uplo == uplo_t::Upper) transpose(n0, n1, ptrmv(lda,a,0,n0), lda, ptrmv(lda,a,n0,0), lda);
-			else if(uplo == uplo_t::Lower) transpose(n1, n0, ptrmv(lda,a,n0,0), lda, ptrmv(lda,a,0,n0), lda);
+		xx2ge_tiled(uplo, n, a, lda, [](const T_Scalar& x) { return x; });
 
-		} else if(ptype == prop_t::Hermitian) {
+	} else if(ptype == prop_t::Hermitian) {
 
-			/**/ if(uplo == uplo_t::Upper) conjugate_transpose(n0, n1, ptrmv(lda,a,0,n0), lda, ptrmv(lda,a,n0,0), lda);
-			else if(uplo == uplo_t::Lower) conjugate_transpose(n1, n0, ptrmv(lda,a,n0,0), lda, ptrmv(lda,a,0,n0), lda);
+		xx2ge_tiled(uplo, n, a, lda, [](const T_Scalar& x) { return arith::conj(x); });
 
-		} else if(ptype == prop_t::Skew) {
+	} else if(ptype == prop_t::Skew) {
 
-			/**/ if(uplo == uplo_t::Upper) transpose(n0, n1, ptrmv(lda,a,0,n0), lda, ptrmv(lda,a,n0,0), lda, T_Scalar(-1));
-			else if(uplo == uplo_t::Lower) transpose(n1, n0, ptrmv(lda,a,n0,0), lda, ptrmv(lda,a,0,n0), lda, T_Scalar(-1));
+		xx2ge_tiled(uplo, n, a, lda, [](const T_Scalar& x) { return -x; });
 
-		} else {
+	} else {
 
-			throw err::Exception();
+		throw err::Exception();
 
-		} // ptype
+	} // ptype
 
-	} // dim check
-}
-/*-------------------------------------------------*/
-template <typename T_Scalar>
-static void xx2ge(uplo_t uplo, uint_t n, T_Scalar *a, uint_t lda, prop_t ptype)
-{
-	xx2ge_recursive(uplo, n, a, lda, ptype);
+	set_diag_zeros(ptype, n, a, lda);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -567,23 +654,47 @@ template void tr2ge(uplo_t, uint_t, uint_t, complex8_t*, uint_t);
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
+//
+// Column sums of a skew matrix, stored column j contributes to column j & (as a row) to the columns i,
+// so every thread accumulates in a private array
+//
 template <typename T_Scalar>
-typename TypeTraits<T_Scalar>::real_type
-static norm_one_skew(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda)
+static typename TypeTraits<T_Scalar>::real_type
+norm_one_skew(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda)
 {
 	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
 
 	T_RScalar ret = 0;
 	T_RScalar *tmp = alloc<T_RScalar>(n, 1, n, true);
 
-	for(uint_t j = 0; j < n; j++) {
-		RowRange ir = irange_strict(uplo, n, j);
-		for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-			T_RScalar absAij = std::abs(entry(lda,a,i,j));
-			tmp[i] += absAij;
-			tmp[j] += absAij;
-		} // i
-	} // j
+	int_t nn = static_cast<int_t>(n);
+
+	#pragma omp parallel if(static_cast<bulk_t>(n) * n >= structural_parallel_min_size())
+	{
+		T_RScalar *loc = alloc<T_RScalar>(n, 1, n, true);
+
+		#pragma omp for schedule(dynamic,16) nowait
+		for(int_t j = 0; j < nn; j++) {
+			const T_Scalar *aj = ptrmv(lda,a,0,j);
+			RowRange ir = irange_strict(uplo, n, j);
+			T_RScalar colsum = 0;
+			for(uint_t i = ir.ibgn; i < ir.iend; i++) {
+				T_RScalar absAij = std::abs(aj[i]);
+				colsum += absAij;
+				loc[i] += absAij;
+			} // i
+			loc[j] += colsum;
+		} // j
+
+		#pragma omp critical
+		{
+			for(uint_t i = 0; i < n; i++) {
+				tmp[i] += loc[i];
+			} // i
+		}
+
+		i_free(loc);
+	}
 
 	for(uint_t j = 0; j < n; j++) {
 		ret = std::max(ret,tmp[j]);
@@ -689,12 +800,17 @@ norm_max_skew(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda)
 	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
 
 	T_RScalar ret = 0;
+	int_t nn = static_cast<int_t>(n);
 
-	for(uint_t j = 0; j < n; j++) {
+	#pragma omp parallel for schedule(dynamic,16) reduction(max:ret) if(static_cast<bulk_t>(n) * n >= structural_parallel_min_size())
+	for(int_t j = 0; j < nn; j++) {
+		const T_Scalar *aj = ptrmv(lda,a,0,j);
 		RowRange ir = irange_strict(uplo, n, j);
+		T_RScalar colmax = 0;
 		for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-			ret = std::max(ret,std::abs(entry(lda,a,i,j)));
+			colmax = std::max(colmax, static_cast<T_RScalar>(std::abs(aj[i])));
 		} // i
+		ret = std::max(ret, colmax);
 	} // j
 
 	return ret;
@@ -747,50 +863,46 @@ template real4_t norm_max(prop_t, uplo_t, uint_t, uint_t, const complex8_t*, uin
 /*-------------------------------------------------*/
 //
 // fro norm for Symmetric/Hermitian wrong in lapack for n >= 128
-// TODO: more efficient
+// Off-diagonal columns are accumulated as scaled sums of squares (counted twice) & merged across threads
 //
 template <typename T_Scalar>
 static typename TypeTraits<T_Scalar>::real_type
-naive_xx_norm_fro(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda, prop_t ptype)
+xx_norm_fro(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda, prop_t ptype)
 {
 	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
 
-	T_RScalar sum = 0;
-	T_RScalar two = 2;
-
-	if(ptype == prop_t::Symmetric) {
-
-		for(uint_t j = 0; j < n; j++) {
-			T_RScalar absAjj = std::abs(entry(lda,a,j,j));
-			sum += absAjj * absAjj;
-		} // j
+	if(ptype != prop_t::Symmetric && ptype != prop_t::Hermitian && ptype != prop_t::Skew) {
+		throw err::Exception();
+	} // property
 
-	} else if(ptype == prop_t::Hermitian) {
+	ScaledSsq<T_RScalar> ret;
+	int_t nn = static_cast<int_t>(n);
 
-		for(uint_t j = 0; j < n; j++) {
-			T_RScalar absAjj = std::abs(arith::getRe(entry(lda,a,j,j)));
-			sum += absAjj * absAjj;
-		} // j
+	#pragma omp parallel if(static_cast<bulk_t>(n) * n >= structural_parallel_min_size())
+	{
+		ScaledSsq<T_RScalar> acc;
 
-	} else if(ptype == prop_t::Skew) {
+		#pragma omp for schedule(dynamic,16) nowait
+		for(int_t j = 0; j < nn; j++) {
 
-		// nothing to add
+			const T_Scalar *aj = ptrmv(lda,a,0,j);
+			RowRange ir = irange_strict(uplo, n, j);
 
-	} else {
+			acc.add(ir.iend - ir.ibgn, aj + ir.ibgn, T_RScalar(2));
 
-		throw err::Exception();
+			if(ptype == prop_t::Symmetric) {
+				acc.add(aj[j]);
+			} else if(ptype == prop_t::Hermitian) {
+				acc.add(arith::getRe(aj[j]));
+			} // diagonal
 
-	} // property
+		} // j
 
-	for(uint_t j = 0; j < n; j++) {
-		RowRange ir = irange_strict(uplo, n, j);
-		for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-			T_RScalar aij = std::abs(entry(lda,a,i,j));
-			sum += two * aij * aij;
-		} // i
-	} // j
+		#pragma omp critical(cla3p_dns_norm_fro)
+		ret.merge(acc);
+	}
 
-	return std::sqrt(sum);
+	return ret.value();
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -813,19 +925,11 @@ norm_fro(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, const T_Scalar *a, uint_
 
 	} else if(prop.isSymmetric()) {
 
-		if(n >= 128) {
-			return naive_xx_norm_fro(uplo, n, a, lda, prop.type());
-		} else {
-			return lapack::lansy('F', prop.cuplo(), n, a, lda);
-		}
+		return xx_norm_fro(uplo, n, a, lda, prop.type());
 
 	} else if(prop.isHermitian()) { 
 
-		if(n >= 128) {
-			return naive_xx_norm_fro(uplo, n, a, lda, prop.type());
-		} else {
-			return lapack::lanhe('F', prop.cuplo(), n, a, lda);
-		}
+		return xx_norm_fro(uplo, n, a, lda, prop.type());
 
 	} else if(prop.isTriangular()) {
 
@@ -833,7 +937,7 @@ norm_fro(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, const T_Scalar *a, uint_
 
 	} else if(prop.isSkew()) {
 
-		return naive_xx_norm_fro(uplo, n, a, lda, prop.type());
+		return xx_norm_fro(uplo, n, a, lda, prop.type());
 
 	} // property
 	
@@ -857,63 +961,167 @@ template real4_t norm_euc(uint_t, const real4_t   *);
 template real_t  norm_euc(uint_t, const complex_t *);
 template real4_t norm_euc(uint_t, const complex8_t*);
 /*-------------------------------------------------*/
+//
+// Out-of-place kernels gather (rows x cols) tiles of the target, 
+// writes are sequential & the tile being filled stays in cache
+//
+static inline uint_t permute_tile_rows()
+{
+	return 1024;
+}
+/*-------------------------------------------------*/
+static inline uint_t permute_tile_cols()
+{
+	return 16;
+}
+/*-------------------------------------------------*/
+static inline bulk_t permute_parallel_min_size()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+static std::vector<int_t> inverse_perm(uint_t n, const int_t *P)
+{
+	std::vector<int_t> ret(n);
+	int_t nn = static_cast<int_t>(n);
+
+	#pragma omp parallel for schedule(static) if(n >= permute_parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		ret[P[i]] = i;
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// Cycle decomposition of P, cycle k is members[ptr[k]:ptr[k+1]] with members[l+1] = P[members[l]]
+// Fixed points are appended as trailing single entry cycles only if withFixed is set
+// A P that is not a permutation of 0..n-1 would never close a cycle, so the walk is bounded
+//
+static void perm_cycles(uint_t n, const int_t *P, bool withFixed, std::vector<int_t>& members, std::vector<bulk_t>& ptr)
+{
+	std::vector<bool> visited(n, false);
+
+	members.clear();
+	members.reserve(n);
+	ptr.assign(1, 0);
+
+	for(uint_t s = 0; s < n; s++) {
+
+		if(visited[s] || static_cast<uint_t>(P[s]) == s) continue;
+
+		uint_t i = s;
+		do {
+			visited[i] = true;
+			members.push_back(static_cast<int_t>(i));
+			i = static_cast<uint_t>(P[i]);
+			if(i >= n || (i != s && visited[i])) {
+				throw err::InvalidOp("Invalid permutation");
+			} // not a bijection
+		} while(i != s);
+
+		ptr.push_back(members.size());
+
+	} // s
+
+	if(withFixed) {
+		for(uint_t s = 0; s < n; s++) {
+			if(static_cast<uint_t>(P[s]) == s) {
+				members.push_back(static_cast<int_t>(s));
+				ptr.push_back(members.size());
+			} // fixed point
+		} // s
+	} // withFixed
+}
+/*-------------------------------------------------*/
+//
+// b(i,j) = a(iP[i],Q[j]), the identity is used for nullptr perms
+//
+template <typename T_Scalar>
+static void permute_ge_tiled(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, const int_t *iP, const int_t *Q)
+{
+	const uint_t rb = permute_tile_rows();
+	const uint_t cb = permute_tile_cols();
+
+	int_t mt = static_cast<int_t>((m + rb - 1) / rb);
+	int_t nt = static_cast<int_t>((n + cb - 1) / cb);
+
+	#pragma omp parallel for collapse(2) schedule(static) if(static_cast<bulk_t>(m) * n >= permute_parallel_min_size())
+	for(int_t tj = 0; tj < nt; tj++) {
+		for(int_t ti = 0; ti < mt; ti++) {
+
+			uint_t ibgn = static_cast<uint_t>(ti) * rb;
+			uint_t jbgn = static_cast<uint_t>(tj) * cb;
+			uint_t iend = std::min(m, ibgn + rb);
+			uint_t jend = std::min(n, jbgn + cb);
+
+			for(uint_t j = jbgn; j < jend; j++) {
+
+				const T_Scalar *aj = ptrmv(lda, a, 0, Q ? static_cast<uint_t>(Q[j]) : j);
+				T_Scalar *bj = ptrmv(ldb, b, 0, j);
+
+				if(iP) {
+					for(uint_t i = ibgn; i < iend; i++) {
+						bj[i] = aj[iP[i]];
+					} // i
+				} else {
+					std::copy(aj + ibgn, aj + iend, bj + ibgn);
+				} // iP
+
+			} // j
+
+		} // ti
+	} // tj
+}
+/*-------------------------------------------------*/
 template <typename T_Scalar>
 static void permute_ge_left(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, const int_t *P)
 {
-	for(uint_t j = 0; j < n; j++) {
-		for(uint_t i = 0; i < m; i++) {
-			entry(ldb, b, P[i], j) = entry(lda, a, i, j);
-		} // i
-	} // j
+	std::vector<int_t> iP = inverse_perm(m, P);
+	permute_ge_tiled(m, n, a, lda, b, ldb, iP.data(), nullptr);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 static void permute_ge_right(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, const int_t *Q)
 {
-	for(uint_t j = 0; j < n; j++) {
-		copy(uplo_t::Full, m, 1, ptrmv(lda,a,0,Q[j]), lda, ptrmv(ldb,b,0,j), ldb);
-	} // j
+	permute_ge_tiled(m, n, a, lda, b, ldb, nullptr, Q);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 static void permute_ge_both(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, const int_t *P, const int_t *Q)
 {
-	for(uint_t j = 0; j < n; j++) {
-		for(uint_t i = 0; i < m; i++) {
-			entry(ldb, b, P[i], j) = entry(lda, a, i, Q[j]);
-		} // i
-	} // j
+	std::vector<int_t> iP = inverse_perm(m, P);
+	permute_ge_tiled(m, n, a, lda, b, ldb, iP.data(), Q);
 }
 /*-------------------------------------------------*/
+//
+// Gathers b(r,c) = a(iP[r],iP[c]), reading the opposite element when (iP[r],iP[c]) falls outside the stored part
+//
 template <typename T_Scalar>
 static void permute_xx_mirror(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb, const int_t *P, prop_t ptype)
 {
-	uint_t Pi;
-	uint_t Pj;
-
-	for(uint_t j = 0; j < n; j++) {
-		RowRange ir = irange(uplo, n, j);
-		for(uint_t i = ir.ibgn; i < ir.iend; i++) {
-
-			Pi = P[i];
-			Pj = P[j];
+	std::vector<int_t> iP = inverse_perm(n, P);
+	int_t nn = static_cast<int_t>(n);
 
-			if(uplo == uplo_t::Upper && Pj < Pi) {
+	#pragma omp parallel for schedule(dynamic,16) if(static_cast<bulk_t>(n) * n >= permute_parallel_min_size())
+	for(int_t c = 0; c < nn; c++) {
 
-				entry(ldb,b,Pj,Pi) = opposite_element(entry(lda,a,i,j),ptype);
+		uint_t jc = static_cast<uint_t>(iP[c]);
+		T_Scalar *bc = ptrmv(ldb, b, 0, c);
 
-			} else if(uplo == uplo_t::Lower && Pj > Pi) {
+		RowRange ir = irange(uplo, n, c);
+		for(uint_t r = ir.ibgn; r < ir.iend; r++) {
 
-				entry(ldb,b,Pj,Pi) = opposite_element(entry(lda,a,i,j),ptype);
+			uint_t jr = static_cast<uint_t>(iP[r]);
 
+			if(uplo == uplo_t::Upper ? jr <= jc : jr >= jc) {
+				bc[r] = entry(lda, a, jr, jc);
 			} else {
+				bc[r] = opposite_element(entry(lda, a, jc, jr), ptype);
+			} // stored part
 
-				entry(ldb,b,Pi,Pj) = entry(lda,a,i,j);
-
-			} // uplo switch
-
-		} // i
-	} // j
+		} // r
+	} // c
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -961,6 +1169,199 @@ instantiate_permute(complex_t);
 instantiate_permute(complex8_t);
 #undef instantiate_permute
 /*-------------------------------------------------*/
+//
+// In-place kernels follow the cycles of the permutations, 
+// the only extra memory is the cycle decomposition & a small buffer per thread
+//
+template <typename T_Scalar>
+static void ipermute_ge_left(uint_t m, uint_t n, T_Scalar *a, uint_t lda, const std::vector<int_t>& members, const std::vector<bulk_t>& ptr)
+{
+	int_t nc = static_cast<int_t>(ptr.size() - 1);
+	int_t nn = static_cast<int_t>(n);
+
+	//
+	// a(P[i],j) = a(i,j), shift each cycle backwards so that every read hits an untouched entry
+	//
+	#pragma omp parallel for collapse(2) schedule(static) if(static_cast<bulk_t>(m) * n >= permute_parallel_min_size())
+	for(int_t j = 0; j < nn; j++) {
+		for(int_t c = 0; c < nc; c++) {
+
+			T_Scalar *aj = ptrmv(lda, a, 0, j);
+			const int_t *cyc = members.data() + ptr[c];
+			bulk_t len = ptr[c + 1] - ptr[c];
+
+			T_Scalar carry = aj[cyc[len - 1]];
+			for(bulk_t l = len - 1; l > 0; l--) {
+				aj[cyc[l]] = aj[cyc[l - 1]];
+			} // l
+			aj[cyc[0]] = carry;
+
+		} // c
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void ipermute_ge_right(uint_t m, uint_t n, T_Scalar *a, uint_t lda, const std::vector<int_t>& members, const std::vector<bulk_t>& ptr)
+{
+	const uint_t rb = 256;
+
+	int_t nc = static_cast<int_t>(ptr.size() - 1);
+	int_t mt = static_cast<int_t>((m + rb - 1) / rb);
+
+	//
+	// a(:,j) = a(:,Q[j]), each task moves a row chunk of a whole cycle through a local buffer
+	//
+	#pragma omp parallel for collapse(2) schedule(static) if(static_cast<bulk_t>(m) * n >= permute_parallel_min_size())
+	for(int_t c = 0; c < nc; c++) {
+		for(int_t ti = 0; ti < mt; ti++) {
+
+			T_Scalar buf[rb];
+
+			const int_t *cyc = members.data() + ptr[c];
+			bulk_t len = ptr[c + 1] - ptr[c];
+
+			uint_t ibgn = static_cast<uint_t>(ti) * rb;
+			uint_t iend = std::min(m, ibgn + rb);
+
+			const T_Scalar *a0 = ptrmv(lda, a, ibgn, cyc[0]);
+			std::copy(a0, a0 + (iend - ibgn), buf);
+
+			for(bulk_t l = 0; l + 1 < len; l++) {
+				const T_Scalar *src = ptrmv(lda, a, ibgn, cyc[l + 1]);
+				std::copy(src, src + (iend - ibgn), ptrmv(lda, a, ibgn, cyc[l]));
+			} // l
+
+			std::copy(buf, buf + (iend - ibgn), ptrmv(lda, a, ibgn, cyc[len - 1]));
+
+		} // ti
+	} // c
+}
+/*-------------------------------------------------*/
+//
+// Moves the stored entries of the orbit of (i0,j0) under (i,j) -> (P[i],P[j])
+//
+template <typename T_Scalar>
+static void ipermute_xx_orbit(uplo_t uplo, T_Scalar *a, uint_t lda, const int_t *P, prop_t ptype, uint_t i0, uint_t j0)
+{
+	bool upper = (uplo == uplo_t::Upper);
+
+	if(upper ? i0 > j0 : i0 < j0) std::swap(i0, j0);
+
+	uint_t i = i0;
+	uint_t j = j0;
+	T_Scalar carry = entry(lda, a, i, j);
+
+	do {
+
+		uint_t pi = static_cast<uint_t>(P[i]);
+		uint_t pj = static_cast<uint_t>(P[j]);
+
+		if(upper ? pi > pj : pi < pj) {
+			std::swap(pi, pj);
+			carry = opposite_element(carry, ptype);
+		} // mirror
+
+		std::swap(entry(lda, a, pi, pj), carry);
+
+		i = pi;
+		j = pj;
+
+	} while(i != i0 || j != j0);
+}
+/*-------------------------------------------------*/
+//
+// For P cycles A,B the pairs A x B are closed under the permutation, 
+// orbit leaders are (A[0],B[t]) t < gcd(|A|,|B|) & (A[0],A[d]) d <= |A|/2 when A == B
+//
+template <typename T_Scalar>
+static void ipermute_xx_mirror(uplo_t uplo, uint_t n, T_Scalar *a, uint_t lda, const int_t *P, prop_t ptype)
+{
+	std::vector<int_t> members;
+	std::vector<bulk_t> ptr;
+	perm_cycles(n, P, true, members, ptr);
+
+	int_t nc = static_cast<int_t>(ptr.size() - 1);
+
+	#pragma omp parallel for schedule(dynamic) if(static_cast<bulk_t>(n) * n >= permute_parallel_min_size())
+	for(int_t ca = 0; ca < nc; ca++) {
+
+		const int_t *cycA = members.data() + ptr[ca];
+		bulk_t lenA = ptr[ca + 1] - ptr[ca];
+
+		if(lenA == 1) continue; // fixed points are trailing, pairs of fixed points stay in place
+
+		for(bulk_t d = 0; d <= lenA / 2; d++) {
+			ipermute_xx_orbit(uplo, a, lda, P, ptype, cycA[0], cycA[d]);
+		} // d
+
+		for(int_t cb = ca + 1; cb < nc; cb++) {
+
+			const int_t *cycB = members.data() + ptr[cb];
+			bulk_t lenB = ptr[cb + 1] - ptr[cb];
+
+			bulk_t g = lenA;
+			bulk_t r = lenB;
+			while(r) {
+				bulk_t tmp = g % r;
+				g = r;
+				r = tmp;
+			} // gcd
+
+			for(bulk_t t = 0; t < g; t++) {
+				ipermute_xx_orbit(uplo, a, lda, P, ptype, cycA[0], cycB[t]);
+			} // t
+
+		} // cb
+
+	} // ca
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void ipermute(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda, const int_t *P, const int_t *Q)
+{
+	if(!m || !n) return;
+
+	Property prop(ptype, uplo);
+
+	if(prop.isSquare()) {
+		square_check(m, n);
+	}
+
+	if(prop.isGeneral()) {
+
+		//
+		// Both decompositions are formed first, an invalid P or Q leaves a untouched
+		//
+		std::vector<int_t> pmembers, qmembers;
+		std::vector<bulk_t> pptr, qptr;
+
+		if(P) perm_cycles(m, P, false, pmembers, pptr);
+		if(Q) perm_cycles(n, Q, false, qmembers, qptr);
+
+		if(Q) ipermute_ge_right(m, n, a, lda, qmembers, qptr);
+		if(P) ipermute_ge_left(m, n, a, lda, pmembers, pptr);
+
+	} else if(prop.isSymmetric() || prop.isHermitian() || prop.isSkew()) {
+
+		if(P) ipermute_xx_mirror(uplo, n, a, lda, P, prop.type());
+
+	} else {
+
+		throw err::Exception("Invalid property: " + prop.name());
+
+	} // prop
+}
+/*-------------------------------------------------*/
+#define instantiate_ipermute(T_Scl) \
+template void ipermute(prop_t, uplo_t, uint_t, uint_t, T_Scl*, uint_t, const int_t*, const int_t*)
+instantiate_ipermute(int_t);
+instantiate_ipermute(uint_t);
+instantiate_ipermute(real_t);
+instantiate_ipermute(real4_t);
+instantiate_ipermute(complex_t);
+instantiate_ipermute(complex8_t);
+#undef instantiate_ipermute
+/*-------------------------------------------------*/
 } // namespace dns
 } // namespace bulk
 } // namespace cla3p
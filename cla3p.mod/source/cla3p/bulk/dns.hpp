@@ -85,13 +85,18 @@ T_Scalar* alloc(uint_t m, uint_t n, uint_t lda, bool wipe = false)
 }
 
 //
-// Set random values
+// Set random values (uniform in [lo,hi) & normal with mean mu & standard deviation sigma)
 //
 template <typename T_Scalar>
 void rand(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda,
 		typename TypeTraits<T_Scalar>::real_type lo,
 		typename TypeTraits<T_Scalar>::real_type hi);
 
+template <typename T_Scalar>
+void randn(uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda,
+		typename TypeTraits<T_Scalar>::real_type mu,
+		typename TypeTraits<T_Scalar>::real_type sigma);
+
 //
 // Copy
 //
@@ -219,6 +224,13 @@ template <typename T_Scalar>
 void permute(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, const T_Scalar *a, uint_t lda, 
 		T_Scalar *b, uint_t ldb, const int_t *P, const int_t *Q);
 
+//
+// In-place permutations (same conventions as permute), no copy of the matrix is allocated
+//
+template <typename T_Scalar>
+void ipermute(prop_t ptype, uplo_t uplo, uint_t m, uint_t n, T_Scalar *a, uint_t lda, 
+		const int_t *P, const int_t *Q);
+
 /*-------------------------------------------------*/
 } // namespace dns
 } // namespace bulk
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/dns_band.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/proxies/blas_proxy.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+static inline bulk_t band_parallel_min_size()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void band_pack(uint_t m, uint_t n, uint_t kl, uint_t ku, const T_Scalar *a, uint_t lda, T_Scalar *ab, uint_t ldab)
+{
+	#pragma omp parallel for schedule(static) if(static_cast<bulk_t>(kl + ku + 1) * n >= band_parallel_min_size())
+	for(int_t jj = 0; jj < static_cast<int_t>(n); jj++) {
+		uint_t j = static_cast<uint_t>(jj);
+		uint_t ibgn = (j > ku ? j - ku : 0);
+		uint_t iend = std::min(m, j + kl + 1);
+		for(uint_t i = ibgn; i < iend; i++) {
+			ab[band_offset(ku, ldab, i, j)] = a[i + static_cast<bulk_t>(j) * lda];
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void band_unpack(uint_t m, uint_t n, uint_t kl, uint_t ku, const T_Scalar *ab, uint_t ldab, T_Scalar *a, uint_t lda)
+{
+	#pragma omp parallel for schedule(static) if(static_cast<bulk_t>(kl + ku + 1) * n >= band_parallel_min_size())
+	for(int_t jj = 0; jj < static_cast<int_t>(n); jj++) {
+		uint_t j = static_cast<uint_t>(jj);
+		uint_t ibgn = (j > ku ? j - ku : 0);
+		uint_t iend = std::min(m, j + kl + 1);
+		for(uint_t i = ibgn; i < iend; i++) {
+			a[i + static_cast<bulk_t>(j) * lda] = ab[band_offset(ku, ldab, i, j)];
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+static inline void hb_x_vec(char uplo, uint_t n, uint_t k, real_t alpha, const real_t *a, uint_t lda, const real_t *x, real_t *y)
+{
+	blas::sbmv(uplo, n, k, alpha, a, lda, x, 1, 1, y, 1);
+}
+/*-------------------------------------------------*/
+static inline void hb_x_vec(char uplo, uint_t n, uint_t k, real4_t alpha, const real4_t *a, uint_t lda, const real4_t *x, real4_t *y)
+{
+	blas::sbmv(uplo, n, k, alpha, a, lda, x, 1, 1, y, 1);
+}
+/*-------------------------------------------------*/
+static inline void hb_x_vec(char uplo, uint_t n, uint_t k, complex_t alpha, const complex_t *a, uint_t lda, const complex_t *x, complex_t *y)
+{
+	blas::hbmv(uplo, n, k, alpha, a, lda, x, 1, 1, y, 1);
+}
+/*-------------------------------------------------*/
+static inline void hb_x_vec(char uplo, uint_t n, uint_t k, complex8_t alpha, const complex8_t *a, uint_t lda, const complex8_t *x, complex8_t *y)
+{
+	blas::hbmv(uplo, n, k, alpha, a, lda, x, 1, 1, y, 1);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void band_x_mat(prop_t ptype, uplo_t uplo, op_t opA, uint_t m, uint_t n, uint_t kl, uint_t ku, 
+		T_Scalar alpha, const T_Scalar *ab, uint_t ldab, 
+		uint_t nrhs, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc)
+{
+	//
+	// There is no BLAS3 band kernel, the right hand sides are processed in parallel
+	//
+	if(ptype == prop_t::General) {
+
+		#pragma omp parallel for schedule(static) if(nrhs > 1)
+		for(int_t j = 0; j < static_cast<int_t>(nrhs); j++) {
+			blas::gbmv(static_cast<char>(opA), m, n, kl, ku, alpha, ab, ldab, 
+					b + static_cast<bulk_t>(j) * ldb, 1, T_Scalar(1), 
+					c + static_cast<bulk_t>(j) * ldc, 1);
+		} // j
+
+	} else {
+
+		uint_t kd = (uplo == uplo_t::Lower ? kl : ku);
+
+		#pragma omp parallel for schedule(static) if(nrhs > 1)
+		for(int_t j = 0; j < static_cast<int_t>(nrhs); j++) {
+			hb_x_vec(static_cast<char>(uplo), n, kd, alpha, ab, ldab, 
+					b + static_cast<bulk_t>(j) * ldb, 
+					c + static_cast<bulk_t>(j) * ldc);
+		} // j
+
+	} // ptype
+}
+/*-------------------------------------------------*/
+//
+// Entry k of the off-diagonal p, recovered as the conjugate of q[k] if p is nullptr
+//
+template <typename T_Scalar>
+static inline T_Scalar tri_entry(const T_Scalar *p, const T_Scalar *q, uint_t k, bool conjop)
+{
+	T_Scalar ret = (p ? p[k] : arith::conj(q[k]));
+	return (conjop ? arith::conj(ret) : ret);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void tri_x_mat(op_t opA, uint_t n, T_Scalar alpha, 
+		const T_Scalar *dl, const T_Scalar *d, const T_Scalar *du, 
+		uint_t nrhs, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc)
+{
+	const T_Scalar *lo = (opA == op_t::N ? dl : du);
+	const T_Scalar *up = (opA == op_t::N ? du : dl);
+	bool conjop = (opA == op_t::C);
+	bool hermitian = (!dl || !du); // the imaginary part of the diagonal is ignored
+
+	#pragma omp parallel for collapse(2) schedule(static) if(static_cast<bulk_t>(n) * nrhs >= band_parallel_min_size())
+	for(int_t jj = 0; jj < static_cast<int_t>(nrhs); jj++) {
+		for(int_t ii = 0; ii < static_cast<int_t>(n); ii++) {
+
+			uint_t i = static_cast<uint_t>(ii);
+			const T_Scalar *bj = b + static_cast<bulk_t>(jj) * ldb;
+
+			T_Scalar di = (hermitian ? T_Scalar(arith::getRe(d[i])) : (conjop ? arith::conj(d[i]) : d[i]));
+			T_Scalar sum = di * bj[i];
+
+			if(i > 0    ) sum += tri_entry(lo, up, i - 1, conjop) * bj[i - 1];
+			if(i + 1 < n) sum += tri_entry(up, lo, i    , conjop) * bj[i + 1];
+
+			c[i + static_cast<bulk_t>(jj) * ldc] += alpha * sum;
+
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t tri_factor(prop_t ptype, uint_t n, T_Scalar *dl, T_Scalar *d, T_Scalar *du, 
+		T_Scalar *du2, int_t *ipiv, typename TypeTraits<T_Scalar>::real_type *dr)
+{
+	if(ptype == prop_t::General)
+		return lapack::gttrf(n, dl, d, du, du2, ipiv);
+
+	for(uint_t i = 0; i < n; i++) {
+		dr[i] = arith::getRe(d[i]);
+	} // i
+
+	return lapack::pttrf(n, dr, (dl ? dl : du));
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+int_t tri_solve(prop_t ptype, uint_t n, const T_Scalar *dl, const T_Scalar *d, const T_Scalar *du, 
+		const T_Scalar *du2, const int_t *ipiv, const typename TypeTraits<T_Scalar>::real_type *dr, 
+		uint_t nrhs, T_Scalar *b, uint_t ldb)
+{
+	if(ptype == prop_t::General)
+		return lapack::gttrs('N', n, nrhs, dl, d, du, du2, ipiv, b, ldb);
+
+	return lapack::pttrs((dl ? 'L' : 'U'), n, nrhs, dr, (dl ? dl : du), b, ldb);
+}
+/*-------------------------------------------------*/
+#define instantiate_band(T_Scl) \
+template void band_pack(uint_t, uint_t, uint_t, uint_t, const T_Scl*, uint_t, T_Scl*, uint_t); \
+template void band_unpack(uint_t, uint_t, uint_t, uint_t, const T_Scl*, uint_t, T_Scl*, uint_t); \
+template void band_x_mat(prop_t, uplo_t, op_t, uint_t, uint_t, uint_t, uint_t, T_Scl, const T_Scl*, uint_t, uint_t, const T_Scl*, uint_t, T_Scl*, uint_t); \
+template void tri_x_mat(op_t, uint_t, T_Scl, const T_Scl*, const T_Scl*, const T_Scl*, uint_t, const T_Scl*, uint_t, T_Scl*, uint_t); \
+template int_t tri_factor(prop_t, uint_t, T_Scl*, T_Scl*, T_Scl*, T_Scl*, int_t*, TypeTraits<T_Scl>::real_type*); \
+template int_t tri_solve(prop_t, uint_t, const T_Scl*, const T_Scl*, const T_Scl*, const T_Scl*, const int_t*, const TypeTraits<T_Scl>::real_type*, uint_t, T_Scl*, uint_t)
+instantiate_band(real_t);
+instantiate_band(real4_t);
+instantiate_band(complex_t);
+instantiate_band(complex8_t);
+#undef instantiate_band
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_DNS_BAND_HPP_
+#define CLA3P_BULK_DNS_BAND_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+
+//
+// Band storage (lapack layout) of an m x n matrix with kl sub-diagonals & ku super-diagonals
+// ab is ldab x n (ldab >= kl + ku + 1), entry (i,j) is stored in ab[ku + i - j + j * ldab]
+// For Symmetric/Hermitian matrices the band of the uplo triangle is stored (ku = 0 for Lower, kl = 0 for Upper)
+//
+inline bulk_t band_offset(uint_t ku, uint_t ldab, uint_t i, uint_t j) 
+{ 
+	return static_cast<bulk_t>(ku + i - j) + static_cast<bulk_t>(j) * ldab; 
+}
+
+//
+// Conversion between the band of a (full storage) & ab
+//
+template <typename T_Scalar>
+void band_pack(uint_t m, uint_t n, uint_t kl, uint_t ku, const T_Scalar *a, uint_t lda, T_Scalar *ab, uint_t ldab);
+
+template <typename T_Scalar>
+void band_unpack(uint_t m, uint_t n, uint_t kl, uint_t ku, const T_Scalar *ab, uint_t ldab, T_Scalar *a, uint_t lda);
+
+//
+// Products with band matrices, B & C have nrhs columns
+// General: C += alpha * op(A) * B
+// Symmetric (real)/Hermitian (complex): C += alpha * A * B
+//
+template <typename T_Scalar>
+void band_x_mat(prop_t ptype, uplo_t uplo, op_t opA, uint_t m, uint_t n, uint_t kl, uint_t ku, 
+		T_Scalar alpha, const T_Scalar *ab, uint_t ldab, 
+		uint_t nrhs, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc);
+
+//
+// Products with n x n tridiagonal matrices, B & C have nrhs columns
+// dl, d, du are the sub-diagonal, diagonal & super-diagonal of A
+// A nullptr dl (du) is recovered as the conjugate of du (dl), as in Hermitian matrices
+// C += alpha * op(A) * B
+//
+template <typename T_Scalar>
+void tri_x_mat(op_t opA, uint_t n, T_Scalar alpha, 
+		const T_Scalar *dl, const T_Scalar *d, const T_Scalar *du, 
+		uint_t nrhs, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc);
+
+//
+// Tridiagonal factorization & solution
+// General: LU with partial pivoting of (dl, d, du), du2 & ipiv have size n
+// Symmetric (real)/Hermitian (complex): LDL' of (d, dl) or (d, du), whichever off-diagonal is not nullptr,
+// the real diagonal is kept in dr (size n)
+//
+template <typename T_Scalar>
+int_t tri_factor(prop_t ptype, uint_t n, T_Scalar *dl, T_Scalar *d, T_Scalar *du, 
+		T_Scalar *du2, int_t *ipiv, typename TypeTraits<T_Scalar>::real_type *dr);
+
+template <typename T_Scalar>
+int_t tri_solve(prop_t ptype, uint_t n, const T_Scalar *dl, const T_Scalar *d, const T_Scalar *du, 
+		const T_Scalar *du2, const int_t *ipiv, const typename TypeTraits<T_Scalar>::real_type *dr, 
+		uint_t nrhs, T_Scalar *b, uint_t ldb);
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_DNS_BAND_HPP_
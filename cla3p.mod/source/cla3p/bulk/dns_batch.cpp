@@ -0,0 +1,524 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/dns_batch.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/proxies/blas_proxy.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+//
+// Up to this dimension the native kernels outperform the per-matrix dispatch of blas/lapack
+//
+static uint_t native_max_size_gemm()
+{
+	return 16;
+}
+/*-------------------------------------------------*/
+static uint_t native_max_size_getrf()
+{
+	return 64;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+inline typename TypeTraits<T_Scalar>::real_type abs1(const T_Scalar& v)
+{
+	return (std::abs(arith::getRe(v)) + std::abs(arith::getIm(v)));
+}
+/*-------------------------------------------------*/
+//
+// Offset of op(A)(i,j) in a column major matrix (in units of W interleaved entries)
+//
+inline bulk_t opoff(op_t op, uint_t i, uint_t j, uint_t ld)
+{
+	return (op == op_t::N ? static_cast<bulk_t>(j) * ld + i : static_cast<bulk_t>(i) * ld + j);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_pack(uint_t m, uint_t n, uint_t count, const T_Scalar *b, uint_t ldb, bulk_t strideb, T_Scalar *c, uint_t ldc)
+{
+	uint_t W = batch_compact_width<T_Scalar>();
+	bulk_t gs = static_cast<bulk_t>(ldc) * n * W;
+	int_t ng = static_cast<int_t>(batch_compact_groups<T_Scalar>(count));
+
+#pragma omp parallel for schedule(static)
+	for(int_t g = 0; g < ng; g++) {
+		T_Scalar *cg = c + g * gs;
+		for(uint_t j = 0; j < n; j++) {
+			for(uint_t i = 0; i < ldc; i++) {
+				T_Scalar *cij = cg + (static_cast<bulk_t>(j) * ldc + i) * W;
+				for(uint_t w = 0; w < W; w++) {
+					bulk_t k = static_cast<bulk_t>(g) * W + w;
+					cij[w] = (k < count && i < m ? b[k * strideb + static_cast<bulk_t>(j) * ldb + i] : T_Scalar(0));
+				} // w
+			} // i
+		} // j
+	} // g
+}
+/*-------------------------------------------------*/
+template void batch_pack(uint_t, uint_t, uint_t, const real_t    *, uint_t, bulk_t, real_t    *, uint_t);
+template void batch_pack(uint_t, uint_t, uint_t, const real4_t   *, uint_t, bulk_t, real4_t   *, uint_t);
+template void batch_pack(uint_t, uint_t, uint_t, const complex_t *, uint_t, bulk_t, complex_t *, uint_t);
+template void batch_pack(uint_t, uint_t, uint_t, const complex8_t*, uint_t, bulk_t, complex8_t*, uint_t);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_unpack(uint_t m, uint_t n, uint_t count, const T_Scalar *c, uint_t ldc, T_Scalar *b, uint_t ldb, bulk_t strideb)
+{
+	uint_t W = batch_compact_width<T_Scalar>();
+	bulk_t gs = static_cast<bulk_t>(ldc) * n * W;
+	int_t nn = static_cast<int_t>(count);
+
+#pragma omp parallel for schedule(static)
+	for(int_t k = 0; k < nn; k++) {
+		const T_Scalar *cg = c + (k / W) * gs + (k % W);
+		T_Scalar *bk = b + k * strideb;
+		for(uint_t j = 0; j < n; j++) {
+			for(uint_t i = 0; i < m; i++) {
+				bk[static_cast<bulk_t>(j) * ldb + i] = cg[(static_cast<bulk_t>(j) * ldc + i) * W];
+			} // i
+		} // j
+	} // k
+}
+/*-------------------------------------------------*/
+template void batch_unpack(uint_t, uint_t, uint_t, const real_t    *, uint_t, real_t    *, uint_t, bulk_t);
+template void batch_unpack(uint_t, uint_t, uint_t, const real4_t   *, uint_t, real4_t   *, uint_t, bulk_t);
+template void batch_unpack(uint_t, uint_t, uint_t, const complex_t *, uint_t, complex_t *, uint_t, bulk_t);
+template void batch_unpack(uint_t, uint_t, uint_t, const complex8_t*, uint_t, complex8_t*, uint_t, bulk_t);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void gemm_small(op_t opA, op_t opB, uint_t m, uint_t n, uint_t k, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc)
+{
+	bool conjA = (opA == op_t::C);
+	bool conjB = (opB == op_t::C);
+
+	for(uint_t j = 0; j < n; j++) {
+
+		T_Scalar *cj = c + static_cast<bulk_t>(j) * ldc;
+
+		if(opA == op_t::N) {
+
+			for(uint_t l = 0; l < k; l++) {
+				const T_Scalar *al = a + static_cast<bulk_t>(l) * lda;
+				T_Scalar blj = alpha * opval(conjB, b[opoff(opB, l, j, ldb)]);
+				for(uint_t i = 0; i < m; i++) {
+					cj[i] += al[i] * blj;
+				} // i
+			} // l
+
+		} else {
+
+			for(uint_t i = 0; i < m; i++) {
+				const T_Scalar *ai = a + static_cast<bulk_t>(i) * lda;
+				T_Scalar sum = 0;
+				for(uint_t l = 0; l < k; l++) {
+					sum += opval(conjA, ai[l]) * opval(conjB, b[opoff(opB, l, j, ldb)]);
+				} // l
+				cj[i] += alpha * sum;
+			} // i
+
+		} // opA
+
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_gemm(op_t opA, op_t opB, uint_t m, uint_t n, uint_t k, uint_t count, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, bulk_t stridea, 
+		const T_Scalar *b, uint_t ldb, bulk_t strideb, 
+		T_Scalar *c, uint_t ldc, bulk_t stridec)
+{
+	if(!m || !n || !count) 
+		return;
+
+	if(std::max(m, std::max(n, k)) > native_max_size_gemm()) {
+		blas::gemm_batch_strided(static_cast<char>(opA), static_cast<char>(opB), m, n, k, 
+				alpha, a, lda, stridea, b, ldb, strideb, T_Scalar(1), c, ldc, stridec, count);
+		return;
+	} // blas
+
+	int_t nn = static_cast<int_t>(count);
+
+#pragma omp parallel for schedule(static)
+	for(int_t ib = 0; ib < nn; ib++) {
+		gemm_small(opA, opB, m, n, k, alpha, a + ib * stridea, lda, b + ib * strideb, ldb, c + ib * stridec, ldc);
+	} // ib
+}
+/*-------------------------------------------------*/
+#define instantiate_batch_gemm(T_Scl) \
+template void batch_gemm(op_t, op_t, uint_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Scl*, uint_t, bulk_t, const T_Scl*, uint_t, bulk_t, T_Scl*, uint_t, bulk_t)
+instantiate_batch_gemm(real_t);
+instantiate_batch_gemm(real4_t);
+instantiate_batch_gemm(complex_t);
+instantiate_batch_gemm(complex8_t);
+#undef instantiate_batch_gemm
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_gemm_compact(op_t opA, op_t opB, uint_t m, uint_t n, uint_t k, uint_t count, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, 
+		const T_Scalar *b, uint_t ldb, 
+		T_Scalar *c, uint_t ldc)
+{
+	if(!m || !n || !count) 
+		return;
+
+	uint_t W = batch_compact_width<T_Scalar>();
+	bool conjA = (opA == op_t::C);
+	bool conjB = (opB == op_t::C);
+
+	bulk_t gsa = static_cast<bulk_t>(lda) * (opA == op_t::N ? k : m) * W;
+	bulk_t gsb = static_cast<bulk_t>(ldb) * (opB == op_t::N ? n : k) * W;
+	bulk_t gsc = static_cast<bulk_t>(ldc) * n * W;
+
+	int_t ng = static_cast<int_t>(batch_compact_groups<T_Scalar>(count));
+
+#pragma omp parallel for schedule(static)
+	for(int_t g = 0; g < ng; g++) {
+
+		const T_Scalar *ag = a + g * gsa;
+		const T_Scalar *bg = b + g * gsb;
+		T_Scalar *cg = c + g * gsc;
+
+		for(uint_t j = 0; j < n; j++) {
+			for(uint_t l = 0; l < k; l++) {
+				const T_Scalar *blj = bg + opoff(opB, l, j, ldb) * W;
+				for(uint_t i = 0; i < m; i++) {
+					const T_Scalar *ail = ag + opoff(opA, i, l, lda) * W;
+					T_Scalar *cij = cg + (static_cast<bulk_t>(j) * ldc + i) * W;
+					for(uint_t w = 0; w < W; w++) {
+						cij[w] += alpha * opval(conjA, ail[w]) * opval(conjB, blj[w]);
+					} // w
+				} // i
+			} // l
+		} // j
+
+	} // g
+}
+/*-------------------------------------------------*/
+#define instantiate_batch_gemm_compact(T_Scl) \
+template void batch_gemm_compact(op_t, op_t, uint_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Scl*, uint_t, const T_Scl*, uint_t, T_Scl*, uint_t)
+instantiate_batch_gemm_compact(real_t);
+instantiate_batch_gemm_compact(real4_t);
+instantiate_batch_gemm_compact(complex_t);
+instantiate_batch_gemm_compact(complex8_t);
+#undef instantiate_batch_gemm_compact
+/*-------------------------------------------------*/
+//
+// Unblocked right-looking LU with partial pivoting (lapack getf2)
+//
+template <typename T_Scalar>
+static int_t getrf_small(uint_t n, T_Scalar *a, uint_t lda, int_t *ipiv)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	int_t info = 0;
+
+	for(uint_t j = 0; j < n; j++) {
+
+		T_Scalar *aj = a + static_cast<bulk_t>(j) * lda;
+
+		uint_t p = j;
+		T_RScalar pmax = abs1(aj[j]);
+		for(uint_t i = j + 1; i < n; i++) {
+			if(abs1(aj[i]) > pmax) {
+				p = i;
+				pmax = abs1(aj[i]);
+			} // new max
+		} // i
+
+		ipiv[j] = static_cast<int_t>(p + 1);
+
+		if(pmax == T_RScalar(0)) {
+			if(!info) info = static_cast<int_t>(j + 1);
+			continue;
+		} // zero pivot
+
+		if(p != j) {
+			for(uint_t c = 0; c < n; c++) {
+				std::swap(a[static_cast<bulk_t>(c) * lda + j], a[static_cast<bulk_t>(c) * lda + p]);
+			} // c
+		} // swap
+
+		T_Scalar inv = T_Scalar(1) / aj[j];
+		for(uint_t i = j + 1; i < n; i++) {
+			aj[i] *= inv;
+		} // i
+
+		for(uint_t c = j + 1; c < n; c++) {
+			T_Scalar *ac = a + static_cast<bulk_t>(c) * lda;
+			T_Scalar ajc = ac[j];
+			for(uint_t i = j + 1; i < n; i++) {
+				ac[i] -= aj[i] * ajc;
+			} // i
+		} // c
+
+	} // j
+
+	return info;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_getrf(uint_t n, uint_t count, T_Scalar *a, uint_t lda, bulk_t stridea, int_t *ipiv, int_t *info)
+{
+	bool native = (n <= native_max_size_getrf());
+	int_t nn = static_cast<int_t>(count);
+
+#pragma omp parallel for schedule(static)
+	for(int_t ib = 0; ib < nn; ib++) {
+		T_Scalar *ak = a + ib * stridea;
+		int_t *pk = ipiv + ib * static_cast<bulk_t>(n);
+		info[ib] = (native ? getrf_small(n, ak, lda, pk) : lapack::getrf(n, n, ak, lda, pk));
+	} // ib
+}
+/*-------------------------------------------------*/
+template void batch_getrf(uint_t, uint_t, real_t    *, uint_t, bulk_t, int_t*, int_t*);
+template void batch_getrf(uint_t, uint_t, real4_t   *, uint_t, bulk_t, int_t*, int_t*);
+template void batch_getrf(uint_t, uint_t, complex_t *, uint_t, bulk_t, int_t*, int_t*);
+template void batch_getrf(uint_t, uint_t, complex8_t*, uint_t, bulk_t, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_getrf_compact(uint_t n, uint_t count, T_Scalar *a, uint_t lda, int_t *ipiv, int_t *info)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	const uint_t W = batch_compact_width<T_Scalar>();
+	bulk_t gs = static_cast<bulk_t>(lda) * n * W;
+	int_t ng = static_cast<int_t>(batch_compact_groups<T_Scalar>(count));
+
+	std::fill(info, info + count, 0);
+
+#pragma omp parallel for schedule(static)
+	for(int_t g = 0; g < ng; g++) {
+
+		T_Scalar *ag = a + g * gs;
+		T_Scalar inv[64 / sizeof(T_Scalar)];
+
+		for(uint_t j = 0; j < n; j++) {
+
+			T_Scalar *ajj = ag + (static_cast<bulk_t>(j) * lda + j) * W;
+
+			//
+			// Pivoting is lane dependent, search & swap one lane at a time
+			//
+			for(uint_t w = 0; w < W; w++) {
+
+				bulk_t kb = static_cast<bulk_t>(g) * W + w;
+
+				uint_t p = j;
+				T_RScalar pmax = abs1(ajj[w]);
+				for(uint_t i = j + 1; i < n; i++) {
+					T_RScalar v = abs1(ajj[(i - j) * W + w]);
+					if(v > pmax) {
+						p = i;
+						pmax = v;
+					} // new max
+				} // i
+
+				if(kb < count) {
+					ipiv[kb * n + j] = static_cast<int_t>(p + 1);
+					if(pmax == T_RScalar(0) && !info[kb]) info[kb] = static_cast<int_t>(j + 1);
+				} // valid lane
+
+				if(p != j) {
+					for(uint_t c = 0; c < n; c++) {
+						T_Scalar *ac = ag + static_cast<bulk_t>(c) * lda * W;
+						std::swap(ac[j * W + w], ac[p * W + w]);
+					} // c
+				} // swap
+
+				inv[w] = (pmax == T_RScalar(0) ? T_Scalar(0) : T_Scalar(1) / ajj[w]);
+
+			} // w
+
+			for(uint_t i = j + 1; i < n; i++) {
+				T_Scalar *aij = ajj + (i - j) * W;
+				for(uint_t w = 0; w < W; w++) {
+					aij[w] *= inv[w];
+				} // w
+			} // i
+
+			for(uint_t c = j + 1; c < n; c++) {
+				T_Scalar *ac = ag + static_cast<bulk_t>(c) * lda * W;
+				const T_Scalar *ajc = ac + j * W;
+				for(uint_t i = j + 1; i < n; i++) {
+					T_Scalar *aic = ac + i * W;
+					const T_Scalar *aij = ajj + (i - j) * W;
+					for(uint_t w = 0; w < W; w++) {
+						aic[w] -= aij[w] * ajc[w];
+					} // w
+				} // i
+			} // c
+
+		} // j
+
+	} // g
+}
+/*-------------------------------------------------*/
+template void batch_getrf_compact(uint_t, uint_t, real_t    *, uint_t, int_t*, int_t*);
+template void batch_getrf_compact(uint_t, uint_t, real4_t   *, uint_t, int_t*, int_t*);
+template void batch_getrf_compact(uint_t, uint_t, complex_t *, uint_t, int_t*, int_t*);
+template void batch_getrf_compact(uint_t, uint_t, complex8_t*, uint_t, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void getrs_small(uint_t n, uint_t nrhs, const T_Scalar *a, uint_t lda, const int_t *ipiv, T_Scalar *b, uint_t ldb)
+{
+	for(uint_t r = 0; r < nrhs; r++) {
+
+		T_Scalar *x = b + static_cast<bulk_t>(r) * ldb;
+
+		for(uint_t j = 0; j < n; j++) {
+			uint_t p = static_cast<uint_t>(ipiv[j] - 1);
+			if(p != j) std::swap(x[j], x[p]);
+		} // j
+
+		for(uint_t j = 0; j < n; j++) {
+			const T_Scalar *aj = a + static_cast<bulk_t>(j) * lda;
+			T_Scalar xj = x[j];
+			for(uint_t i = j + 1; i < n; i++) {
+				x[i] -= aj[i] * xj;
+			} // i
+		} // j
+
+		for(uint_t jj = n; jj > 0; jj--) {
+			uint_t j = jj - 1;
+			const T_Scalar *aj = a + static_cast<bulk_t>(j) * lda;
+			x[j] /= aj[j];
+			T_Scalar xj = x[j];
+			for(uint_t i = 0; i < j; i++) {
+				x[i] -= aj[i] * xj;
+			} // i
+		} // j
+
+	} // r
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_getrs(uint_t n, uint_t nrhs, uint_t count, 
+		const T_Scalar *a, uint_t lda, bulk_t stridea, const int_t *ipiv, 
+		T_Scalar *b, uint_t ldb, bulk_t strideb)
+{
+	bool native = (n <= native_max_size_getrf());
+	int_t nn = static_cast<int_t>(count);
+
+#pragma omp parallel for schedule(static)
+	for(int_t ib = 0; ib < nn; ib++) {
+		const T_Scalar *ak = a + ib * stridea;
+		const int_t *pk = ipiv + ib * static_cast<bulk_t>(n);
+		T_Scalar *bk = b + ib * strideb;
+		if(native) {
+			getrs_small(n, nrhs, ak, lda, pk, bk, ldb);
+		} else {
+			lapack::getrs('N', n, nrhs, ak, lda, pk, bk, ldb);
+		} // native
+	} // ib
+}
+/*-------------------------------------------------*/
+#define instantiate_batch_getrs(T_Scl) \
+template void batch_getrs(uint_t, uint_t, uint_t, const T_Scl*, uint_t, bulk_t, const int_t*, T_Scl*, uint_t, bulk_t)
+instantiate_batch_getrs(real_t);
+instantiate_batch_getrs(real4_t);
+instantiate_batch_getrs(complex_t);
+instantiate_batch_getrs(complex8_t);
+#undef instantiate_batch_getrs
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void batch_getrs_compact(uint_t n, uint_t nrhs, uint_t count, 
+		const T_Scalar *a, uint_t lda, const int_t *ipiv, T_Scalar *b, uint_t ldb)
+{
+	const uint_t W = batch_compact_width<T_Scalar>();
+	bulk_t gsa = static_cast<bulk_t>(lda) * n * W;
+	bulk_t gsb = static_cast<bulk_t>(ldb) * nrhs * W;
+	int_t ng = static_cast<int_t>(batch_compact_groups<T_Scalar>(count));
+
+#pragma omp parallel for schedule(static)
+	for(int_t g = 0; g < ng; g++) {
+
+		const T_Scalar *ag = a + g * gsa;
+		T_Scalar *bg = b + g * gsb;
+
+		for(uint_t r = 0; r < nrhs; r++) {
+
+			T_Scalar *x = bg + static_cast<bulk_t>(r) * ldb * W;
+
+			for(uint_t w = 0; w < W; w++) {
+				bulk_t kb = static_cast<bulk_t>(g) * W + w;
+				if(kb >= count) break;
+				for(uint_t j = 0; j < n; j++) {
+					uint_t p = static_cast<uint_t>(ipiv[kb * n + j] - 1);
+					if(p != j) std::swap(x[j * W + w], x[p * W + w]);
+				} // j
+			} // w
+
+			for(uint_t j = 0; j < n; j++) {
+				const T_Scalar *aj = ag + static_cast<bulk_t>(j) * lda * W;
+				const T_Scalar *xj = x + j * W;
+				for(uint_t i = j + 1; i < n; i++) {
+					const T_Scalar *aij = aj + i * W;
+					T_Scalar *xi = x + i * W;
+					for(uint_t w = 0; w < W; w++) {
+						xi[w] -= aij[w] * xj[w];
+					} // w
+				} // i
+			} // j
+
+			for(uint_t jj = n; jj > 0; jj--) {
+				uint_t j = jj - 1;
+				const T_Scalar *aj = ag + static_cast<bulk_t>(j) * lda * W;
+				const T_Scalar *ajj = aj + j * W;
+				T_Scalar *xj = x + j * W;
+				for(uint_t w = 0; w < W; w++) {
+					xj[w] = (ajj[w] == T_Scalar(0) ? T_Scalar(0) : xj[w] / ajj[w]);
+				} // w
+				for(uint_t i = 0; i < j; i++) {
+					const T_Scalar *aij = aj + i * W;
+					T_Scalar *xi = x + i * W;
+					for(uint_t w = 0; w < W; w++) {
+						xi[w] -= aij[w] * xj[w];
+					} // w
+				} // i
+			} // j
+
+		} // r
+
+	} // g
+}
+/*-------------------------------------------------*/
+#define instantiate_batch_getrs_compact(T_Scl) \
+template void batch_getrs_compact(uint_t, uint_t, uint_t, const T_Scl*, uint_t, const int_t*, T_Scl*, uint_t)
+instantiate_batch_getrs_compact(real_t);
+instantiate_batch_getrs_compact(real4_t);
+instantiate_batch_getrs_compact(complex_t);
+instantiate_batch_getrs_compact(complex8_t);
+#undef instantiate_batch_getrs_compact
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_DNS_BATCH_HPP_
+#define CLA3P_BULK_DNS_BATCH_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+
+//
+// Kernels on batches of small uniformly sized matrices
+// All kernels run in parallel across the batch
+//
+// Strided layout: matrix k starts at a + k * stride (column major, leading dimension ld)
+// Compact layout: groups of batch_compact_width() matrices are interleaved, 
+//                 entry (i,j) of matrix k is at a + g * ld * n * W + (j * ld + i) * W + k % W, g = k / W
+//                 lanes past the batch count are padding
+//
+// Pivots are 1-based (lapack style), stored as n consecutive entries per matrix
+// Per matrix info follows the lapack convention (0 success, i > 0 zero pivot at position i)
+//
+
+//
+// The number of interleaved matrices of a compact group (one 64-byte line per entry)
+//
+template <typename T_Scalar>
+inline uint_t batch_compact_width() { return 64 / sizeof(T_Scalar); }
+
+//
+// The number of compact groups needed for count matrices
+//
+template <typename T_Scalar>
+inline uint_t batch_compact_groups(uint_t count) 
+{ 
+	return (count + batch_compact_width<T_Scalar>() - 1) / batch_compact_width<T_Scalar>(); 
+}
+
+//
+// Conversion between strided (b) & compact (c) layouts
+//
+template <typename T_Scalar>
+void batch_pack(uint_t m, uint_t n, uint_t count, const T_Scalar *b, uint_t ldb, bulk_t strideb, T_Scalar *c, uint_t ldc);
+
+template <typename T_Scalar>
+void batch_unpack(uint_t m, uint_t n, uint_t count, const T_Scalar *c, uint_t ldc, T_Scalar *b, uint_t ldb, bulk_t strideb);
+
+//
+// Update: C[k] += alpha * op(A[k]) * op(B[k]), op(A[k]): m x k, op(B[k]): k x n
+//
+template <typename T_Scalar>
+void batch_gemm(op_t opA, op_t opB, uint_t m, uint_t n, uint_t k, uint_t count, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, bulk_t stridea, 
+		const T_Scalar *b, uint_t ldb, bulk_t strideb, 
+		T_Scalar *c, uint_t ldc, bulk_t stridec);
+
+template <typename T_Scalar>
+void batch_gemm_compact(op_t opA, op_t opB, uint_t m, uint_t n, uint_t k, uint_t count, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, 
+		const T_Scalar *b, uint_t ldb, 
+		T_Scalar *c, uint_t ldc);
+
+//
+// Factorize: A[k] = P[k] * L[k] * U[k], A[k]: n x n
+//
+template <typename T_Scalar>
+void batch_getrf(uint_t n, uint_t count, T_Scalar *a, uint_t lda, bulk_t stridea, int_t *ipiv, int_t *info);
+
+template <typename T_Scalar>
+void batch_getrf_compact(uint_t n, uint_t count, T_Scalar *a, uint_t lda, int_t *ipiv, int_t *info);
+
+//
+// Solve: A[k] * X[k] = B[k] using the factors of batch_getrf(), B[k] overwritten by X[k]
+//
+template <typename T_Scalar>
+void batch_getrs(uint_t n, uint_t nrhs, uint_t count, 
+		const T_Scalar *a, uint_t lda, bulk_t stridea, const int_t *ipiv, 
+		T_Scalar *b, uint_t ldb, bulk_t strideb);
+
+template <typename T_Scalar>
+void batch_getrs_compact(uint_t n, uint_t nrhs, uint_t count, 
+		const T_Scalar *a, uint_t lda, const int_t *ipiv, T_Scalar *b, uint_t ldb);
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_DNS_BATCH_HPP_
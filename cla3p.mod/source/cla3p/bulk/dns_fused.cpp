@@ -0,0 +1,274 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/dns_fused.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+//
+// Below this size the kernels are memory bound on a single core 
+// & the thread startup overhead dominates
+//
+static uint_t parallel_min_size()
+{
+	return 8192;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+inline typename TypeTraits<T_Scalar>::real_type abs2(const T_Scalar& v)
+{
+	return (arith::getRe(v) * arith::getRe(v) + arith::getIm(v) * arith::getIm(v));
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+T_Scalar vec_dotc(uint_t n, const T_Scalar *x, const T_Scalar *y)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar re = 0;
+	T_RScalar im = 0;
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) reduction(+:re,im) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		T_Scalar v = arith::conj(x[i]) * y[i];
+		re += arith::getRe(v);
+		im += arith::getIm(v);
+	} // i
+
+	T_Scalar ret = re;
+	arith::setIm(ret, im);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template real_t     vec_dotc(uint_t, const real_t    *, const real_t    *);
+template real4_t    vec_dotc(uint_t, const real4_t   *, const real4_t   *);
+template complex_t  vec_dotc(uint_t, const complex_t *, const complex_t *);
+template complex8_t vec_dotc(uint_t, const complex8_t*, const complex8_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_nrm2sq(uint_t n, const T_Scalar *x)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) reduction(+:ret) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		ret += abs2(x[i]);
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template real_t  vec_nrm2sq(uint_t, const real_t    *);
+template real4_t vec_nrm2sq(uint_t, const real4_t   *);
+template real_t  vec_nrm2sq(uint_t, const complex_t *);
+template real4_t vec_nrm2sq(uint_t, const complex8_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void vec_axpby(uint_t n, T_Scalar alpha, const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	int_t nn = static_cast<int_t>(n);
+
+	if(beta == T_Scalar(0)) {
+
+#pragma omp parallel for schedule(static) if(n >= parallel_min_size())
+		for(int_t i = 0; i < nn; i++) {
+			y[i] = alpha * x[i];
+		} // i
+
+	} else {
+
+#pragma omp parallel for schedule(static) if(n >= parallel_min_size())
+		for(int_t i = 0; i < nn; i++) {
+			y[i] = alpha * x[i] + beta * y[i];
+		} // i
+
+	} // beta
+}
+/*-------------------------------------------------*/
+template void vec_axpby(uint_t, real_t    , const real_t    *, real_t    , real_t    *);
+template void vec_axpby(uint_t, real4_t   , const real4_t   *, real4_t   , real4_t   *);
+template void vec_axpby(uint_t, complex_t , const complex_t *, complex_t , complex_t *);
+template void vec_axpby(uint_t, complex8_t, const complex8_t*, complex8_t, complex8_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void vec_diag_x_vec(uint_t n, const T_Scalar *d, const T_Scalar *x, T_Scalar *y)
+{
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		y[i] = d[i] * x[i];
+	} // i
+}
+/*-------------------------------------------------*/
+template void vec_diag_x_vec(uint_t, const real_t    *, const real_t    *, real_t    *);
+template void vec_diag_x_vec(uint_t, const real4_t   *, const real4_t   *, real4_t   *);
+template void vec_diag_x_vec(uint_t, const complex_t *, const complex_t *, complex_t *);
+template void vec_diag_x_vec(uint_t, const complex8_t*, const complex8_t*, complex8_t*);
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_waxpy_nrm2sq(uint_t n, 
+		const T_Scalar *x, T_Scalar alpha, const T_Scalar *y, T_Scalar *w)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) reduction(+:ret) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		w[i] = x[i] + alpha * y[i];
+		ret += abs2(w[i]);
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_vec_waxpy_nrm2sq(T_Scl) \
+template typename TypeTraits<T_Scl>::real_type vec_waxpy_nrm2sq(uint_t, \
+		const T_Scl*, T_Scl, const T_Scl*, T_Scl*)
+instantiate_vec_waxpy_nrm2sq(real_t);
+instantiate_vec_waxpy_nrm2sq(real4_t);
+instantiate_vec_waxpy_nrm2sq(complex_t);
+instantiate_vec_waxpy_nrm2sq(complex8_t);
+#undef instantiate_vec_waxpy_nrm2sq
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_cg_update(uint_t n, T_Scalar alpha, 
+		const T_Scalar *p, const T_Scalar *q, T_Scalar *x, T_Scalar *r)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) reduction(+:ret) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		x[i] += alpha * p[i];
+		r[i] -= alpha * q[i];
+		ret += abs2(r[i]);
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_vec_cg_update(T_Scl) \
+template typename TypeTraits<T_Scl>::real_type vec_cg_update(uint_t, T_Scl, \
+		const T_Scl*, const T_Scl*, T_Scl*, T_Scl*)
+instantiate_vec_cg_update(real_t);
+instantiate_vec_cg_update(real4_t);
+instantiate_vec_cg_update(complex_t);
+instantiate_vec_cg_update(complex8_t);
+#undef instantiate_vec_cg_update
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void vec_bicgstab_direction(uint_t n, T_Scalar beta, T_Scalar omega, 
+		const T_Scalar *r, const T_Scalar *v, T_Scalar *p)
+{
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		p[i] = r[i] + beta * (p[i] - omega * v[i]);
+	} // i
+}
+/*-------------------------------------------------*/
+#define instantiate_vec_bicgstab_direction(T_Scl) \
+template void vec_bicgstab_direction(uint_t, T_Scl, T_Scl, \
+		const T_Scl*, const T_Scl*, T_Scl*)
+instantiate_vec_bicgstab_direction(real_t);
+instantiate_vec_bicgstab_direction(real4_t);
+instantiate_vec_bicgstab_direction(complex_t);
+instantiate_vec_bicgstab_direction(complex8_t);
+#undef instantiate_vec_bicgstab_direction
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_bicgstab_update(uint_t n, T_Scalar alpha, T_Scalar omega, 
+		const T_Scalar *p, const T_Scalar *z, const T_Scalar *s, const T_Scalar *t, T_Scalar *x, T_Scalar *r)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	T_RScalar ret = 0;
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) reduction(+:ret) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		x[i] += alpha * p[i] + omega * z[i];
+		r[i] = s[i] - omega * t[i];
+		ret += abs2(r[i]);
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+#define instantiate_vec_bicgstab_update(T_Scl) \
+template typename TypeTraits<T_Scl>::real_type vec_bicgstab_update(uint_t, T_Scl, T_Scl, \
+		const T_Scl*, const T_Scl*, const T_Scl*, const T_Scl*, T_Scl*, T_Scl*)
+instantiate_vec_bicgstab_update(real_t);
+instantiate_vec_bicgstab_update(real4_t);
+instantiate_vec_bicgstab_update(complex_t);
+instantiate_vec_bicgstab_update(complex8_t);
+#undef instantiate_vec_bicgstab_update
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void vec_minres_update(uint_t n, 
+		typename TypeTraits<T_Scalar>::real_type c, 
+		typename TypeTraits<T_Scalar>::real_type a, 
+		typename TypeTraits<T_Scalar>::real_type b, 
+		typename TypeTraits<T_Scalar>::real_type phi, 
+		const T_Scalar *v, const T_Scalar *w1, const T_Scalar *w2, T_Scalar *w, T_Scalar *x)
+{
+	int_t nn = static_cast<int_t>(n);
+
+#pragma omp parallel for schedule(static) if(n >= parallel_min_size())
+	for(int_t i = 0; i < nn; i++) {
+		w[i] = c * (v[i] - a * w1[i] - b * w2[i]);
+		x[i] += phi * w[i];
+	} // i
+}
+/*-------------------------------------------------*/
+#define instantiate_vec_minres_update(T_Scl) \
+template void vec_minres_update(uint_t, \
+		typename TypeTraits<T_Scl>::real_type, \
+		typename TypeTraits<T_Scl>::real_type, \
+		typename TypeTraits<T_Scl>::real_type, \
+		typename TypeTraits<T_Scl>::real_type, \
+		const T_Scl*, const T_Scl*, const T_Scl*, T_Scl*, T_Scl*)
+instantiate_vec_minres_update(real_t);
+instantiate_vec_minres_update(real4_t);
+instantiate_vec_minres_update(complex_t);
+instantiate_vec_minres_update(complex8_t);
+#undef instantiate_vec_minres_update
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_DNS_FUSED_HPP_
+#define CLA3P_BULK_DNS_FUSED_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+
+//
+// Multithreaded single-pass vector kernels used by iterative solvers
+// Kernels returning a norm compute it on the fly, on the updated values
+//
+
+//
+// Return: conj(x)^T * y
+//
+template <typename T_Scalar>
+T_Scalar vec_dotc(uint_t n, const T_Scalar *x, const T_Scalar *y);
+
+//
+// Return: ||x||^2
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_nrm2sq(uint_t n, const T_Scalar *x);
+
+//
+// Update: y = alpha * x + beta * y
+//
+template <typename T_Scalar>
+void vec_axpby(uint_t n, T_Scalar alpha, const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: y = d .* x (elementwise)
+//
+template <typename T_Scalar>
+void vec_diag_x_vec(uint_t n, const T_Scalar *d, const T_Scalar *x, T_Scalar *y);
+
+//
+// Update: w = x + alpha * y
+// Return: ||w||^2
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_waxpy_nrm2sq(uint_t n, 
+		const T_Scalar *x, T_Scalar alpha, const T_Scalar *y, T_Scalar *w);
+
+//
+// Update: x += alpha * p, r -= alpha * q
+// Return: ||r||^2
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_cg_update(uint_t n, T_Scalar alpha, 
+		const T_Scalar *p, const T_Scalar *q, T_Scalar *x, T_Scalar *r);
+
+//
+// Update: p = r + beta * (p - omega * v)
+//
+template <typename T_Scalar>
+void vec_bicgstab_direction(uint_t n, T_Scalar beta, T_Scalar omega, 
+		const T_Scalar *r, const T_Scalar *v, T_Scalar *p);
+
+//
+// Update: x += alpha * p + omega * z, r = s - omega * t
+// Return: ||r||^2
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type vec_bicgstab_update(uint_t n, T_Scalar alpha, T_Scalar omega, 
+		const T_Scalar *p, const T_Scalar *z, const T_Scalar *s, const T_Scalar *t, T_Scalar *x, T_Scalar *r);
+
+//
+// Update: w = c * (v - a * w1 - b * w2), x += phi * w
+//
+template <typename T_Scalar>
+void vec_minres_update(uint_t n, 
+		typename TypeTraits<T_Scalar>::real_type c, 
+		typename TypeTraits<T_Scalar>::real_type a, 
+		typename TypeTraits<T_Scalar>::real_type b, 
+		typename TypeTraits<T_Scalar>::real_type phi, 
+		const T_Scalar *v, const T_Scalar *w1, const T_Scalar *w2, T_Scalar *w, T_Scalar *x);
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_DNS_FUSED_HPP_
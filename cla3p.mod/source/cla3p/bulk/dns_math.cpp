@@ -18,6 +18,7 @@
 #include "cla3p/bulk/dns_math.hpp"
 
 // system
+#include <algorithm>
 
 // 3rd
 
@@ -53,6 +54,71 @@ template void update(uplo_t, uint_t, uint_t, complex8_t, const complex8_t*, uint
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Scalar>
+static void update_op_block(bool trans, bool conj, uint_t m, uint_t n, T_Scalar alpha, 
+		const T_Scalar *a, uint_t lda, T_Scalar *c, uint_t ldc)
+{
+	for(uint_t j = 0; j < n; j++) {
+		T_Scalar *cj = ptrmv(ldc,c,0,j);
+		if(trans) {
+			if(conj) for(uint_t i = 0; i < m; i++) cj[i] += alpha * arith::conj(entry(lda,a,j,i));
+			else     for(uint_t i = 0; i < m; i++) cj[i] += alpha * entry(lda,a,j,i);
+		} else {
+			const T_Scalar *aj = ptrmv(lda,a,0,j);
+			if(conj) for(uint_t i = 0; i < m; i++) cj[i] += alpha * arith::conj(aj[i]);
+			else     for(uint_t i = 0; i < m; i++) cj[i] += alpha * aj[i];
+		} // trans
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void update_op(uplo_t uplo, op_t opA, bool conjA, uint_t m, uint_t n, T_Scalar alpha, const T_Scalar *a, uint_t lda, T_Scalar *c, uint_t ldc)
+{
+	if(!m || !n || alpha == T_Scalar(0)) return;
+
+	bool trans = (opA != op_t::N);
+	bool conj = (conjA != (opA == op_t::C));
+
+	if(!trans && !conj) {
+		update(uplo, m, n, alpha, a, lda, c, ldc);
+		return;
+	} // plain update
+
+	if(!trans) {
+
+		for(uint_t j = 0; j < n; j++) {
+			RowRange ir = irange(uplo, m, j);
+			update_op_block(false, conj, ir.ilen, 1, alpha, ptrmv(lda,a,ir.ibgn,j), lda, ptrmv(ldc,c,ir.ibgn,j), ldc);
+		} // j
+
+		return;
+	} // no transposition
+
+	if(uplo != uplo_t::Full) {
+		throw err::Exception("Transposed updates are applied on full storage");
+	} // uplo
+
+	//
+	// Tiled so that both the rows of A and the columns of C stay in cache
+	//
+	const uint_t bs = 64;
+
+	for(uint_t jb = 0; jb < n; jb += bs) {
+		uint_t nb = std::min(bs, n - jb);
+		for(uint_t ib = 0; ib < m; ib += bs) {
+			uint_t mb = std::min(bs, m - ib);
+			update_op_block(true, conj, mb, nb, alpha, ptrmv(lda,a,jb,ib), lda, ptrmv(ldc,c,ib,jb), ldc);
+		} // ib
+	} // jb
+}
+/*-------------------------------------------------*/
+template void update_op(uplo_t, op_t, bool, uint_t, uint_t, real_t    , const real_t    *, uint_t, real_t    *, uint_t);
+template void update_op(uplo_t, op_t, bool, uint_t, uint_t, real4_t   , const real4_t   *, uint_t, real4_t   *, uint_t);
+template void update_op(uplo_t, op_t, bool, uint_t, uint_t, complex_t , const complex_t *, uint_t, complex_t *, uint_t);
+template void update_op(uplo_t, op_t, bool, uint_t, uint_t, complex8_t, const complex8_t*, uint_t, complex8_t*, uint_t);
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Scalar>
 void add(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha, const T_Scalar *a, uint_t lda, 
 		T_Scalar beta, const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc)
 {
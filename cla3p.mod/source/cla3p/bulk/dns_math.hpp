@@ -32,6 +32,13 @@ namespace dns {
 template <typename T_Scalar>
 void update(uplo_t uplo, uint_t m, uint_t n, T_Scalar alpha, const T_Scalar *a, uint_t lda, T_Scalar *c, uint_t ldc);
 
+//
+// Update: C += alpha * op(A), op(A) is optionally conjugated
+// C(m x n), transpositions apply on full storage only
+//
+template <typename T_Scalar>
+void update_op(uplo_t uplo, op_t opA, bool conjA, uint_t m, uint_t n, T_Scalar alpha, const T_Scalar *a, uint_t lda, T_Scalar *c, uint_t ldc);
+
 //
 // Update: C = alpha * A + beta * B
 // C(m x n)
@@ -0,0 +1,328 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/dns_rfp.hpp"
+
+// system
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/bulk/dns_ssq.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+static inline bulk_t rfp_parallel_min_size()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+RfpBlocks rfp_blocks(uplo_t uplo, uint_t n)
+{
+	RfpBlocks ret;
+
+	bool lower = (uplo == uplo_t::Lower);
+
+	if(n % 2) {
+
+		ret.n1 = (lower ? n - n / 2 : n / 2);
+		ret.n2 = n - ret.n1;
+		ret.ld = n;
+		ret.t1 = (lower ? 0     : ret.n2);
+		ret.t2 = (lower ? n     : ret.n1);
+		ret.s  = (lower ? ret.n1 : 0    );
+
+	} else {
+
+		uint_t k = n / 2;
+		ret.n1 = k;
+		ret.n2 = k;
+		ret.ld = n + 1;
+		ret.t1 = (lower ? 1     : k + 1);
+		ret.t2 = (lower ? 0     : k    );
+		ret.s  = (lower ? k + 1 : 0    );
+
+	} // odd/even
+
+	return ret;
+}
+/*-------------------------------------------------*/
+bulk_t rfp_offset(uplo_t uplo, uint_t n, uint_t i, uint_t j, bool& conj)
+{
+	RfpBlocks B = rfp_blocks(uplo, n);
+
+	bulk_t ld = B.ld;
+	uint_t n1 = B.n1;
+
+	conj = false;
+
+	if(uplo == uplo_t::Lower) {
+		if(j >= n1) {
+			conj = true;
+			return B.t2 + (j - n1) + (i - n1) * ld;
+		} // T2
+		if(i >= n1) return B.s + (i - n1) + j * ld;
+		return B.t1 + i + j * ld;
+	} // lower
+
+	if(i >= n1) return B.t2 + (i - n1) + (j - n1) * ld;
+	if(j >= n1) return B.s + i + (j - n1) * ld;
+	conj = true;
+	return B.t1 + j + i * ld;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void rfp_pack(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *arf)
+{
+	if(!n) return;
+	int_t info = lapack::trttf('N', static_cast<char>(uplo), n, a, lda, arf);
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void rfp_unpack(uplo_t uplo, uint_t n, const T_Scalar *arf, T_Scalar *a, uint_t lda)
+{
+	if(!n) return;
+	int_t info = lapack::tfttr('N', static_cast<char>(uplo), n, arf, a, lda);
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+//
+// Calls f(i,j,v) for all stored entries, (i,j) in the uplo triangle of A, v = A(i,j) or its conjugate
+//
+template <typename T_Scalar, typename T_Func>
+static void rfp_visit(uplo_t uplo, uint_t n, const T_Scalar *arf, T_Func f)
+{
+	RfpBlocks B = rfp_blocks(uplo, n);
+
+	bool lower = (uplo == uplo_t::Lower);
+	bulk_t ld = B.ld;
+
+	const T_Scalar *t1 = arf + B.t1;
+	const T_Scalar *t2 = arf + B.t2;
+	const T_Scalar *s  = arf + B.s;
+
+	for(uint_t c = 0; c < B.n1; c++) {
+		for(uint_t r = c; r < B.n1; r++) {
+			if(lower) f(r, c, t1[r + c * ld]);
+			else      f(c, r, t1[r + c * ld]);
+		} // r
+	} // c
+
+	for(uint_t c = 0; c < B.n2; c++) {
+		for(uint_t r = 0; r <= c; r++) {
+			if(lower) f(B.n1 + c, B.n1 + r, t2[r + c * ld]);
+			else      f(B.n1 + r, B.n1 + c, t2[r + c * ld]);
+		} // r
+	} // c
+
+	uint_t sm = (lower ? B.n2 : B.n1);
+	uint_t sn = (lower ? B.n1 : B.n2);
+
+	for(uint_t c = 0; c < sn; c++) {
+		for(uint_t r = 0; r < sm; r++) {
+			if(lower) f(B.n1 + r, c, s[r + c * ld]);
+			else      f(r, B.n1 + c, s[r + c * ld]);
+		} // r
+	} // c
+}
+/*-------------------------------------------------*/
+//
+// Absolute column (cols = true) or row sums, symmetric/hermitian entries count for both
+//
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type rfp_norm_sums(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf, bool cols)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	std::vector<T_RScalar> sums(n, T_RScalar(0));
+
+	bool both = (ptype != prop_t::Triangular);
+
+	rfp_visit(uplo, n, arf, [&](uint_t i, uint_t j, const T_Scalar& v) {
+			T_RScalar absv = std::abs(v);
+			sums[cols ? j : i] += absv;
+			if(both && i != j) sums[cols ? i : j] += absv;
+			});
+
+	T_RScalar ret = 0;
+
+	for(uint_t k = 0; k < n; k++) {
+		if(!(sums[k] <= ret)) ret = sums[k]; // propagates NaN
+	} // k
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_max(uint_t n, const T_Scalar *arf)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	RfpBlocks B = rfp_blocks(uplo_t::Lower, n);
+
+	T_RScalar ret = 0;
+	int_t nc = static_cast<int_t>(rfp_size(n) / B.ld);
+
+	#pragma omp parallel for schedule(static) reduction(max:ret) if(rfp_size(n) >= rfp_parallel_min_size())
+	for(int_t j = 0; j < nc; j++) {
+		const T_Scalar *aj = arf + static_cast<bulk_t>(j) * B.ld;
+		T_RScalar colmax = 0;
+		for(uint_t i = 0; i < B.ld; i++) {
+			colmax = std::max(colmax, static_cast<T_RScalar>(std::abs(aj[i])));
+		} // i
+		ret = std::max(ret, colmax);
+	} // j
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_one(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf)
+{
+	return rfp_norm_sums(ptype, uplo, n, arf, true);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_inf(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf)
+{
+	return rfp_norm_sums(ptype, uplo, n, arf, false);
+}
+/*-------------------------------------------------*/
+//
+// All stored values are entries of the matrix, 
+// for symmetric/hermitian matrices the off-diagonal entries count twice
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_fro(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf)
+{
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	RfpBlocks B = rfp_blocks(uplo, n);
+
+	ScaledSsq<T_RScalar> ret;
+	T_RScalar w = (ptype == prop_t::Triangular ? 1 : 2);
+	int_t nc = static_cast<int_t>(rfp_size(n) / B.ld);
+
+	#pragma omp parallel if(rfp_size(n) >= rfp_parallel_min_size())
+	{
+		ScaledSsq<T_RScalar> acc;
+
+		#pragma omp for schedule(static) nowait
+		for(int_t j = 0; j < nc; j++) {
+			acc.add(B.ld, arf + static_cast<bulk_t>(j) * B.ld, w);
+		} // j
+
+		#pragma omp critical(cla3p_rfp_norm_fro)
+		ret.merge(acc);
+	}
+
+	if(ptype == prop_t::Triangular) 
+		return ret.value();
+
+	//
+	// The diagonal was counted twice, its scale never exceeds the accumulated one
+	//
+	ScaledSsq<T_RScalar> diag;
+
+	for(uint_t k = 0; k < B.n1; k++) diag.add(arf[B.t1 + k * (B.ld + 1)]);
+	for(uint_t k = 0; k < B.n2; k++) diag.add(arf[B.t2 + k * (B.ld + 1)]);
+
+	ret.merge(diag, T_RScalar(-1));
+
+	return ret.value();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void rfp_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, const T_Scalar *arf, const T_Scalar *x, T_Scalar *y)
+{
+	RfpBlocks B = rfp_blocks(uplo, n);
+
+	const T_Scalar *x1 = x;
+	const T_Scalar *x2 = x + B.n1;
+	T_Scalar *y1 = y;
+	T_Scalar *y2 = y + B.n1;
+
+	if(B.n1) hem_x_vec(uplo_t::Lower, B.n1, alpha, arf + B.t1, B.ld, x1, T_Scalar(1), y1);
+	if(B.n2) hem_x_vec(uplo_t::Upper, B.n2, alpha, arf + B.t2, B.ld, x2, T_Scalar(1), y2);
+
+	if(!B.n1 || !B.n2)
+		return;
+
+	if(uplo == uplo_t::Lower) {
+		gem_x_vec(op_t::N, B.n2, B.n1, alpha, arf + B.s, B.ld, x1, T_Scalar(1), y2);
+		gem_x_vec(op_t::C, B.n2, B.n1, alpha, arf + B.s, B.ld, x2, T_Scalar(1), y1);
+	} else {
+		gem_x_vec(op_t::N, B.n1, B.n2, alpha, arf + B.s, B.ld, x2, T_Scalar(1), y1);
+		gem_x_vec(op_t::C, B.n1, B.n2, alpha, arf + B.s, B.ld, x1, T_Scalar(1), y2);
+	} // uplo
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void rfp_x_mat(uplo_t uplo, uint_t n, uint_t m, T_Scalar alpha, const T_Scalar *arf, 
+		const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc)
+{
+	RfpBlocks B = rfp_blocks(uplo, n);
+
+	const T_Scalar *b1 = b;
+	const T_Scalar *b2 = b + B.n1;
+	T_Scalar *c1 = c;
+	T_Scalar *c2 = c + B.n1;
+
+	if(B.n1) hem_x_gem(uplo_t::Lower, B.n1, m, alpha, arf + B.t1, B.ld, b1, ldb, T_Scalar(1), c1, ldc);
+	if(B.n2) hem_x_gem(uplo_t::Upper, B.n2, m, alpha, arf + B.t2, B.ld, b2, ldb, T_Scalar(1), c2, ldc);
+
+	if(!B.n1 || !B.n2)
+		return;
+
+	if(uplo == uplo_t::Lower) {
+		gem_x_gem(B.n2, m, B.n1, alpha, op_t::N, arf + B.s, B.ld, op_t::N, b1, ldb, T_Scalar(1), c2, ldc);
+		gem_x_gem(B.n1, m, B.n2, alpha, op_t::C, arf + B.s, B.ld, op_t::N, b2, ldb, T_Scalar(1), c1, ldc);
+	} else {
+		gem_x_gem(B.n1, m, B.n2, alpha, op_t::N, arf + B.s, B.ld, op_t::N, b2, ldb, T_Scalar(1), c1, ldc);
+		gem_x_gem(B.n2, m, B.n1, alpha, op_t::C, arf + B.s, B.ld, op_t::N, b1, ldb, T_Scalar(1), c2, ldc);
+	} // uplo
+}
+/*-------------------------------------------------*/
+#define instantiate_rfp(T_Scl) \
+template void rfp_pack(uplo_t, uint_t, const T_Scl*, uint_t, T_Scl*); \
+template void rfp_unpack(uplo_t, uint_t, const T_Scl*, T_Scl*, uint_t); \
+template TypeTraits<T_Scl>::real_type rfp_norm_max(uint_t, const T_Scl*); \
+template TypeTraits<T_Scl>::real_type rfp_norm_one(prop_t, uplo_t, uint_t, const T_Scl*); \
+template TypeTraits<T_Scl>::real_type rfp_norm_inf(prop_t, uplo_t, uint_t, const T_Scl*); \
+template TypeTraits<T_Scl>::real_type rfp_norm_fro(prop_t, uplo_t, uint_t, const T_Scl*); \
+template void rfp_x_vec(uplo_t, uint_t, T_Scl, const T_Scl*, const T_Scl*, T_Scl*); \
+template void rfp_x_mat(uplo_t, uint_t, uint_t, T_Scl, const T_Scl*, const T_Scl*, uint_t, T_Scl*, uint_t)
+instantiate_rfp(real_t);
+instantiate_rfp(real4_t);
+instantiate_rfp(complex_t);
+instantiate_rfp(complex8_t);
+#undef instantiate_rfp
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_DNS_RFP_HPP_
+#define CLA3P_BULK_DNS_RFP_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+
+//
+// Rectangular full packed (RFP) storage of the uplo triangle of an n x n matrix (lapack layout, transr = 'N')
+// The n * (n + 1) / 2 values form a column major ld x (n * (n + 1) / 2 / ld) array that holds three blocks:
+//   T1 (n1 x n1) at arf + t1, stored lower:  the leading diagonal block
+//   T2 (n2 x n2) at arf + t2, stored upper:  the trailing diagonal block
+//   S            at arf + s : A(n1:n,0:n1) (n2 x n1) for uplo lower, A(0:n1,n1:n) (n1 x n2) for uplo upper
+// For uplo lower T2 holds the conjugate transpose of the lower part of A22, 
+// for uplo upper T1 holds the conjugate transpose of the upper part of A11
+//
+struct RfpBlocks {
+	uint_t n1;
+	uint_t n2;
+	uint_t ld;
+	bulk_t t1;
+	bulk_t t2;
+	bulk_t s;
+};
+
+RfpBlocks rfp_blocks(uplo_t uplo, uint_t n);
+
+inline bulk_t rfp_size(uint_t n) { return static_cast<bulk_t>(n) * (n + 1) / 2; }
+
+//
+// Position of entry (i,j) of the uplo triangle, conj is set if the conjugate of the entry is stored
+//
+bulk_t rfp_offset(uplo_t uplo, uint_t n, uint_t i, uint_t j, bool& conj);
+
+//
+// Conversion between the uplo triangle of a (full storage) & arf
+//
+template <typename T_Scalar>
+void rfp_pack(uplo_t uplo, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *arf);
+
+template <typename T_Scalar>
+void rfp_unpack(uplo_t uplo, uint_t n, const T_Scalar *arf, T_Scalar *a, uint_t lda);
+
+//
+// Norms of symmetric/hermitian (ptype) or triangular (uplo) matrices in RFP storage
+//
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_max(uint_t n, const T_Scalar *arf);
+
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_one(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf);
+
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_inf(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf);
+
+template <typename T_Scalar>
+typename TypeTraits<T_Scalar>::real_type rfp_norm_fro(prop_t ptype, uplo_t uplo, uint_t n, const T_Scalar *arf);
+
+//
+// Products with symmetric (real) or hermitian (complex) matrices in RFP storage
+// y += alpha * A * x
+// C += alpha * A * B, B & C: n x m
+//
+template <typename T_Scalar>
+void rfp_x_vec(uplo_t uplo, uint_t n, T_Scalar alpha, const T_Scalar *arf, const T_Scalar *x, T_Scalar *y);
+
+template <typename T_Scalar>
+void rfp_x_mat(uplo_t uplo, uint_t n, uint_t m, T_Scalar alpha, const T_Scalar *arf, 
+		const T_Scalar *b, uint_t ldb, T_Scalar *c, uint_t ldc);
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_DNS_RFP_HPP_
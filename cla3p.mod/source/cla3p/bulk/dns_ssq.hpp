@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_DNS_SSQ_HPP_
+#define CLA3P_BULK_DNS_SSQ_HPP_
+
+#include <cmath>
+#include <limits>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace dns {
+/*-------------------------------------------------*/
+
+//
+// Scaled sum of squares (as in lapack lassq), the accumulated sum is scale^2 * ssq
+// Entries are divided by the largest magnitude before squaring, so the sum neither overflows nor underflows
+//
+template <typename T_RScalar>
+class ScaledSsq {
+
+	public:
+		ScaledSsq() : m_scale(0), m_ssq(1), m_nan(false) {}
+
+		//
+		// Adds w * scale^2 * ssq, a negative w removes a contribution already part of the sum
+		//
+		void merge(T_RScalar scale, T_RScalar ssq, T_RScalar w = 1)
+		{
+			if(std::isnan(scale) || std::isnan(ssq)) {
+				m_nan = true;
+			} else if(scale > m_scale) {
+				T_RScalar r = m_scale / scale;
+				m_ssq = w * ssq + m_ssq * r * r;
+				m_scale = scale;
+			} else if(scale > 0) {
+				T_RScalar r = (scale == m_scale ? T_RScalar(1) : scale / m_scale);
+				m_ssq += w * ssq * r * r;
+			} // scale
+		}
+
+		void merge(const ScaledSsq<T_RScalar>& other, T_RScalar w = 1)
+		{
+			if(other.m_nan) m_nan = true;
+			merge(other.m_scale, other.m_ssq, w);
+		}
+
+		//
+		// Adds w * |x|^2
+		//
+		template <typename T_Scalar>
+		void add(const T_Scalar& x, T_RScalar w = 1)
+		{
+			merge(static_cast<T_RScalar>(std::abs(x)), T_RScalar(1), w);
+		}
+
+		//
+		// Adds w * sum(|a[i]|^2), i in [0, n)
+		//
+		template <typename T_Scalar>
+		void add(uint_t n, const T_Scalar *a, T_RScalar w = 1)
+		{
+			T_RScalar amax = 0;
+			for(uint_t i = 0; i < n; i++) {
+				T_RScalar x = std::abs(a[i]);
+				if(x > amax || std::isnan(x)) amax = x;
+			} // i
+
+			if(amax == 0) return;
+
+			if(!std::isfinite(amax)) {
+				merge(amax, T_RScalar(1), w);
+				return;
+			} // inf/nan
+
+			T_RScalar sum = 0;
+			for(uint_t i = 0; i < n; i++) {
+				T_RScalar x = std::abs(a[i]) / amax;
+				sum += x * x;
+			} // i
+
+			merge(amax, sum, w);
+		}
+
+		T_RScalar value() const
+		{
+			return (m_nan ? std::numeric_limits<T_RScalar>::quiet_NaN() : m_scale * std::sqrt(m_ssq));
+		}
+
+	private:
+		T_RScalar m_scale;
+		T_RScalar m_ssq;
+		bool m_nan;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_DNS_SSQ_HPP_
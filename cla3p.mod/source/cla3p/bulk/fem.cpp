@@ -0,0 +1,277 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/fem.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace fem {
+/*-------------------------------------------------*/
+static bulk_t parallel_min_nnz()
+{
+	return 65536;
+}
+/*-------------------------------------------------*/
+bool use_parallel(bulk_t nwork)
+{
+	return (max_threads() > 1 && nwork >= parallel_min_nnz());
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static bool in_uplo(uplo_t uplo, T_Int i, T_Int j)
+{
+	return ((uplo == uplo_t::Lower && i >= j) || (uplo == uplo_t::Upper && i <= j) || uplo == uplo_t::Full);
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+void dof2elem(uint_t n, uint_t ne, const T_Int *eptr, const T_Int *eind, T_Int *dptr, T_Int *delem)
+{
+	std::fill(dptr, dptr + n + 1, 0);
+
+	for(T_Int k = eptr[0]; k < eptr[ne]; k++) {
+		dptr[eind[k]+1]++;
+	} // k
+
+	csc::roll(n, dptr);
+
+	std::vector<T_Int> pos(dptr, dptr + n);
+
+	for(uint_t e = 0; e < ne; e++) {
+		for(T_Int k = eptr[e]; k < eptr[e+1]; k++) {
+			delem[pos[eind[k]]++] = static_cast<T_Int>(e);
+		} // k
+	} // e
+}
+/*-------------------------------------------------*/
+template void dof2elem(uint_t, uint_t, const int_t*, const int_t*, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int>
+void elem2csc(uplo_t uplo, uint_t n, const T_Int *eptr, const T_Int *eind, const T_Int *dptr, const T_Int *delem, 
+		T_Int *colptr, T_Int **rowidx)
+{
+	bool parallel = use_parallel(static_cast<bulk_t>(dptr[n]));
+
+	//
+	// Column j couples with every dof of the elements containing j, 
+	// a per-thread marker stamped with j skips rows already visited
+	//
+	auto visit = [&](std::vector<T_Int>& mark, T_Int j, T_Int *ri) -> T_Int
+	{
+		T_Int cnt = 0;
+		for(T_Int l = dptr[j]; l < dptr[j+1]; l++) {
+			T_Int e = delem[l];
+			for(T_Int k = eptr[e]; k < eptr[e+1]; k++) {
+				T_Int i = eind[k];
+				if(mark[i] != j && in_uplo(uplo, i, j)) {
+					mark[i] = j;
+					if(ri) ri[cnt] = i;
+					cnt++;
+				} // new row
+			} // k
+		} // l
+		return cnt;
+	};
+
+	colptr[0] = 0;
+
+	#pragma omp parallel if(parallel)
+	{
+		std::vector<T_Int> mark(n, -1);
+
+		#pragma omp for schedule(dynamic, 256)
+		for(int_t j = 0; j < static_cast<int_t>(n); j++) {
+			colptr[j+1] = visit(mark, static_cast<T_Int>(j), nullptr);
+		} // j
+	}
+
+	csc::roll(n, colptr);
+
+	T_Int *ri = static_cast<T_Int*>(i_malloc(colptr[n], sizeof(T_Int)));
+
+	#pragma omp parallel if(parallel)
+	{
+		std::vector<T_Int> mark(n, -1);
+
+		#pragma omp for schedule(dynamic, 256)
+		for(int_t j = 0; j < static_cast<int_t>(n); j++) {
+			visit(mark, static_cast<T_Int>(j), ri + colptr[j]);
+			std::sort(ri + colptr[j], ri + colptr[j+1]);
+		} // j
+	}
+
+	*rowidx = ri;
+}
+/*-------------------------------------------------*/
+template void elem2csc(uplo_t, uint_t, const int_t*, const int_t*, const int_t*, const int_t*, int_t*, int_t**);
+/*-------------------------------------------------*/
+template <typename T_Int>
+void elem_offsets(uint_t ne, const T_Int *eptr, bulk_t *eoff)
+{
+	eoff[0] = 0;
+
+	for(uint_t e = 0; e < ne; e++) {
+		bulk_t nd = static_cast<bulk_t>(eptr[e+1] - eptr[e]);
+		eoff[e+1] = eoff[e] + nd * nd;
+	} // e
+}
+/*-------------------------------------------------*/
+template void elem_offsets(uint_t, const int_t*, bulk_t*);
+/*-------------------------------------------------*/
+template <typename T_Int>
+void elem2csc_map(uplo_t uplo, uint_t ne, const T_Int *eptr, const T_Int *eind, const bulk_t *eoff, 
+		const T_Int *colptr, const T_Int *rowidx, T_Int *emap)
+{
+	bool parallel = use_parallel(eoff[ne]);
+
+	#pragma omp parallel for schedule(static) if(parallel)
+	for(int_t e = 0; e < static_cast<int_t>(ne); e++) {
+
+		const T_Int *dofs = eind + eptr[e];
+		T_Int nd = eptr[e+1] - eptr[e];
+		T_Int *map = emap + eoff[e];
+
+		for(T_Int b = 0; b < nd; b++) {
+			T_Int j = dofs[b];
+			const T_Int *rbgn = rowidx + colptr[j];
+			const T_Int *rend = rowidx + colptr[j+1];
+			for(T_Int a = 0; a < nd; a++) {
+				T_Int i = dofs[a];
+				map[a + b * nd] = (in_uplo(uplo, i, j) ? static_cast<T_Int>(std::lower_bound(rbgn, rend, i) - rowidx) : -1);
+			} // a
+		} // b
+
+	} // e
+}
+/*-------------------------------------------------*/
+template void elem2csc_map(uplo_t, uint_t, const int_t*, const int_t*, const bulk_t*, const int_t*, const int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int>
+uint_t color(uint_t ne, const T_Int *eptr, const T_Int *eind, const T_Int *dptr, const T_Int *delem, 
+		T_Int *cptr, T_Int *celem)
+{
+	std::vector<T_Int> ecolor(ne, -1);
+	std::vector<T_Int> taken;
+
+	T_Int ncolors = 0;
+
+	//
+	// Element e takes the smallest color not taken by an already colored element sharing a dof with it, 
+	// taken[c] == e marks color c as unavailable for e
+	//
+	for(uint_t e = 0; e < ne; e++) {
+
+		for(T_Int k = eptr[e]; k < eptr[e+1]; k++) {
+			T_Int d = eind[k];
+			for(T_Int l = dptr[d]; l < dptr[d+1]; l++) {
+				T_Int c = ecolor[delem[l]];
+				if(c >= 0) taken[c] = static_cast<T_Int>(e);
+			} // l
+		} // k
+
+		T_Int c = 0;
+		while(c < ncolors && taken[c] == static_cast<T_Int>(e)) c++;
+
+		if(c == ncolors) {
+			taken.push_back(-1);
+			ncolors++;
+		} // new color
+
+		ecolor[e] = c;
+
+	} // e
+
+	std::fill(cptr, cptr + ncolors + 1, 0);
+
+	for(uint_t e = 0; e < ne; e++) {
+		cptr[ecolor[e]+1]++;
+	} // e
+
+	csc::roll(ncolors, cptr);
+
+	std::vector<T_Int> pos(cptr, cptr + ncolors);
+
+	for(uint_t e = 0; e < ne; e++) {
+		celem[pos[ecolor[e]]++] = static_cast<T_Int>(e);
+	} // e
+
+	return static_cast<uint_t>(ncolors);
+}
+/*-------------------------------------------------*/
+template uint_t color(uint_t, const int_t*, const int_t*, const int_t*, const int_t*, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void add_element(bulk_t nv, const T_Int *emap, const T_Scalar *evals, T_Scalar *values)
+{
+	for(bulk_t k = 0; k < nv; k++) {
+		if(emap[k] >= 0) values[emap[k]] += evals[k];
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void scatter_add(uint_t ncolors, const T_Int *cptr, const T_Int *celem, const bulk_t *eoff, 
+		const T_Int *emap, const T_Scalar *evals, T_Scalar *values)
+{
+	T_Int ne = cptr[ncolors];
+
+	bool parallel = use_parallel(eoff[ne]);
+
+	#pragma omp parallel if(parallel)
+	{
+		for(uint_t c = 0; c < ncolors; c++) {
+
+			#pragma omp for schedule(static)
+			for(int_t k = cptr[c]; k < cptr[c+1]; k++) {
+				T_Int e = celem[k];
+				add_element(eoff[e+1] - eoff[e], emap + eoff[e], evals + eoff[e], values);
+			} // k
+
+		} // c
+	}
+}
+/*-------------------------------------------------*/
+#define instantiate_add_element(T_Int, T_Scl) \
+template void add_element(bulk_t, const T_Int*, const T_Scl*, T_Scl*)
+instantiate_add_element(int_t, real_t);
+instantiate_add_element(int_t, real4_t);
+instantiate_add_element(int_t, complex_t);
+instantiate_add_element(int_t, complex8_t);
+#undef instantiate_add_element
+/*-------------------------------------------------*/
+#define instantiate_scatter_add(T_Int, T_Scl) \
+template void scatter_add(uint_t, const T_Int*, const T_Int*, const bulk_t*, const T_Int*, const T_Scl*, T_Scl*)
+instantiate_scatter_add(int_t, real_t);
+instantiate_scatter_add(int_t, real4_t);
+instantiate_scatter_add(int_t, complex_t);
+instantiate_scatter_add(int_t, complex8_t);
+#undef instantiate_scatter_add
+/*-------------------------------------------------*/
+} // namespace fem
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
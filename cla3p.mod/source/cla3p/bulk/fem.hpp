@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_FEM_HPP_
+#define CLA3P_BULK_FEM_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace fem {
+/*-------------------------------------------------*/
+
+//
+// Element connectivity lists: element e owns the dofs eind[eptr[e] ... eptr[e+1]-1] of an (n x n) system
+// Element values: the column-major (nd x nd) matrix of element e (nd dofs) starts at eoff[e], eoff[e+1] = eoff[e] + nd * nd
+//
+
+//
+// Dof -> element adjacency (transpose of the connectivity lists)
+// Fills dptr (n+1) & delem (eptr[ne]), elements of a dof in increasing order
+//
+template <typename T_Int>
+void dof2elem(uint_t n, uint_t ne, const T_Int *eptr, const T_Int *eind, T_Int *dptr, T_Int *delem);
+
+//
+// Whether an element loop that touches nwork values (or dofs) is run in parallel
+//
+bool use_parallel(bulk_t nwork);
+
+//
+// Symbolic csc(n x n) pattern of the sum of the element matrices, uplo part only
+// Fills colptr (n+1) & allocates *rowidx (colptr[n]), sorted rows
+//
+template <typename T_Int>
+void elem2csc(uplo_t uplo, uint_t n, const T_Int *eptr, const T_Int *eind, const T_Int *dptr, const T_Int *delem, 
+		T_Int *colptr, T_Int **rowidx);
+
+//
+// Fills eoff (ne+1), the element value offsets
+//
+template <typename T_Int>
+void elem_offsets(uint_t ne, const T_Int *eptr, bulk_t *eoff);
+
+//
+// Fills emap (eoff[ne]), emap[eoff[e] + a + b * nd] is the position of the local (a,b) contribution of element e 
+// in the csc values, -1 for contributions outside the uplo part
+//
+template <typename T_Int>
+void elem2csc_map(uplo_t uplo, uint_t ne, const T_Int *eptr, const T_Int *eind, const bulk_t *eoff, 
+		const T_Int *colptr, const T_Int *rowidx, T_Int *emap);
+
+//
+// Greedy element coloring, elements of the same color share no dofs
+// Fills cptr (ne+1) & celem (ne), elements of color c are celem[cptr[c] ... cptr[c+1]-1] in increasing order
+// Returns the number of colors
+//
+template <typename T_Int>
+uint_t color(uint_t ne, const T_Int *eptr, const T_Int *eind, const T_Int *dptr, const T_Int *delem, 
+		T_Int *cptr, T_Int *celem);
+
+//
+// values[emap[k]] += evals[k] for k in [0, nv), entries with emap[k] < 0 are skipped
+//
+template <typename T_Int, typename T_Scalar>
+void add_element(bulk_t nv, const T_Int *emap, const T_Scalar *evals, T_Scalar *values);
+
+//
+// Adds all element contributions to values
+// Colors are processed in sequence, the elements of each color in parallel without write conflicts
+//
+template <typename T_Int, typename T_Scalar>
+void scatter_add(uint_t ncolors, const T_Int *cptr, const T_Int *celem, const bulk_t *eoff, 
+		const T_Int *emap, const T_Scalar *evals, T_Scalar *values);
+
+/*-------------------------------------------------*/
+} // namespace fem
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_FEM_HPP_
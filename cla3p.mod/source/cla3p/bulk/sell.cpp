@@ -0,0 +1,449 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/bulk/sell.hpp"
+
+// system
+#include <algorithm>
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace sell {
+/*-------------------------------------------------*/
+static bulk_t parallel_min_nnz()
+{
+	return 16384;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static bool use_parallel(uint_t m, uint_t c, const T_Int *chunkptr)
+{
+	uint_t nchunks = (m + c - 1) / c;
+	return (max_threads() > 1 && nchunks > 1 && static_cast<bulk_t>(chunkptr[nchunks]) >= parallel_min_nnz());
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+uint_t default_chunk_size()
+{
+	return std::max<uint_t>(1, 64 / sizeof(T_Scalar));
+}
+/*-------------------------------------------------*/
+template uint_t default_chunk_size<real_t>();
+template uint_t default_chunk_size<real4_t>();
+template uint_t default_chunk_size<complex_t>();
+template uint_t default_chunk_size<complex8_t>();
+/*-------------------------------------------------*/
+//
+// Chunk kernels are instantiated for fixed chunk heights (C > 0) so that the row loop 
+// of every chunk column maps to whole vector registers, C = 0 is the run-time chunk height fallback
+//
+template <uint_t C>
+inline uint_t fixed_cs(uint_t c)
+{
+	return (C ? C : c);
+}
+/*-------------------------------------------------*/
+template <uint_t C, uint_t N, typename T_Scalar>
+class ChunkWork {
+	public:
+		explicit ChunkWork(uint_t) {}
+		T_Scalar *data() { return m_data; }
+	private:
+		T_Scalar m_data[C * N];
+};
+/*-------------------------------------------------*/
+template <uint_t N, typename T_Scalar>
+class ChunkWork<0,N,T_Scalar> {
+	public:
+		explicit ChunkWork(uint_t c) : m_data(c * N) {}
+		T_Scalar *data() { return m_data.data(); }
+	private:
+		std::vector<T_Scalar> m_data;
+};
+/*-------------------------------------------------*/
+template <typename T_Int>
+void csr2sell_layout(uint_t m, uint_t c, uint_t sigma, const T_Int *rowptr, T_Int *rowidx, T_Int *chunkptr)
+{
+	sigma = std::max<uint_t>(sigma, 1);
+
+	int_t nwin = static_cast<int_t>((m + sigma - 1) / sigma);
+	int_t nchunks = static_cast<int_t>((m + c - 1) / c);
+
+	bool parallel = (max_threads() > 1 && static_cast<bulk_t>(rowptr[m]) >= parallel_min_nnz());
+
+	//
+	// Stable sort by decreasing row length inside each window, 
+	// equal length rows keep their original order
+	//
+	#pragma omp parallel for schedule(dynamic) if(parallel)
+	for(int_t w = 0; w < nwin; w++) {
+
+		uint_t ibgn = static_cast<uint_t>(w) * sigma;
+		uint_t iend = std::min(m, ibgn + sigma);
+
+		for(uint_t i = ibgn; i < iend; i++) {
+			rowidx[i] = static_cast<T_Int>(i);
+		} // i
+
+		if(sigma > 1) {
+			std::stable_sort(rowidx + ibgn, rowidx + iend, 
+					[&](T_Int i1, T_Int i2) { return (rowptr[i1+1] - rowptr[i1]) > (rowptr[i2+1] - rowptr[i2]); });
+		} // sort
+
+	} // w
+
+	chunkptr[0] = 0;
+
+	#pragma omp parallel for schedule(static) if(parallel)
+	for(int_t ch = 0; ch < nchunks; ch++) {
+
+		uint_t sbgn = static_cast<uint_t>(ch) * c;
+		uint_t send = std::min(m, sbgn + c);
+
+		T_Int width = 0;
+		for(uint_t s = sbgn; s < send; s++) {
+			width = std::max(width, rowptr[rowidx[s]+1] - rowptr[rowidx[s]]);
+		} // s
+
+		chunkptr[ch+1] = width * static_cast<T_Int>(c);
+
+	} // ch
+
+	csc::roll(nchunks, chunkptr);
+}
+/*-------------------------------------------------*/
+template void csr2sell_layout(uint_t, uint_t, uint_t, const int_t*, int_t*, int_t*);
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void csr2sell(uint_t m, uint_t c, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowidx, const T_Int *chunkptr, T_Int *colidx_out, T_Scalar *values_out)
+{
+	int_t nchunks = static_cast<int_t>((m + c - 1) / c);
+
+	bool parallel = (max_threads() > 1 && static_cast<bulk_t>(chunkptr[nchunks]) >= parallel_min_nnz());
+
+	#pragma omp parallel for schedule(dynamic, 16) if(parallel)
+	for(int_t ch = 0; ch < nchunks; ch++) {
+
+		T_Int off = chunkptr[ch];
+		T_Int width = (chunkptr[ch+1] - off) / static_cast<T_Int>(c);
+
+		for(uint_t r = 0; r < c; r++) {
+
+			uint_t s = static_cast<uint_t>(ch) * c + r;
+
+			T_Int len = 0;
+			T_Int jlast = 0;
+
+			if(s < m) {
+				T_Int i = rowidx[s];
+				len = rowptr[i+1] - rowptr[i];
+				for(T_Int k = 0; k < len; k++) {
+					colidx_out[off + k * c + r] = colidx[rowptr[i] + k];
+					values_out[off + k * c + r] = values[rowptr[i] + k];
+				} // k
+				if(len) jlast = colidx[rowptr[i+1] - 1];
+			} // s < m
+
+			for(T_Int k = len; k < width; k++) {
+				colidx_out[off + k * c + r] = jlast;
+				values_out[off + k * c + r] = T_Scalar(0);
+			} // padding
+
+		} // r
+
+	} // ch
+}
+/*-------------------------------------------------*/
+#define instantiate_csr2sell(T_Int, T_Scl) \
+template void csr2sell(uint_t, uint_t, const T_Int*, const T_Int*, const T_Scl*, \
+		const T_Int*, const T_Int*, T_Int*, T_Scl*)
+instantiate_csr2sell(int_t, real_t);
+instantiate_csr2sell(int_t, real4_t);
+instantiate_csr2sell(int_t, complex_t);
+instantiate_csr2sell(int_t, complex8_t);
+#undef instantiate_csr2sell
+/*-------------------------------------------------*/
+//
+// acc(c x N) += A(chunk ch) * B(:,0:N-1), N right hand sides loaded per matrix entry
+//
+template <uint_t C, uint_t N, typename T_Int, typename T_Scalar>
+inline void chunk_x_panel(uint_t c, uint_t nl, int_t ch, 
+		const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar *acc)
+{
+	const uint_t cs = fixed_cs<C>(c);
+
+	const T_Int off = chunkptr[ch];
+	const uint_t width = static_cast<uint_t>(chunkptr[ch+1] - off) / cs;
+
+	for(uint_t r = 0; r < cs * N; r++) {
+		acc[r] = 0;
+	} // r
+
+	for(uint_t k = 0; k < width; k++) {
+
+		const T_Int    *ck = colidx + off + k * cs;
+		const T_Scalar *vk = values + off + k * cs;
+
+		for(uint_t q = 0; q < nl; q++) {
+
+			const T_Scalar *bq = b + q * ldb;
+			T_Scalar *aq = acc + q * cs;
+
+			#pragma omp simd
+			for(uint_t r = 0; r < cs; r++) {
+				aq[r] += vk[r] * bq[ck[r]];
+			} // r
+
+		} // q
+
+	} // k
+}
+/*-------------------------------------------------*/
+//
+// C(rowidx,:) = beta * C(rowidx,:) + alpha * A * B, stored rows are independent
+//
+template <uint_t C, typename T_Int, typename T_Scalar>
+static void sell_x_gem_n(bool parallel, uint_t m, uint_t c, uint_t k, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *cc, uint_t ldc)
+{
+	const uint_t nrhs = 4;
+	const uint_t cs = fixed_cs<C>(c);
+
+	int_t nchunks = static_cast<int_t>((m + cs - 1) / cs);
+
+	#pragma omp parallel if(parallel)
+	{
+		ChunkWork<C,nrhs,T_Scalar> w(cs);
+		T_Scalar *acc = w.data();
+
+		#pragma omp for schedule(dynamic, 16)
+		for(int_t ch = 0; ch < nchunks; ch++) {
+
+			uint_t sbgn = static_cast<uint_t>(ch) * cs;
+			uint_t nr = std::min(cs, m - sbgn);
+
+			for(uint_t l = 0; l < k; l += nrhs) {
+
+				uint_t nl = std::min(nrhs, k - l);
+
+				if(nl == 1) {
+					chunk_x_panel<C,1>(cs, 1, ch, chunkptr, colidx, values, dns::ptrmv(ldb, b, 0, l), ldb, acc);
+				} else {
+					chunk_x_panel<C,nrhs>(cs, nl, ch, chunkptr, colidx, values, dns::ptrmv(ldb, b, 0, l), ldb, acc);
+				} // nl
+
+				for(uint_t q = 0; q < nl; q++) {
+					T_Scalar *cq = dns::ptrmv(ldc, cc, 0, l + q);
+					const T_Scalar *aq = acc + q * cs;
+					for(uint_t r = 0; r < nr; r++) {
+						T_Int i = rowidx[sbgn + r];
+						cq[i] = beta_scaled(beta, cq[i]) + alpha * aq[r];
+					} // r
+				} // q
+
+			} // l
+
+		} // ch
+	}
+}
+/*-------------------------------------------------*/
+//
+// z += op(A(chunk ch))^T * (alpha * x(rowidx)), padding entries add zeros
+//
+template <uint_t C, typename T_Int, typename T_Scalar>
+inline void chunk_scatter(bool conjop, uint_t m, uint_t c, int_t ch, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar *z, T_Scalar *w)
+{
+	const uint_t cs = fixed_cs<C>(c);
+
+	const T_Int off = chunkptr[ch];
+	const uint_t width = static_cast<uint_t>(chunkptr[ch+1] - off) / cs;
+
+	uint_t sbgn = static_cast<uint_t>(ch) * cs;
+	uint_t nr = std::min(cs, m - sbgn);
+
+	for(uint_t r = 0; r < cs; r++) {
+		w[r] = (r < nr ? alpha * x[rowidx[sbgn + r]] : T_Scalar(0));
+	} // r
+
+	for(uint_t k = 0; k < width; k++) {
+
+		const T_Int    *ck = colidx + off + k * cs;
+		const T_Scalar *vk = values + off + k * cs;
+
+		for(uint_t r = 0; r < nr; r++) {
+			z[ck[r]] += opval(conjop, vk[r]) * w[r];
+		} // r
+
+	} // k
+}
+/*-------------------------------------------------*/
+//
+// y = beta * y + alpha * op(A) * x, op(A) = A^T/A^H
+// Chunks are split in parts of balanced stored entries, each part scatters into a private buffer, 
+// buffers are reduced row-wise
+//
+template <uint_t C, typename T_Int, typename T_Scalar>
+static void sell_x_vec_t(bool parallel, bool conjop, uint_t m, uint_t n, uint_t c, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	const uint_t cs = fixed_cs<C>(c);
+
+	int_t nchunks = static_cast<int_t>((m + cs - 1) / cs);
+	int_t np = (parallel ? max_threads() : 1);
+	int_t ny = static_cast<int_t>(n);
+
+	#pragma omp parallel for schedule(static) if(parallel)
+	for(int_t j = 0; j < ny; j++) {
+		y[j] = beta_scaled(beta, y[j]);
+	} // j
+
+	if(np == 1) {
+
+		ChunkWork<C,1,T_Scalar> w(cs);
+
+		for(int_t ch = 0; ch < nchunks; ch++) {
+			chunk_scatter<C>(conjop, m, cs, ch, alpha, rowidx, chunkptr, colidx, values, x, y, w.data());
+		} // ch
+
+		return;
+
+	} // np = 1
+
+	std::vector<int_t> csplit(np + 1);
+	std::vector<T_Scalar*> buf(np, nullptr);
+
+	for(int_t p = 0; p < np; p++) {
+		T_Int target = static_cast<T_Int>((static_cast<bulk_t>(chunkptr[nchunks]) * p) / np);
+		csplit[p] = static_cast<int_t>(std::lower_bound(chunkptr, chunkptr + nchunks + 1, target) - chunkptr);
+	} // p
+	csplit[np] = nchunks;
+
+	#pragma omp parallel for schedule(static, 1) num_threads(np)
+	for(int_t p = 0; p < np; p++) {
+
+		ChunkWork<C,1,T_Scalar> w(cs);
+
+		T_Scalar *z = i_calloc<T_Scalar>(n);
+
+		for(int_t ch = csplit[p]; ch < std::max(csplit[p], csplit[p+1]); ch++) {
+			chunk_scatter<C>(conjop, m, cs, ch, alpha, rowidx, chunkptr, colidx, values, x, z, w.data());
+		} // ch
+
+		buf[p] = z;
+
+	} // p
+
+	#pragma omp parallel for schedule(static) num_threads(np)
+	for(int_t j = 0; j < ny; j++) {
+		T_Scalar acc = 0;
+		for(int_t p = 0; p < np; p++) {
+			acc += buf[p][j];
+		} // p
+		y[j] += acc;
+	} // j
+
+	for(int_t p = 0; p < np; p++) {
+		i_free(buf[p]);
+	} // p
+}
+/*-------------------------------------------------*/
+template <uint_t C, typename T_Int, typename T_Scalar>
+static void sell_x_gem_tmpl(bool parallel, op_t opA, uint_t m, uint_t n, uint_t c, uint_t k, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *cc, uint_t ldc)
+{
+	if(opA == op_t::N) {
+
+		sell_x_gem_n<C>(parallel, m, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc);
+
+	} else {
+
+		for(uint_t l = 0; l < k; l++) {
+			sell_x_vec_t<C>(parallel, opA == op_t::C, m, n, c, alpha, rowidx, chunkptr, colidx, values, 
+					dns::ptrmv(ldb, b, 0, l), beta, dns::ptrmv(ldc, cc, 0, l));
+		} // l
+
+	} // opA
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t c, uint_t k, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *cc, uint_t ldc)
+{
+	if(!m || !n || !k) return;
+
+	bool parallel = use_parallel(m, c, chunkptr);
+
+	switch(c) {
+		case  4: sell_x_gem_tmpl< 4>(parallel, opA, m, n, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc); break;
+		case  8: sell_x_gem_tmpl< 8>(parallel, opA, m, n, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc); break;
+		case 16: sell_x_gem_tmpl<16>(parallel, opA, m, n, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc); break;
+		case 32: sell_x_gem_tmpl<32>(parallel, opA, m, n, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc); break;
+		default: sell_x_gem_tmpl< 0>(parallel, opA, m, n, c, k, alpha, rowidx, chunkptr, colidx, values, b, ldb, beta, cc, ldc);
+	} // c
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_gem(T_Int, T_Scl) \
+template void gem_x_gem(op_t, uint_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, uint_t, T_Scl, T_Scl*, uint_t)
+instantiate_gem_x_gem(int_t, real_t);
+instantiate_gem_x_gem(int_t, real4_t);
+instantiate_gem_x_gem(int_t, complex_t);
+instantiate_gem_x_gem(int_t, complex8_t);
+#undef instantiate_gem_x_gem
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+void gem_x_vec(op_t opA, uint_t m, uint_t n, uint_t c, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y)
+{
+	uint_t nx = (opA == op_t::N ? n : m);
+	uint_t ny = (opA == op_t::N ? m : n);
+	gem_x_gem(opA, m, n, c, 1, alpha, rowidx, chunkptr, colidx, values, x, nx, beta, y, ny);
+}
+/*-------------------------------------------------*/
+#define instantiate_gem_x_vec(T_Int, T_Scl) \
+template void gem_x_vec(op_t, uint_t, uint_t, uint_t, T_Scl, \
+		const T_Int*, const T_Int*, const T_Int*, const T_Scl*, const T_Scl*, T_Scl, T_Scl*)
+instantiate_gem_x_vec(int_t, real_t);
+instantiate_gem_x_vec(int_t, real4_t);
+instantiate_gem_x_vec(int_t, complex_t);
+instantiate_gem_x_vec(int_t, complex8_t);
+#undef instantiate_gem_x_vec
+/*-------------------------------------------------*/
+} // namespace sell
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BULK_SELL_HPP_
+#define CLA3P_BULK_SELL_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bulk {
+namespace sell {
+/*-------------------------------------------------*/
+
+//
+// Sliced ELLPACK (SELL-C-sigma) arrays of an (m x n) matrix:
+//   rowidx (m): the original row of each stored row, rows are sorted by decreasing length in windows of sigma rows
+//   chunkptr (nchunks+1): the offset of each chunk of c consecutive stored rows, nchunks = ceil(m/c)
+//   colidx/values (chunkptr[nchunks]): each chunk is a (c x width) column-major panel, width the longest row of the chunk
+// Padding entries have zero values & repeat the last column index of their row (0 for empty rows)
+//
+
+//
+// Default chunk height, one 512-bit vector register of T_Scalar
+//
+template <typename T_Scalar>
+uint_t default_chunk_size();
+
+//
+// Conversion csr(m x n) -> sell, first pass
+// Fills rowidx (m) & chunkptr (ceil(m/c)+1)
+//
+template <typename T_Int>
+void csr2sell_layout(uint_t m, uint_t c, uint_t sigma, const T_Int *rowptr, T_Int *rowidx, T_Int *chunkptr);
+
+//
+// Conversion csr(m x n) -> sell, second pass
+// Fills colidx & values (chunkptr[nchunks])
+//
+template <typename T_Int, typename T_Scalar>
+void csr2sell(uint_t m, uint_t c, 
+		const T_Int *rowptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Int *rowidx, const T_Int *chunkptr, T_Int *colidx_out, T_Scalar *values_out);
+
+//
+// Update: dnsY = beta * dnsY + alpha * op(sellA) * dnsX
+// A(m x n), x & y in the original ordering
+//
+template <typename T_Int, typename T_Scalar>
+void gem_x_vec(op_t opA, uint_t m, uint_t n, uint_t c, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *x, T_Scalar beta, T_Scalar *y);
+
+//
+// Update: dnsC = beta * dnsC + alpha * op(sellA) * dnsB
+// A(m x n), C(op(A) rows x k), B & C in the original ordering
+//
+template <typename T_Int, typename T_Scalar>
+void gem_x_gem(op_t opA, uint_t m, uint_t n, uint_t c, uint_t k, T_Scalar alpha, 
+		const T_Int *rowidx, const T_Int *chunkptr, const T_Int *colidx, const T_Scalar *values, 
+		const T_Scalar *b, uint_t ldb, T_Scalar beta, T_Scalar *cc, uint_t ldc);
+
+/*-------------------------------------------------*/
+} // namespace sell
+} // namespace bulk
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BULK_SELL_HPP_
@@ -28,11 +28,11 @@ namespace cla3p {
 template <typename T_Matrix>
 void llt_decomp_input_check(const T_Matrix& mat)
 {
+	using T_Scalar = typename T_Matrix::value_type;
+
 	bool supported_prop = (
-			(std::is_same<T_Matrix,dns::RdMatrix>::value && mat.prop().isSymmetric()) || 
-			(std::is_same<T_Matrix,dns::RfMatrix>::value && mat.prop().isSymmetric()) || 
-			(std::is_same<T_Matrix,dns::CdMatrix>::value && mat.prop().isHermitian()) || 
-			(std::is_same<T_Matrix,dns::CfMatrix>::value && mat.prop().isHermitian()) ); 
+			(TypeTraits<T_Scalar>::is_real() && mat.prop().isSymmetric()) || 
+			(TypeTraits<T_Scalar>::is_complex() && mat.prop().isHermitian()) ); 
 
 	if(mat.empty()) {
 		throw err::InvalidOp("Input matrix is empty");
@@ -21,6 +21,10 @@
 #include "cla3p/dense/dns_cxvector.hpp"
 #include "cla3p/dense/dns_rxmatrix.hpp"
 #include "cla3p/dense/dns_cxmatrix.hpp"
+#include "cla3p/dense/dns_matrix_batch.hpp"
+#include "cla3p/dense/dns_rfp_matrix.hpp"
+#include "cla3p/dense/dns_band_matrix.hpp"
+#include "cla3p/dense/dns_tridiagonal_matrix.hpp"
 
 namespace cla3p {
 namespace dns {
@@ -73,6 +77,102 @@ using CdMatrix = CxMatrix<complex_t>;
  */
 using CfMatrix = CxMatrix<complex8_t>;
 
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision real matrix batch.
+ */
+using RdMatrixBatch = MatrixBatch<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision real matrix batch.
+ */
+using RfMatrixBatch = MatrixBatch<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision complex matrix batch.
+ */
+using CdMatrixBatch = MatrixBatch<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision complex matrix batch.
+ */
+using CfMatrixBatch = MatrixBatch<CfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision real matrix in RFP storage.
+ */
+using RdRfpMatrix = RfpMatrix<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision real matrix in RFP storage.
+ */
+using RfRfpMatrix = RfpMatrix<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision complex matrix in RFP storage.
+ */
+using CdRfpMatrix = RfpMatrix<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision complex matrix in RFP storage.
+ */
+using CfRfpMatrix = RfpMatrix<CfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision real matrix in band storage.
+ */
+using RdBandMatrix = BandMatrix<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision real matrix in band storage.
+ */
+using RfBandMatrix = BandMatrix<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision complex matrix in band storage.
+ */
+using CdBandMatrix = BandMatrix<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision complex matrix in band storage.
+ */
+using CfBandMatrix = BandMatrix<CfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision real tridiagonal matrix.
+ */
+using RdTridiagonalMatrix = TridiagonalMatrix<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision real tridiagonal matrix.
+ */
+using RfTridiagonalMatrix = TridiagonalMatrix<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Double precision complex tridiagonal matrix.
+ */
+using CdTridiagonalMatrix = TridiagonalMatrix<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @brief Single precision complex tridiagonal matrix.
+ */
+using CfTridiagonalMatrix = TridiagonalMatrix<CfMatrix>;
+
 } // namespace dns
 } // namespace cla3p
 
@@ -0,0 +1,268 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/dense/dns_band_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_band.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void band_property_check(uint_t nr, uint_t nc, uint_t kl, uint_t ku, const Property& pr)
+{
+	bool supported_prop = (
+			pr.isGeneral() || 
+			(TypeTraits<T_Scalar>::is_real() && pr.isSymmetric()) || 
+			(TypeTraits<T_Scalar>::is_complex() && pr.isHermitian()));
+
+	if(!supported_prop) {
+		throw err::InvalidOp("Matrices with property " + pr.name() + " not supported for band storage");
+	} // valid prop
+
+	if(pr.isGeneral())
+		return;
+
+	if(nr != nc) {
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+
+	if((pr.isLower() && ku) || (pr.isUpper() && kl)) {
+		throw err::InvalidOp("Only the band of the " + pr.name() + " part can be stored");
+	} // band
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix>::BandMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix>::BandMatrix(uint_t nr, uint_t nc, uint_t kl, uint_t ku, const Property& pr)
+{
+	defaults();
+
+	Property spr = sanitizeProperty<T_Scalar>(pr);
+	band_property_check<T_Scalar>(nr, nc, kl, ku, spr);
+
+	if(!nr || !nc)
+		return;
+
+	m_nr = nr;
+	m_nc = nc;
+	m_kl = kl;
+	m_ku = ku;
+	m_prop = spr;
+	m_values = i_calloc<T_Scalar>(static_cast<bulk_t>(ld()) * nc);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix>::BandMatrix(BandMatrix<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix>::~BandMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix>& BandMatrix<T_Matrix>::operator=(BandMatrix<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_nr     = other.m_nr;
+		m_nc     = other.m_nc;
+		m_kl     = other.m_kl;
+		m_ku     = other.m_ku;
+		m_prop   = other.m_prop;
+		m_values = other.m_values;
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void BandMatrix<T_Matrix>::defaults()
+{
+	m_nr = 0;
+	m_nc = 0;
+	m_kl = 0;
+	m_ku = 0;
+	m_prop = Property();
+	m_values = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void BandMatrix<T_Matrix>::clear()
+{
+	i_free(m_values);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t BandMatrix<T_Matrix>::nrows() const { return m_nr; }
+template <typename T_Matrix> uint_t BandMatrix<T_Matrix>::ncols() const { return m_nc; }
+template <typename T_Matrix> uint_t BandMatrix<T_Matrix>::kl() const { return m_kl; }
+template <typename T_Matrix> uint_t BandMatrix<T_Matrix>::ku() const { return m_ku; }
+template <typename T_Matrix> uint_t BandMatrix<T_Matrix>::ld() const { return m_kl + m_ku + 1; }
+template <typename T_Matrix> const Property& BandMatrix<T_Matrix>::prop() const { return m_prop; }
+template <typename T_Matrix> typename BandMatrix<T_Matrix>::T_Scalar* BandMatrix<T_Matrix>::values() { return m_values; }
+template <typename T_Matrix> const typename BandMatrix<T_Matrix>::T_Scalar* BandMatrix<T_Matrix>::values() const { return m_values; }
+template <typename T_Matrix> bool BandMatrix<T_Matrix>::empty() const { return (m_values == nullptr); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string BandMatrix<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::DenseBandMatrix() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Sub-diagonals........ " << kl() << "\n";
+	ss << "  Super-diagonals...... " << ku() << "\n";
+	ss << "  Leading dimension.... " << ld() << "\n";
+	ss << "  Values............... " << values() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix> BandMatrix<T_Matrix>::copy() const
+{
+	if(empty())
+		return BandMatrix<T_Matrix>();
+
+	BandMatrix<T_Matrix> ret(nrows(), ncols(), kl(), ku(), prop());
+
+	std::copy(m_values, m_values + static_cast<bulk_t>(ld()) * ncols(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix> BandMatrix<T_Matrix>::move()
+{
+	BandMatrix<T_Matrix> ret = std::move(*this);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void BandMatrix<T_Matrix>::indexCheck(uint_t i, uint_t j) const
+{
+	if(i >= nrows() || j >= ncols()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(nrows(),ncols(),i,j));
+	} // out-of-bounds
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool BandMatrix<T_Matrix>::inBand(uint_t i, uint_t j) const
+{
+	return (i <= j + kl() && j <= i + ku());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename BandMatrix<T_Matrix>::T_Scalar BandMatrix<T_Matrix>::get(uint_t i, uint_t j) const
+{
+	indexCheck(i, j);
+
+	if(inBand(i, j))
+		return m_values[bulk::dns::band_offset(ku(), ld(), i, j)];
+
+	if(!prop().isGeneral() && inBand(j, i)) // mirrored entries of hermitian matrices are conjugated
+		return arith::conj(m_values[bulk::dns::band_offset(ku(), ld(), j, i)]);
+
+	return T_Scalar(0);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void BandMatrix<T_Matrix>::set(uint_t i, uint_t j, T_Scalar val)
+{
+	indexCheck(i, j);
+
+	if(!inBand(i, j)) {
+		throw err::InvalidOp("Entry (" + std::to_string(i) + "," + std::to_string(j) + ") is outside the stored band");
+	} // band
+
+	m_values[bulk::dns::band_offset(ku(), ld(), i, j)] = val;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix BandMatrix<T_Matrix>::toDense() const
+{
+	if(empty())
+		return T_Matrix();
+
+	T_Matrix ret(nrows(), ncols(), prop());
+	ret = 0;
+
+	bulk::dns::band_unpack(nrows(), ncols(), kl(), ku(), values(), ld(), ret.values(), ret.ld());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+BandMatrix<T_Matrix> BandMatrix<T_Matrix>::fromDense(const T_Matrix& mat, uint_t kl, uint_t ku)
+{
+	band_property_check<T_Scalar>(mat.nrows(), mat.ncols(), kl, ku, mat.prop());
+
+	if(mat.empty())
+		return BandMatrix<T_Matrix>();
+
+	BandMatrix<T_Matrix> ret(mat.nrows(), mat.ncols(), kl, ku, mat.prop());
+
+	bulk::dns::band_pack(mat.nrows(), mat.ncols(), kl, ku, mat.values(), mat.ld(), ret.values(), ret.ld());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template class BandMatrix<RdMatrix>;
+template class BandMatrix<RfMatrix>;
+template class BandMatrix<CdMatrix>;
+template class BandMatrix<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
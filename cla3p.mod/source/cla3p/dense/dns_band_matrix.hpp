@@ -0,0 +1,255 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_BAND_MATRIX_HPP_
+#define CLA3P_DNS_BAND_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @nosubgrouping 
+ * @brief A dense matrix in band storage.
+ *
+ * Stores the kl sub-diagonals, the diagonal & the ku super-diagonals of a General (m x n) matrix 
+ * in (kl + ku + 1) * n values, using the lapack band layout.@n
+ * Symmetric (real) & Hermitian (complex) matrices store the band of their uplo triangle only, 
+ * ku must be zero for Lower & kl must be zero for Upper matrices.
+ */
+template <typename T_Matrix>
+class BandMatrix {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+
+	public:
+		using value_type = T_Scalar;
+
+		// no copy
+		BandMatrix(const BandMatrix<T_Matrix>&) = delete;
+		BandMatrix<T_Matrix>& operator=(const BandMatrix<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit BandMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs an (nr x nc) band matrix with zero values.
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] kl The number of sub-diagonals.
+		 * @param[in] ku The number of super-diagonals.
+		 * @param[in] pr The matrix property, General, Symmetric (real) or Hermitian (complex).
+		 */
+		explicit BandMatrix(uint_t nr, uint_t nc, uint_t kl, uint_t ku, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of other, other is destroyed.
+		 */
+		BandMatrix(BandMatrix<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~BandMatrix();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		BandMatrix<T_Matrix>& operator=(BandMatrix<T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of matrix rows.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of matrix columns.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The number of sub-diagonals.
+		 */
+		uint_t kl() const;
+
+		/**
+		 * @brief The number of super-diagonals.
+		 */
+		uint_t ku() const;
+
+		/**
+		 * @brief The leading dimension of the band storage (kl() + ku() + 1).
+		 */
+		uint_t ld() const;
+
+		/**
+		 * @brief The matrix property.
+		 */
+		const Property& prop() const;
+
+		/**
+		 * @brief The values array (ld() x ncols(), entry (i,j) is stored in position ku() + i - j + j * ld()).
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the matrix is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the matrix.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the matrix.
+		 * @param[in] msg Header message.
+		 * @return A string with the matrix information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies the matrix.
+		 * @return A deep copy of the matrix.
+		 */
+		BandMatrix<T_Matrix> copy() const;
+
+		/**
+		 * @brief Moves the matrix.
+		 * @return A matrix with the contents of (*this), (*this) is destroyed.
+		 */
+		BandMatrix<T_Matrix> move();
+
+		/**
+		 * @brief Gets a matrix entry.
+		 *
+		 * Entries outside the band are zero, 
+		 * entries outside the stored triangle of Symmetric/Hermitian matrices are mirrored.
+		 *
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @return The (i,j) entry of the matrix.
+		 */
+		T_Scalar get(uint_t i, uint_t j) const;
+
+		/**
+		 * @brief Sets an entry of the stored band.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @param[in] val The new value of the (i,j) entry.
+		 */
+		void set(uint_t i, uint_t j, T_Scalar val);
+
+		/**
+		 * @brief Converts to full storage.
+		 * @return A dense matrix with the same property (entries outside the band are zero).
+		 */
+		T_Matrix toDense() const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Converts a dense matrix to band storage.
+		 *
+		 * Entries outside the band are discarded.
+		 *
+		 * @param[in] mat A General, Symmetric (real) or Hermitian (complex) matrix.
+		 * @param[in] kl The number of sub-diagonals.
+		 * @param[in] ku The number of super-diagonals.
+		 * @return The matrix in band storage, the property of mat is retained.
+		 */
+		static BandMatrix<T_Matrix> fromDense(const T_Matrix& mat, uint_t kl, uint_t ku);
+
+		/** @} */
+
+	private:
+		uint_t m_nr;
+		uint_t m_nc;
+		uint_t m_kl;
+		uint_t m_ku;
+		Property m_prop;
+		T_Scalar *m_values;
+
+		void defaults();
+		void indexCheck(uint_t i, uint_t j) const;
+		bool inBand(uint_t i, uint_t j) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_BAND_MATRIX_HPP_
@@ -0,0 +1,396 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/dense/dns_matrix_batch.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/dns_batch.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix>::MatrixBatch()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix>::MatrixBatch(uint_t nr, uint_t nc, uint_t count, layout_t layout)
+{
+	defaults();
+
+	if(!nr || !nc || !count) 
+		return;
+
+	m_nrows = nr;
+	m_ncols = nc;
+	m_size = count;
+	m_layout = layout;
+	m_values = i_malloc<T_Scalar>(allocSize());
+
+	//
+	// Padded lanes must hold harmless values for the compact kernels
+	//
+	if(m_layout == layout_t::Compact) {
+		std::fill(m_values, m_values + allocSize(), T_Scalar(0));
+	} // compact
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix>::MatrixBatch(MatrixBatch<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix>::~MatrixBatch()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix>& MatrixBatch<T_Matrix>::operator=(MatrixBatch<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_nrows  = other.m_nrows;
+		m_ncols  = other.m_ncols;
+		m_size   = other.m_size;
+		m_layout = other.m_layout;
+		m_values = other.m_values;
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixBatch<T_Matrix>::defaults()
+{
+	m_nrows = 0;
+	m_ncols = 0;
+	m_size = 0;
+	m_layout = layout_t::Strided;
+	m_values = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixBatch<T_Matrix>::clear()
+{
+	i_free(m_values);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bulk_t MatrixBatch<T_Matrix>::allocSize() const
+{
+	uint_t ncopies = (m_layout == layout_t::Strided ? m_size : bulk::dns::batch_compact_groups<T_Scalar>(m_size) * width());
+	return stride() / width() * ncopies;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bulk_t MatrixBatch<T_Matrix>::offset(uint_t k, uint_t i, uint_t j) const
+{
+	bulk_t W = width();
+	return (k / W) * stride() + (static_cast<bulk_t>(j) * ld() + i) * W + (k % W);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixBatch<T_Matrix>::stridedCheck() const
+{
+	if(m_layout != layout_t::Strided) {
+		throw err::InvalidOp("Individual matrices can be referenced only in Strided batches");
+	} // compact
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename MatrixBatch<T_Matrix>::T_Scalar& MatrixBatch<T_Matrix>::operator()(uint_t k, uint_t i, uint_t j)
+{
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	if(i >= nrows() || j >= ncols()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(nrows(),ncols(),i,j));
+	} // out-of-bounds
+
+	return m_values[offset(k,i,j)];
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const typename MatrixBatch<T_Matrix>::T_Scalar& MatrixBatch<T_Matrix>::operator()(uint_t k, uint_t i, uint_t j) const
+{
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	if(i >= nrows() || j >= ncols()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(nrows(),ncols(),i,j));
+	} // out-of-bounds
+
+	return m_values[offset(k,i,j)];
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixBatch<T_Matrix>::operator=(T_Scalar val)
+{
+	if(m_layout == layout_t::Strided) {
+		std::fill(m_values, m_values + allocSize(), val);
+		return;
+	} // strided
+
+	for(uint_t k = 0; k < size(); k++) {
+		for(uint_t j = 0; j < ncols(); j++) {
+			for(uint_t i = 0; i < nrows(); i++) {
+				m_values[offset(k,i,j)] = val;
+			} // i
+		} // j
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixBatch<T_Matrix>::nrows() const
+{
+	return m_nrows;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixBatch<T_Matrix>::ncols() const
+{
+	return m_ncols;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixBatch<T_Matrix>::size() const
+{
+	return m_size;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+layout_t MatrixBatch<T_Matrix>::layout() const
+{
+	return m_layout;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixBatch<T_Matrix>::width() const
+{
+	return (m_layout == layout_t::Strided ? 1 : bulk::dns::batch_compact_width<T_Scalar>());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixBatch<T_Matrix>::ld() const
+{
+	return m_nrows;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bulk_t MatrixBatch<T_Matrix>::stride() const
+{
+	return static_cast<bulk_t>(ld()) * ncols() * width();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename MatrixBatch<T_Matrix>::T_Scalar* MatrixBatch<T_Matrix>::values()
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const typename MatrixBatch<T_Matrix>::T_Scalar* MatrixBatch<T_Matrix>::values() const
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bool MatrixBatch<T_Matrix>::empty() const
+{
+	return (m_values == nullptr);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string MatrixBatch<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::DenseMatrixBatch() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of matrices... " << size() << "\n";
+	ss << "  Layout............... " << (m_layout == layout_t::Strided ? "Strided" : "Compact") << "\n";
+	ss << "  Width................ " << width() << "\n";
+	ss << "  Values............... " << values() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix> MatrixBatch<T_Matrix>::copy() const
+{
+	MatrixBatch<T_Matrix> ret(nrows(), ncols(), size(), layout());
+
+	if(!empty()) {
+		std::copy(m_values, m_values + allocSize(), ret.values());
+	} // empty
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix> MatrixBatch<T_Matrix>::move()
+{
+	MatrixBatch<T_Matrix> ret = std::move(*this);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix> MatrixBatch<T_Matrix>::convert(layout_t layout) const
+{
+	if(layout == m_layout) 
+		return copy();
+
+	MatrixBatch<T_Matrix> ret(nrows(), ncols(), size(), layout);
+
+	if(empty())
+		return ret;
+
+	if(layout == layout_t::Compact) {
+		bulk::dns::batch_pack(nrows(), ncols(), size(), values(), ld(), stride(), ret.values(), ret.ld());
+	} else {
+		bulk::dns::batch_unpack(nrows(), ncols(), size(), values(), ld(), ret.values(), ret.ld(), ret.stride());
+	} // layout
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix MatrixBatch<T_Matrix>::get(uint_t k) const
+{
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	T_Matrix ret(nrows(), ncols());
+
+	for(uint_t j = 0; j < ncols(); j++) {
+		for(uint_t i = 0; i < nrows(); i++) {
+			ret(i,j) = m_values[offset(k,i,j)];
+		} // i
+	} // j
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixBatch<T_Matrix>::set(uint_t k, const T_Matrix& mat)
+{
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	if(mat.nrows() != nrows() || mat.ncols() != ncols()) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	if(!mat.prop().isGeneral()) {
+		throw err::InvalidOp(msg::InvalidProperty());
+	} // prop
+
+	for(uint_t j = 0; j < ncols(); j++) {
+		for(uint_t i = 0; i < nrows(); i++) {
+			m_values[offset(k,i,j)] = mat(i,j);
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix MatrixBatch<T_Matrix>::matrix(uint_t k)
+{
+	stridedCheck();
+
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	return T_Matrix::wrap(nrows(), ncols(), m_values + offset(k,0,0), ld(), false);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Guard<T_Matrix> MatrixBatch<T_Matrix>::matrix(uint_t k) const
+{
+	stridedCheck();
+
+	if(k >= size()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(size(), k));
+	} // out-of-bounds
+
+	const T_Scalar *vals = m_values + offset(k,0,0);
+
+	return T_Matrix::wrap(nrows(), ncols(), vals, ld());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixBatch<T_Matrix> MatrixBatch<T_Matrix>::random(uint_t nr, uint_t nc, uint_t count, layout_t layout, T_RScalar lo, T_RScalar hi)
+{
+	MatrixBatch<T_Matrix> ret(nr, nc, count);
+
+	if(!ret.empty()) {
+		bulk::dns::rand(uplo_t::Full, nr * nc, count, ret.values(), nr * nc, lo, hi);
+	} // empty
+
+	if(layout == layout_t::Compact) {
+		ret = ret.convert(layout_t::Compact);
+	} // compact
+
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class MatrixBatch<RdMatrix>;
+template class MatrixBatch<RfMatrix>;
+template class MatrixBatch<CdMatrix>;
+template class MatrixBatch<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
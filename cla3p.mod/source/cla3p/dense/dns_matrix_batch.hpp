@@ -0,0 +1,293 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_MATRIX_BATCH_HPP_
+#define CLA3P_DNS_MATRIX_BATCH_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/guard.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @nosubgrouping 
+ * @brief A batch of uniformly sized dense matrices.
+ *
+ * All matrices of the batch are stored in a single allocation.@n
+ * In the Strided layout matrix k is a regular column-major (nrows x ncols) matrix stored at values() + k * stride().@n
+ * In the Compact layout groups of width() matrices are interleaved, so that the same entry of all matrices in a group is contiguous.
+ * Batched kernels then vectorize across the matrices of a group, which pays off for very small matrices.
+ */
+template <typename T_Matrix>
+class MatrixBatch {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+		using value_type = T_Scalar;
+
+		// no copy
+		MatrixBatch(const MatrixBatch<T_Matrix>&) = delete;
+		MatrixBatch<T_Matrix>& operator=(const MatrixBatch<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty batch.
+		 */
+		explicit MatrixBatch();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs a batch of count (nr x nc) matrices with uninitialized values.
+		 *
+		 * @param[in] nr The number of rows of each matrix.
+		 * @param[in] nc The number of columns of each matrix.
+		 * @param[in] count The number of matrices.
+		 * @param[in] layout The storage layout.
+		 */
+		explicit MatrixBatch(uint_t nr, uint_t nc, uint_t count, layout_t layout = layout_t::Strided);
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a batch with the contents of other, other is destroyed.
+		 */
+		MatrixBatch(MatrixBatch<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the batch.
+		 */
+		~MatrixBatch();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		MatrixBatch<T_Matrix>& operator=(MatrixBatch<T_Matrix>&& other);
+
+		/**
+		 * @brief Matrix entry operator.
+		 * @param[in] k The matrix index, must be less than size().
+		 * @param[in] i The row index, must be less than nrows().
+		 * @param[in] j The column index, must be less than ncols().
+		 * @return A reference to the (i,j) entry of matrix k.
+		 */
+		T_Scalar& operator()(uint_t k, uint_t i, uint_t j);
+
+		/**
+		 * @copydoc operator()(uint_t k, uint_t i, uint_t j)
+		 */
+		const T_Scalar& operator()(uint_t k, uint_t i, uint_t j) const;
+
+		/**
+		 * @brief Sets all entries of all matrices to val.
+		 */
+		void operator=(T_Scalar val);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of rows of each matrix.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of columns of each matrix.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The number of matrices in the batch.
+		 */
+		uint_t size() const;
+
+		/**
+		 * @brief The storage layout.
+		 */
+		layout_t layout() const;
+
+		/**
+		 * @brief The number of interleaved matrices (1 for the Strided layout).
+		 */
+		uint_t width() const;
+
+		/**
+		 * @brief The leading dimension of each matrix.
+		 */
+		uint_t ld() const;
+
+		/**
+		 * @brief The distance between two consecutive matrices (Strided) or groups (Compact).
+		 */
+		bulk_t stride() const;
+
+		/**
+		 * @brief The values array.
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the batch is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the batch.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the batch.
+		 * @param[in] msg Header message.
+		 * @return A string with the batch information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies the batch.
+		 * @return A deep copy of the batch.
+		 */
+		MatrixBatch<T_Matrix> copy() const;
+
+		/**
+		 * @brief Moves the batch.
+		 * @return A batch with the contents of (*this), (*this) is destroyed.
+		 */
+		MatrixBatch<T_Matrix> move();
+
+		/**
+		 * @brief Copies the batch to a different layout.
+		 * @param[in] layout The storage layout of the returned batch.
+		 * @return A deep copy of the batch in the requested layout.
+		 */
+		MatrixBatch<T_Matrix> convert(layout_t layout) const;
+
+		/**
+		 * @brief Copies a matrix of the batch.
+		 * @param[in] k The matrix index.
+		 * @return A copy of matrix k.
+		 */
+		T_Matrix get(uint_t k) const;
+
+		/**
+		 * @brief Overwrites a matrix of the batch.
+		 * @param[in] k The matrix index.
+		 * @param[in] mat A (nrows() x ncols()) general matrix.
+		 */
+		void set(uint_t k, const T_Matrix& mat);
+
+		/**
+		 * @brief Accesses a matrix of a Strided batch.
+		 *
+		 * Changes to the returned matrix are reflected in the batch.
+		 *
+		 * @param[in] k The matrix index.
+		 * @return A shallow matrix referencing the contents of matrix k.
+		 */
+		T_Matrix matrix(uint_t k);
+
+		/**
+		 * @brief Accesses a matrix of a Strided batch.
+		 * @param[in] k The matrix index.
+		 * @return A guard referencing the contents of matrix k.
+		 */
+		Guard<T_Matrix> matrix(uint_t k) const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Creates a batch with random values in (lo,hi).
+		 * @param[in] nr The number of rows of each matrix.
+		 * @param[in] nc The number of columns of each matrix.
+		 * @param[in] count The number of matrices.
+		 * @param[in] layout The storage layout.
+		 * @param[in] lo The smallest value of each generated element.
+		 * @param[in] hi The largest value of each generated element.
+		 * @return The newly created batch.
+		 */
+		static MatrixBatch<T_Matrix> random(uint_t nr, uint_t nc, uint_t count, layout_t layout = layout_t::Strided,
+				T_RScalar lo = T_RScalar(0), T_RScalar hi = T_RScalar(1));
+
+		/** @} */
+
+	private:
+		uint_t m_nrows;
+		uint_t m_ncols;
+		uint_t m_size;
+		layout_t m_layout;
+		T_Scalar *m_values;
+
+		void defaults();
+		bulk_t allocSize() const;
+		bulk_t offset(uint_t k, uint_t i, uint_t j) const;
+		void stridedCheck() const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_MATRIX_BATCH_HPP_
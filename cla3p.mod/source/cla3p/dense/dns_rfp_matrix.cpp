@@ -0,0 +1,275 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/dense/dns_rfp_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_rfp.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void rfp_property_check(uint_t nr, uint_t nc, const Property& pr)
+{
+	bool supported_prop = (
+			(TypeTraits<T_Scalar>::is_real() && pr.isSymmetric()) || 
+			(TypeTraits<T_Scalar>::is_complex() && pr.isHermitian()) || 
+			pr.isTriangular()) && !pr.isFull();
+
+	if(!supported_prop) {
+		throw err::InvalidOp("Matrices with property " + pr.name() + " not supported for RFP storage");
+	} // valid prop
+
+	if(nr != nc) {
+		throw err::InvalidOp("Only square matrices are supported for RFP storage");
+	} // square
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix>::RfpMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix>::RfpMatrix(uint_t n, const Property& pr)
+{
+	defaults();
+
+	Property spr = sanitizeProperty<T_Scalar>(pr);
+	rfp_property_check<T_Scalar>(n, n, spr);
+
+	if(!n)
+		return;
+
+	m_n = n;
+	m_prop = spr;
+	m_values = i_malloc<T_Scalar>(bulk::dns::rfp_size(n));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix>::RfpMatrix(RfpMatrix<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix>::~RfpMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix>& RfpMatrix<T_Matrix>::operator=(RfpMatrix<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_n      = other.m_n;
+		m_prop   = other.m_prop;
+		m_values = other.m_values;
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RfpMatrix<T_Matrix>::defaults()
+{
+	m_n = 0;
+	m_prop = Property();
+	m_values = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RfpMatrix<T_Matrix>::clear()
+{
+	i_free(m_values);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t RfpMatrix<T_Matrix>::nrows() const { return m_n; }
+template <typename T_Matrix> uint_t RfpMatrix<T_Matrix>::ncols() const { return m_n; }
+template <typename T_Matrix> const Property& RfpMatrix<T_Matrix>::prop() const { return m_prop; }
+template <typename T_Matrix> typename RfpMatrix<T_Matrix>::T_Scalar* RfpMatrix<T_Matrix>::values() { return m_values; }
+template <typename T_Matrix> const typename RfpMatrix<T_Matrix>::T_Scalar* RfpMatrix<T_Matrix>::values() const { return m_values; }
+template <typename T_Matrix> bool RfpMatrix<T_Matrix>::empty() const { return (m_values == nullptr); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string RfpMatrix<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::DenseRfpMatrix() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Stored values........ " << bulk::dns::rfp_size(m_n) << "\n";
+	ss << "  Values............... " << values() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix> RfpMatrix<T_Matrix>::copy() const
+{
+	if(empty())
+		return RfpMatrix<T_Matrix>();
+
+	RfpMatrix<T_Matrix> ret(nrows(), prop());
+
+	std::copy(m_values, m_values + bulk::dns::rfp_size(m_n), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix> RfpMatrix<T_Matrix>::move()
+{
+	RfpMatrix<T_Matrix> ret = std::move(*this);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RfpMatrix<T_Matrix>::indexCheck(uint_t i, uint_t j) const
+{
+	if(i >= nrows() || j >= ncols()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(nrows(),ncols(),i,j));
+	} // out-of-bounds
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RfpMatrix<T_Matrix>::T_Scalar RfpMatrix<T_Matrix>::get(uint_t i, uint_t j) const
+{
+	indexCheck(i, j);
+
+	bool stored = (prop().isLower() ? i >= j : i <= j);
+
+	if(!stored && prop().isTriangular())
+		return T_Scalar(0);
+
+	bool conj = false;
+	T_Scalar ret = (stored ? 
+			m_values[bulk::dns::rfp_offset(prop().uplo(), m_n, i, j, conj)] : 
+			m_values[bulk::dns::rfp_offset(prop().uplo(), m_n, j, i, conj)]);
+
+	if(conj != !stored) ret = arith::conj(ret); // mirrored entries of hermitian matrices are conjugated
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RfpMatrix<T_Matrix>::set(uint_t i, uint_t j, T_Scalar val)
+{
+	indexCheck(i, j);
+
+	bool stored = (prop().isLower() ? i >= j : i <= j);
+
+	if(!stored) {
+		throw err::InvalidOp("Only the " + prop().name() + " part of the matrix can be set");
+	} // stored
+
+	bool conj = false;
+	bulk_t off = bulk::dns::rfp_offset(prop().uplo(), m_n, i, j, conj);
+
+	m_values[off] = (conj ? arith::conj(val) : val);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RfpMatrix<T_Matrix>::T_RScalar RfpMatrix<T_Matrix>::normOne() const
+{
+	return bulk::dns::rfp_norm_one(prop().type(), prop().uplo(), m_n, values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RfpMatrix<T_Matrix>::T_RScalar RfpMatrix<T_Matrix>::normInf() const
+{
+	return bulk::dns::rfp_norm_inf(prop().type(), prop().uplo(), m_n, values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RfpMatrix<T_Matrix>::T_RScalar RfpMatrix<T_Matrix>::normMax() const
+{
+	return bulk::dns::rfp_norm_max(m_n, values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RfpMatrix<T_Matrix>::T_RScalar RfpMatrix<T_Matrix>::normFro() const
+{
+	return bulk::dns::rfp_norm_fro(prop().type(), prop().uplo(), m_n, values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix RfpMatrix<T_Matrix>::toDense() const
+{
+	if(empty())
+		return T_Matrix();
+
+	T_Matrix ret(nrows(), ncols(), prop());
+
+	bulk::dns::rfp_unpack(prop().uplo(), m_n, values(), ret.values(), ret.ld());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RfpMatrix<T_Matrix> RfpMatrix<T_Matrix>::fromDense(const T_Matrix& mat)
+{
+	rfp_property_check<T_Scalar>(mat.nrows(), mat.ncols(), mat.prop());
+
+	if(mat.empty())
+		return RfpMatrix<T_Matrix>();
+
+	RfpMatrix<T_Matrix> ret(mat.nrows(), mat.prop());
+
+	bulk::dns::rfp_pack(mat.prop().uplo(), mat.nrows(), mat.values(), mat.ld(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template class RfpMatrix<RdMatrix>;
+template class RfpMatrix<RfMatrix>;
+template class RfpMatrix<CdMatrix>;
+template class RfpMatrix<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
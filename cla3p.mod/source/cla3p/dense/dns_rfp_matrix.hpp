@@ -0,0 +1,250 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_RFP_MATRIX_HPP_
+#define CLA3P_DNS_RFP_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @nosubgrouping 
+ * @brief A dense square matrix in rectangular full packed (RFP) storage.
+ *
+ * Stores the uplo triangle of a Symmetric (real), Hermitian (complex) or Triangular n x n matrix 
+ * in n * (n + 1) / 2 values, half the memory of the full storage.@n
+ * The values are arranged in the lapack RFP layout (normal form): the two triangular diagonal blocks 
+ * are packed together in a rectangular array next to the off-diagonal block, 
+ * so that factorizations & products run on BLAS3 kernels.
+ */
+template <typename T_Matrix>
+class RfpMatrix {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+		using value_type = T_Scalar;
+
+		// no copy
+		RfpMatrix(const RfpMatrix<T_Matrix>&) = delete;
+		RfpMatrix<T_Matrix>& operator=(const RfpMatrix<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit RfpMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs an (n x n) matrix with uninitialized values.
+		 *
+		 * @param[in] n The matrix dimension.
+		 * @param[in] pr The matrix property, Symmetric (real), Hermitian (complex) or Triangular, Lower or Upper.
+		 */
+		explicit RfpMatrix(uint_t n, const Property& pr);
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of other, other is destroyed.
+		 */
+		RfpMatrix(RfpMatrix<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~RfpMatrix();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		RfpMatrix<T_Matrix>& operator=(RfpMatrix<T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of matrix rows.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of matrix columns.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The matrix property.
+		 */
+		const Property& prop() const;
+
+		/**
+		 * @brief The values array (nrows() * (nrows() + 1) / 2 values in the lapack RFP layout).
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the matrix is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the matrix.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the matrix.
+		 * @param[in] msg Header message.
+		 * @return A string with the matrix information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies the matrix.
+		 * @return A deep copy of the matrix.
+		 */
+		RfpMatrix<T_Matrix> copy() const;
+
+		/**
+		 * @brief Moves the matrix.
+		 * @return A matrix with the contents of (*this), (*this) is destroyed.
+		 */
+		RfpMatrix<T_Matrix> move();
+
+		/**
+		 * @brief Gets a matrix entry.
+		 *
+		 * Entries outside the stored triangle are recovered from the property 
+		 * (mirrored for Symmetric/Hermitian, zero for Triangular).
+		 *
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @return The (i,j) entry of the matrix.
+		 */
+		T_Scalar get(uint_t i, uint_t j) const;
+
+		/**
+		 * @brief Sets an entry of the stored triangle.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @param[in] val The new value of the (i,j) entry.
+		 */
+		void set(uint_t i, uint_t j, T_Scalar val);
+
+		/**
+		 * @brief The 1-norm.
+		 */
+		T_RScalar normOne() const;
+
+		/**
+		 * @brief The infinite norm.
+		 */
+		T_RScalar normInf() const;
+
+		/**
+		 * @brief The maximum norm.
+		 */
+		T_RScalar normMax() const;
+
+		/**
+		 * @brief The Frobenius norm.
+		 */
+		T_RScalar normFro() const;
+
+		/**
+		 * @brief Converts to full storage.
+		 * @return A dense matrix with the same property (only the stored triangle is filled).
+		 */
+		T_Matrix toDense() const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Converts a dense matrix to RFP storage.
+		 * @param[in] mat A square Symmetric (real), Hermitian (complex) or Triangular matrix.
+		 * @return The matrix in RFP storage, the property of mat is retained.
+		 */
+		static RfpMatrix<T_Matrix> fromDense(const T_Matrix& mat);
+
+		/** @} */
+
+	private:
+		uint_t m_n;
+		Property m_prop;
+		T_Scalar *m_values;
+
+		void defaults();
+		void indexCheck(uint_t i, uint_t j) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_RFP_MATRIX_HPP_
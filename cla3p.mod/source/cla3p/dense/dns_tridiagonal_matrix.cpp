@@ -0,0 +1,337 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/dense/dns_tridiagonal_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void tridiagonal_property_check(uint_t nr, uint_t nc, const Property& pr)
+{
+	bool supported_prop = (
+			pr.isGeneral() || 
+			(TypeTraits<T_Scalar>::is_real() && pr.isSymmetric()) || 
+			(TypeTraits<T_Scalar>::is_complex() && pr.isHermitian()));
+
+	if(!supported_prop) {
+		throw err::InvalidOp("Matrices with property " + pr.name() + " not supported for tridiagonal storage");
+	} // valid prop
+
+	if(nr != nc) {
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix>::TridiagonalMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix>::TridiagonalMatrix(uint_t n, const Property& pr)
+{
+	defaults();
+
+	Property spr = sanitizeProperty<T_Scalar>(pr);
+	tridiagonal_property_check<T_Scalar>(n, n, spr);
+
+	if(!n)
+		return;
+
+	m_n = n;
+	m_prop = spr;
+	m_values = i_calloc<T_Scalar>(size());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix>::TridiagonalMatrix(TridiagonalMatrix<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix>::~TridiagonalMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix>& TridiagonalMatrix<T_Matrix>::operator=(TridiagonalMatrix<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_n      = other.m_n;
+		m_prop   = other.m_prop;
+		m_values = other.m_values;
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void TridiagonalMatrix<T_Matrix>::defaults()
+{
+	m_n = 0;
+	m_prop = Property();
+	m_values = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void TridiagonalMatrix<T_Matrix>::clear()
+{
+	i_free(m_values);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+bulk_t TridiagonalMatrix<T_Matrix>::size() const
+{
+	if(!m_n)
+		return 0;
+
+	bulk_t noffdiags = (prop().isGeneral() ? 2 : 1);
+
+	return m_n + noffdiags * (m_n - 1);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t TridiagonalMatrix<T_Matrix>::nrows() const { return m_n; }
+template <typename T_Matrix> uint_t TridiagonalMatrix<T_Matrix>::ncols() const { return m_n; }
+template <typename T_Matrix> const Property& TridiagonalMatrix<T_Matrix>::prop() const { return m_prop; }
+template <typename T_Matrix> typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::values() { return m_values; }
+template <typename T_Matrix> const typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::values() const { return m_values; }
+template <typename T_Matrix> bool TridiagonalMatrix<T_Matrix>::empty() const { return (m_values == nullptr); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::diagonal()
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::diagonal() const
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::subdiagonal()
+{
+	return (empty() || prop().isUpper() ? nullptr : m_values + m_n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::subdiagonal() const
+{
+	return (empty() || prop().isUpper() ? nullptr : m_values + m_n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::superdiagonal()
+{
+	if(empty() || prop().isLower()) return nullptr;
+	return (prop().isGeneral() ? m_values + 2 * m_n - 1 : m_values + m_n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::superdiagonal() const
+{
+	if(empty() || prop().isLower()) return nullptr;
+	return (prop().isGeneral() ? m_values + 2 * m_n - 1 : m_values + m_n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string TridiagonalMatrix<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::DenseTridiagonalMatrix() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Stored values........ " << size() << "\n";
+	ss << "  Values............... " << values() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix> TridiagonalMatrix<T_Matrix>::copy() const
+{
+	if(empty())
+		return TridiagonalMatrix<T_Matrix>();
+
+	TridiagonalMatrix<T_Matrix> ret(nrows(), prop());
+
+	std::copy(m_values, m_values + size(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix> TridiagonalMatrix<T_Matrix>::move()
+{
+	TridiagonalMatrix<T_Matrix> ret = std::move(*this);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void TridiagonalMatrix<T_Matrix>::indexCheck(uint_t i, uint_t j) const
+{
+	if(i >= nrows() || j >= ncols()) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(nrows(),ncols(),i,j));
+	} // out-of-bounds
+}
+/*-------------------------------------------------*/
+//
+// Position of entry (i,j), nullptr outside the three diagonals
+// conj is set for the mirrored entries of Symmetric/Hermitian matrices
+//
+template <typename T_Matrix>
+typename TridiagonalMatrix<T_Matrix>::T_Scalar* TridiagonalMatrix<T_Matrix>::entry(uint_t i, uint_t j, bool& conj) const
+{
+	T_Scalar *dl = const_cast<T_Scalar*>(subdiagonal());
+	T_Scalar *du = const_cast<T_Scalar*>(superdiagonal());
+
+	conj = false;
+
+	if(i == j) 
+		return m_values + i;
+
+	if(i == j + 1) {
+		conj = (dl == nullptr);
+		return (conj ? du + j : dl + j);
+	} // sub-diagonal
+
+	if(j == i + 1) {
+		conj = (du == nullptr);
+		return (conj ? dl + i : du + i);
+	} // super-diagonal
+
+	return nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TridiagonalMatrix<T_Matrix>::T_Scalar TridiagonalMatrix<T_Matrix>::get(uint_t i, uint_t j) const
+{
+	indexCheck(i, j);
+
+	bool conj = false;
+	const T_Scalar *ptr = entry(i, j, conj);
+
+	if(!ptr)
+		return T_Scalar(0);
+
+	return (conj ? arith::conj(*ptr) : *ptr);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void TridiagonalMatrix<T_Matrix>::set(uint_t i, uint_t j, T_Scalar val)
+{
+	indexCheck(i, j);
+
+	bool conj = false;
+	T_Scalar *ptr = entry(i, j, conj);
+
+	if(!ptr || conj) {
+		throw err::InvalidOp("Entry (" + std::to_string(i) + "," + std::to_string(j) + ") is not stored");
+	} // stored
+
+	*ptr = val;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix TridiagonalMatrix<T_Matrix>::toDense() const
+{
+	if(empty())
+		return T_Matrix();
+
+	T_Matrix ret(nrows(), ncols(), prop());
+	ret = 0;
+
+	const T_Scalar *d  = diagonal();
+	const T_Scalar *dl = subdiagonal();
+	const T_Scalar *du = superdiagonal();
+
+	for(uint_t i = 0; i < m_n; i++) {
+		ret(i,i) = d[i];
+		if(dl && i + 1 < m_n) ret(i+1,i) = dl[i];
+		if(du && i + 1 < m_n) ret(i,i+1) = du[i];
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+TridiagonalMatrix<T_Matrix> TridiagonalMatrix<T_Matrix>::fromDense(const T_Matrix& mat)
+{
+	tridiagonal_property_check<T_Scalar>(mat.nrows(), mat.ncols(), mat.prop());
+
+	if(mat.empty())
+		return TridiagonalMatrix<T_Matrix>();
+
+	TridiagonalMatrix<T_Matrix> ret(mat.nrows(), mat.prop());
+
+	uint_t n = ret.nrows();
+	T_Scalar *d  = ret.diagonal();
+	T_Scalar *dl = ret.subdiagonal();
+	T_Scalar *du = ret.superdiagonal();
+
+	for(uint_t i = 0; i < n; i++) {
+		d[i] = mat(i,i);
+		if(dl && i + 1 < n) dl[i] = mat(i+1,i);
+		if(du && i + 1 < n) du[i] = mat(i,i+1);
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template class TridiagonalMatrix<RdMatrix>;
+template class TridiagonalMatrix<RfMatrix>;
+template class TridiagonalMatrix<CdMatrix>;
+template class TridiagonalMatrix<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_TRIDIAGONAL_MATRIX_HPP_
+#define CLA3P_DNS_TRIDIAGONAL_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_dense
+ * @nosubgrouping 
+ * @brief A dense square tridiagonal matrix.
+ *
+ * Stores the diagonal (n values) followed by the sub-diagonal & the super-diagonal (n - 1 values each) of a General matrix.@n
+ * Symmetric (real) & Hermitian (complex) matrices store the diagonal followed by 
+ * the sub-diagonal (Lower) or the super-diagonal (Upper) only.
+ */
+template <typename T_Matrix>
+class TridiagonalMatrix {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+
+	public:
+		using value_type = T_Scalar;
+
+		// no copy
+		TridiagonalMatrix(const TridiagonalMatrix<T_Matrix>&) = delete;
+		TridiagonalMatrix<T_Matrix>& operator=(const TridiagonalMatrix<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit TridiagonalMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs an (n x n) tridiagonal matrix with zero values.
+		 *
+		 * @param[in] n The matrix dimension.
+		 * @param[in] pr The matrix property, General, Symmetric (real) or Hermitian (complex).
+		 */
+		explicit TridiagonalMatrix(uint_t n, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of other, other is destroyed.
+		 */
+		TridiagonalMatrix(TridiagonalMatrix<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~TridiagonalMatrix();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		TridiagonalMatrix<T_Matrix>& operator=(TridiagonalMatrix<T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of matrix rows.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of matrix columns.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The matrix property.
+		 */
+		const Property& prop() const;
+
+		/**
+		 * @brief The values array.
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/**
+		 * @brief The diagonal (n values).
+		 */
+		T_Scalar* diagonal();
+
+		/**
+		 * @copydoc diagonal()
+		 */
+		const T_Scalar* diagonal() const;
+
+		/**
+		 * @brief The sub-diagonal (n - 1 values), nullptr if not stored.
+		 */
+		T_Scalar* subdiagonal();
+
+		/**
+		 * @copydoc subdiagonal()
+		 */
+		const T_Scalar* subdiagonal() const;
+
+		/**
+		 * @brief The super-diagonal (n - 1 values), nullptr if not stored.
+		 */
+		T_Scalar* superdiagonal();
+
+		/**
+		 * @copydoc superdiagonal()
+		 */
+		const T_Scalar* superdiagonal() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the matrix is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the matrix.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the matrix.
+		 * @param[in] msg Header message.
+		 * @return A string with the matrix information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies the matrix.
+		 * @return A deep copy of the matrix.
+		 */
+		TridiagonalMatrix<T_Matrix> copy() const;
+
+		/**
+		 * @brief Moves the matrix.
+		 * @return A matrix with the contents of (*this), (*this) is destroyed.
+		 */
+		TridiagonalMatrix<T_Matrix> move();
+
+		/**
+		 * @brief Gets a matrix entry.
+		 *
+		 * Entries outside the three diagonals are zero, 
+		 * entries outside the stored triangle of Symmetric/Hermitian matrices are mirrored.
+		 *
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @return The (i,j) entry of the matrix.
+		 */
+		T_Scalar get(uint_t i, uint_t j) const;
+
+		/**
+		 * @brief Sets a stored entry.
+		 * @param[in] i The row index.
+		 * @param[in] j The column index.
+		 * @param[in] val The new value of the (i,j) entry.
+		 */
+		void set(uint_t i, uint_t j, T_Scalar val);
+
+		/**
+		 * @brief Converts to full storage.
+		 * @return A dense matrix with the same property (entries outside the three diagonals are zero).
+		 */
+		T_Matrix toDense() const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Converts a dense matrix to tridiagonal storage.
+		 *
+		 * Entries outside the three diagonals are discarded.
+		 *
+		 * @param[in] mat A square General, Symmetric (real) or Hermitian (complex) matrix.
+		 * @return The tridiagonal matrix, the property of mat is retained.
+		 */
+		static TridiagonalMatrix<T_Matrix> fromDense(const T_Matrix& mat);
+
+		/** @} */
+
+	private:
+		uint_t m_n;
+		Property m_prop;
+		T_Scalar *m_values;
+
+		void defaults();
+		void indexCheck(uint_t i, uint_t j) const;
+		bulk_t size() const;
+		T_Scalar* entry(uint_t i, uint_t j, bool& conj) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_TRIDIAGONAL_MATRIX_HPP_
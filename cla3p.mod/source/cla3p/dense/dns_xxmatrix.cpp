@@ -303,6 +303,15 @@ T_Matrix XxMatrixTmpl::random(uint_t nr, uint_t nc, const Property& pr, T_RScala
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
+T_Matrix XxMatrixTmpl::randomNormal(uint_t nr, uint_t nc, const Property& pr, T_RScalar mean, T_RScalar stddev)
+{
+	T_Matrix ret = init(nr, nc, pr);
+	bulk::dns::randn(ret.prop().uplo(), ret.nrows(), ret.ncols(), ret.values(), ret.ld(), mean, stddev);
+	bulk::dns::set_diag_zeros(ret.prop().type(), ret.ncols(), ret.values(), ret.ld());
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
 T_Matrix XxMatrixTmpl::wrap(uint_t nr, uint_t nc, T_Scalar *vals, uint_t ldv, bool bind, const Property& pr)
 {
 	T_Matrix ret;
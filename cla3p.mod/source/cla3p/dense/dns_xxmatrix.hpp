@@ -411,7 +411,8 @@ class XxMatrix : public XxObject<T_Scalar,T_Matrix> {
 		/**
 		 * @brief Creates a matrix with random values in (lo,hi).
 		 *
-		 * Creates a (nr x nc) matrix with random values.
+		 * Creates a (nr x nc) matrix with uniformly distributed random values.
+		 * Values are reproducible for a given seed, see setRandomSeed().
 		 *
 		 * @param[in] nr The number of matrix rows.
 		 * @param[in] nc The number of matrix columns.
@@ -423,6 +424,23 @@ class XxMatrix : public XxObject<T_Scalar,T_Matrix> {
 		static T_Matrix random(uint_t nr, uint_t nc, const Property& pr = defaultProperty(), 
 				T_RScalar lo = T_RScalar(0), T_RScalar hi = T_RScalar(1));
 
+		/**
+		 * @brief Creates a matrix with normally distributed random values.
+		 *
+		 * Creates a (nr x nc) matrix with normally distributed random values.
+		 * For complex matrices, the real & imaginary parts are independently distributed.
+		 * Values are reproducible for a given seed, see setRandomSeed().
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] pr The matrix property.
+		 * @param[in] mean The mean of the distribution.
+		 * @param[in] stddev The standard deviation of the distribution.
+		 * @return The newly created matrix.
+		 */
+		static T_Matrix randomNormal(uint_t nr, uint_t nc, const Property& pr = defaultProperty(), 
+				T_RScalar mean = T_RScalar(0), T_RScalar stddev = T_RScalar(1));
+
 		/**
 		 * @brief Creates a matrix from aux data.
 		 *
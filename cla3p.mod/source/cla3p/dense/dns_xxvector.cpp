@@ -214,6 +214,14 @@ T_Vector XxVectorTmpl::random(uint_t n, T_RScalar lo, T_RScalar hi)
 }
 /*-------------------------------------------------*/
 XxVectorTlst
+T_Vector XxVectorTmpl::randomNormal(uint_t n, T_RScalar mean, T_RScalar stddev)
+{
+	T_Vector ret(n);
+	bulk::dns::randn(uplo_t::Full, ret.rsize(), ret.csize(), ret.values(), ret.lsize(), mean, stddev);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxVectorTlst
 T_Vector XxVectorTmpl::wrap(uint_t n, T_Scalar *vals, bool bind)
 {
 	T_Vector ret;
@@ -276,7 +276,8 @@ class XxVector : public XxObject<T_Scalar,T_Vector> {
 		/**
 		 * @brief Creates a vector with random values in (lo,hi).
 		 *
-		 * Creates a n-sized vector with random values.
+		 * Creates a n-sized vector with uniformly distributed random values.
+		 * Values are reproducible for a given seed, see setRandomSeed().
 		 *
 		 * @param[in] n The vector size.
 		 * @param[in] lo The smallest value of each generated element.
@@ -285,6 +286,20 @@ class XxVector : public XxObject<T_Scalar,T_Vector> {
 		 */
 		static T_Vector random(uint_t n, T_RScalar lo = T_RScalar(0), T_RScalar hi = T_RScalar(1));
 
+		/**
+		 * @brief Creates a vector with normally distributed random values.
+		 *
+		 * Creates a n-sized vector with normally distributed random values.
+		 * For complex vectors, the real & imaginary parts are independently distributed.
+		 * Values are reproducible for a given seed, see setRandomSeed().
+		 *
+		 * @param[in] n The vector size.
+		 * @param[in] mean The mean of the distribution.
+		 * @param[in] stddev The standard deviation of the distribution.
+		 * @return The newly created vector.
+		 */
+		static T_Vector randomNormal(uint_t n, T_RScalar mean = T_RScalar(0), T_RScalar stddev = T_RScalar(1));
+
 		/**
 		 * @brief Creates a vector from aux data.
 		 *
@@ -341,33 +341,36 @@ void Array2D<T_Scalar>::xxPermuteToMirror(Array2D<T_Scalar>& trg, const prm::PiM
 template <typename T_Scalar>
 void Array2D<T_Scalar>::gePermuteIpLeftRight(const prm::PiMatrix& P, const prm::PiMatrix& Q)
 {
-	Array2D<T_Scalar> tmp;
-	gePermuteToLeftRight(tmp, P, Q);
-	tmp.copyToAllocated(*this);
+	perm_ge_op_consistency_check(property().type(), rsize(), csize(), P.size(), Q.size());
+
+	bulk::dns::ipermute(property().type(), property().uplo(), rsize(), csize(), values(), lsize(), P.values(), Q.values());
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 void Array2D<T_Scalar>::gePermuteIpLeft(const prm::PiMatrix& P)
 {
-	Array2D<T_Scalar> tmp;
-	gePermuteToLeft(tmp, P);
-	tmp.copyToAllocated(*this);
+	perm_ge_op_consistency_check(property().type(), rsize(), csize(), P.size(), csize());
+
+	bulk::dns::ipermute(property().type(), property().uplo(), rsize(), csize(), values(), lsize(), P.values(), nullptr);
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 void Array2D<T_Scalar>::gePermuteIpRight(const prm::PiMatrix& Q)
 {
-	Array2D<T_Scalar> tmp;
-	gePermuteToRight(tmp, Q);
-	tmp.copyToAllocated(*this);
+	perm_ge_op_consistency_check(property().type(), rsize(), csize(), rsize(), Q.size());
+
+	bulk::dns::ipermute(property().type(), property().uplo(), rsize(), csize(), values(), lsize(), nullptr, Q.values());
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 void Array2D<T_Scalar>::xxPermuteIpMirror(const prm::PiMatrix& P)
 {
-	Array2D<T_Scalar> tmp;
-	xxPermuteToMirror(tmp, P);
-	tmp.copyToAllocated(*this);
+	perm_op_consistency_check(rsize(), csize(), P.size(), P.size());
+
+	prm::PiMatrix iP;
+	if(property().isGeneral()) iP = P.inverse();
+
+	bulk::dns::ipermute(property().type(), property().uplo(), rsize(), csize(), values(), lsize(), P.values(), iP.values());
 }
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
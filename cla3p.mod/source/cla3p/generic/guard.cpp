@@ -86,6 +86,11 @@ template class Guard<csc::RfMatrix>;
 template class Guard<csc::CdMatrix>;
 template class Guard<csc::CfMatrix>;
 /*-------------------------------------------------*/
+template class Guard<csr::RdMatrix>;
+template class Guard<csr::RfMatrix>;
+template class Guard<csr::CdMatrix>;
+template class Guard<csr::CfMatrix>;
+/*-------------------------------------------------*/
 template class Guard<prm::PiMatrix>;
 /*-------------------------------------------------*/
 } // namespace cla3p
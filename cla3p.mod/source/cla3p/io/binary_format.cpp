@@ -0,0 +1,351 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/io/binary_format.hpp"
+
+// system
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/support/file_io.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace io {
+/*-------------------------------------------------*/
+static const char bin_magic[8] = {'C', 'L', 'A', '3', 'P', 'B', 'I', 'N'};
+/*-------------------------------------------------*/
+static uint64_t align_up(uint64_t offset)
+{
+	return (offset + bin_align - 1) / bin_align * bin_align;
+}
+/*-------------------------------------------------*/
+FileHeader create_header(uint32_t object, uint32_t scalar, uint32_t intwidth, const Property& pr, 
+		uint64_t nrows, uint64_t ncols, uint64_t ld, uint64_t nnz)
+{
+	FileHeader ret;
+	std::memset(&ret, 0, sizeof(FileHeader));
+
+	std::memcpy(ret.magic, bin_magic, sizeof(bin_magic));
+	ret.version  = bin_version;
+	ret.endian   = bin_endian;
+	ret.object   = object;
+	ret.scalar   = scalar;
+	ret.intwidth = intwidth;
+	ret.ptype    = static_cast<uint32_t>(pr.type());
+	ret.uplo     = static_cast<uint32_t>(pr.uplo());
+	ret.nrows    = nrows;
+	ret.ncols    = ncols;
+	ret.ld       = ld;
+	ret.nnz      = nnz;
+	ret.complete = 0;
+
+	return ret;
+}
+/*-------------------------------------------------*/
+void parse_header(const void *data, uint64_t nbytes, const std::string& filename, FileHeader& header, std::vector<SectionEntry>& sections)
+{
+	const char *ptr = static_cast<const char*>(data);
+
+	if(nbytes < sizeof(FileHeader)) {
+		throw err::InvalidOp("File '" + filename + "' is not a cla3p binary file");
+	} // size
+
+	std::memcpy(&header, ptr, sizeof(FileHeader));
+
+	if(std::memcmp(header.magic, bin_magic, sizeof(bin_magic))) {
+		throw err::InvalidOp("File '" + filename + "' is not a cla3p binary file");
+	} // magic
+
+	if(header.endian != bin_endian) {
+		throw err::InvalidOp("File '" + filename + "' has incompatible byte order");
+	} // endianness
+
+	if(header.version > bin_version) {
+		throw err::InvalidOp("File '" + filename + "' has unsupported version " + std::to_string(header.version));
+	} // version
+
+	if(header.nsections > bin_max_sections || nbytes < bin_table_offset + header.nsections * sizeof(SectionEntry)) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (invalid section table)");
+	} // nsections
+
+	sections.resize(header.nsections);
+
+	if(header.nsections) {
+		std::memcpy(sections.data(), ptr + bin_table_offset, header.nsections * sizeof(SectionEntry));
+	} // nsections
+}
+/*-------------------------------------------------*/
+void read_header(std::FILE *fp, const std::string& filename, FileHeader& header, std::vector<SectionEntry>& sections)
+{
+	char buffer[bin_data_offset];
+
+	bulk_t nbytes = std::fread(buffer, 1, bin_data_offset, fp);
+
+	parse_header(buffer, nbytes, filename, header, sections);
+}
+/*-------------------------------------------------*/
+void check_header(const std::string& filename, const FileHeader& header, const std::vector<SectionEntry>& sections, 
+		uint64_t fsize, uint32_t object, uint32_t scalar)
+{
+	if(!header.complete) {
+		throw err::InvalidOp("File '" + filename + "' is incomplete");
+	} // complete
+
+	if(header.object != object || header.scalar != scalar) {
+		throw err::NoConsistency("File '" + filename + "' contains an object of different type");
+	} // type
+
+	//
+	// Dimensions are narrowed to uint_t (ncols + 1 included), nnz to the stored integer type
+	//
+	const uint64_t dmax = std::numeric_limits<uint_t>::max();
+	const uint64_t zmax = (header.intwidth == 4 ? 
+			static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) : 
+			static_cast<uint64_t>(std::numeric_limits<int64_t>::max()));
+
+	if(header.intwidth != 4 && header.intwidth != 8) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (invalid integer width)");
+	} // intwidth
+
+	if(header.nrows > dmax || header.ncols >= dmax || header.ld > dmax || header.nnz > zmax || header.ld < header.nrows) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (dimensions out of range)");
+	} // dims
+
+	for(const SectionEntry& sec : sections) {
+		if(sec.offset % bin_align || sec.bytes > fsize || sec.offset > fsize - sec.bytes) {
+			throw err::InvalidOp("File '" + filename + "' is corrupted (section out of range)");
+		} // range
+	} // sec
+}
+/*-------------------------------------------------*/
+uint64_t section_bytes(const std::string& filename, uint64_t count, uint64_t width)
+{
+	if(width && count > std::numeric_limits<uint64_t>::max() / width) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (section size overflow)");
+	} // overflow
+
+	return count * width;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+Checksum::Checksum()
+	: m_hash(0xcbf29ce484222325ULL), m_tail(0), m_nbytes(0), m_ntail(0)
+{
+}
+/*-------------------------------------------------*/
+void Checksum::mix(uint64_t word)
+{
+	m_hash ^= word;
+	m_hash *= 0x9e3779b97f4a7c15ULL;
+	m_hash ^= (m_hash >> 29);
+}
+/*-------------------------------------------------*/
+void Checksum::update(const void *data, bulk_t nbytes)
+{
+	const unsigned char *ptr = static_cast<const unsigned char*>(data);
+
+	m_nbytes += nbytes;
+
+	while(nbytes && m_ntail) {
+		m_tail |= (static_cast<uint64_t>(*ptr) << (8 * m_ntail));
+		ptr++;
+		nbytes--;
+		if(++m_ntail == 8) {
+			mix(m_tail);
+			m_tail = 0;
+			m_ntail = 0;
+		} // full word
+	} // pending tail
+
+	bulk_t nwords = nbytes / 8;
+
+	for(bulk_t k = 0; k < nwords; k++) {
+		uint64_t word;
+		std::memcpy(&word, ptr + 8 * k, 8);
+		mix(word);
+	} // k
+
+	ptr += 8 * nwords;
+	nbytes -= 8 * nwords;
+
+	for(bulk_t k = 0; k < nbytes; k++) {
+		m_tail |= (static_cast<uint64_t>(ptr[k]) << (8 * m_ntail));
+		m_ntail++;
+	} // k
+}
+/*-------------------------------------------------*/
+uint64_t Checksum::value() const
+{
+	uint64_t ret = m_hash;
+
+	if(m_ntail) {
+		ret ^= m_tail;
+		ret *= 0x9e3779b97f4a7c15ULL;
+		ret ^= (ret >> 29);
+	} // tail
+
+	ret ^= m_nbytes;
+	ret *= 0xff51afd7ed558ccdULL;
+	ret ^= (ret >> 33);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+uint64_t checksum(const void *data, bulk_t nbytes)
+{
+	Checksum ret;
+	ret.update(data, nbytes);
+	return ret.value();
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+FileWriter::FileWriter(const std::string& filename, const FileHeader& header, const std::vector<uint64_t>& sectionBytes)
+	: 
+		m_filename(filename), 
+		m_fp(nullptr), 
+		m_header(header), 
+		m_current(0), 
+		m_written(0)
+{
+	if(sectionBytes.size() > bin_max_sections) {
+		throw err::InvalidOp("Too many sections for binary file '" + filename + "'");
+	} // nsections
+
+	m_header.nsections = static_cast<uint32_t>(sectionBytes.size());
+	m_header.complete = 0;
+
+	m_sections.resize(sectionBytes.size());
+	m_checksums.resize(sectionBytes.size());
+
+	uint64_t offset = bin_data_offset;
+	for(bulk_t k = 0; k < sectionBytes.size(); k++) {
+		std::memset(&m_sections[k], 0, sizeof(SectionEntry));
+		m_sections[k].offset = offset;
+		m_sections[k].bytes = sectionBytes[k];
+		offset = align_up(offset + sectionBytes[k]);
+	} // k
+
+	m_fp = std::fopen(filename.c_str(), "wb");
+
+	if(!m_fp) {
+		throw err::InvalidOp("Could not open file '" + filename + "' for writing");
+	} // fp
+
+	put(&m_header, sizeof(FileHeader));
+	pad(bin_data_offset);
+	advance();
+}
+/*-------------------------------------------------*/
+FileWriter::~FileWriter()
+{
+	if(m_fp) {
+		std::fclose(m_fp);
+	} // fp
+}
+/*-------------------------------------------------*/
+void FileWriter::put(const void *data, bulk_t nbytes)
+{
+	if(nbytes && std::fwrite(data, 1, nbytes, m_fp) != nbytes) {
+		throw err::InvalidOp("Failed to write to file '" + m_filename + "'");
+	} // fwrite
+}
+/*-------------------------------------------------*/
+void FileWriter::pad(uint64_t offset)
+{
+	static const char zeros[bin_align] = {};
+
+	uint64_t pos = file_tell(m_fp);
+
+	while(pos < offset) {
+		bulk_t len = static_cast<bulk_t>(std::min(offset - pos, bin_align));
+		put(zeros, len);
+		pos += len;
+	} // pos
+}
+/*-------------------------------------------------*/
+//
+// Skips completed (or empty) sections & pads up to the start of the next one
+//
+void FileWriter::advance()
+{
+	while(m_current < m_sections.size() && m_written == m_sections[m_current].bytes) {
+		m_sections[m_current].checksum = m_checksums[m_current].value();
+		m_current++;
+		m_written = 0;
+		if(m_current < m_sections.size()) pad(m_sections[m_current].offset);
+	} // m_current
+}
+/*-------------------------------------------------*/
+void FileWriter::write(const void *data, bulk_t nbytes)
+{
+	const char *ptr = static_cast<const char*>(data);
+
+	while(nbytes) {
+
+		if(m_current >= m_sections.size()) {
+			throw err::InvalidOp("Data exceed the declared size of binary file '" + m_filename + "'");
+		} // overflow
+
+		bulk_t len = static_cast<bulk_t>(std::min(static_cast<uint64_t>(nbytes), m_sections[m_current].bytes - m_written));
+
+		put(ptr, len);
+		m_checksums[m_current].update(ptr, len);
+
+		m_written += len;
+		ptr += len;
+		nbytes -= len;
+
+		advance();
+
+	} // nbytes
+}
+/*-------------------------------------------------*/
+void FileWriter::finalize()
+{
+	advance();
+
+	if(m_current < m_sections.size()) {
+		throw err::InvalidOp("Binary file '" + m_filename + "' is incomplete");
+	} // incomplete
+
+	m_header.complete = 1;
+
+	bool ok = (file_seek(m_fp, 0, SEEK_SET) == 0);
+	if(ok) put(&m_header, sizeof(FileHeader));
+	ok = ok && (file_seek(m_fp, bin_table_offset, SEEK_SET) == 0);
+	if(ok && !m_sections.empty()) put(m_sections.data(), m_sections.size() * sizeof(SectionEntry));
+	ok = ok && (std::fclose(m_fp) == 0);
+
+	m_fp = nullptr;
+
+	if(!ok) {
+		throw err::InvalidOp("Failed to finalize binary file '" + m_filename + "'");
+	} // ok
+}
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BINARY_FORMAT_HPP_
+#define CLA3P_BINARY_FORMAT_HPP_
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace io {
+/*-------------------------------------------------*/
+
+/*
+ * Binary container layout (version 1)
+ *
+ *   [0, 128)   FileHeader
+ *   [128, 256) SectionEntry table (up to 4 entries)
+ *   [256, ...) Sections, each starting at a 64-byte aligned offset
+ *
+ * Dense values are stored column-wise with leading dimension ld,
+ * csc matrices store colptr, rowidx & values sections,
+ * integer arrays are stored with the width (4 or 8 bytes) recorded in the header
+ */
+const uint32_t bin_version = 1;
+const uint32_t bin_endian = 0x01020304;
+const uint64_t bin_align = 64;
+const uint64_t bin_table_offset = 128;
+const uint64_t bin_data_offset = 256;
+const uint32_t bin_max_sections = 4;
+
+enum bin_object : uint32_t {
+	DnsVector = 1,
+	DnsMatrix = 2,
+	CscMatrix = 3,
+	PrmMatrix = 4
+};
+
+enum bin_scalar : uint32_t {
+	Real      = 1,
+	Real4     = 2,
+	Complex   = 3,
+	Complex8  = 4,
+	Integer   = 5
+};
+
+struct FileHeader {
+	char     magic[8];
+	uint32_t version;
+	uint32_t endian;
+	uint32_t object;
+	uint32_t scalar;
+	uint32_t intwidth;
+	uint32_t ptype;
+	uint32_t uplo;
+	uint32_t nsections;
+	uint64_t nrows;
+	uint64_t ncols;
+	uint64_t ld;
+	uint64_t nnz;
+	uint64_t complete;
+	char     reserved[48];
+};
+
+struct SectionEntry {
+	uint64_t offset;
+	uint64_t bytes;
+	uint64_t checksum;
+	uint64_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 128, "Invalid binary header size");
+static_assert(sizeof(SectionEntry) == 32, "Invalid binary section entry size");
+
+inline uint32_t scalar_code(const real_t    *) { return bin_scalar::Real    ; }
+inline uint32_t scalar_code(const real4_t   *) { return bin_scalar::Real4   ; }
+inline uint32_t scalar_code(const complex_t *) { return bin_scalar::Complex ; }
+inline uint32_t scalar_code(const complex8_t*) { return bin_scalar::Complex8; }
+inline uint32_t scalar_code(const int_t     *) { return bin_scalar::Integer ; }
+
+FileHeader create_header(uint32_t object, uint32_t scalar, uint32_t intwidth, const Property& pr, 
+		uint64_t nrows, uint64_t ncols, uint64_t ld, uint64_t nnz);
+
+/*
+ * Reads & validates the header and the section table (from a file or a mapped region)
+ */
+void parse_header(const void *data, uint64_t nbytes, const std::string& filename, FileHeader& header, std::vector<SectionEntry>& sections);
+void read_header(std::FILE *fp, const std::string& filename, FileHeader& header, std::vector<SectionEntry>& sections);
+void check_header(const std::string& filename, const FileHeader& header, const std::vector<SectionEntry>& sections, 
+		uint64_t fsize, uint32_t object, uint32_t scalar);
+
+/*
+ * count * width, a product that overflows means the file is corrupted
+ */
+uint64_t section_bytes(const std::string& filename, uint64_t count, uint64_t width);
+
+/*
+ * Incremental 64-bit checksum, processes 8-byte words independently of the update boundaries
+ */
+class Checksum {
+
+	public:
+		Checksum();
+
+		void update(const void *data, bulk_t nbytes);
+		uint64_t value() const;
+
+	private:
+		uint64_t m_hash;
+		uint64_t m_tail;
+		uint64_t m_nbytes;
+		uint32_t m_ntail;
+
+		void mix(uint64_t word);
+};
+
+uint64_t checksum(const void *data, bulk_t nbytes);
+
+/*
+ * Streaming writer, sections are written sequentially in chunks of arbitrary size
+ * The header is marked complete after all sections are fully written
+ */
+class FileWriter {
+
+	public:
+		FileWriter(const FileWriter&) = delete;
+		FileWriter& operator=(const FileWriter&) = delete;
+
+		FileWriter(const std::string& filename, const FileHeader& header, const std::vector<uint64_t>& sectionBytes);
+		~FileWriter();
+
+		void write(const void *data, bulk_t nbytes);
+		void finalize();
+
+	private:
+		std::string m_filename;
+		std::FILE *m_fp;
+		FileHeader m_header;
+		std::vector<SectionEntry> m_sections;
+		std::vector<Checksum> m_checksums;
+		uint32_t m_current;
+		uint64_t m_written;
+
+		void put(const void *data, bulk_t nbytes);
+		void pad(uint64_t offset);
+		void advance();
+};
+
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BINARY_FORMAT_HPP_
@@ -0,0 +1,647 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/io/binary_io.hpp"
+
+// system
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/perms.hpp"
+#include "cla3p/io/binary_format.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/file_io.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace io {
+/*-------------------------------------------------*/
+static const bulk_t bin_chunk = 1 << 20;
+/*-------------------------------------------------*/
+static void check_sections(const std::string& filename, const std::vector<SectionEntry>& sections, const std::vector<uint64_t>& bytes)
+{
+	bool ok = (sections.size() == bytes.size());
+
+	for(bulk_t k = 0; ok && k < bytes.size(); k++) {
+		ok = (sections[k].bytes == bytes[k]);
+	} // k
+
+	if(!ok) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (section size mismatch)");
+	} // ok
+}
+/*-------------------------------------------------*/
+static Property header_property(const FileHeader& header)
+{
+	return Property(static_cast<prop_t>(header.ptype), static_cast<uplo_t>(header.uplo));
+}
+/*-------------------------------------------------*/
+template <typename T_Src, typename T_Dst>
+static void convert_indices(const std::string& filename, bulk_t n, const T_Src *src, T_Dst *dst)
+{
+	for(bulk_t i = 0; i < n; i++) {
+		if(src[i] < 0 || static_cast<uint64_t>(src[i]) > static_cast<uint64_t>(std::numeric_limits<T_Dst>::max())) {
+			throw err::NoConsistency("File '" + filename + "' contains indices that exceed the integer range");
+		} // range
+		dst[i] = static_cast<T_Dst>(src[i]);
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static void check_csc_indices(const std::string& filename, const FileHeader& header, const T_Int *cptr, const T_Int *ridx)
+{
+	if(cptr[0] != 0 || static_cast<uint64_t>(cptr[header.ncols]) != header.nnz) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (invalid column pointers)");
+	} // colptr
+
+	Property pr = header_property(header);
+
+	try {
+		bulk::csc::check(pr.type(), pr.uplo(), header.nrows, header.ncols, cptr, ridx);
+	} catch(const err::Exception& e) {
+		throw err::InvalidOp("File '" + filename + "' is corrupted (" + std::string(e.what()) + ")");
+	} // check
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+//
+// Sequential section reader, verifies section checksums on the fly
+//
+class FileReader {
+
+	public:
+		FileReader(const FileReader&) = delete;
+		FileReader& operator=(const FileReader&) = delete;
+
+		FileReader(const std::string& filename, bool verify)
+			: m_filename(filename), m_fp(nullptr), m_verify(verify)
+		{
+			m_fp = std::fopen(filename.c_str(), "rb");
+
+			if(!m_fp) {
+				throw err::InvalidOp("Could not open file '" + filename + "' for reading");
+			} // fp
+
+			read_header(m_fp, filename, m_header, m_sections);
+
+			file_seek(m_fp, 0, SEEK_END);
+			m_fsize = file_tell(m_fp);
+		}
+
+		~FileReader()
+		{
+			std::fclose(m_fp);
+		}
+
+		const std::string& filename() const { return m_filename; }
+		const FileHeader& header() const { return m_header; }
+
+		void check(uint32_t object, uint32_t scalar, const std::vector<uint64_t>& bytes) const
+		{
+			check_header(m_filename, m_header, m_sections, m_fsize, object, scalar);
+			check_sections(m_filename, m_sections, bytes);
+		}
+
+		void read(uint32_t k, void *data)
+		{
+			char *ptr = static_cast<char*>(data);
+			stream(k, [ptr](const char*, uint64_t offset, bulk_t) { return ptr + offset; });
+		}
+
+		template <typename T_Int>
+		void readIndices(uint32_t k, T_Int *data)
+		{
+			if(m_header.intwidth == sizeof(T_Int)) {
+				read(k, data);
+			} else if(m_header.intwidth == sizeof(int32_t)) {
+				convert<int32_t>(k, data);
+			} else if(m_header.intwidth == sizeof(int64_t)) {
+				convert<int64_t>(k, data);
+			} else {
+				throw err::InvalidOp("File '" + m_filename + "' has invalid integer width");
+			} // intwidth
+		}
+
+	private:
+		std::string m_filename;
+		std::FILE *m_fp;
+		bool m_verify;
+		uint64_t m_fsize;
+		FileHeader m_header;
+		std::vector<SectionEntry> m_sections;
+
+		//
+		// target(buffer, offset, len) returns the address the next chunk is read to,
+		// a null return reads to buffer (consumed by the next call or after the loop)
+		//
+		template <typename T_Target>
+		void stream(uint32_t k, T_Target target, std::vector<char> *buffer = nullptr)
+		{
+			const SectionEntry& sec = m_sections[k];
+
+			if(file_seek(m_fp, sec.offset, SEEK_SET)) {
+				throw err::InvalidOp("File '" + m_filename + "' is corrupted (section out of range)");
+			} // seek
+
+			Checksum chk;
+
+			for(uint64_t offset = 0; offset < sec.bytes; offset += bin_chunk) {
+
+				bulk_t len = static_cast<bulk_t>(std::min(static_cast<uint64_t>(bin_chunk), sec.bytes - offset));
+				char *ptr = target(buffer ? buffer->data() : nullptr, offset, len);
+
+				if(std::fread(ptr, 1, len, m_fp) != len) {
+					throw err::InvalidOp("File '" + m_filename + "' is corrupted (unexpected end of file)");
+				} // fread
+
+				if(m_verify) chk.update(ptr, len);
+
+			} // offset
+
+			if(m_verify && chk.value() != sec.checksum) {
+				throw err::InvalidOp("File '" + m_filename + "' is corrupted (checksum mismatch)");
+			} // verify
+		}
+
+		template <typename T_Src, typename T_Dst>
+		void convert(uint32_t k, T_Dst *data)
+		{
+			std::vector<char> buffer(bin_chunk);
+
+			const std::string& fname = m_filename;
+			bulk_t pending = 0;
+			T_Dst *dst = data;
+
+			auto flush = [&]() {
+				convert_indices(fname, pending / sizeof(T_Src), reinterpret_cast<const T_Src*>(buffer.data()), dst);
+				dst += pending / sizeof(T_Src);
+				pending = 0;
+			};
+
+			stream(k, [&](char *buf, uint64_t, bulk_t len) { flush(); pending = len; return buf; }, &buffer);
+			flush();
+		}
+};
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Vector>
+static void save_object(const std::string& filename, const dns::XxVector<T_Scalar,T_Vector>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	uint64_t n = obj.size();
+
+	FileHeader header = create_header(bin_object::DnsVector, scalar_code(dummy), sizeof(int_t), defaultProperty(), n, 1, n, 0);
+	FileWriter writer(filename, header, {n * sizeof(T_Scalar)});
+	writer.write(obj.values(), n * sizeof(T_Scalar));
+	writer.finalize();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Matrix>
+static void save_object(const std::string& filename, const dns::XxMatrix<T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	uint64_t m = obj.nrows();
+	uint64_t n = obj.ncols();
+
+	FileHeader header = create_header(bin_object::DnsMatrix, scalar_code(dummy), sizeof(int_t), obj.prop(), m, n, m, 0);
+	FileWriter writer(filename, header, {m * n * sizeof(T_Scalar)});
+
+	for(uint_t j = 0; j < obj.ncols(); j++) {
+		writer.write(obj.values() + j * obj.ld(), m * sizeof(T_Scalar));
+	} // j
+
+	writer.finalize();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void save_object(const std::string& filename, const csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	uint64_t m = obj.nrows();
+	uint64_t n = obj.ncols();
+	uint64_t nz = obj.nnz();
+	uint64_t np = (obj.empty() ? 0 : n + 1);
+
+	FileHeader header = create_header(bin_object::CscMatrix, scalar_code(dummy), sizeof(T_Int), obj.prop(), m, n, m, nz);
+	FileWriter writer(filename, header, {np * sizeof(T_Int), nz * sizeof(T_Int), nz * sizeof(T_Scalar)});
+	writer.write(obj.colptr(), np * sizeof(T_Int));
+	writer.write(obj.rowidx(), nz * sizeof(T_Int));
+	writer.write(obj.values(), nz * sizeof(T_Scalar));
+	writer.finalize();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static void save_object(const std::string& filename, const prm::PxMatrix<T_Int>& obj)
+{
+	uint64_t n = obj.size();
+
+	FileHeader header = create_header(bin_object::PrmMatrix, bin_scalar::Integer, sizeof(T_Int), defaultProperty(), n, 1, n, 0);
+	FileWriter writer(filename, header, {n * sizeof(T_Int)});
+	writer.write(obj.values(), n * sizeof(T_Int));
+	writer.finalize();
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Vector>
+static void load_object(FileReader& rd, dns::XxVector<T_Scalar,T_Vector>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	const FileHeader& header = rd.header();
+
+	rd.check(bin_object::DnsVector, scalar_code(dummy), {section_bytes(rd.filename(), header.nrows, sizeof(T_Scalar))});
+
+	T_Vector ret(header.nrows);
+	rd.read(0, ret.values());
+
+	static_cast<T_Vector&>(obj) = ret.move();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Matrix>
+static void load_object(FileReader& rd, dns::XxMatrix<T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	const FileHeader& header = rd.header();
+
+	rd.check(bin_object::DnsMatrix, scalar_code(dummy), {section_bytes(rd.filename(), section_bytes(rd.filename(), header.ld, header.ncols), sizeof(T_Scalar))});
+
+	T_Matrix ret;
+
+	if(header.nrows && header.ncols) {
+		T_Scalar *vals = i_malloc<T_Scalar>(header.ld * header.ncols);
+		ret = T_Matrix::wrap(header.nrows, header.ncols, vals, header.ld, true, header_property(header));
+		rd.read(0, vals);
+	} // not empty
+
+	static_cast<T_Matrix&>(obj) = ret.move();
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void load_object(FileReader& rd, csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	const FileHeader& header = rd.header();
+
+	uint64_t np = section_bytes(rd.filename(), header.ncols + 1, header.intwidth);
+	uint64_t ni = section_bytes(rd.filename(), header.nnz, header.intwidth);
+	uint64_t nv = section_bytes(rd.filename(), header.nnz, sizeof(T_Scalar));
+
+	if(!header.nrows || !header.ncols) {
+		rd.check(bin_object::CscMatrix, scalar_code(dummy), {0, 0, 0});
+		static_cast<T_Matrix&>(obj).clear();
+		return;
+	} // empty
+
+	rd.check(bin_object::CscMatrix, scalar_code(dummy), {np, ni, nv});
+
+	T_Matrix ret(header.nrows, header.ncols, header.nnz, header_property(header));
+	rd.readIndices(0, ret.colptr());
+	rd.readIndices(1, ret.rowidx());
+	rd.read(2, ret.values());
+
+	check_csc_indices(rd.filename(), header, ret.colptr(), ret.rowidx());
+
+	static_cast<T_Matrix&>(obj) = ret.move();
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static void load_object(FileReader& rd, prm::PxMatrix<T_Int>& obj)
+{
+	const FileHeader& header = rd.header();
+
+	rd.check(bin_object::PrmMatrix, bin_scalar::Integer, {section_bytes(rd.filename(), header.nrows, header.intwidth)});
+
+	prm::PxMatrix<T_Int> ret(header.nrows);
+	rd.readIndices(0, ret.values());
+
+	obj = ret.move();
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+//
+// Mapped objects share the (private) mapped pages, no data are copied
+//
+static void check_intwidth(const std::string& filename, const FileHeader& header, bulk_t width)
+{
+	if(header.intwidth != width) {
+		throw err::NoConsistency("File '" + filename + "' has different integer width, use load() to convert");
+	} // intwidth
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Vector>
+static void map_object(const std::string& filename, char *base, bulk_t size, dns::XxVector<T_Scalar,T_Vector>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	FileHeader header;
+	std::vector<SectionEntry> sections;
+
+	parse_header(base, size, filename, header, sections);
+	check_header(filename, header, sections, size, bin_object::DnsVector, scalar_code(dummy));
+	check_sections(filename, sections, {section_bytes(filename, header.nrows, sizeof(T_Scalar))});
+
+	T_Scalar *vals = reinterpret_cast<T_Scalar*>(base + sections[0].offset);
+	static_cast<T_Vector&>(obj) = T_Vector::wrap(header.nrows, vals, false);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Matrix>
+static void map_object(const std::string& filename, char *base, bulk_t size, dns::XxMatrix<T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	FileHeader header;
+	std::vector<SectionEntry> sections;
+
+	parse_header(base, size, filename, header, sections);
+	check_header(filename, header, sections, size, bin_object::DnsMatrix, scalar_code(dummy));
+	check_sections(filename, sections, {section_bytes(filename, section_bytes(filename, header.ld, header.ncols), sizeof(T_Scalar))});
+
+	if(!header.nrows || !header.ncols) {
+		static_cast<T_Matrix&>(obj).clear();
+		return;
+	} // empty
+
+	T_Scalar *vals = reinterpret_cast<T_Scalar*>(base + sections[0].offset);
+	static_cast<T_Matrix&>(obj) = T_Matrix::wrap(header.nrows, header.ncols, vals, header.ld, false, header_property(header));
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void map_object(const std::string& filename, char *base, bulk_t size, csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& obj)
+{
+	const T_Scalar *dummy = nullptr;
+	FileHeader header;
+	std::vector<SectionEntry> sections;
+
+	parse_header(base, size, filename, header, sections);
+	check_header(filename, header, sections, size, bin_object::CscMatrix, scalar_code(dummy));
+	check_intwidth(filename, header, sizeof(T_Int));
+
+	if(!header.nrows || !header.ncols) {
+		check_sections(filename, sections, {0, 0, 0});
+		static_cast<T_Matrix&>(obj).clear();
+		return;
+	} // empty
+
+	check_sections(filename, sections, {
+			section_bytes(filename, header.ncols + 1, sizeof(T_Int)), 
+			section_bytes(filename, header.nnz, sizeof(T_Int)), 
+			section_bytes(filename, header.nnz, sizeof(T_Scalar))});
+
+	T_Int    *cptr = reinterpret_cast<T_Int   *>(base + sections[0].offset);
+	T_Int    *ridx = reinterpret_cast<T_Int   *>(base + sections[1].offset);
+	T_Scalar *vals = reinterpret_cast<T_Scalar*>(base + sections[2].offset);
+
+	check_csc_indices(filename, header, cptr, ridx);
+
+	static_cast<T_Matrix&>(obj) = T_Matrix::wrap(header.nrows, header.ncols, cptr, ridx, vals, false, header_property(header));
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+static void map_object(const std::string& filename, char *base, bulk_t size, prm::PxMatrix<T_Int>& obj)
+{
+	FileHeader header;
+	std::vector<SectionEntry> sections;
+
+	parse_header(base, size, filename, header, sections);
+	check_header(filename, header, sections, size, bin_object::PrmMatrix, bin_scalar::Integer);
+	check_intwidth(filename, header, sizeof(T_Int));
+	check_sections(filename, sections, {section_bytes(filename, header.nrows, sizeof(T_Int))});
+
+	T_Int *vals = reinterpret_cast<T_Int*>(base + sections[0].offset);
+	obj = prm::PxMatrix<T_Int>::wrap(header.nrows, vals, false);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Object>
+void save(const std::string& filename, const T_Object& obj)
+{
+	save_object(filename, obj);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+T_Object load(const std::string& filename, bool verify)
+{
+	T_Object ret;
+	FileReader rd(filename, verify);
+	load_object(rd, ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+MappedFile::MappedFile()
+	: m_addr(nullptr), m_size(0)
+{
+}
+/*-------------------------------------------------*/
+MappedFile::MappedFile(const std::string& filename, bool verify)
+	: m_addr(nullptr), m_size(0)
+{
+	open(filename, verify);
+}
+/*-------------------------------------------------*/
+MappedFile::~MappedFile()
+{
+	close();
+}
+/*-------------------------------------------------*/
+void MappedFile::open(const std::string& filename, bool verify)
+{
+	close();
+
+	bulk_t size = 0;
+	void *addr = file_map(filename, size);
+
+	if(!addr) {
+		throw err::InvalidOp("Could not map file '" + filename + "'");
+	} // addr
+
+	m_filename = filename;
+	m_addr = addr;
+	m_size = size;
+
+	try {
+		FileHeader header;
+		std::vector<SectionEntry> sections;
+		parse_header(m_addr, m_size, m_filename, header, sections);
+	} catch(...) {
+		close();
+		throw;
+	} // header
+
+	if(verify && !this->verify()) {
+		close();
+		throw err::InvalidOp("File '" + filename + "' is corrupted (checksum mismatch)");
+	} // verify
+}
+/*-------------------------------------------------*/
+void MappedFile::close()
+{
+	file_unmap(m_addr, m_size);
+
+	m_filename.clear();
+	m_addr = nullptr;
+	m_size = 0;
+}
+/*-------------------------------------------------*/
+bool MappedFile::isOpen() const
+{
+	return (m_addr != nullptr);
+}
+/*-------------------------------------------------*/
+bulk_t MappedFile::size() const
+{
+	return m_size;
+}
+/*-------------------------------------------------*/
+bool MappedFile::verify() const
+{
+	if(!isOpen()) {
+		throw err::InvalidOp("No file is mapped");
+	} // open
+
+	const char *base = static_cast<const char*>(m_addr);
+
+	FileHeader header;
+	std::vector<SectionEntry> sections;
+	parse_header(base, m_size, m_filename, header, sections);
+
+	for(const SectionEntry& sec : sections) {
+		if(sec.bytes > m_size || sec.offset > m_size - sec.bytes || checksum(base + sec.offset, sec.bytes) != sec.checksum) return false;
+	} // sec
+
+	return true;
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+T_Object MappedFile::get()
+{
+	if(!isOpen()) {
+		throw err::InvalidOp("No file is mapped");
+	} // open
+
+	T_Object ret;
+	map_object(m_filename, static_cast<char*>(m_addr), m_size, ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixWriter<T_Matrix>::MatrixWriter(const std::string& filename, uint_t nr, uint_t nc, const Property& pr)
+	: m_writer(nullptr), m_nrows(nr), m_ncols(nc), m_written(0)
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	const T_Scalar *dummy = nullptr;
+	uint64_t m = nr;
+	uint64_t n = nc;
+
+	FileHeader header = create_header(bin_object::DnsMatrix, scalar_code(dummy), sizeof(int_t), pr, m, n, m, 0);
+	m_writer = new FileWriter(filename, header, {m * n * sizeof(T_Scalar)});
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixWriter<T_Matrix>::~MatrixWriter()
+{
+	delete m_writer;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixWriter<T_Matrix>::write(const T_Matrix& block)
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	if(!m_writer) {
+		throw err::InvalidOp("Writer is closed");
+	} // m_writer
+
+	if(block.nrows() != m_nrows || m_written + block.ncols() > m_ncols) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	for(uint_t j = 0; j < block.ncols(); j++) {
+		m_writer->write(block.values() + j * block.ld(), block.nrows() * sizeof(T_Scalar));
+	} // j
+
+	m_written += block.ncols();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixWriter<T_Matrix>::columnsWritten() const
+{
+	return m_written;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixWriter<T_Matrix>::close()
+{
+	if(!m_writer) {
+		throw err::InvalidOp("Writer is closed");
+	} // m_writer
+
+	if(m_written != m_ncols) {
+		throw err::InvalidOp("Not all columns are written (" + std::to_string(m_written) + "/" + std::to_string(m_ncols) + ")");
+	} // m_written
+
+	m_writer->finalize();
+
+	delete m_writer;
+	m_writer = nullptr;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+#define instantiate_io(T_Object) \
+template void save(const std::string&, const T_Object&); \
+template T_Object load(const std::string&, bool); \
+template T_Object MappedFile::get()
+instantiate_io(dns::RdVector);
+instantiate_io(dns::RfVector);
+instantiate_io(dns::CdVector);
+instantiate_io(dns::CfVector);
+instantiate_io(dns::RdMatrix);
+instantiate_io(dns::RfMatrix);
+instantiate_io(dns::CdMatrix);
+instantiate_io(dns::CfMatrix);
+instantiate_io(csc::RdMatrix);
+instantiate_io(csc::RfMatrix);
+instantiate_io(csc::CdMatrix);
+instantiate_io(csc::CfMatrix);
+instantiate_io(prm::PiMatrix);
+#undef instantiate_io
+/*-------------------------------------------------*/
+template class MatrixWriter<dns::RdMatrix>;
+template class MatrixWriter<dns::RfMatrix>;
+template class MatrixWriter<dns::CdMatrix>;
+template class MatrixWriter<dns::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BINARY_IO_HPP_
+#define CLA3P_BINARY_IO_HPP_
+
+/**
+ * @file
+ * Binary serialization of cla3p objects
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace io { 
+/*-------------------------------------------------*/
+
+class FileWriter;
+
+/**
+ * @ingroup module_index_io
+ * @brief Saves an object to a binary file.
+ *
+ * Supported objects are dense vectors & matrices, sparse (csc) matrices & permutation matrices.@n
+ * The file records the object type, property, dimensions, leading dimension & integer width. 
+ * Data are stored in 64-byte aligned sections, each protected by a checksum.
+ *
+ * @param[in] filename The name of the file.
+ * @param[in] obj The object to be saved.
+ */
+template <typename T_Object>
+void save(const std::string& filename, const T_Object& obj);
+
+/**
+ * @ingroup module_index_io
+ * @brief Loads an object from a binary file.
+ *
+ * Creates a new object that owns its data. 
+ * Integer arrays are converted if the file was written with a different integer width.
+ *
+ * @param[in] filename The name of the file.
+ * @param[in] verify Verifies the section checksums.
+ * @return The loaded object.
+ */
+template <typename T_Object>
+T_Object load(const std::string& filename, bool verify = true);
+
+/**
+ * @ingroup module_index_io
+ * @nosubgrouping
+ * @brief A memory-mapped binary file.
+ *
+ * Maps a binary file created by save() or MatrixWriter in memory. 
+ * Objects obtained via get() are non-owning wrappers of the mapped sections, no data are copied or read upfront.
+ * The mapping is private, modifications of mapped objects are not written back to the file.
+ * Mapped objects must not be used after the file is closed.
+ */
+class MappedFile {
+
+	public:
+
+		// no copy
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 */
+		MappedFile();
+
+		/**
+		 * @brief Maps a file in memory.
+		 * @param[in] filename The name of the file.
+		 * @param[in] verify Verifies the section checksums (reads the whole file).
+		 */
+		explicit MappedFile(const std::string& filename, bool verify = false);
+
+		/**
+		 * @brief Unmaps the file.
+		 */
+		~MappedFile();
+
+		/**
+		 * @brief Maps a file in memory, a previously mapped file is unmapped.
+		 * @param[in] filename The name of the file.
+		 * @param[in] verify Verifies the section checksums (reads the whole file).
+		 */
+		void open(const std::string& filename, bool verify = false);
+
+		/**
+		 * @brief Unmaps the file.
+		 */
+		void close();
+
+		/**
+		 * @brief The mapping state.
+		 * @return Whether a file is mapped.
+		 */
+		bool isOpen() const;
+
+		/**
+		 * @brief The mapped size.
+		 * @return The size of the mapped file in bytes.
+		 */
+		bulk_t size() const;
+
+		/**
+		 * @brief Verifies the section checksums.
+		 * @return Whether all section checksums match.
+		 */
+		bool verify() const;
+
+		/**
+		 * @brief The mapped object.
+		 *
+		 * The integer width of the file must match the integer width of the object.
+		 *
+		 * @return A non-owning object wrapping the mapped data.
+		 */
+		template <typename T_Object>
+		T_Object get();
+
+	private:
+		std::string m_filename;
+		void *m_addr;
+		bulk_t m_size;
+};
+
+/**
+ * @ingroup module_index_io
+ * @nosubgrouping
+ * @brief A streaming dense matrix writer.
+ *
+ * Writes a dense matrix to a binary file in column blocks, without the whole matrix residing in memory.
+ * The file is valid (loadable) only after all columns are written & the writer is closed.
+ */
+template <typename T_Matrix>
+class MatrixWriter {
+
+	public:
+
+		// no copy
+		MatrixWriter(const MatrixWriter&) = delete;
+		MatrixWriter& operator=(const MatrixWriter&) = delete;
+
+		/**
+		 * @brief Creates the file & writes the header.
+		 * @param[in] filename The name of the file.
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] pr The matrix property.
+		 */
+		MatrixWriter(const std::string& filename, uint_t nr, uint_t nc, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief Closes the file, an incomplete file is not loadable.
+		 */
+		~MatrixWriter();
+
+		/**
+		 * @brief Appends columns.
+		 * @param[in] block A matrix with nr rows, its columns are appended to the file.
+		 */
+		void write(const T_Matrix& block);
+
+		/**
+		 * @brief The number of columns written.
+		 * @return The number of columns appended so far.
+		 */
+		uint_t columnsWritten() const;
+
+		/**
+		 * @brief Finalizes the file.
+		 *
+		 * Writes the section checksums & marks the file complete. All columns must be written.
+		 */
+		void close();
+
+	private:
+		FileWriter *m_writer;
+		uint_t m_nrows;
+		uint_t m_ncols;
+		uint_t m_written;
+};
+
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_BINARY_IO_HPP_
@@ -0,0 +1,578 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/io/matrix_market.hpp"
+
+// system
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/sparse.hpp"
+#include "cla3p/generic/tuple.hpp"
+#include "cla3p/support/file_io.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/support/utils.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace io {
+/*-------------------------------------------------*/
+enum class mm_field {
+	Real = 0,
+	Integer,
+	Complex,
+	Pattern
+};
+/*-------------------------------------------------*/
+struct MMHeader {
+	mm_field field;
+	prop_t ptype;
+	uint64_t nrows;
+	uint64_t ncols;
+	uint64_t nnz;
+	uint64_t offset;
+	uint64_t fsize;
+};
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+static std::string lowercase(const char *str)
+{
+	std::string ret(str);
+	std::transform(ret.begin(), ret.end(), ret.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return ret;
+}
+/*-------------------------------------------------*/
+static bool read_line(std::FILE *fp, std::string& line)
+{
+	line.clear();
+
+	int c;
+	while((c = std::fgetc(fp)) != EOF && c != '\n') {
+		line.push_back(static_cast<char>(c));
+	} // c
+
+	return (c != EOF || !line.empty());
+}
+/*-------------------------------------------------*/
+static MMHeader read_mm_header(const std::string& filename)
+{
+	std::FILE *fp = std::fopen(filename.c_str(), "rb");
+
+	if(!fp) {
+		throw err::InvalidOp("Could not open file '" + filename + "' for reading");
+	} // fp
+
+	MMHeader ret;
+	std::string line;
+	std::string error;
+
+	char banner[64], object[64], format[64], field[64], symmetry[64];
+
+	bool ok = read_line(fp, line);
+
+	if(!ok || std::sscanf(line.c_str(), "%63s %63s %63s %63s %63s", banner, object, format, field, symmetry) != 5 || 
+			lowercase(banner) != "%%matrixmarket") {
+		error = "File '" + filename + "' is not a Matrix Market file";
+	} else if(lowercase(object) != "matrix" || lowercase(format) != "coordinate") {
+		error = "File '" + filename + "' is not in coordinate format";
+	} // banner
+
+	if(error.empty()) {
+
+		std::string fstr = lowercase(field);
+		std::string sstr = lowercase(symmetry);
+
+		if     (fstr == "real"   ) ret.field = mm_field::Real;
+		else if(fstr == "double" ) ret.field = mm_field::Real;
+		else if(fstr == "integer") ret.field = mm_field::Integer;
+		else if(fstr == "complex") ret.field = mm_field::Complex;
+		else if(fstr == "pattern") ret.field = mm_field::Pattern;
+		else error = "File '" + filename + "' has unsupported field '" + fstr + "'";
+
+		if     (sstr == "general"       ) ret.ptype = prop_t::General;
+		else if(sstr == "symmetric"     ) ret.ptype = prop_t::Symmetric;
+		else if(sstr == "hermitian"     ) ret.ptype = prop_t::Hermitian;
+		else if(sstr == "skew-symmetric") ret.ptype = prop_t::Skew;
+		else error = "File '" + filename + "' has unsupported symmetry '" + sstr + "'";
+
+	} // field & symmetry
+
+	if(error.empty()) {
+
+		do {
+			ok = read_line(fp, line);
+		} while(ok && (line.find_first_not_of(" \t\r") == std::string::npos || line[0] == '%'));
+
+		unsigned long long m = 0;
+		unsigned long long n = 0;
+		unsigned long long nz = 0;
+
+		if(!ok || std::sscanf(line.c_str(), "%llu %llu %llu", &m, &n, &nz) != 3) {
+			error = "File '" + filename + "' has invalid size line";
+		} // size line
+
+		ret.nrows = m;
+		ret.ncols = n;
+		ret.nnz = nz;
+		ret.offset = file_tell(fp);
+
+		file_seek(fp, 0, SEEK_END);
+		ret.fsize = file_tell(fp);
+
+	} // size
+
+	std::fclose(fp);
+
+	if(!error.empty()) {
+		throw err::InvalidOp(error);
+	} // error
+
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+inline void set_value(real_t    & v, real_t re, real_t   ) { v = re; }
+inline void set_value(real4_t   & v, real_t re, real_t   ) { v = static_cast<real4_t>(re); }
+inline void set_value(complex_t & v, real_t re, real_t im) { v = complex_t(re, im); }
+inline void set_value(complex8_t& v, real_t re, real_t im) { v = complex8_t(static_cast<real4_t>(re), static_cast<real4_t>(im)); }
+/*-------------------------------------------------*/
+inline const char* skip_blanks(const char *p)
+{
+	while(*p == ' ' || *p == '\t' || *p == '\r') p++;
+	return p;
+}
+/*-------------------------------------------------*/
+inline const char* skip_line(const char *p)
+{
+	while(*p && *p != '\n') p++;
+	return (*p ? p + 1 : p);
+}
+/*-------------------------------------------------*/
+inline bool parse_index(const char*& p, uint64_t& idx)
+{
+	p = skip_blanks(p);
+
+	if(*p < '0' || *p > '9') return false;
+
+	idx = 0;
+	while(*p >= '0' && *p <= '9') {
+		idx = idx * 10 + static_cast<uint64_t>(*p - '0');
+		p++;
+	} // p
+
+	return true;
+}
+/*-------------------------------------------------*/
+//
+// Exact fast path for decimals with up to 15 significant digits & small exponents,
+// every other input is handed to strtod
+//
+inline bool parse_real_fast(const char*& p, real_t& val)
+{
+	static const real_t pow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 
+		1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+	const char *q = p;
+	bool neg = (*q == '-');
+	if(*q == '-' || *q == '+') q++;
+
+	uint64_t mant = 0;
+	int_t ndigits = 0;
+	int_t exp10 = 0;
+
+	for(; *q >= '0' && *q <= '9'; q++, ndigits++) mant = mant * 10 + static_cast<uint64_t>(*q - '0');
+
+	if(*q == '.') {
+		for(q++; *q >= '0' && *q <= '9'; q++, ndigits++, exp10--) mant = mant * 10 + static_cast<uint64_t>(*q - '0');
+	} // fraction
+
+	if(!ndigits || ndigits > 15) return false;
+
+	if(*q == 'e' || *q == 'E') {
+		q++;
+		bool eneg = (*q == '-');
+		if(*q == '-' || *q == '+') q++;
+		if(*q < '0' || *q > '9') return false;
+		int_t e = 0;
+		for(; *q >= '0' && *q <= '9' && e < 1000; q++) e = e * 10 + (*q - '0');
+		exp10 += (eneg ? -e : e);
+	} // exponent
+
+	if(*q != ' ' && *q != '\t' && *q != '\r' && *q != '\n' && *q) return false;
+	if(exp10 < -22 || exp10 > 22) return false;
+
+	val = static_cast<real_t>(mant);
+	val = (exp10 < 0 ? val / pow10[-exp10] : val * pow10[exp10]);
+	if(neg) val = -val;
+
+	p = q;
+	return true;
+}
+/*-------------------------------------------------*/
+inline bool parse_real(const char*& p, real_t& val)
+{
+	p = skip_blanks(p);
+
+	if(!*p || *p == '\n') return false;
+
+	if(parse_real_fast(p, val)) return true;
+
+	char *end = nullptr;
+	val = std::strtod(p, &end);
+
+	if(end == p) return false;
+
+	p = end;
+	return true;
+}
+/*-------------------------------------------------*/
+static void read_bytes(std::FILE *fp, char *dst, uint64_t offset, bulk_t nbytes, const std::string& filename)
+{
+	if(file_seek(fp, offset, SEEK_SET) || std::fread(dst, 1, nbytes, fp) != nbytes) {
+		throw err::InvalidOp("Failed to read from file '" + filename + "'");
+	} // read
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar>
+struct MMChunk {
+	std::vector<Tuple<T_Int,T_Scalar>> tuples;
+	std::string error;
+};
+/*-------------------------------------------------*/
+//
+// A chunk owns the lines that start in [bgn, end), the bytes of its last line 
+// past end are read on demand, so every line is parsed by exactly one chunk
+//
+template <typename T_Int, typename T_Scalar>
+static void parse_chunk(std::FILE *fp, const std::string& filename, const MMHeader& header, 
+		uint64_t bgn, uint64_t end, MMChunk<T_Int,T_Scalar>& chunk)
+{
+	uint64_t lo = (bgn > header.offset ? bgn - 1 : bgn);
+
+	std::vector<char> buffer(end - lo);
+	read_bytes(fp, buffer.data(), lo, buffer.size(), filename);
+
+	uint64_t pos = end;
+	bulk_t scan = buffer.size() - 1;
+
+	while(!std::memchr(buffer.data() + scan, '\n', buffer.size() - scan) && pos < header.fsize) {
+		scan = buffer.size();
+		bulk_t len = static_cast<bulk_t>(std::min(header.fsize - pos, static_cast<uint64_t>(65536)));
+		buffer.resize(buffer.size() + len);
+		read_bytes(fp, buffer.data() + scan, pos, len, filename);
+		pos += len;
+	} // extend last line
+
+	buffer.push_back('\0');
+
+	const char *p = buffer.data();
+	const char *pend = buffer.data() + (end - lo);
+
+	if(lo < bgn) p = skip_line(p);
+
+	bool mirror = (header.ptype != prop_t::General);
+
+	for(; p < pend && *p; p = skip_line(p)) {
+
+		const char *q = skip_blanks(p);
+
+		if(!*q || *q == '\n' || *q == '%') continue;
+
+		uint64_t i = 0;
+		uint64_t j = 0;
+		real_t re = 1;
+		real_t im = 0;
+
+		bool ok = (parse_index(q, i) && parse_index(q, j));
+
+		if(ok && header.field != mm_field::Pattern) ok = parse_real(q, re);
+		if(ok && header.field == mm_field::Complex) ok = parse_real(q, im);
+
+		if(!ok || i < 1 || i > header.nrows || j < 1 || j > header.ncols) {
+			chunk.error = "File '" + filename + "' has invalid entry at byte offset " + std::to_string(lo + (p - buffer.data()));
+			return;
+		} // ok
+
+		T_Scalar v;
+		set_value(v, re, im);
+
+		if(mirror && i < j) {
+			std::swap(i, j);
+			if(header.ptype == prop_t::Hermitian) v = arith::conj(v);
+			if(header.ptype == prop_t::Skew) v = -v;
+		} // mirror
+
+		chunk.tuples.push_back(Tuple<T_Int,T_Scalar>(static_cast<T_Int>(i - 1), static_cast<T_Int>(j - 1), v));
+
+	} // p
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void read_object(const std::string& filename, coo::XxMatrix<T_Int,T_Scalar,T_Matrix>& obj)
+{
+	MMHeader header = read_mm_header(filename);
+
+	if(header.field == mm_field::Complex && TypeTraits<T_Scalar>::is_real()) {
+		throw err::NoConsistency("File '" + filename + "' contains complex values");
+	} // field
+
+	uplo_t uplo = (header.ptype == prop_t::General ? uplo_t::Full : uplo_t::Lower);
+	T_Matrix ret(header.nrows, header.ncols, header.nnz, Property(header.ptype, uplo));
+
+	uint64_t nbytes = header.fsize - header.offset;
+	uint64_t csize = std::max(nbytes / (4 * static_cast<uint64_t>(max_threads())), static_cast<uint64_t>(1) << 16);
+	csize = std::min(csize, static_cast<uint64_t>(1) << 24);
+
+	int_t nchunks = static_cast<int_t>((nbytes + csize - 1) / csize);
+	std::vector<MMChunk<T_Int,T_Scalar>> chunks(nchunks);
+
+	//
+	// Every thread reads through its own stream
+	//
+	#pragma omp parallel
+	{
+		std::FILE *fp = std::fopen(filename.c_str(), "rb");
+
+		#pragma omp for schedule(dynamic, 1)
+		for(int_t k = 0; k < nchunks; k++) {
+			uint64_t bgn = header.offset + static_cast<uint64_t>(k) * csize;
+			uint64_t end = std::min(bgn + csize, header.fsize);
+			if(!fp) {
+				chunks[k].error = "Could not open file '" + filename + "' for reading";
+				continue;
+			} // fp
+			try {
+				chunks[k].tuples.reserve(static_cast<bulk_t>((end - bgn) / 16));
+				parse_chunk(fp, filename, header, bgn, end, chunks[k]);
+			} catch(const std::exception& e) {
+				chunks[k].error = e.what();
+			} // error
+		} // k
+
+		if(fp) std::fclose(fp);
+	}
+
+	uint64_t total = 0;
+	for(const MMChunk<T_Int,T_Scalar>& chunk : chunks) {
+		if(!chunk.error.empty()) throw err::InvalidOp(chunk.error);
+		total += chunk.tuples.size();
+	} // chunk
+
+	if(total != header.nnz) {
+		throw err::InvalidOp("File '" + filename + "' contains " + std::to_string(total) + 
+				" entries, " + std::to_string(header.nnz) + " declared");
+	} // total
+
+	for(MMChunk<T_Int,T_Scalar>& chunk : chunks) {
+		ret.insert(chunk.tuples);
+		std::vector<Tuple<T_Int,T_Scalar>>().swap(chunk.tuples);
+	} // chunk
+
+	static_cast<T_Matrix&>(obj) = std::move(ret);
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void read_object(const std::string& filename, csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& obj)
+{
+	using T_CooMatrix = typename TypeTraits<T_Matrix>::coo_type;
+
+	T_CooMatrix tmp;
+	read_object(filename, tmp);
+
+	static_cast<T_Matrix&>(obj) = tmp.toCsc();
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+inline void append_value(std::string& str, real_t v)
+{
+	char buffer[64];
+	int len = std::snprintf(buffer, sizeof(buffer), " %.17g", v);
+	str.append(buffer, len);
+}
+/*-------------------------------------------------*/
+inline void append_value(std::string& str, real4_t v)
+{
+	char buffer[64];
+	int len = std::snprintf(buffer, sizeof(buffer), " %.9g", static_cast<real_t>(v));
+	str.append(buffer, len);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+inline void append_value(std::string& str, const std::complex<T_Scalar>& v)
+{
+	append_value(str, v.real());
+	append_value(str, v.imag());
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+inline void append_entry(std::string& str, uint64_t i, uint64_t j, const T_Scalar& v)
+{
+	char buffer[64];
+	int len = std::snprintf(buffer, sizeof(buffer), "%llu %llu", 
+			static_cast<unsigned long long>(i + 1), static_cast<unsigned long long>(j + 1));
+	str.append(buffer, len);
+	append_value(str, v);
+	str.push_back('\n');
+}
+/*-------------------------------------------------*/
+static std::string symmetry_name(const Property& pr)
+{
+	if(pr.isSymmetric()) return "symmetric";
+	if(pr.isHermitian()) return "hermitian";
+	if(pr.isSkew()) return "skew-symmetric";
+	return "general";
+}
+/*-------------------------------------------------*/
+static void write_text(std::FILE *fp, const std::string& str, const std::string& filename)
+{
+	if(!str.empty() && std::fwrite(str.data(), 1, str.size(), fp) != str.size()) {
+		std::fclose(fp);
+		throw err::InvalidOp("Failed to write to file '" + filename + "'");
+	} // fwrite
+}
+/*-------------------------------------------------*/
+//
+// Columns are formatted in batches, each batch is split in nnz-balanced parts 
+// formatted in parallel & written in order
+//
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void write_object(const std::string& filename, const csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat)
+{
+	std::FILE *fp = std::fopen(filename.c_str(), "wb");
+
+	if(!fp) {
+		throw err::InvalidOp("Could not open file '" + filename + "' for writing");
+	} // fp
+
+	const Property& pr = mat.prop();
+
+	std::string header = "%%MatrixMarket matrix coordinate ";
+	header += (TypeTraits<T_Scalar>::is_real() ? "real " : "complex ");
+	header += symmetry_name(pr) + "\n";
+	header += std::to_string(mat.nrows()) + " " + std::to_string(mat.ncols()) + " " + std::to_string(mat.nnz()) + "\n";
+	write_text(fp, header, filename);
+
+	bool flip = (pr.isUpper() && !pr.isGeneral() && !pr.isTriangular());
+
+	uint_t n = mat.ncols();
+	const T_Int    *colptr = mat.colptr();
+	const T_Int    *rowidx = mat.rowidx();
+	const T_Scalar *values = mat.values();
+
+	int_t np = max_threads();
+	bulk_t batch = static_cast<bulk_t>(np) << 18;
+
+	std::vector<std::string> parts(np);
+	std::vector<uint_t> jsplit(np + 1);
+
+	for(uint_t jbgn = 0; jbgn < n && mat.nnz(); ) {
+
+		bulk_t target = std::min(static_cast<bulk_t>(colptr[jbgn]) + batch, static_cast<bulk_t>(colptr[n]));
+		uint_t jend = std::lower_bound(colptr + jbgn + 1, colptr + n + 1, static_cast<T_Int>(target)) - colptr;
+		bulk_t nzb = colptr[jend] - colptr[jbgn];
+
+		for(int_t p = 0; p < np; p++) {
+			T_Int split = static_cast<T_Int>(colptr[jbgn] + (nzb * p) / np);
+			jsplit[p] = std::lower_bound(colptr + jbgn, colptr + jend + 1, split) - colptr;
+		} // p
+		jsplit[np] = jend;
+
+		#pragma omp parallel for schedule(static, 1)
+		for(int_t p = 0; p < np; p++) {
+			std::string& str = parts[p];
+			str.clear();
+			for(uint_t j = jsplit[p]; j < jsplit[p+1]; j++) {
+				for(T_Int irow = colptr[j]; irow < colptr[j+1]; irow++) {
+					uint64_t i = static_cast<uint64_t>(rowidx[irow]);
+					T_Scalar v = values[irow];
+					if(flip) {
+						if(pr.isHermitian()) v = arith::conj(v);
+						if(pr.isSkew()) v = -v;
+						append_entry(str, j, i, v);
+					} else {
+						append_entry(str, i, j, v);
+					} // flip
+				} // irow
+			} // j
+		} // p
+
+		for(int_t p = 0; p < np; p++) {
+			write_text(fp, parts[p], filename);
+		} // p
+
+		jbgn = jend;
+
+	} // jbgn
+
+	if(std::fclose(fp)) {
+		throw err::InvalidOp("Failed to write to file '" + filename + "'");
+	} // fclose
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void write_object(const std::string& filename, const coo::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat)
+{
+	write_object(filename, mat.toCsc());
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix readMatrixMarket(const std::string& filename)
+{
+	T_Matrix ret;
+	read_object(filename, ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void writeMatrixMarket(const std::string& filename, const T_Matrix& mat)
+{
+	write_object(filename, mat);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+#define instantiate_mm(T_Matrix) \
+template T_Matrix readMatrixMarket(const std::string&); \
+template void writeMatrixMarket(const std::string&, const T_Matrix&)
+instantiate_mm(coo::RdMatrix);
+instantiate_mm(coo::RfMatrix);
+instantiate_mm(coo::CdMatrix);
+instantiate_mm(coo::CfMatrix);
+instantiate_mm(csc::RdMatrix);
+instantiate_mm(csc::RfMatrix);
+instantiate_mm(csc::CdMatrix);
+instantiate_mm(csc::CfMatrix);
+#undef instantiate_mm
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
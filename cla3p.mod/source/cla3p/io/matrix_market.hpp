@@ -0,0 +1,67 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_MATRIX_MARKET_HPP_
+#define CLA3P_MATRIX_MARKET_HPP_
+
+/**
+ * @file
+ * Matrix Market input/output
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace io { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_io
+ * @brief Reads a sparse matrix from a Matrix Market file.
+ *
+ * Supports coordinate files with real, integer, complex or pattern fields.@n
+ * The symmetric, hermitian & skew-symmetric headers are mapped onto the matrix property (lower storage), 
+ * entries stored in the upper part are mirrored to the lower part.@n
+ * The file is split in chunks that are read & parsed in parallel.
+ *
+ * @param[in] filename The name of the file.
+ * @return The matrix (coo or csc type), csc matrices are assembled via coo::XxMatrix::toCsc().
+ */
+template <typename T_Matrix>
+T_Matrix readMatrixMarket(const std::string& filename);
+
+/**
+ * @ingroup module_index_io
+ * @brief Writes a sparse matrix to a Matrix Market file.
+ *
+ * Symmetric, hermitian & skew matrices are written with the respective header using lower storage.@n
+ * The entries are formatted in parallel, coo matrices are written in compressed form (duplicates are summed).
+ *
+ * @param[in] filename The name of the file.
+ * @param[in] mat The matrix (coo or csc type) to be written.
+ */
+template <typename T_Matrix>
+void writeMatrixMarket(const std::string& filename, const T_Matrix& mat);
+
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_MATRIX_MARKET_HPP_
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/io/tile_store.hpp"
+
+// system
+#include <vector>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/support/file_io.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace io {
+/*-------------------------------------------------*/
+static void tile_pread(file_handle_t fh, const std::string& filename, char *buf, bulk_t nbytes, bulk_t offset)
+{
+	if(!file_read_at(fh, buf, nbytes, offset)) {
+		throw err::InvalidOp("Failed to read from file '" + filename + "'");
+	} // error
+}
+/*-------------------------------------------------*/
+static void tile_pwrite(file_handle_t fh, const std::string& filename, const char *buf, bulk_t nbytes, bulk_t offset)
+{
+	if(!file_write_at(fh, buf, nbytes, offset)) {
+		throw err::InvalidOp("Failed to write to file '" + filename + "'");
+	} // error
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+TileStore<T_Scalar>::TileStore()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+TileStore<T_Scalar>::TileStore(const std::string& filename, uint_t nrows, uint_t ncols, uint_t nb, bool temporary)
+{
+	defaults();
+	open(filename, nrows, ncols, nb, temporary);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+TileStore<T_Scalar>::~TileStore()
+{
+	close();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::defaults()
+{
+	m_filename.clear();
+	m_fd = -1;
+	m_nrows = 0;
+	m_ncols = 0;
+	m_nb = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::open(const std::string& filename, uint_t nrows, uint_t ncols, uint_t nb, bool temporary)
+{
+	close();
+
+	if(!nrows || !ncols || !nb) {
+		throw err::InvalidOp("Invalid dimensions for tile store '" + filename + "'");
+	} // dims
+
+	file_handle_t fd = file_open_rw(filename, temporary);
+
+	if(fd == -1) {
+		throw err::InvalidOp("Could not open file '" + filename + "' for writing");
+	} // fd
+
+	m_filename = filename;
+	m_fd = fd;
+	m_nrows = nrows;
+	m_ncols = ncols;
+	m_nb = nb;
+
+	bulk_t fsize = tileOffset(tileRows(), tileCols() - 1);
+
+	if(!file_resize(m_fd, fsize)) {
+		close();
+		throw err::InvalidOp("Could not allocate " + std::to_string(fsize) + " bytes for file '" + filename + "'");
+	} // resize
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::close()
+{
+	file_close(m_fd);
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar> bool TileStore<T_Scalar>::isOpen() const { return (m_fd != -1); }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::nrows() const { return m_nrows; }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::ncols() const { return m_ncols; }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::tileSize() const { return m_nb; }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::tileRows() const { return (m_nb ? (m_nrows + m_nb - 1) / m_nb : 0); }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::tileCols() const { return (m_nb ? (m_ncols + m_nb - 1) / m_nb : 0); }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::tileNrows(uint_t i) const { return std::min(m_nb, m_nrows - i * m_nb); }
+template <typename T_Scalar> uint_t TileStore<T_Scalar>::tileNcols(uint_t j) const { return std::min(m_nb, m_ncols - j * m_nb); }
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bulk_t TileStore<T_Scalar>::tileOffset(uint_t i, uint_t j) const
+{
+	return (static_cast<bulk_t>(j) * tileRows() + i) * m_nb * m_nb * sizeof(T_Scalar);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::tileCheck(uint_t i, uint_t j) const
+{
+	if(!isOpen()) {
+		throw err::InvalidOp("Tile store is not open");
+	} // open
+
+	if(i >= tileRows() || j >= tileCols()) {
+		throw err::OutOfBounds("Tile (" + std::to_string(i) + "," + std::to_string(j) + ") out of bounds for tile store '" + m_filename + "'");
+	} // bounds
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::read(uint_t i, uint_t j, T_Scalar *dst, uint_t ld) const
+{
+	tileCheck(i, j);
+
+	uint_t m = tileNrows(i);
+	uint_t n = tileNcols(j);
+
+	if(ld == m) {
+		tile_pread(m_fd, m_filename, reinterpret_cast<char*>(dst), m * n * sizeof(T_Scalar), tileOffset(i, j));
+		return;
+	} // contiguous
+
+	std::vector<T_Scalar> tile(m * n);
+	tile_pread(m_fd, m_filename, reinterpret_cast<char*>(tile.data()), m * n * sizeof(T_Scalar), tileOffset(i, j));
+
+	for(uint_t jj = 0; jj < n; jj++) {
+		std::copy(tile.data() + jj * m, tile.data() + (jj + 1) * m, dst + jj * ld);
+	} // jj
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::write(uint_t i, uint_t j, const T_Scalar *src, uint_t ld)
+{
+	tileCheck(i, j);
+
+	uint_t m = tileNrows(i);
+	uint_t n = tileNcols(j);
+
+	if(ld == m) {
+		tile_pwrite(m_fd, m_filename, reinterpret_cast<const char*>(src), m * n * sizeof(T_Scalar), tileOffset(i, j));
+		return;
+	} // contiguous
+
+	std::vector<T_Scalar> tile(m * n);
+
+	for(uint_t jj = 0; jj < n; jj++) {
+		std::copy(src + jj * ld, src + jj * ld + m, tile.data() + jj * m);
+	} // jj
+
+	tile_pwrite(m_fd, m_filename, reinterpret_cast<const char*>(tile.data()), m * n * sizeof(T_Scalar), tileOffset(i, j));
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::readPanel(uint_t j, uint_t ibeg, uint_t iend, T_Scalar *dst, uint_t ld) const
+{
+	for(uint_t i = ibeg; i < iend; i++) {
+		read(i, j, dst + (i - ibeg) * m_nb, ld);
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void TileStore<T_Scalar>::writePanel(uint_t j, uint_t ibeg, uint_t iend, const T_Scalar *src, uint_t ld)
+{
+	for(uint_t i = ibeg; i < iend; i++) {
+		write(i, j, src + (i - ibeg) * m_nb, ld);
+	} // i
+}
+/*-------------------------------------------------*/
+template class TileStore<real_t>;
+template class TileStore<real4_t>;
+template class TileStore<complex_t>;
+template class TileStore<complex8_t>;
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
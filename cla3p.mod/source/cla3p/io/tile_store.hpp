@@ -0,0 +1,189 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_TILE_STORE_HPP_
+#define CLA3P_TILE_STORE_HPP_
+
+/**
+ * @file
+ * File-backed tiled storage for dense matrices that do not fit in memory
+ */
+
+#include <string>
+#include <cstdint>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace io { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_io
+ * @nosubgrouping
+ * @brief A file-backed tiled dense matrix.
+ *
+ * The matrix is split in nb x nb tiles (edge tiles are smaller), each tile is stored column-major 
+ * in a fixed size slot of the file. Slots are ordered by tile column, 
+ * so the tiles of a column panel are contiguous on disk.@n
+ * Tile transfers use positional I/O & may be issued concurrently from different threads.
+ */
+template <typename T_Scalar>
+class TileStore {
+
+	public:
+
+		// no copy
+		TileStore(const TileStore&) = delete;
+		TileStore& operator=(const TileStore&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 */
+		TileStore();
+
+		/**
+		 * @brief Creates a tile store.
+		 * @param[in] filename The name of the backing file, an existing file is truncated.
+		 * @param[in] nrows The number of matrix rows.
+		 * @param[in] ncols The number of matrix columns.
+		 * @param[in] nb The tile size.
+		 * @param[in] temporary Whether to use a scratch file instead, 
+		 *                      it is created next to filename under a unique name & removed once the store is closed.
+		 *                      An existing file named filename is left untouched.
+		 */
+		TileStore(const std::string& filename, uint_t nrows, uint_t ncols, uint_t nb, bool temporary = false);
+
+		/**
+		 * @brief Closes the store.
+		 */
+		~TileStore();
+
+		/**
+		 * @brief Creates a tile store, a previously opened store is closed.
+		 * @param[in] filename The name of the backing file, an existing file is truncated.
+		 * @param[in] nrows The number of matrix rows.
+		 * @param[in] ncols The number of matrix columns.
+		 * @param[in] nb The tile size.
+		 * @param[in] temporary Whether to use a scratch file instead, 
+		 *                      it is created next to filename under a unique name & removed once the store is closed.
+		 *                      An existing file named filename is left untouched.
+		 */
+		void open(const std::string& filename, uint_t nrows, uint_t ncols, uint_t nb, bool temporary = false);
+
+		/**
+		 * @brief Closes the store.
+		 */
+		void close();
+
+		/**
+		 * @brief The store state.
+		 * @return Whether a backing file is open.
+		 */
+		bool isOpen() const;
+
+		/**
+		 * @brief The number of matrix rows.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of matrix columns.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The tile size.
+		 */
+		uint_t tileSize() const;
+
+		/**
+		 * @brief The number of tile rows.
+		 */
+		uint_t tileRows() const;
+
+		/**
+		 * @brief The number of tile columns.
+		 */
+		uint_t tileCols() const;
+
+		/**
+		 * @brief The number of rows of the tiles in tile row i.
+		 */
+		uint_t tileNrows(uint_t i) const;
+
+		/**
+		 * @brief The number of columns of the tiles in tile column j.
+		 */
+		uint_t tileNcols(uint_t j) const;
+
+		/**
+		 * @brief Reads tile (i,j) from the file.
+		 * @param[in] i The tile row.
+		 * @param[in] j The tile column.
+		 * @param[out] dst The destination, tileNrows(i) x tileNcols(j) values with leading dimension ld.
+		 * @param[in] ld The leading dimension of dst.
+		 */
+		void read(uint_t i, uint_t j, T_Scalar *dst, uint_t ld) const;
+
+		/**
+		 * @brief Writes tile (i,j) to the file.
+		 * @param[in] i The tile row.
+		 * @param[in] j The tile column.
+		 * @param[in] src The source, tileNrows(i) x tileNcols(j) values with leading dimension ld.
+		 * @param[in] ld The leading dimension of src.
+		 */
+		void write(uint_t i, uint_t j, const T_Scalar *src, uint_t ld);
+
+		/**
+		 * @brief Reads tiles ibeg,...,iend-1 of tile column j stacked vertically.
+		 * @param[in] j The tile column.
+		 * @param[in] ibeg The first tile row.
+		 * @param[in] iend The end tile row (not included).
+		 * @param[out] dst The destination panel with leading dimension ld.
+		 * @param[in] ld The leading dimension of dst.
+		 */
+		void readPanel(uint_t j, uint_t ibeg, uint_t iend, T_Scalar *dst, uint_t ld) const;
+
+		/**
+		 * @brief Writes tiles ibeg,...,iend-1 of tile column j stacked vertically.
+		 * @param[in] j The tile column.
+		 * @param[in] ibeg The first tile row.
+		 * @param[in] iend The end tile row (not included).
+		 * @param[in] src The source panel with leading dimension ld.
+		 * @param[in] ld The leading dimension of src.
+		 */
+		void writePanel(uint_t j, uint_t ibeg, uint_t iend, const T_Scalar *src, uint_t ld);
+
+	private:
+		std::string m_filename;
+		std::intptr_t m_fd;
+		uint_t m_nrows;
+		uint_t m_ncols;
+		uint_t m_nb;
+
+		void defaults();
+		void tileCheck(uint_t i, uint_t j) const;
+		bulk_t tileOffset(uint_t i, uint_t j) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace io
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_TILE_STORE_HPP_
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/bicgstab_isolver.hpp"
+
+// system
+#include <cmath>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverBiCGStab<T_Vector>::ISolverBiCGStab()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverBiCGStab<T_Vector>::~ISolverBiCGStab()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverBiCGStab<T_Vector>::numWorkVectors() const
+{
+	return 8;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBiCGStab<T_Vector>::iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X)
+{
+	uint_t n = B.size();
+
+	T_Vector& R    = this->work(0);
+	T_Vector& R0   = this->work(1);
+	T_Vector& P    = this->work(2);
+	T_Vector& V    = this->work(3);
+	T_Vector& S    = this->work(4);
+	T_Vector& T    = this->work(5);
+	T_Vector& Phat = this->work(6);
+	T_Vector& Shat = this->work(7);
+
+	//
+	// Without a preconditioner Phat is P & Shat is S
+	//
+	const T_Vector& PP = (this->preconditioned() ? Phat : P);
+	const T_Vector& SS = (this->preconditioned() ? Shat : S);
+
+	A.apply(X, T);
+	T_RScalar rr = bulk::dns::vec_waxpy_nrm2sq(n, B.values(), T_Scalar(-1), T.values(), R.values());
+
+	if(this->monitor(std::sqrt(rr))) return;
+
+	bulk::dns::vec_axpby(n, T_Scalar(1), R.values(), T_Scalar(0), R0.values());
+
+	T_Scalar rho   = 1;
+	T_Scalar alpha = 1;
+	T_Scalar omega = 1;
+
+	for(uint_t it = 0; ; it++) {
+
+		T_Scalar rhonew = bulk::dns::vec_dotc(n, R0.values(), R.values());
+		if(rhonew == T_Scalar(0)) break; // breakdown
+
+		if(it) {
+			T_Scalar beta = (rhonew / rho) * (alpha / omega);
+			bulk::dns::vec_bicgstab_direction(n, beta, omega, R.values(), V.values(), P.values());
+		} else {
+			bulk::dns::vec_axpby(n, T_Scalar(1), R.values(), T_Scalar(0), P.values());
+		} // direction
+
+		rho = rhonew;
+
+		if(this->preconditioned()) this->precondition(P, Phat);
+		A.apply(PP, V);
+
+		T_Scalar r0v = bulk::dns::vec_dotc(n, R0.values(), V.values());
+		if(r0v == T_Scalar(0)) break; // breakdown
+
+		alpha = rho / r0v;
+		T_RScalar ss = bulk::dns::vec_waxpy_nrm2sq(n, R.values(), -alpha, V.values(), S.values());
+
+		if(ss <= T_RScalar(0)) {
+			bulk::dns::vec_axpby(n, alpha, PP.values(), T_Scalar(1), X.values());
+			this->monitor(0);
+			break;
+		} // exact solution
+
+		if(this->preconditioned()) this->precondition(S, Shat);
+		A.apply(SS, T);
+
+		T_RScalar tt = bulk::dns::vec_nrm2sq(n, T.values());
+		if(tt == T_RScalar(0)) break; // breakdown
+
+		omega = bulk::dns::vec_dotc(n, T.values(), S.values()) / tt;
+		rr = bulk::dns::vec_bicgstab_update(n, alpha, omega, PP.values(), SS.values(), S.values(), T.values(), X.values(), R.values());
+
+		if(this->monitor(std::sqrt(rr))) break;
+		if(omega == T_Scalar(0)) break; // stagnation
+
+	} // iterations
+}
+/*-------------------------------------------------*/
+template class ISolverBiCGStab<dns::RdVector>;
+template class ISolverBiCGStab<dns::RfVector>;
+template class ISolverBiCGStab<dns::CdVector>;
+template class ISolverBiCGStab<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_BICGSTAB_ISOLVER_HPP_
+#define CLA3P_ITSOL_BICGSTAB_ISOLVER_HPP_
+
+/**
+ * @file
+ * Biconjugate gradient stabilized iterative solver
+ */
+
+#include "cla3p/itsol/isolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The right-preconditioned biconjugate gradient stabilized (BiCGStab) iterative solver.
+ *
+ * For general (non-symmetric) operators.
+ * Memory requirements are 8 workspace vectors, two operator & preconditioner applications per iteration.
+ */
+template <typename T_Vector>
+class ISolverBiCGStab : public ISolverBase<T_Vector> {
+
+	using typename ISolverBase<T_Vector>::T_Scalar;
+	using typename ISolverBase<T_Vector>::T_RScalar;
+
+	public:
+
+		// no copy
+		ISolverBiCGStab(const ISolverBiCGStab&) = delete;
+		ISolverBiCGStab& operator=(const ISolverBiCGStab&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs a solver with default settings.
+		 */
+		ISolverBiCGStab();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~ISolverBiCGStab();
+
+	protected:
+		uint_t numWorkVectors() const override;
+		void iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X) override;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_BICGSTAB_ISOLVER_HPP_
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/cg_isolver.hpp"
+
+// system
+#include <cmath>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverCG<T_Vector>::ISolverCG()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverCG<T_Vector>::~ISolverCG()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverCG<T_Vector>::numWorkVectors() const
+{
+	return 4;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverCG<T_Vector>::iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X)
+{
+	uint_t n = B.size();
+
+	T_Vector& R = this->work(0);
+	T_Vector& Z = this->work(1);
+	T_Vector& P = this->work(2);
+	T_Vector& Q = this->work(3);
+
+	//
+	// Without a preconditioner Z is R
+	//
+	const T_Vector& ZZ = (this->preconditioned() ? Z : R);
+
+	A.apply(X, Q);
+	T_RScalar rr = bulk::dns::vec_waxpy_nrm2sq(n, B.values(), T_Scalar(-1), Q.values(), R.values());
+
+	if(this->monitor(std::sqrt(rr))) return;
+
+	if(this->preconditioned()) this->precondition(R, Z);
+
+	T_Scalar rho = bulk::dns::vec_dotc(n, R.values(), ZZ.values());
+	bulk::dns::vec_axpby(n, T_Scalar(1), ZZ.values(), T_Scalar(0), P.values());
+
+	for(;;) {
+
+		A.apply(P, Q);
+
+		T_Scalar pq = bulk::dns::vec_dotc(n, P.values(), Q.values());
+		if(pq == T_Scalar(0)) break; // breakdown
+
+		T_Scalar alpha = rho / pq;
+		rr = bulk::dns::vec_cg_update(n, alpha, P.values(), Q.values(), X.values(), R.values());
+
+		if(this->monitor(std::sqrt(rr))) break;
+
+		if(this->preconditioned()) this->precondition(R, Z);
+
+		T_Scalar rhonew = bulk::dns::vec_dotc(n, R.values(), ZZ.values());
+		T_Scalar beta = rhonew / rho;
+		rho = rhonew;
+
+		bulk::dns::vec_axpby(n, T_Scalar(1), ZZ.values(), beta, P.values());
+
+	} // iterations
+}
+/*-------------------------------------------------*/
+template class ISolverCG<dns::RdVector>;
+template class ISolverCG<dns::RfVector>;
+template class ISolverCG<dns::CdVector>;
+template class ISolverCG<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_CG_ISOLVER_HPP_
+#define CLA3P_ITSOL_CG_ISOLVER_HPP_
+
+/**
+ * @file
+ * Conjugate gradient iterative solver
+ */
+
+#include "cla3p/itsol/isolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The preconditioned conjugate gradient (CG) iterative solver.
+ *
+ * For symmetric (real) or hermitian (complex) positive definite operators & preconditioners.
+ * Memory requirements are 4 workspace vectors.
+ */
+template <typename T_Vector>
+class ISolverCG : public ISolverBase<T_Vector> {
+
+	using typename ISolverBase<T_Vector>::T_Scalar;
+	using typename ISolverBase<T_Vector>::T_RScalar;
+
+	public:
+
+		// no copy
+		ISolverCG(const ISolverCG&) = delete;
+		ISolverCG& operator=(const ISolverCG&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs a solver with default settings.
+		 */
+		ISolverCG();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~ISolverCG();
+
+	protected:
+		uint_t numWorkVectors() const override;
+		void iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X) override;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_CG_ISOLVER_HPP_
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/gmres_isolver.hpp"
+
+// system
+#include <cmath>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+//
+// Computes the rotation [c s; -conj(s) c] with c real, that maps (a,b) to (r,0)
+//
+template <typename T_Scalar, typename T_RScalar>
+static void givens_rotation(T_Scalar a, T_Scalar b, T_RScalar& c, T_Scalar& s, T_Scalar& r)
+{
+	T_RScalar absa = std::abs(a);
+
+	if(absa == T_RScalar(0)) {
+		c = 0;
+		s = 1;
+		r = b;
+		return;
+	} // a is zero
+
+	T_RScalar nrm = std::hypot(absa, T_RScalar(std::abs(b)));
+	T_Scalar alpha = a / absa;
+
+	c = absa / nrm;
+	s = alpha * arith::conj(b) / nrm;
+	r = alpha * nrm;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverGMRES<T_Vector>::ISolverGMRES()
+	: m_restart(30)
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverGMRES<T_Vector>::~ISolverGMRES()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverGMRES<T_Vector>::setRestart(uint_t m)
+{
+	if(!m) {
+		throw err::InvalidOp("Restart length must be positive");
+	} // m
+
+	m_restart = m;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverGMRES<T_Vector>::restart() const
+{
+	return m_restart;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverGMRES<T_Vector>::numWorkVectors() const
+{
+	return m_restart + 2;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverGMRES<T_Vector>::iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X)
+{
+	uint_t n = B.size();
+	uint_t m = m_restart;
+	uint_t ldh = m + 1;
+
+	m_hessenberg.resize(ldh * m);
+	m_cs.resize(m);
+	m_sn.resize(m);
+	m_g.resize(m + 1);
+	m_y.resize(m);
+
+	T_Scalar  *H  = m_hessenberg.data();
+	T_RScalar *cs = m_cs.data();
+	T_Scalar  *sn = m_sn.data();
+	T_Scalar  *g  = m_g.data();
+	T_Scalar  *y  = m_y.data();
+
+	T_Vector& Z = this->work(m + 1);
+
+	A.apply(X, Z);
+	T_RScalar beta = std::sqrt(bulk::dns::vec_waxpy_nrm2sq(n, B.values(), T_Scalar(-1), Z.values(), this->work(0).values()));
+
+	if(this->monitor(beta)) return;
+
+	for(;;) {
+
+		bulk::dns::vec_axpby(n, T_Scalar(1 / beta), this->work(0).values(), T_Scalar(0), this->work(0).values());
+
+		g[0] = beta;
+		for(uint_t i = 1; i <= m; i++) g[i] = 0;
+
+		uint_t k = 0;
+		bool stop = false;
+
+		for(uint_t j = 0; j < m && !stop; j++) {
+
+			T_Vector& Vj = this->work(j);
+			T_Vector& Vn = this->work(j + 1);
+			T_Scalar *h = H + j * ldh;
+
+			if(this->preconditioned()) this->precondition(Vj, Z);
+			A.apply(this->preconditioned() ? Z : Vj, Vn);
+
+			//
+			// Modified Gram-Schmidt
+			//
+			for(uint_t i = 0; i <= j; i++) {
+				h[i] = bulk::dns::vec_dotc(n, this->work(i).values(), Vn.values());
+				bulk::dns::vec_axpby(n, -h[i], this->work(i).values(), T_Scalar(1), Vn.values());
+			} // i
+
+			T_RScalar hn = std::sqrt(bulk::dns::vec_nrm2sq(n, Vn.values()));
+			h[j + 1] = hn;
+
+			if(hn > T_RScalar(0)) {
+				bulk::dns::vec_axpby(n, T_Scalar(1 / hn), Vn.values(), T_Scalar(0), Vn.values());
+			} // normalize
+
+			for(uint_t i = 0; i < j; i++) {
+				T_Scalar tmp = cs[i] * h[i] + sn[i] * h[i + 1];
+				h[i + 1] = -arith::conj(sn[i]) * h[i] + cs[i] * h[i + 1];
+				h[i] = tmp;
+			} // apply previous rotations
+
+			givens_rotation(h[j], h[j + 1], cs[j], sn[j], h[j]);
+			h[j + 1] = 0;
+
+			g[j + 1] = -arith::conj(sn[j]) * g[j];
+			g[j] = cs[j] * g[j];
+
+			k = j + 1;
+			stop = (this->monitor(std::abs(g[j + 1])) || hn == T_RScalar(0));
+
+		} // j
+
+		//
+		// Solve the triangular least squares system & update the solution
+		//
+		for(uint_t ii = k; ii > 0; ii--) {
+			uint_t i = ii - 1;
+			T_Scalar sum = g[i];
+			for(uint_t l = i + 1; l < k; l++) {
+				sum -= H[i + l * ldh] * y[l];
+			} // l
+			T_Scalar hii = H[i + i * ldh];
+			y[i] = (hii == T_Scalar(0) ? T_Scalar(0) : sum / hii);
+		} // ii
+
+		bulk::dns::vec_axpby(n, y[0], this->work(0).values(), T_Scalar(0), Z.values());
+		for(uint_t i = 1; i < k; i++) {
+			bulk::dns::vec_axpby(n, y[i], this->work(i).values(), T_Scalar(1), Z.values());
+		} // i
+
+		if(this->preconditioned()) {
+			this->precondition(Z, this->work(0));
+			bulk::dns::vec_axpby(n, T_Scalar(1), this->work(0).values(), T_Scalar(1), X.values());
+		} else {
+			bulk::dns::vec_axpby(n, T_Scalar(1), Z.values(), T_Scalar(1), X.values());
+		} // update
+
+		if(stop) break;
+
+		//
+		// Restart with the explicit residual
+		//
+		A.apply(X, Z);
+		beta = std::sqrt(bulk::dns::vec_waxpy_nrm2sq(n, B.values(), T_Scalar(-1), Z.values(), this->work(0).values()));
+
+		if(beta == T_RScalar(0)) break;
+
+	} // restarts
+}
+/*-------------------------------------------------*/
+template class ISolverGMRES<dns::RdVector>;
+template class ISolverGMRES<dns::RfVector>;
+template class ISolverGMRES<dns::CdVector>;
+template class ISolverGMRES<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_GMRES_ISOLVER_HPP_
+#define CLA3P_ITSOL_GMRES_ISOLVER_HPP_
+
+/**
+ * @file
+ * Generalized minimal residual iterative solver
+ */
+
+#include <vector>
+
+#include "cla3p/itsol/isolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The right-preconditioned restarted generalized minimal residual (GMRES) iterative solver.
+ *
+ * For general (non-symmetric) operators. The residual is monitored with the (implicit) Arnoldi residual estimate.
+ * Memory requirements are (restart + 2) workspace vectors.
+ */
+template <typename T_Vector>
+class ISolverGMRES : public ISolverBase<T_Vector> {
+
+	using typename ISolverBase<T_Vector>::T_Scalar;
+	using typename ISolverBase<T_Vector>::T_RScalar;
+
+	public:
+
+		// no copy
+		ISolverGMRES(const ISolverGMRES&) = delete;
+		ISolverGMRES& operator=(const ISolverGMRES&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs a solver with default settings.
+		 */
+		ISolverGMRES();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~ISolverGMRES();
+
+		/**
+		 * @brief Sets the restart length.
+		 * @param[in] m The number of iterations between restarts (Krylov subspace dimension), default is 30.
+		 */
+		void setRestart(uint_t m);
+
+		/**
+		 * @brief The restart length.
+		 */
+		uint_t restart() const;
+
+	protected:
+		uint_t numWorkVectors() const override;
+		void iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X) override;
+
+	private:
+		uint_t m_restart;
+		std::vector<T_Scalar> m_hessenberg;
+		std::vector<T_RScalar> m_cs;
+		std::vector<T_Scalar> m_sn;
+		std::vector<T_Scalar> m_g;
+		std::vector<T_Scalar> m_y;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_GMRES_ISOLVER_HPP_
@@ -0,0 +1,340 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/incomplete_factor.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csc_ilu.hpp"
+#include "cla3p/bulk/csc_sweep.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+#include "cla3p/checks/decomp_lu_checks.hpp"
+#include "cla3p/checks/decomp_llt_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteFactorBase<T_Matrix>::IncompleteFactorBase()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IncompleteFactorBase<T_Matrix>::~IncompleteFactorBase()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteFactorBase<T_Matrix>::clear()
+{
+	m_L.clear();
+	m_U.clear();
+	m_forward = Sweep();
+	m_backward = Sweep();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const T_Matrix& IncompleteFactorBase<T_Matrix>::lower() const
+{
+	return m_L;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const T_Matrix& IncompleteFactorBase<T_Matrix>::upper() const
+{
+	return m_U;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix IncompleteFactorBase<T_Matrix>::createFactor(uint_t n, uplo_t uplo, const std::vector<T_Int>& colptr, 
+		const std::vector<T_Int>& rowidx, const std::vector<T_Scalar>& values)
+{
+	T_Matrix ret(n, n, colptr[n], Property(prop_t::Triangular, uplo));
+
+	std::copy(colptr.begin(), colptr.end(), ret.colptr());
+	std::copy(rowidx.begin(), rowidx.end(), ret.rowidx());
+	std::copy(values.begin(), values.end(), ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// Forward sweep: rows of L through a row map of the csc arrays
+// Backward sweep: rows of U through a row map of the csc arrays, 
+//                 or columns of L (rows of L^H) directly if U is empty
+//
+template <typename T_Matrix>
+void IncompleteFactorBase<T_Matrix>::setFactors(T_Matrix& L, T_Matrix& U)
+{
+	clear();
+
+	m_L = L.move();
+	if(!U.empty()) m_U = U.move();
+
+	uint_t n = m_L.ncols();
+	uint_t nzl = m_L.nnz();
+
+	m_forward.rptr.resize(n + 1);
+	m_forward.cidx.resize(nzl);
+	m_forward.vpos.resize(nzl);
+	m_forward.levptr.resize(n + 1);
+	m_forward.levrow.resize(n);
+
+	bulk::csc::row_map(n, n, m_L.colptr(), m_L.rowidx(), 
+			m_forward.rptr.data(), m_forward.cidx.data(), m_forward.vpos.data());
+
+	m_forward.nlev = bulk::csc::level_sets(uplo_t::Lower, n, 
+			m_forward.rptr.data(), m_forward.cidx.data(), m_forward.levptr.data(), m_forward.levrow.data());
+
+	m_backward.levptr.resize(n + 1);
+	m_backward.levrow.resize(n);
+
+	if(m_U.empty()) {
+
+		m_forward.dpos.assign(m_L.colptr(), m_L.colptr() + n);
+
+		m_backward.nlev = bulk::csc::level_sets(uplo_t::Upper, n, 
+				m_L.colptr(), m_L.rowidx(), m_backward.levptr.data(), m_backward.levrow.data());
+
+	} else {
+
+		uint_t nzu = m_U.nnz();
+
+		m_backward.rptr.resize(n + 1);
+		m_backward.cidx.resize(nzu);
+		m_backward.vpos.resize(nzu);
+		m_backward.dpos.resize(n);
+
+		bulk::csc::row_map(n, n, m_U.colptr(), m_U.rowidx(), 
+				m_backward.rptr.data(), m_backward.cidx.data(), m_backward.vpos.data());
+
+		for(uint_t i = 0; i < n; i++) {
+			m_backward.dpos[i] = m_U.colptr()[i+1] - 1;
+		} // i
+
+		m_backward.nlev = bulk::csc::level_sets(uplo_t::Upper, n, 
+				m_backward.rptr.data(), m_backward.cidx.data(), m_backward.levptr.data(), m_backward.levrow.data());
+
+	} // U
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void IncompleteFactorBase<T_Matrix>::apply(const T_Vector& R, T_Vector& Z) const
+{
+	if(m_L.empty()) {
+		throw err::InvalidOp("Incomplete factorization is not computed");
+	} // empty
+
+	uint_t n = m_L.ncols();
+
+	if(R.size() != n || Z.size() != n) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	bulk::dns::vec_axpby(n, T_Scalar(1), R.values(), T_Scalar(0), Z.values());
+
+	bulk::csc::level_sweep(m_forward.nlev, m_forward.levptr.data(), m_forward.levrow.data(), 
+			m_forward.rptr.data(), m_forward.cidx.data(), m_forward.vpos.data(), 
+			m_L.values(), (m_forward.dpos.empty() ? nullptr : m_forward.dpos.data()), false, Z.values());
+
+	if(m_U.empty()) {
+
+		bulk::csc::level_sweep(m_backward.nlev, m_backward.levptr.data(), m_backward.levrow.data(), 
+				m_L.colptr(), m_L.rowidx(), static_cast<const T_Int*>(nullptr), 
+				m_L.values(), m_L.colptr(), true, Z.values());
+
+	} else {
+
+		bulk::csc::level_sweep(m_backward.nlev, m_backward.levptr.data(), m_backward.levrow.data(), 
+				m_backward.rptr.data(), m_backward.cidx.data(), m_backward.vpos.data(), 
+				m_U.values(), m_backward.dpos.data(), false, Z.values());
+
+	} // U
+}
+/*-------------------------------------------------*/
+template class IncompleteFactorBase<csc::RdMatrix>;
+template class IncompleteFactorBase<csc::RfMatrix>;
+template class IncompleteFactorBase<csc::CdMatrix>;
+template class IncompleteFactorBase<csc::CfMatrix>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILU0Preconditioner<T_Matrix>::ILU0Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILU0Preconditioner<T_Matrix>::ILU0Preconditioner(const T_Matrix& mat)
+{
+	compute(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILU0Preconditioner<T_Matrix>::~ILU0Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void ILU0Preconditioner<T_Matrix>::compute(const T_Matrix& mat)
+{
+	lu_decomp_input_check(mat);
+
+	std::vector<T_Int> lcolptr, lrowidx, ucolptr, urowidx;
+	std::vector<T_Scalar> lvalues, uvalues;
+
+	uint_t n = mat.ncols();
+
+	if(mat.prop().isGeneral()) {
+		bulk::csc::ilu0(n, mat.colptr(), mat.rowidx(), mat.values(), lcolptr, lrowidx, lvalues, ucolptr, urowidx, uvalues);
+	} else {
+		T_Matrix tmp = mat.general();
+		bulk::csc::ilu0(n, tmp.colptr(), tmp.rowidx(), tmp.values(), lcolptr, lrowidx, lvalues, ucolptr, urowidx, uvalues);
+	} // prop
+
+	T_Matrix L = this->createFactor(n, uplo_t::Lower, lcolptr, lrowidx, lvalues);
+	T_Matrix U = this->createFactor(n, uplo_t::Upper, ucolptr, urowidx, uvalues);
+
+	this->setFactors(L, U);
+}
+/*-------------------------------------------------*/
+template class ILU0Preconditioner<csc::RdMatrix>;
+template class ILU0Preconditioner<csc::RfMatrix>;
+template class ILU0Preconditioner<csc::CdMatrix>;
+template class ILU0Preconditioner<csc::CfMatrix>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILUTPreconditioner<T_Matrix>::ILUTPreconditioner(T_RScalar droptol, uint_t fill)
+	: m_droptol(droptol), m_fill(fill)
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILUTPreconditioner<T_Matrix>::ILUTPreconditioner(const T_Matrix& mat, T_RScalar droptol, uint_t fill)
+	: m_droptol(droptol), m_fill(fill)
+{
+	compute(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+ILUTPreconditioner<T_Matrix>::~ILUTPreconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void ILUTPreconditioner<T_Matrix>::compute(const T_Matrix& mat)
+{
+	lu_decomp_input_check(mat);
+
+	std::vector<T_Int> lcolptr, lrowidx, ucolptr, urowidx;
+	std::vector<T_Scalar> lvalues, uvalues;
+
+	uint_t n = mat.ncols();
+
+	if(mat.prop().isGeneral()) {
+		bulk::csc::ilut(n, mat.colptr(), mat.rowidx(), mat.values(), m_droptol, m_fill, 
+				lcolptr, lrowidx, lvalues, ucolptr, urowidx, uvalues);
+	} else {
+		T_Matrix tmp = mat.general();
+		bulk::csc::ilut(n, tmp.colptr(), tmp.rowidx(), tmp.values(), m_droptol, m_fill, 
+				lcolptr, lrowidx, lvalues, ucolptr, urowidx, uvalues);
+	} // prop
+
+	T_Matrix L = this->createFactor(n, uplo_t::Lower, lcolptr, lrowidx, lvalues);
+	T_Matrix U = this->createFactor(n, uplo_t::Upper, ucolptr, urowidx, uvalues);
+
+	this->setFactors(L, U);
+}
+/*-------------------------------------------------*/
+template class ILUTPreconditioner<csc::RdMatrix>;
+template class ILUTPreconditioner<csc::RfMatrix>;
+template class ILUTPreconditioner<csc::CdMatrix>;
+template class ILUTPreconditioner<csc::CfMatrix>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IC0Preconditioner<T_Matrix>::IC0Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IC0Preconditioner<T_Matrix>::IC0Preconditioner(const T_Matrix& mat)
+{
+	compute(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+IC0Preconditioner<T_Matrix>::~IC0Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+//
+// The upper part of a symmetric (hermitian) matrix is the transpose (conjugate transpose) of the lower part
+//
+template <typename T_Matrix>
+void IC0Preconditioner<T_Matrix>::compute(const T_Matrix& mat)
+{
+	llt_decomp_input_check(mat);
+
+	uint_t n = mat.ncols();
+	T_Matrix L(n, n, mat.nnz(), Property(prop_t::Triangular, uplo_t::Lower));
+
+	if(mat.prop().isLower()) {
+
+		std::copy(mat.colptr(), mat.colptr() + n + 1, L.colptr());
+		std::copy(mat.rowidx(), mat.rowidx() + mat.nnz(), L.rowidx());
+		std::copy(mat.values(), mat.values() + mat.nnz(), L.values());
+
+	} else if(mat.prop().isHermitian()) {
+
+		bulk::csc::conjugate_transpose(n, n, mat.colptr(), mat.rowidx(), mat.values(), L.colptr(), L.rowidx(), L.values());
+
+	} else {
+
+		bulk::csc::transpose(n, n, mat.colptr(), mat.rowidx(), mat.values(), L.colptr(), L.rowidx(), L.values());
+
+	} // uplo
+
+	bulk::csc::ic0(n, L.colptr(), L.rowidx(), L.values());
+
+	T_Matrix U;
+	this->setFactors(L, U);
+}
+/*-------------------------------------------------*/
+template class IC0Preconditioner<csc::RdMatrix>;
+template class IC0Preconditioner<csc::RfMatrix>;
+template class IC0Preconditioner<csc::CdMatrix>;
+template class IC0Preconditioner<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
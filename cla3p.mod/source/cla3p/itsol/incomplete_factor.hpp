@@ -0,0 +1,242 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_INCOMPLETE_FACTOR_HPP_
+#define CLA3P_ITSOL_INCOMPLETE_FACTOR_HPP_
+
+/**
+ * @file
+ * Incomplete factorization preconditioners for sparse matrices
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/itsol/preconditioner.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The abstract incomplete factorization preconditioner for sparse (csc) matrices.
+ *
+ * The factors are stored as csc matrices. 
+ * Preconditioner applications are performed with level-scheduled multithreaded triangular sweeps.
+ */
+template <typename T_Matrix>
+class IncompleteFactorBase : public Preconditioner<typename TypeTraits<T_Matrix>::vector_type> {
+
+	protected:
+		using T_Int = typename T_Matrix::index_type;
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+		using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		IncompleteFactorBase(const IncompleteFactorBase&) = delete;
+		IncompleteFactorBase& operator=(const IncompleteFactorBase&) = delete;
+
+		IncompleteFactorBase();
+		virtual ~IncompleteFactorBase();
+
+		/**
+		 * @brief Clears the preconditioner internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Computes the incomplete factorization of a matrix.
+		 * @param[in] mat The square matrix to be factorized.
+		 */
+		virtual void compute(const T_Matrix& mat) = 0;
+
+		/**
+		 * @brief The lower triangular factor L.
+		 */
+		const T_Matrix& lower() const;
+
+		/**
+		 * @brief The upper triangular factor U.
+		 * @return The upper factor, empty for Cholesky type factorizations (U = L^H).
+		 */
+		const T_Matrix& upper() const;
+
+		/**
+		 * @brief Applies the preconditioner.
+		 *
+		 * Performs the operation <b>Z := inv(U) * inv(L) * R</b>
+		 *
+		 * @param[in] R The input vector.
+		 * @param[out] Z The output vector, already sized.
+		 */
+		void apply(const T_Vector& R, T_Vector& Z) const override;
+
+	protected:
+		void setFactors(T_Matrix& L, T_Matrix& U);
+		static T_Matrix createFactor(uint_t n, uplo_t uplo, const std::vector<T_Int>& colptr, 
+				const std::vector<T_Int>& rowidx, const std::vector<T_Scalar>& values);
+
+	private:
+		struct Sweep {
+			std::vector<T_Int> rptr;
+			std::vector<T_Int> cidx;
+			std::vector<T_Int> vpos;
+			std::vector<T_Int> dpos;
+			std::vector<T_Int> levptr;
+			std::vector<T_Int> levrow;
+			uint_t nlev = 0;
+		};
+
+		T_Matrix m_L;
+		T_Matrix m_U;
+		Sweep m_forward;
+		Sweep m_backward;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The incomplete LU preconditioner with zero fill-in, ILU(0).
+ *
+ * The factors L & U preserve the sparsity pattern of the matrix. 
+ * Symmetric & hermitian matrices are expanded to general before factorization.
+ */
+template <typename T_Matrix>
+class ILU0Preconditioner : public IncompleteFactorBase<T_Matrix> {
+
+	using typename IncompleteFactorBase<T_Matrix>::T_Int;
+	using typename IncompleteFactorBase<T_Matrix>::T_Scalar;
+
+	public:
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner.
+		 */
+		ILU0Preconditioner();
+
+		/**
+		 * @brief The matrix constructor.
+		 * @param[in] mat The square matrix to be factorized.
+		 */
+		explicit ILU0Preconditioner(const T_Matrix& mat);
+		~ILU0Preconditioner();
+
+		/**
+		 * @copydoc cla3p::itsol::IncompleteFactorBase::compute()
+		 */
+		void compute(const T_Matrix& mat) override;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The incomplete LU preconditioner with threshold dropping, ILUT.
+ *
+ * Entries smaller than droptol times the norm of the matrix column are dropped, 
+ * and at most fill entries are kept in each column of L & U (besides the diagonal).
+ * Symmetric & hermitian matrices are expanded to general before factorization.
+ */
+template <typename T_Matrix>
+class ILUTPreconditioner : public IncompleteFactorBase<T_Matrix> {
+
+	using typename IncompleteFactorBase<T_Matrix>::T_Int;
+	using typename IncompleteFactorBase<T_Matrix>::T_Scalar;
+	using typename IncompleteFactorBase<T_Matrix>::T_RScalar;
+
+	public:
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner.
+		 *
+		 * @param[in] droptol The relative drop tolerance.
+		 * @param[in] fill The maximum number of off-diagonal entries per factor column.
+		 */
+		explicit ILUTPreconditioner(T_RScalar droptol = T_RScalar(1.e-3), uint_t fill = 20);
+
+		/**
+		 * @brief The matrix constructor.
+		 * @param[in] mat The square matrix to be factorized.
+		 * @param[in] droptol The relative drop tolerance.
+		 * @param[in] fill The maximum number of off-diagonal entries per factor column.
+		 */
+		explicit ILUTPreconditioner(const T_Matrix& mat, T_RScalar droptol = T_RScalar(1.e-3), uint_t fill = 20);
+		~ILUTPreconditioner();
+
+		/**
+		 * @copydoc cla3p::itsol::IncompleteFactorBase::compute()
+		 */
+		void compute(const T_Matrix& mat) override;
+
+	private:
+		T_RScalar m_droptol;
+		uint_t m_fill;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The incomplete Cholesky preconditioner with zero fill-in, IC(0).
+ *
+ * For symmetric (real) or hermitian (complex) positive definite matrices. 
+ * The factor L preserves the sparsity pattern of the lower part of the matrix.
+ */
+template <typename T_Matrix>
+class IC0Preconditioner : public IncompleteFactorBase<T_Matrix> {
+
+	public:
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner.
+		 */
+		IC0Preconditioner();
+
+		/**
+		 * @brief The matrix constructor.
+		 * @param[in] mat The symmetric/hermitian matrix to be factorized.
+		 */
+		explicit IC0Preconditioner(const T_Matrix& mat);
+		~IC0Preconditioner();
+
+		/**
+		 * @copydoc cla3p::itsol::IncompleteFactorBase::compute()
+		 */
+		void compute(const T_Matrix& mat) override;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_INCOMPLETE_FACTOR_HPP_
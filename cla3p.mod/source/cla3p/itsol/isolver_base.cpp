@@ -0,0 +1,226 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/isolver_base.hpp"
+
+// system
+#include <cmath>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverBase<T_Vector>::ISolverBase()
+	: 
+		m_tolerance(std::sqrt(TypeTraits<T_Scalar>::epsilon())), 
+		m_maxIterations(1000), 
+		m_preconditioner(nullptr), 
+		m_converged(false), 
+		m_refnorm(1)
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverBase<T_Vector>::~ISolverBase()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::clear()
+{
+	m_converged = false;
+	m_refnorm = 1;
+	m_history.clear();
+	m_work.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::setTolerance(T_RScalar tol)
+{
+	if(tol <= 0) {
+		throw err::InvalidOp("Tolerance must be positive");
+	} // tol
+
+	m_tolerance = tol;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+typename ISolverBase<T_Vector>::T_RScalar ISolverBase<T_Vector>::tolerance() const
+{
+	return m_tolerance;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::setMaxIterations(uint_t maxit)
+{
+	m_maxIterations = maxit;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverBase<T_Vector>::maxIterations() const
+{
+	return m_maxIterations;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::setPreconditioner(const Preconditioner<T_Vector>& prec)
+{
+	m_preconditioner = &prec;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::unsetPreconditioner()
+{
+	m_preconditioner = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+bool ISolverBase<T_Vector>::converged() const
+{
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverBase<T_Vector>::iterations() const
+{
+	return (m_history.empty() ? 0 : m_history.size() - 1);
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+typename ISolverBase<T_Vector>::T_RScalar ISolverBase<T_Vector>::residual() const
+{
+	return (m_history.empty() ? T_RScalar(0) : m_history.back());
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+const std::vector<typename ISolverBase<T_Vector>::T_RScalar>& ISolverBase<T_Vector>::history() const
+{
+	return m_history;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+T_Vector& ISolverBase<T_Vector>::work(uint_t i)
+{
+	return m_work[i];
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+bool ISolverBase<T_Vector>::preconditioned() const
+{
+	return (m_preconditioner != nullptr);
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::precondition(const T_Vector& R, T_Vector& Z) const
+{
+	if(m_preconditioner) {
+		m_preconditioner->apply(R, Z);
+	} else {
+		bulk::dns::vec_axpby(R.size(), T_Scalar(1), R.values(), T_Scalar(0), Z.values());
+	} // prec
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::setReferenceNorm(T_RScalar nrm)
+{
+	m_refnorm = (nrm > 0 ? nrm : T_RScalar(1));
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+bool ISolverBase<T_Vector>::monitor(T_RScalar resnorm)
+{
+	T_RScalar relres = resnorm / m_refnorm;
+
+	m_history.push_back(relres);
+	m_converged = (relres <= m_tolerance);
+
+	return (m_converged || iterations() >= m_maxIterations);
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void ISolverBase<T_Vector>::reserveWorkspace(uint_t n)
+{
+	uint_t nvecs = numWorkVectors();
+
+	bool reuse = (m_work.size() == nvecs);
+	for(uint_t i = 0; reuse && i < nvecs; i++) {
+		reuse = (m_work[i].size() == n);
+	} // i
+
+	if(reuse) return;
+
+	m_work.clear();
+	m_work.reserve(nvecs);
+	for(uint_t i = 0; i < nvecs; i++) {
+		m_work.push_back(T_Vector(n));
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+bool ISolverBase<T_Vector>::solve(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X)
+{
+	uint_t n = A.size();
+
+	if(B.size() != n) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // B dims
+
+	if(X.empty()) {
+		X = T_Vector(n);
+		X = T_Scalar(0);
+	} else if(X.size() != n) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // X dims
+
+	m_converged = false;
+	m_history.clear();
+
+	T_RScalar bnorm = std::sqrt(bulk::dns::vec_nrm2sq(n, B.values()));
+
+	if(bnorm == 0) {
+		X = T_Scalar(0);
+		m_history.push_back(0);
+		m_converged = true;
+		return m_converged;
+	} // trivial
+
+	setReferenceNorm(bnorm);
+	reserveWorkspace(n);
+
+	iterate(A, B, X);
+
+	return m_converged;
+}
+/*-------------------------------------------------*/
+template class ISolverBase<dns::RdVector>;
+template class ISolverBase<dns::RfVector>;
+template class ISolverBase<dns::CdVector>;
+template class ISolverBase<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_ISOLVER_BASE_HPP_
+#define CLA3P_ITSOL_ISOLVER_BASE_HPP_
+
+/**
+ * @file
+ * Base class for iterative linear solvers
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/itsol/operator.hpp"
+#include "cla3p/itsol/preconditioner.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The abstract iterative linear solver base.
+ *
+ * Iterative solvers approximate the solution of <b>A * X = B</b> accessing A only through operator applications.
+ * Workspace vectors are allocated at the first solve and reused by subsequent solves of the same dimension.
+ * The iteration stops when the relative residual norm drops below the tolerance, 
+ * or when the maximum number of iterations is reached.
+ */
+template <typename T_Vector>
+class ISolverBase {
+
+	protected:
+		using T_Scalar = typename T_Vector::value_type;
+		using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+
+		// no copy
+		ISolverBase(const ISolverBase&) = delete;
+		ISolverBase& operator=(const ISolverBase&) = delete;
+
+		ISolverBase();
+		virtual ~ISolverBase();
+
+		/**
+		 * @brief Clears the solver internal data (workspace & convergence history).
+		 */
+		virtual void clear();
+
+		/**
+		 * @brief Sets the relative residual tolerance.
+		 * @param[in] tol The convergence tolerance, default is the square root of the machine precision.
+		 */
+		void setTolerance(T_RScalar tol);
+
+		/**
+		 * @brief The relative residual tolerance.
+		 */
+		T_RScalar tolerance() const;
+
+		/**
+		 * @brief Sets the maximum number of iterations.
+		 * @param[in] maxit The maximum number of iterations, default is 1000.
+		 */
+		void setMaxIterations(uint_t maxit);
+
+		/**
+		 * @brief The maximum number of iterations.
+		 */
+		uint_t maxIterations() const;
+
+		/**
+		 * @brief Sets the preconditioner.
+		 * @param[in] prec The preconditioner, referenced (not copied) & must outlive the solves.
+		 */
+		void setPreconditioner(const Preconditioner<T_Vector>& prec);
+
+		/**
+		 * @brief Removes the preconditioner.
+		 */
+		void unsetPreconditioner();
+
+		/**
+		 * @brief Solves a linear system.
+		 * @param[in] A The system operator.
+		 * @param[in] B The right hand side vector.
+		 * @param[in,out] X The initial guess on entry (zero if empty), the approximate solution on exit.
+		 * @return Whether the iteration converged.
+		 */
+		bool solve(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X);
+
+		/**
+		 * @brief Convergence status of the last solve.
+		 */
+		bool converged() const;
+
+		/**
+		 * @brief The number of iterations performed in the last solve.
+		 */
+		uint_t iterations() const;
+
+		/**
+		 * @brief The final relative residual norm of the last solve.
+		 */
+		T_RScalar residual() const;
+
+		/**
+		 * @brief The relative residual norm history of the last solve.
+		 * @return The relative residual norms, starting with the initial one (iteration 0).
+		 */
+		const std::vector<T_RScalar>& history() const;
+
+	protected:
+		virtual uint_t numWorkVectors() const = 0;
+		virtual void iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X) = 0;
+
+		T_Vector& work(uint_t i);
+		bool preconditioned() const;
+		void precondition(const T_Vector& R, T_Vector& Z) const;
+		void setReferenceNorm(T_RScalar nrm);
+		bool monitor(T_RScalar resnorm);
+
+	private:
+		T_RScalar m_tolerance;
+		uint_t m_maxIterations;
+		const Preconditioner<T_Vector>* m_preconditioner;
+
+		bool m_converged;
+		T_RScalar m_refnorm;
+		std::vector<T_RScalar> m_history;
+		std::vector<T_Vector> m_work;
+
+		void reserveWorkspace(uint_t n);
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_ISOLVER_BASE_HPP_
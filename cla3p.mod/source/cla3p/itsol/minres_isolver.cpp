@@ -0,0 +1,158 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/minres_isolver.hpp"
+
+// system
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverMINRES<T_Vector>::ISolverMINRES()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+ISolverMINRES<T_Vector>::~ISolverMINRES()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t ISolverMINRES<T_Vector>::numWorkVectors() const
+{
+	return 7;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_RScalar = typename TypeTraits<T_Scalar>::real_type>
+static T_RScalar minres_mnorm(uint_t n, const T_Scalar *r, const T_Scalar *z)
+{
+	T_RScalar rz = arith::getRe(bulk::dns::vec_dotc(n, r, z));
+
+	if(rz < 0) {
+		throw err::InvalidOp("Preconditioner is not positive definite");
+	} // indefinite
+
+	return std::sqrt(rz);
+}
+/*-------------------------------------------------*/
+//
+// Lanczos process with the recurrences of Paige & Saunders
+// For hermitian operators all Lanczos coefficients are real
+//
+template <typename T_Vector>
+void ISolverMINRES<T_Vector>::iterate(const Operator<T_Vector>& A, const T_Vector& B, T_Vector& X)
+{
+	uint_t n = B.size();
+
+	T_Vector *R1 = &this->work(0);
+	T_Vector *R2 = &this->work(1);
+	T_Vector *Y  = &this->work(2);
+	T_Vector *V  = &this->work(3);
+	T_Vector *W  = &this->work(4);
+	T_Vector *W1 = &this->work(5);
+	T_Vector *W2 = &this->work(6);
+
+	if(this->preconditioned()) {
+		this->precondition(B, *Y);
+		this->setReferenceNorm(minres_mnorm(n, B.values(), Y->values()));
+	} // preconditioned reference norm
+
+	A.apply(X, *Y);
+	bulk::dns::vec_waxpy_nrm2sq(n, B.values(), T_Scalar(-1), Y->values(), R1->values());
+	this->precondition(*R1, *Y);
+
+	T_RScalar beta1 = minres_mnorm(n, R1->values(), Y->values());
+
+	if(this->monitor(beta1)) return;
+
+	bulk::dns::vec_axpby(n, T_Scalar(1), R1->values(), T_Scalar(0), R2->values());
+	*W  = T_Scalar(0);
+	*W2 = T_Scalar(0);
+
+	T_RScalar oldb   = 0;
+	T_RScalar beta   = beta1;
+	T_RScalar dbar   = 0;
+	T_RScalar epsln  = 0;
+	T_RScalar phibar = beta1;
+	T_RScalar cs     = -1;
+	T_RScalar sn     = 0;
+
+	for(uint_t it = 0; ; it++) {
+
+		bulk::dns::vec_axpby(n, T_Scalar(1 / beta), Y->values(), T_Scalar(0), V->values());
+		A.apply(*V, *Y);
+
+		if(it) {
+			bulk::dns::vec_axpby(n, T_Scalar(-beta / oldb), R1->values(), T_Scalar(1), Y->values());
+		} // three-term recurrence
+
+		T_RScalar alfa = arith::getRe(bulk::dns::vec_dotc(n, V->values(), Y->values()));
+		bulk::dns::vec_axpby(n, T_Scalar(-alfa / beta), R2->values(), T_Scalar(1), Y->values());
+
+		std::swap(R1, R2); // R1 <- R2
+		std::swap(R2, Y);  // R2 <- Y, Y is free
+
+		this->precondition(*R2, *Y);
+
+		oldb = beta;
+		beta = minres_mnorm(n, R2->values(), Y->values());
+
+		T_RScalar oldeps = epsln;
+		T_RScalar delta = cs * dbar + sn * alfa;
+		T_RScalar gbar  = sn * dbar - cs * alfa;
+		epsln = sn * beta;
+		dbar  = -cs * beta;
+
+		T_RScalar gamma = std::max(std::hypot(gbar, beta), TypeTraits<T_Scalar>::epsilon());
+		cs = gbar / gamma;
+		sn = beta / gamma;
+
+		T_RScalar phi = cs * phibar;
+		phibar = sn * phibar;
+
+		std::swap(W1, W2); // W1 <- W2
+		std::swap(W2, W);  // W2 <- W, W is free
+
+		bulk::dns::vec_minres_update(n, 1 / gamma, oldeps, delta, phi, 
+				V->values(), W1->values(), W2->values(), W->values(), X.values());
+
+		if(this->monitor(std::abs(phibar))) break;
+		if(beta == T_RScalar(0)) break; // invariant subspace
+
+	} // iterations
+}
+/*-------------------------------------------------*/
+template class ISolverMINRES<dns::RdVector>;
+template class ISolverMINRES<dns::RfVector>;
+template class ISolverMINRES<dns::CdVector>;
+template class ISolverMINRES<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
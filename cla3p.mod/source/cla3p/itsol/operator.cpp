@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/operator.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/algebra/functional_multmv.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Vector>
+Operator<T_Vector>::Operator()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+Operator<T_Vector>::~Operator()
+{
+}
+/*-------------------------------------------------*/
+template class Operator<dns::RdVector>;
+template class Operator<dns::RfVector>;
+template class Operator<dns::CdVector>;
+template class Operator<dns::CfVector>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixOperator<T_Matrix>::MatrixOperator(const T_Matrix& mat)
+	: m_mat(mat)
+{
+	if(mat.nrows() != mat.ncols()) {
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+MatrixOperator<T_Matrix>::~MatrixOperator()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t MatrixOperator<T_Matrix>::size() const
+{
+	return m_mat.nrows();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void MatrixOperator<T_Matrix>::apply(const T_Vector& X, T_Vector& Y) const
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	Y = T_Scalar(0);
+	ops::mult(T_Scalar(1), op_t::N, m_mat, X, Y);
+}
+/*-------------------------------------------------*/
+template class MatrixOperator<dns::RdMatrix>;
+template class MatrixOperator<dns::RfMatrix>;
+template class MatrixOperator<dns::CdMatrix>;
+template class MatrixOperator<dns::CfMatrix>;
+template class MatrixOperator<csc::RdMatrix>;
+template class MatrixOperator<csc::RfMatrix>;
+template class MatrixOperator<csc::CdMatrix>;
+template class MatrixOperator<csc::CfMatrix>;
+template class MatrixOperator<csr::RdMatrix>;
+template class MatrixOperator<csr::RfMatrix>;
+template class MatrixOperator<csr::CdMatrix>;
+template class MatrixOperator<csr::CfMatrix>;
+template class MatrixOperator<bsr::RdMatrix>;
+template class MatrixOperator<bsr::RfMatrix>;
+template class MatrixOperator<bsr::CdMatrix>;
+template class MatrixOperator<bsr::CfMatrix>;
+template class MatrixOperator<csc::RdSellMatrix>;
+template class MatrixOperator<csc::RfSellMatrix>;
+template class MatrixOperator<csc::CdSellMatrix>;
+template class MatrixOperator<csc::CfSellMatrix>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Vector>
+FunctionOperator<T_Vector>::FunctionOperator(uint_t n, const T_Function& func)
+	: m_size(n), m_func(func)
+{
+	if(!m_func) {
+		throw err::InvalidOp("Empty operator callback");
+	} // callback
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+FunctionOperator<T_Vector>::~FunctionOperator()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+uint_t FunctionOperator<T_Vector>::size() const
+{
+	return m_size;
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+void FunctionOperator<T_Vector>::apply(const T_Vector& X, T_Vector& Y) const
+{
+	m_func(X, Y);
+}
+/*-------------------------------------------------*/
+template class FunctionOperator<dns::RdVector>;
+template class FunctionOperator<dns::RfVector>;
+template class FunctionOperator<dns::CdVector>;
+template class FunctionOperator<dns::CfVector>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_OPERATOR_HPP_
+#define CLA3P_ITSOL_OPERATOR_HPP_
+
+/**
+ * @file
+ * Linear operators for iterative solvers
+ */
+
+#include <functional>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The abstract square linear operator.
+ *
+ * Iterative solvers access the system matrix only through operator applications.
+ */
+template <typename T_Vector>
+class Operator {
+
+	public:
+		Operator();
+		virtual ~Operator();
+
+		/**
+		 * @brief The operator dimension.
+		 * @return The number of rows (and columns) of the operator.
+		 */
+		virtual uint_t size() const = 0;
+
+		/**
+		 * @brief Applies the operator.
+		 *
+		 * Performs the operation <b>Y := A * X</b>
+		 *
+		 * @param[in] X The input vector.
+		 * @param[out] Y The output vector, already sized.
+		 */
+		virtual void apply(const T_Vector& X, T_Vector& Y) const = 0;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The matrix linear operator.
+ *
+ * Wraps a dense (dns::XxMatrix) or sparse (csc::XxMatrix, csr::XxMatrix, bsr::XxMatrix, csc::SellMatrix) matrix, 
+ * using the library matrix-vector kernels. The matrix is referenced, not copied.
+ */
+template <typename T_Matrix>
+class MatrixOperator : public Operator<typename TypeTraits<T_Matrix>::vector_type> {
+
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		MatrixOperator(const MatrixOperator&) = delete;
+		MatrixOperator& operator=(const MatrixOperator&) = delete;
+
+		/**
+		 * @brief The matrix constructor.
+		 * @param[in] mat The square matrix, must outlive the operator.
+		 */
+		explicit MatrixOperator(const T_Matrix& mat);
+		~MatrixOperator();
+
+		/**
+		 * @copydoc cla3p::itsol::Operator::size()
+		 */
+		uint_t size() const override;
+
+		/**
+		 * @copydoc cla3p::itsol::Operator::apply()
+		 */
+		void apply(const T_Vector& X, T_Vector& Y) const override;
+
+	private:
+		const T_Matrix& m_mat;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The user-defined (matrix-free) linear operator.
+ */
+template <typename T_Vector>
+class FunctionOperator : public Operator<T_Vector> {
+
+	public:
+
+		/**
+		 * @brief The callback type, must perform <b>Y := A * X</b>.
+		 */
+		using T_Function = std::function<void(const T_Vector& X, T_Vector& Y)>;
+
+		/**
+		 * @brief The callback constructor.
+		 * @param[in] n The operator dimension.
+		 * @param[in] func The operator callback.
+		 */
+		explicit FunctionOperator(uint_t n, const T_Function& func);
+		~FunctionOperator();
+
+		/**
+		 * @copydoc cla3p::itsol::Operator::size()
+		 */
+		uint_t size() const override;
+
+		/**
+		 * @copydoc cla3p::itsol::Operator::apply()
+		 */
+		void apply(const T_Vector& X, T_Vector& Y) const override;
+
+	private:
+		uint_t m_size;
+		T_Function m_func;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_OPERATOR_HPP_
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/itsol/preconditioner.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/dns_fused.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace itsol {
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Matrix>
+static void extract_diagonal(const dns::XxMatrix<T_Scalar,T_Matrix>& mat, T_Scalar *d)
+{
+	for(uint_t i = 0; i < mat.nrows(); i++) {
+		d[i] = mat.values()[i + i * mat.ld()];
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void extract_diagonal(const csc::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat, T_Scalar *d)
+{
+	for(uint_t j = 0; j < mat.ncols(); j++) {
+		d[j] = 0;
+		for(T_Int irow = mat.colptr()[j]; irow < mat.colptr()[j+1]; irow++) {
+			if(mat.rowidx()[irow] == static_cast<T_Int>(j)) d[j] += mat.values()[irow];
+		} // irow
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+static void extract_diagonal(const csr::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat, T_Scalar *d)
+{
+	for(uint_t i = 0; i < mat.nrows(); i++) {
+		d[i] = 0;
+		for(T_Int jcol = mat.rowptr()[i]; jcol < mat.rowptr()[i+1]; jcol++) {
+			if(mat.colidx()[jcol] == static_cast<T_Int>(i)) d[i] += mat.values()[jcol];
+		} // jcol
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+Preconditioner<T_Vector>::Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Vector>
+Preconditioner<T_Vector>::~Preconditioner()
+{
+}
+/*-------------------------------------------------*/
+template class Preconditioner<dns::RdVector>;
+template class Preconditioner<dns::RfVector>;
+template class Preconditioner<dns::CdVector>;
+template class Preconditioner<dns::CfVector>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+JacobiPreconditioner<T_Matrix>::JacobiPreconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+JacobiPreconditioner<T_Matrix>::JacobiPreconditioner(const T_Matrix& mat)
+{
+	compute(mat);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+JacobiPreconditioner<T_Matrix>::~JacobiPreconditioner()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void JacobiPreconditioner<T_Matrix>::compute(const T_Matrix& mat)
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	if(mat.nrows() != mat.ncols()) {
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+
+	m_invdiag = T_Vector(mat.nrows());
+
+	T_Scalar *d = m_invdiag.values();
+	extract_diagonal(mat, d);
+
+	for(uint_t i = 0; i < m_invdiag.size(); i++) {
+		if(d[i] == T_Scalar(0)) {
+			throw err::InvalidOp(msg::DivisionByZero());
+		} // zero diagonal
+		d[i] = arith::inv(d[i]);
+	} // i
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void JacobiPreconditioner<T_Matrix>::apply(const T_Vector& R, T_Vector& Z) const
+{
+	if(R.size() != m_invdiag.size() || Z.size() != m_invdiag.size()) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	bulk::dns::vec_diag_x_vec(R.size(), m_invdiag.values(), R.values(), Z.values());
+}
+/*-------------------------------------------------*/
+template class JacobiPreconditioner<dns::RdMatrix>;
+template class JacobiPreconditioner<dns::RfMatrix>;
+template class JacobiPreconditioner<dns::CdMatrix>;
+template class JacobiPreconditioner<dns::CfMatrix>;
+template class JacobiPreconditioner<csc::RdMatrix>;
+template class JacobiPreconditioner<csc::RfMatrix>;
+template class JacobiPreconditioner<csc::CdMatrix>;
+template class JacobiPreconditioner<csc::CfMatrix>;
+template class JacobiPreconditioner<csr::RdMatrix>;
+template class JacobiPreconditioner<csr::RfMatrix>;
+template class JacobiPreconditioner<csr::CdMatrix>;
+template class JacobiPreconditioner<csr::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
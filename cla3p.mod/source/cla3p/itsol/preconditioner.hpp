@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_ITSOL_PRECONDITIONER_HPP_
+#define CLA3P_ITSOL_PRECONDITIONER_HPP_
+
+/**
+ * @file
+ * Preconditioners for iterative solvers
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace itsol { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The abstract preconditioner.
+ *
+ * A preconditioner approximates the inverse of the system operator.
+ */
+template <typename T_Vector>
+class Preconditioner {
+
+	public:
+		Preconditioner();
+		virtual ~Preconditioner();
+
+		/**
+		 * @brief Applies the preconditioner.
+		 *
+		 * Performs the operation <b>Z := inv(M) * R</b>
+		 *
+		 * @param[in] R The input vector.
+		 * @param[out] Z The output vector, already sized.
+		 */
+		virtual void apply(const T_Vector& R, T_Vector& Z) const = 0;
+};
+
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_itsol
+ * @nosubgrouping
+ * @brief The Jacobi (diagonal) preconditioner.
+ */
+template <typename T_Matrix>
+class JacobiPreconditioner : public Preconditioner<typename TypeTraits<T_Matrix>::vector_type> {
+
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		JacobiPreconditioner(const JacobiPreconditioner&) = delete;
+		JacobiPreconditioner& operator=(const JacobiPreconditioner&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty preconditioner.
+		 */
+		JacobiPreconditioner();
+
+		/**
+		 * @brief The matrix constructor.
+		 * @param[in] mat The square matrix, all diagonal elements must be non-zero.
+		 */
+		explicit JacobiPreconditioner(const T_Matrix& mat);
+		~JacobiPreconditioner();
+
+		/**
+		 * @brief Computes the preconditioner from a matrix.
+		 * @param[in] mat The square matrix, all diagonal elements must be non-zero.
+		 */
+		void compute(const T_Matrix& mat);
+
+		/**
+		 * @copydoc cla3p::itsol::Preconditioner::apply()
+		 */
+		void apply(const T_Vector& R, T_Vector& Z) const override;
+
+	private:
+		T_Vector m_invdiag;
+};
+
+/*-------------------------------------------------*/
+} // namespace itsol
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_ITSOL_PRECONDITIONER_HPP_
@@ -23,5 +23,16 @@
 #include "cla3p/linsol/dns_ldlt_lsolver.hpp"
 #include "cla3p/linsol/dns_lu_lsolver.hpp"
 #include "cla3p/linsol/dns_complete_lu_lsolver.hpp"
+#include "cla3p/linsol/dns_batch_lu_lsolver.hpp"
+#include "cla3p/linsol/dns_mixed_lsolver.hpp"
+#include "cla3p/linsol/dns_qr_lsolver.hpp"
+#include "cla3p/linsol/dns_ooc_lsolver.hpp"
+#include "cla3p/linsol/dns_rfp_llt_lsolver.hpp"
+#include "cla3p/linsol/dns_band_lsolver.hpp"
+#include "cla3p/linsol/dns_tridiagonal_lsolver.hpp"
+#include "cla3p/linsol/csc_lsolver_base.hpp"
+#include "cla3p/linsol/csc_llt_lsolver.hpp"
+#include "cla3p/linsol/csc_ldlt_lsolver.hpp"
+#include "cla3p/linsol/csc_lu_lsolver.hpp"
 
 #endif // CLA3P_LINSOL_HPP_
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/csc_llt_lsolver.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+
+#include "cla3p/checks/decomp_llt_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverLLt<T_Matrix>::LSolverLLt()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverLLt<T_Matrix>::~LSolverLLt()
+{
+	this->clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverLLt<T_Matrix>::analyze(const T_Matrix& mat)
+{
+	llt_decomp_input_check(mat);
+	this->absorbInput(mat, mat.prop().type(), true);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverLLt<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	analyze(mat);
+	this->fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverLLt<T_Matrix>::idecompose(T_Matrix& mat)
+{
+	decompose(mat);
+	mat.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverLLt<T_Matrix>::solve(T_DnsMatrix& rhs) const
+{
+	this->fsolve(rhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverLLt<T_Matrix>::solve(T_DnsVector& rhs) const
+{
+	LSolverBase<T_Matrix>::solve(rhs);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LSolverLLt<RdMatrix>;
+template class LSolverLLt<RfMatrix>;
+template class LSolverLLt<CdMatrix>;
+template class LSolverLLt<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_LLT_LSOLVER_HPP_
+#define CLA3P_CSC_LLT_LSOLVER_HPP_
+
+/**
+ * @file
+ * Cholesky LLt sparse linear solver
+ */
+
+#include "cla3p/linsol/csc_lsolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_sparse
+ * @nosubgrouping
+ * @brief The definite Cholesky (LL') linear solver for sparse matrices.
+ */
+template <typename T_Matrix>
+class LSolverLLt : public LSolverBase<T_Matrix> {
+
+	using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+	using T_DnsVector = typename TypeTraits<T_DnsMatrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverLLt(const LSolverLLt&) = delete;
+		LSolverLLt& operator=(const LSolverLLt&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverLLt();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverLLt();
+
+		using LSolverBase<T_Matrix>::analyze;
+		using LSolverBase<T_Matrix>::decompose;
+
+		/**
+		 * @copydoc cla3p::csc::LSolverBase::analyze()
+		 */
+		void analyze(const T_Matrix& mat) override;
+
+		/**
+		 * @copydoc cla3p::csc::LSolverBase::decompose()
+		 */
+		void decompose(const T_Matrix& mat) override;
+
+		/**
+		 * @copydoc cla3p::csc::LSolverBase::idecompose()
+		 */
+		void idecompose(T_Matrix& mat) override;
+
+		/**
+		 * @copydoc cla3p::csc::LSolverBase::solve(T_DnsMatrix& rhs) const
+		 */
+		void solve(T_DnsMatrix& rhs) const override;
+
+		/**
+		 * @copydoc cla3p::csc::LSolverBase::solve(T_DnsVector& rhs) const
+		 */
+		void solve(T_DnsVector& rhs) const override;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_LLT_LSOLVER_HPP_
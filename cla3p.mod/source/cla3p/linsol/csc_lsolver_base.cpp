@@ -0,0 +1,265 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/csc_lsolver_base.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/proxies/mkl_pardiso_proxy.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+#include "cla3p/checks/solve_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csc { 
+/*-------------------------------------------------*/
+//
+// Sorts the column indexes of each row (if needed) & for symmetric types 
+// inserts explicit zeros for missing diagonal elements, both are solver requirements
+//
+template <typename T_CsrMatrix>
+static void sanitize_csr(T_CsrMatrix& mat, bool need_diag)
+{
+	using T_Int    = typename T_CsrMatrix::index_type;
+	using T_Scalar = typename T_CsrMatrix::value_type;
+
+	uint_t n = mat.nrows();
+	const T_Int *rowptr = mat.rowptr();
+	const T_Int *colidx = mat.colidx();
+
+	bool sorted = true;
+	uint_t nmiss = 0;
+
+	for(uint_t i = 0; i < n; i++) {
+		for(T_Int jcol = rowptr[i] + 1; jcol < rowptr[i+1]; jcol++) {
+			if(colidx[jcol - 1] > colidx[jcol]) sorted = false;
+		} // jcol
+	} // i
+
+	if(!sorted) {
+		bulk::csc::sort(n, mat.rowptr(), mat.colidx(), mat.values());
+	} // sort
+
+	if(!need_diag) return;
+
+	for(uint_t i = 0; i < n; i++) {
+		if(rowptr[i] == rowptr[i+1] || colidx[rowptr[i]] != static_cast<T_Int>(i)) nmiss++;
+	} // i
+
+	if(!nmiss) return;
+
+	uint_t nz = mat.nnz() + nmiss;
+
+	T_Int    *rptr = i_malloc<T_Int>(n + 1);
+	T_Int    *cidx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+	T_Int cnt = 0;
+	rptr[0] = 0;
+
+	for(uint_t i = 0; i < n; i++) {
+
+		if(rowptr[i] == rowptr[i+1] || colidx[rowptr[i]] != static_cast<T_Int>(i)) {
+			cidx[cnt] = i;
+			vals[cnt] = 0;
+			cnt++;
+		} // missing diagonal
+
+		for(T_Int jcol = rowptr[i]; jcol < rowptr[i+1]; jcol++) {
+			cidx[cnt] = colidx[jcol];
+			vals[cnt] = mat.values()[jcol];
+			cnt++;
+		} // jcol
+
+		rptr[i+1] = cnt;
+
+	} // i
+
+	mat = T_CsrMatrix::wrap(n, n, rptr, cidx, vals, true, mat.prop());
+}
+/*-------------------------------------------------*/
+template <typename T_CsrMatrix>
+static bool same_pattern(const T_CsrMatrix& a, const T_CsrMatrix& b)
+{
+	if(a.empty() || b.empty()) return false;
+	if(a.nrows() != b.nrows() || a.nnz() != b.nnz()) return false;
+
+	return (std::equal(a.rowptr(), a.rowptr() + a.nrows() + 1, b.rowptr()) && 
+			std::equal(a.colidx(), a.colidx() + a.nnz(), b.colidx()));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBase<T_Matrix>::LSolverBase()
+	: m_pardiso(nullptr)
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBase<T_Matrix>::~LSolverBase()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::defaults()
+{
+	m_ptype = prop_t::General;
+	m_definite = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::clear()
+{
+	clearAll();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::clearAll()
+{
+	delete m_pardiso;
+	m_pardiso = nullptr;
+
+	m_matrix.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t LSolverBase<T_Matrix>::factorNnz() const
+{
+	return (m_pardiso ? m_pardiso->factorNnz() : 0);
+}
+/*-------------------------------------------------*/
+//
+// The solver requires csr format (upper part for symmetric/hermitian matrices)
+// The lower csc arrays of A are the upper csr arrays of A^T, 
+// which is A for symmetric & conj(A) for hermitian matrices
+//
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::absorbInput(const T_Matrix& mat, prop_t ptype, bool definite)
+{
+	T_CsrMatrix tmp;
+
+	if(ptype == prop_t::General) {
+
+		tmp = (mat.prop().isGeneral() ? mat.toCsr() : mat.general().toCsr());
+
+	} else if(mat.prop().isLower()) {
+
+		tmp = mat.rtranspose().get().copy();
+		if(mat.prop().isHermitian()) tmp.iconjugate();
+
+	} else {
+
+		tmp = mat.toCsr();
+
+	} // ptype
+
+	sanitize_csr(tmp, ptype != prop_t::General);
+
+	bool reuse = (m_pardiso && m_ptype == ptype && m_definite == definite && 
+			m_pardiso->analyzed() && same_pattern(m_matrix, tmp));
+
+	m_matrix = tmp.move();
+
+	if(reuse) return;
+
+	if(!m_pardiso || m_ptype != ptype || m_definite != definite) {
+		delete m_pardiso;
+		m_pardiso = nullptr;
+		m_pardiso = new mkl::Pardiso<T_Scalar>(ptype, definite);
+		m_ptype = ptype;
+		m_definite = definite;
+	} // create
+
+	m_pardiso->analyze(m_matrix.nrows(), m_matrix.rowptr(), m_matrix.colidx(), m_matrix.values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::fdecompose()
+{
+	m_pardiso->factorize(m_matrix.nrows(), m_matrix.rowptr(), m_matrix.colidx(), m_matrix.values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::fsolve(T_DnsMatrix& rhs) const
+{
+	if(!m_pardiso || !m_pardiso->factorized()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty factor
+
+	default_solve_input_check(m_matrix.ncols(), rhs);
+
+	uint_t n = rhs.nrows();
+	uint_t nrhs = rhs.ncols();
+
+	T_DnsMatrix X(n, nrhs);
+
+	if(rhs.ld() == n) {
+
+		m_pardiso->solve(n, m_matrix.rowptr(), m_matrix.colidx(), m_matrix.values(), nrhs, rhs.values(), X.values());
+
+	} else {
+
+		T_DnsMatrix B = rhs.copy();
+		m_pardiso->solve(n, m_matrix.rowptr(), m_matrix.colidx(), m_matrix.values(), nrhs, B.values(), X.values());
+
+	} // contiguous rhs
+
+	bulk::dns::copy(uplo_t::Full, n, nrhs, X.values(), X.ld(), rhs.values(), rhs.ld());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::analyze(const T_BsrMatrix& mat)
+{
+	analyze(mat.toCsc());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::decompose(const T_BsrMatrix& mat)
+{
+	decompose(mat.toCsc());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBase<T_Matrix>::solve(T_DnsVector& rhs) const
+{
+	T_DnsMatrix tmp = rhs.rmatrix();
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LSolverBase<RdMatrix>;
+template class LSolverBase<RfMatrix>;
+template class LSolverBase<CdMatrix>;
+template class LSolverBase<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
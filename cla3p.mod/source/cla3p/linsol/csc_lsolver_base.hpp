@@ -0,0 +1,146 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_LSOLVER_BASE_HPP_
+#define CLA3P_CSC_LSOLVER_BASE_HPP_
+
+/**
+ * @file
+ * Base class for sparse linear solvers
+ */
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace mkl { template <typename T_Scalar> class Pardiso; }
+namespace csc { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_sparse
+ * @nosubgrouping
+ * @brief The abstract linear solver base for sparse matrices.
+ *
+ * Sparse solvers split the decomposition in a symbolic stage (fill-reducing ordering, elimination tree & symbolic factorization) 
+ * and a numerical stage. The symbolic stage is performed once and is reused by every subsequent decomposition 
+ * of a matrix with the same sparsity pattern. All stages are multithreaded.
+ */
+template <typename T_Matrix>
+class LSolverBase {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+	using T_DnsVector = typename TypeTraits<T_DnsMatrix>::vector_type;
+	using T_CsrMatrix = typename TypeTraits<T_Matrix>::csr_type;
+	using T_BsrMatrix = typename TypeTraits<T_Matrix>::bsr_type;
+
+	public:
+
+		// no copy
+		LSolverBase(const LSolverBase&) = delete;
+		LSolverBase& operator=(const LSolverBase&) = delete;
+
+		LSolverBase();
+		~LSolverBase();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		virtual void clear();
+
+		/**
+		 * @brief Performs the symbolic analysis of a matrix.
+		 *
+		 * Computes a fill-reducing ordering & the symbolic factorization of `mat`.
+		 * A subsequent decompose() with a matrix of the same sparsity pattern performs only the numerical stage.
+		 *
+		 * @param[in] mat The matrix to be analyzed.
+		 */
+		virtual void analyze(const T_Matrix& mat) = 0;
+
+		/**
+		 * @brief Performs matrix decomposition.
+		 *
+		 * The symbolic analysis is reused if the sparsity pattern of `mat` matches the analyzed one, otherwise it is recomputed.
+		 *
+		 * @param[in] mat The matrix to be decomposed.
+		 */
+		virtual void decompose(const T_Matrix& mat) = 0;
+
+		/**
+		 * @brief Performs in-place matrix decomposition.
+		 * @param[in] mat The matrix to be decomposed, destroyed after the operation.
+		 */
+		virtual void idecompose(T_Matrix& mat) = 0;
+
+		/**
+		 * @brief Performs the symbolic analysis of a block sparse matrix.
+		 *
+		 * The matrix is converted to csc before the analysis.
+		 *
+		 * @param[in] mat The matrix to be analyzed.
+		 */
+		void analyze(const T_BsrMatrix& mat);
+
+		/**
+		 * @brief Performs block sparse matrix decomposition.
+		 *
+		 * The matrix is converted to csc before the decomposition.
+		 *
+		 * @param[in] mat The matrix to be decomposed.
+		 */
+		void decompose(const T_BsrMatrix& mat);
+
+		/**
+		 * @brief Performs in-place matrix solution.
+		 * @param[in] rhs The right hand side matrix, overwritten with the solution.
+		 */
+		virtual void solve(T_DnsMatrix& rhs) const = 0;
+
+		/**
+		 * @brief Performs in-place vector solution.
+		 * @param[in] rhs The right hand side vector, overwritten with the solution.
+		 */
+		virtual void solve(T_DnsVector& rhs) const;
+
+		/**
+		 * @brief The number of non-zero elements in the factors.
+		 * @return The factor non-zero elements estimated by the symbolic analysis, 0 if no analysis is performed.
+		 */
+		uint_t factorNnz() const;
+
+	protected:
+		void absorbInput(const T_Matrix& mat, prop_t ptype, bool definite);
+		void fdecompose();
+		void fsolve(T_DnsMatrix& rhs) const;
+		void clearAll();
+
+	private:
+		prop_t m_ptype;
+		bool m_definite;
+		T_CsrMatrix m_matrix;
+		mkl::Pardiso<T_Scalar>* m_pardiso;
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_LSOLVER_BASE_HPP_
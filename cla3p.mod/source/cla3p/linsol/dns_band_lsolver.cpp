@@ -0,0 +1,173 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_band_lsolver.hpp"
+
+// system
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBand<T_Matrix>::LSolverBand()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBand<T_Matrix>::~LSolverBand()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::clear()
+{
+	m_factor.clear();
+	m_ipiv.clear();
+}
+/*-------------------------------------------------*/
+//
+// The LU factor of a General matrix needs kl extra super-diagonals, 
+// the band of column j is placed below the first kl rows
+//
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::absorbInput(const BandMatrix<T_Matrix>& mat)
+{
+	using T_Scalar = typename T_Matrix::value_type;
+
+	m_factor = BandMatrix<T_Matrix>(mat.nrows(), mat.ncols(), mat.kl(), mat.kl() + mat.ku(), mat.prop());
+
+	for(uint_t j = 0; j < mat.ncols(); j++) {
+		const T_Scalar *src = mat.values() + static_cast<bulk_t>(j) * mat.ld();
+		T_Scalar *dst = m_factor.values() + static_cast<bulk_t>(j) * m_factor.ld() + mat.kl();
+		std::copy(src, src + mat.ld(), dst);
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::decompose(const BandMatrix<T_Matrix>& mat)
+{
+	clear();
+
+	if(mat.prop().isGeneral()) absorbInput(mat);
+	else                       m_factor = mat.copy();
+
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::idecompose(BandMatrix<T_Matrix>& mat)
+{
+	clear();
+
+	if(mat.prop().isGeneral()) {
+		absorbInput(mat);
+		mat.clear();
+	} else {
+		m_factor = mat.move();
+	} // prop
+
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t LSolverBand<T_Matrix>::kl() const { return m_factor.kl(); }
+template <typename T_Matrix> uint_t LSolverBand<T_Matrix>::ku() const { return m_factor.prop().isGeneral() ? m_factor.ku() - m_factor.kl() : m_factor.ku(); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::fdecompose()
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	} // empty
+
+	if(m_factor.nrows() != m_factor.ncols()) {
+		clear();
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+
+	const Property& pr = m_factor.prop();
+	uint_t n = m_factor.ncols();
+	int_t info = 0;
+
+	if(pr.isGeneral()) {
+		m_ipiv.resize(n);
+		info = lapack::gbtrf(n, n, kl(), ku(), m_factor.values(), m_factor.ld(), m_ipiv.data());
+	} else {
+		uint_t kd = (pr.isLower() ? kl() : ku());
+		info = lapack::pbtrf(pr.cuplo(), n, kd, m_factor.values(), m_factor.ld());
+	} // prop
+
+	if(info) {
+		clear();
+		lapack_info_check(info);
+	} // info
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty
+
+	default_solve_input_check(m_factor.ncols(), rhs);
+
+	const Property& pr = m_factor.prop();
+	uint_t n = m_factor.ncols();
+	int_t info = 0;
+
+	if(pr.isGeneral()) {
+		info = lapack::gbtrs('N', n, kl(), ku(), rhs.ncols(), 
+				m_factor.values(), m_factor.ld(), m_ipiv.data(), 
+				rhs.values(), rhs.ld());
+	} else {
+		uint_t kd = (pr.isLower() ? kl() : ku());
+		info = lapack::pbtrs(pr.cuplo(), n, kd, rhs.ncols(), 
+				m_factor.values(), m_factor.ld(), 
+				rhs.values(), rhs.ld());
+	} // prop
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBand<T_Matrix>::solve(T_Vector& rhs) const
+{
+	T_Matrix tmp = rhs.rmatrix();
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+template class LSolverBand<RdMatrix>;
+template class LSolverBand<RfMatrix>;
+template class LSolverBand<CdMatrix>;
+template class LSolverBand<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
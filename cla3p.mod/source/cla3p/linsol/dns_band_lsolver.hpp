@@ -0,0 +1,115 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_BAND_LSOLVER_HPP_
+#define CLA3P_DNS_BAND_LSOLVER_HPP_
+
+/**
+ * @file
+ * Linear solver for matrices in band storage
+ */
+
+#include <vector>
+
+#include "cla3p/dense.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The linear solver for dense matrices in band storage.
+ *
+ * General matrices are factorized with partial pivoting LU, 
+ * the factor needs kl additional super-diagonals for the fill-in caused by pivoting.@n
+ * Symmetric (real) & Hermitian (complex) positive definite matrices are factorized with LL', 
+ * the factor has the band of the input matrix.
+ */
+template <typename T_Matrix>
+class LSolverBand {
+
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverBand(const LSolverBand&) = delete;
+		LSolverBand& operator=(const LSolverBand&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverBand();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverBand();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the matrix decomposition.
+		 * @param[in] mat The square matrix to be decomposed, it is copied internally.
+		 */
+		void decompose(const BandMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Performs the matrix decomposition.
+		 *
+		 * Symmetric/Hermitian matrices are decomposed in-place, 
+		 * General matrices are copied to the extended band storage of the LU factor.
+		 *
+		 * @param[in,out] mat The square matrix to be decomposed, destroyed after the operation.
+		 */
+		void idecompose(BandMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side matrix, General.
+		 */
+		void solve(T_Matrix& rhs) const;
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side vector.
+		 */
+		void solve(T_Vector& rhs) const;
+
+	private:
+		BandMatrix<T_Matrix> m_factor;
+		std::vector<int_t> m_ipiv;
+
+		void absorbInput(const BandMatrix<T_Matrix>& mat);
+		void fdecompose();
+		uint_t kl() const;
+		uint_t ku() const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_BAND_LSOLVER_HPP_
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_batch_lu_lsolver.hpp"
+
+// system
+#include <string>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/bulk/dns_batch.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBatchLU<T_Matrix>::LSolverBatchLU()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBatchLU<T_Matrix>::~LSolverBatchLU()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchLU<T_Matrix>::clear()
+{
+	m_factor.clear();
+	m_ipiv.clear();
+	m_info.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchLU<T_Matrix>::decompose(const MatrixBatch<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.copy();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchLU<T_Matrix>::idecompose(MatrixBatch<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.move();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchLU<T_Matrix>::fdecompose()
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	} // empty
+
+	if(m_factor.nrows() != m_factor.ncols()) {
+		throw err::InvalidOp(msg::NeedSquareMatrix());
+	} // square
+
+	uint_t n = m_factor.nrows();
+
+	m_ipiv.resize(static_cast<bulk_t>(n) * m_factor.size());
+	m_info.resize(m_factor.size());
+
+	if(m_factor.layout() == layout_t::Strided) {
+		bulk::dns::batch_getrf(n, m_factor.size(), m_factor.values(), m_factor.ld(), m_factor.stride(), m_ipiv.data(), m_info.data());
+	} else {
+		bulk::dns::batch_getrf_compact(n, m_factor.size(), m_factor.values(), m_factor.ld(), m_ipiv.data(), m_info.data());
+	} // layout
+
+	for(uint_t k = 0; k < m_factor.size(); k++) {
+		if(m_info[k]) {
+			throw err::Exception(msg::LapackError() + " info: " + std::to_string(m_info[k]) + " batch index: " + std::to_string(k));
+		} // info
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchLU<T_Matrix>::solve(MatrixBatch<T_Matrix>& rhs) const
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty factor
+
+	if(rhs.nrows() != m_factor.ncols() || rhs.size() != m_factor.size()) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	if(rhs.layout() != m_factor.layout()) {
+		throw err::NoConsistency("Batches of different layout");
+	} // layout
+
+	if(rhs.layout() == layout_t::Strided) {
+		bulk::dns::batch_getrs(m_factor.ncols(), rhs.ncols(), rhs.size(), 
+				m_factor.values(), m_factor.ld(), m_factor.stride(), m_ipiv.data(), 
+				rhs.values(), rhs.ld(), rhs.stride());
+	} else {
+		bulk::dns::batch_getrs_compact(m_factor.ncols(), rhs.ncols(), rhs.size(), 
+				m_factor.values(), m_factor.ld(), m_ipiv.data(), 
+				rhs.values(), rhs.ld());
+	} // layout
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LSolverBatchLU<RdMatrix>;
+template class LSolverBatchLU<RfMatrix>;
+template class LSolverBatchLU<CdMatrix>;
+template class LSolverBatchLU<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_BATCH_LU_LSOLVER_HPP_
+#define CLA3P_DNS_BATCH_LU_LSOLVER_HPP_
+
+/**
+ * @file
+ * Batched LU dense linear solver
+ */
+
+#include <vector>
+
+#include "cla3p/dense/dns_matrix_batch.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The partial pivoting LU linear solver for batches of small dense matrices.
+ *
+ * Every matrix of the batch is factorized & solved independently, in parallel across the batch.@n
+ * Both Strided & Compact batch layouts are supported, the right hand sides must have the layout of the factorized batch.
+ */
+template <typename T_Matrix>
+class LSolverBatchLU {
+
+	public:
+
+		// no copy
+		LSolverBatchLU(const LSolverBatchLU&) = delete;
+		LSolverBatchLU& operator=(const LSolverBatchLU&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverBatchLU();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverBatchLU();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the decomposition of all matrices of a batch.
+		 * @param[in] mat A batch of square matrices.
+		 */
+		void decompose(const MatrixBatch<T_Matrix>& mat);
+
+		/**
+		 * @brief Performs the in-place decomposition of all matrices of a batch.
+		 * @param[in] mat A batch of square matrices, destroyed after the call.
+		 */
+		void idecompose(MatrixBatch<T_Matrix>& mat);
+
+		/**
+		 * @brief Performs the solution stage for all matrices of a batch.
+		 * @param[in,out] rhs On entry, the right hand sides of each system, on exit the solutions.
+		 */
+		void solve(MatrixBatch<T_Matrix>& rhs) const;
+
+	private:
+		MatrixBatch<T_Matrix> m_factor;
+		std::vector<int_t> m_ipiv;
+		std::vector<int_t> m_info;
+
+		void fdecompose();
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_BATCH_LU_LSOLVER_HPP_
@@ -0,0 +1,385 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_mixed_lsolver.hpp"
+
+// system
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+#include "cla3p/checks/decomp_lu_checks.hpp"
+#include "cla3p/checks/decomp_llt_checks.hpp"
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+static inline uint_t mixed_default_max_iterations()
+{
+	return 30;
+}
+/*-------------------------------------------------*/
+//
+// b = a in lower precision
+//
+template <typename T_Scalar, typename T_LScalar>
+static void mixed_demote(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_LScalar *b, uint_t ldb)
+{
+	for(uint_t j = 0; j < n; j++) {
+		for(uint_t i = 0; i < m; i++) {
+			b[i + j * ldb] = static_cast<T_LScalar>(a[i + j * lda]);
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// b += a, a in lower precision
+//
+template <typename T_Scalar, typename T_LScalar>
+static void mixed_promote_add(uint_t m, uint_t n, const T_LScalar *a, uint_t lda, T_Scalar *b, uint_t ldb)
+{
+	for(uint_t j = 0; j < n; j++) {
+		for(uint_t i = 0; i < m; i++) {
+			b[i + j * ldb] += static_cast<T_Scalar>(a[i + j * lda]);
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static typename TypeTraits<T_Scalar>::real_type mixed_column_amax(uint_t m, const T_Scalar *a)
+{
+	typename TypeTraits<T_Scalar>::real_type ret = 0;
+
+	for(uint_t i = 0; i < m; i++) {
+		typename TypeTraits<T_Scalar>::real_type absAi = std::abs(a[i]);
+		if(!(absAi <= ret)) ret = absAi; // propagates NaN
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverMixed<T_Matrix>::LSolverMixed(decomp_t dtype)
+	: m_dtype(dtype)
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverMixed<T_Matrix>::LSolverMixed(uint_t n, decomp_t dtype)
+	: m_dtype(dtype)
+{
+	defaults();
+	reserve(n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverMixed<T_Matrix>::~LSolverMixed()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::defaults()
+{
+	m_tol = 0;
+	m_maxit = mixed_default_max_iterations();
+	m_anorm = 0;
+	m_iters = 0;
+	m_fallback = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::reserve(uint_t n)
+{
+	this->reserveBuffer(n);
+	if(m_dtype == decomp_t::LU) {
+		m_lipiv.reserve(n);
+	} // ipiv
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::clear()
+{
+	T_RScalar tol = m_tol;
+	uint_t maxit = m_maxit;
+
+	m_lfactor.clear();
+	m_dfactor.clear();
+	m_lipiv.clear();
+	this->clearAll();
+	defaults();
+
+	m_tol = tol;
+	m_maxit = maxit;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> void LSolverMixed<T_Matrix>::setTolerance(T_RScalar tol) { m_tol = tol; }
+template <typename T_Matrix> void LSolverMixed<T_Matrix>::setMaxIterations(uint_t maxit) { m_maxit = maxit; }
+template <typename T_Matrix> uint_t LSolverMixed<T_Matrix>::iterations() const { return m_iters; }
+template <typename T_Matrix> bool LSolverMixed<T_Matrix>::fallback() const { return m_fallback; }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename LSolverMixed<T_Matrix>::T_RScalar LSolverMixed<T_Matrix>::tolerance() const
+{
+	if(m_tol > 0)
+		return m_tol;
+
+	return std::sqrt(static_cast<T_RScalar>(this->factor().ncols())) * std::numeric_limits<T_RScalar>::epsilon();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	clear();
+
+	if(m_dtype == decomp_t::LU) lu_decomp_input_check(mat);
+	else                        llt_decomp_input_check(mat);
+
+	this->absorbInput(mat);
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::idecompose(T_Matrix& mat)
+{
+	clear();
+
+	if(m_dtype == decomp_t::LU) lu_decomp_input_check(mat);
+	else                        llt_decomp_input_check(mat);
+
+	this->factor() = mat.move();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+//
+// Factorizes a single precision copy of the matrix, factor() keeps the double precision matrix for the residuals
+//
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::fdecompose()
+{
+	const T_Matrix& A = this->factor();
+	uint_t n = A.ncols();
+
+	m_anorm = A.normInf();
+
+	m_lfactor = T_LMatrix::init(n, n, A.prop());
+	mixed_demote(n, n, A.values(), A.ld(), m_lfactor.values(), m_lfactor.ld());
+
+	if(m_dtype == decomp_t::LU) {
+
+		m_lfactor.igeneral();
+		m_lipiv.resize(n);
+
+		this->info() = lapack::getrf(n, n, m_lfactor.values(), m_lfactor.ld(), m_lipiv.data());
+
+	} else {
+
+		this->info() = lapack::potrf(m_lfactor.prop().cuplo(), n, m_lfactor.values(), m_lfactor.ld());
+
+	} // dtype
+
+	if(this->info() < 0) {
+
+		lapack_info_check(this->info());
+
+	} else if(this->info() > 0) {
+
+		fallbackDecompose();
+
+	} // info
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::fallbackDecompose() const
+{
+	m_fallback = true;
+
+	m_lfactor.clear();
+	m_lipiv.clear();
+
+	const T_Matrix& A = this->factor();
+	uint_t n = A.ncols();
+
+	m_dfactor = A.copy();
+
+	int_t info = 0;
+
+	if(m_dtype == decomp_t::LU) {
+
+		m_dfactor.igeneral();
+		m_lipiv.resize(n);
+		info = lapack::getrf(n, n, m_dfactor.values(), m_dfactor.ld(), m_lipiv.data());
+
+	} else {
+
+		info = lapack::potrf(m_dfactor.prop().cuplo(), n, m_dfactor.values(), m_dfactor.ld());
+
+	} // dtype
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::fallbackSolve(T_Matrix& rhs) const
+{
+	int_t info = 0;
+
+	if(m_dtype == decomp_t::LU) {
+		info = lapack::getrs('N', m_dfactor.ncols(), rhs.ncols(), m_dfactor.values(), m_dfactor.ld(), m_lipiv.data(), rhs.values(), rhs.ld());
+	} else {
+		info = lapack::potrs(m_dfactor.prop().cuplo(), m_dfactor.ncols(), rhs.ncols(), m_dfactor.values(), m_dfactor.ld(), rhs.values(), rhs.ld());
+	} // dtype
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::lowerSolve(T_LMatrix& rhs) const
+{
+	int_t info = 0;
+
+	if(m_dtype == decomp_t::LU) {
+		info = lapack::getrs('N', m_lfactor.ncols(), rhs.ncols(), m_lfactor.values(), m_lfactor.ld(), m_lipiv.data(), rhs.values(), rhs.ld());
+	} else {
+		info = lapack::potrs(m_lfactor.prop().cuplo(), m_lfactor.ncols(), rhs.ncols(), m_lfactor.values(), m_lfactor.ld(), rhs.values(), rhs.ld());
+	} // dtype
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+//
+// r = r - A * x, column by column
+//
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::residual(const T_Matrix& x, T_Matrix& r) const
+{
+	const T_Matrix& A = this->factor();
+	uint_t n = A.ncols();
+
+	for(uint_t k = 0; k < x.ncols(); k++) {
+
+		const T_Scalar *xk = x.values() + k * x.ld();
+		T_Scalar *rk = r.values() + k * r.ld();
+
+		if(A.prop().isGeneral()) {
+			bulk::dns::gem_x_vec(op_t::N, n, n, T_Scalar(-1), A.values(), A.ld(), xk, T_Scalar(1), rk);
+		} else if(A.prop().isSymmetric()) {
+			bulk::dns::sym_x_vec(A.prop().uplo(), n, T_Scalar(-1), A.values(), A.ld(), xk, T_Scalar(1), rk);
+		} else if(A.prop().isHermitian()) {
+			bulk::dns::hem_x_vec(A.prop().uplo(), n, T_Scalar(-1), A.values(), A.ld(), xk, T_Scalar(1), rk);
+		} else {
+			throw err::Exception("Unreachable");
+		} // prop
+
+	} // k
+}
+/*-------------------------------------------------*/
+//
+// Refinement: x += solve_lower(r), r = b - A * x until converged for all rhs
+// Stalled refinement (no contraction of the backward error) triggers the double precision fallback
+//
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(this->factor().empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty factor
+
+	default_solve_input_check(this->factor().ncols(), rhs);
+
+	m_iters = 0;
+
+	if(m_fallback) {
+		fallbackSolve(rhs);
+		return;
+	} // fallback
+
+	uint_t n = rhs.nrows();
+	uint_t nrhs = rhs.ncols();
+
+	T_Matrix b = rhs.copy();
+	T_Matrix r = rhs.copy();
+	T_LMatrix lr = T_LMatrix::init(n, nrhs);
+
+	rhs = 0;
+
+	T_RScalar tol = tolerance() * m_anorm;
+	T_RScalar errPrev = std::numeric_limits<T_RScalar>::infinity();
+
+	while(m_iters < m_maxit) {
+
+		mixed_demote(n, nrhs, r.values(), r.ld(), lr.values(), lr.ld());
+		lowerSolve(lr);
+		mixed_promote_add(n, nrhs, lr.values(), lr.ld(), rhs.values(), rhs.ld());
+
+		r.setBlock(0, 0, b);
+		residual(rhs, r);
+
+		m_iters++;
+
+		T_RScalar err = 0;
+		bool converged = true;
+
+		for(uint_t k = 0; k < nrhs; k++) {
+			T_RScalar rnorm = mixed_column_amax(n, r.values() + k * r.ld());
+			T_RScalar xnorm = mixed_column_amax(n, rhs.values() + k * rhs.ld());
+			T_RScalar errk = (xnorm > 0 ? rnorm / xnorm : rnorm);
+			converged = converged && (rnorm <= tol * xnorm);
+			if(!(errk <= err)) err = errk; // propagates NaN
+		} // k
+
+		if(converged) 
+			return;
+
+		if(!(err < errPrev / 2)) 
+			break;
+
+		errPrev = err;
+
+	} // m_iters
+
+	fallbackDecompose();
+
+	rhs.setBlock(0, 0, b);
+	fallbackSolve(rhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverMixed<T_Matrix>::solve(T_Vector& rhs) const
+{
+	LSolverBase<T_Matrix>::solve(rhs);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LSolverMixed<RdMatrix>;
+template class LSolverMixed<CdMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
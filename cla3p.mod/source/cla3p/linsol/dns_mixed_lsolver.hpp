@@ -0,0 +1,163 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_MIXED_LSOLVER_HPP_
+#define CLA3P_DNS_MIXED_LSOLVER_HPP_
+
+/**
+ * @file
+ * Mixed precision dense linear solver with iterative refinement
+ */
+
+#include "cla3p/dense.hpp"
+#include "cla3p/linsol/dns_lsolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+template <typename T_Matrix> class MixedPrecisionTraits;
+
+template <> class MixedPrecisionTraits<RdMatrix> { public: using lower_type = RfMatrix; };
+template <> class MixedPrecisionTraits<CdMatrix> { public: using lower_type = CfMatrix; };
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The mixed precision linear solver for dense matrices.
+ *
+ * The matrix is factorized in single precision (LU or LL') & the double precision solution 
+ * is recovered by iterative refinement, residuals are computed against the double precision matrix.@n
+ * If the single precision factorization fails or the refinement stalls, 
+ * the solver falls back to a double precision factorization.
+ */
+template <typename T_Matrix>
+class LSolverMixed : public LSolverBase<T_Matrix> {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+	using T_LMatrix = typename MixedPrecisionTraits<T_Matrix>::lower_type;
+
+	public:
+
+		// no copy
+		LSolverMixed(const LSolverMixed&) = delete;
+		LSolverMixed& operator=(const LSolverMixed&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object with decomposition type dtype.
+		 */
+		LSolverMixed(decomp_t dtype = decomp_t::LU);
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs a preallocated solver object with n<sup>2</sup> buffered size & decomposition type dtype.
+		 */
+		LSolverMixed(uint_t n, decomp_t dtype = decomp_t::LU);
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverMixed();
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::reserve(uint_t n)
+		 */
+		void reserve(uint_t n) override;
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::clear()
+		 */
+		void clear() override;
+
+		/**
+		 * @brief Performs matrix decomposition.
+		 * @param[in] mat The matrix to be decomposed, 
+		 *                General for LU, Symmetric (real) or Hermitian (complex) positive definite for LL'.
+		 */
+		void decompose(const T_Matrix& mat) override;
+
+		/**
+		 * @brief Performs matrix decomposition avoiding the copy of mat.
+		 * @param[in] mat The matrix to be decomposed, moved into the solver 
+		 *                (the double precision matrix is required for the residuals).
+		 */
+		void idecompose(T_Matrix& mat) override;
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::solve(T_Matrix& rhs) const
+		 */
+		void solve(T_Matrix& rhs) const override;
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::solve(T_Vector& rhs) const
+		 */
+		void solve(T_Vector& rhs) const override;
+
+		/**
+		 * @brief Sets the refinement tolerance.
+		 *
+		 * The refinement of a rhs converges if ||b - A * x||<sub>inf</sub> <= tol * ||A||<sub>inf</sub> * ||x||<sub>inf</sub>.@n
+		 * A non positive tolerance (default) selects sqrt(n) * eps.
+		 */
+		void setTolerance(T_RScalar tol);
+
+		/**
+		 * @brief Sets the maximum number of refinement steps (default 30).
+		 */
+		void setMaxIterations(uint_t maxit);
+
+		/**
+		 * @brief The number of refinement steps of the last solution stage.
+		 */
+		uint_t iterations() const;
+
+		/**
+		 * @brief Whether the solver has fallen back to a double precision factorization.
+		 */
+		bool fallback() const;
+
+	private:
+		decomp_t m_dtype;
+		T_RScalar m_tol;
+		uint_t m_maxit;
+		T_RScalar m_anorm;
+		mutable T_LMatrix m_lfactor;
+		mutable std::vector<int_t> m_lipiv;
+		mutable uint_t m_iters;
+		mutable bool m_fallback;
+		mutable T_Matrix m_dfactor;
+
+		void defaults();
+		void fdecompose();
+		void fallbackDecompose() const;
+		void fallbackSolve(T_Matrix& rhs) const;
+		void lowerSolve(T_LMatrix& rhs) const;
+		void residual(const T_Matrix& x, T_Matrix& r) const;
+		T_RScalar tolerance() const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_MIXED_LSOLVER_HPP_
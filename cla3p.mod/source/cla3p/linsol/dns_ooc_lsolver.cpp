@@ -0,0 +1,445 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_ooc_lsolver.hpp"
+
+// system
+#include <future>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/proxies/blas_proxy.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+#include "cla3p/checks/decomp_lu_checks.hpp"
+#include "cla3p/checks/decomp_llt_checks.hpp"
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+//
+// b = a' (conjugate transpose), b is m x n
+//
+template <typename T_Scalar>
+static void ooc_ctranspose(uint_t m, uint_t n, const T_Scalar *a, uint_t lda, T_Scalar *b, uint_t ldb)
+{
+	for(uint_t j = 0; j < n; j++) {
+		for(uint_t i = 0; i < m; i++) {
+			b[i + j * ldb] = arith::conj(a[j + i * lda]);
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+//
+// Streams npanels column panels of a tile store through two buffers
+// The panel following the current one is read asynchronously while kernel() processes the current one
+// panel(t, j, ibeg, iend) selects tile rows ibeg,...,iend-1 of tile column j for step t
+// kernel(t, ptr, ld) processes the panel of step t
+//
+template <typename T_Scalar, typename T_Panel, typename T_Kernel>
+static void ooc_stream(const io::TileStore<T_Scalar>& store, uint_t npanels, T_Panel panel, T_Kernel kernel)
+{
+	if(!npanels)
+		return;
+
+	const uint_t n = store.nrows();
+	const uint_t nb = store.tileSize();
+
+	std::vector<T_Scalar> buf[2];
+	uint_t ld[2] = {0, 0};
+	std::future<void> fut[2]; // declared after the buffers, pending reads are joined first
+
+	buf[0].resize(n * nb);
+	buf[1].resize(npanels > 1 ? n * nb : 0);
+
+	auto prefetch = [&](uint_t t) {
+		uint_t j = 0, ibeg = 0, iend = 0;
+		panel(t, j, ibeg, iend);
+		uint_t s = t % 2;
+		ld[s] = std::min(n, iend * nb) - ibeg * nb;
+		T_Scalar *ptr = buf[s].data();
+		uint_t lds = ld[s];
+		fut[s] = std::async(std::launch::async, [&store, j, ibeg, iend, ptr, lds]() { 
+				store.readPanel(j, ibeg, iend, ptr, lds); 
+				});
+	};
+
+	prefetch(0);
+
+	for(uint_t t = 0; t < npanels; t++) {
+		if(t + 1 < npanels) prefetch(t + 1);
+		fut[t % 2].get();
+		kernel(t, buf[t % 2].data(), ld[t % 2]);
+	} // t
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverOutOfCore<T_Matrix>::LSolverOutOfCore(decomp_t dtype)
+	: m_dtype(dtype), m_store(nullptr)
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverOutOfCore<T_Matrix>::~LSolverOutOfCore()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::clear()
+{
+	m_ownStore.close();
+	m_store = nullptr;
+	m_ipiv.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::decompose(io::TileStore<T_Scalar>& store)
+{
+	clear();
+
+	if(!store.isOpen()) {
+		throw err::InvalidOp("Input tile store is not open");
+	} // open
+
+	if(store.nrows() != store.ncols()) {
+		throw err::InvalidOp("Only square matrices are supported for linear decomposition");
+	} // square
+
+	m_store = &store;
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::decompose(const T_Matrix& mat, const std::string& filename, uint_t nb)
+{
+	clear();
+
+	if(m_dtype == decomp_t::LU) lu_decomp_input_check(mat);
+	else                        llt_decomp_input_check(mat);
+
+	uint_t n = mat.ncols();
+	uint_t lda = mat.ld();
+	const T_Scalar *a = mat.values();
+
+	m_ownStore.open(filename, n, n, nb, true);
+
+	uint_t nt = m_ownStore.tileCols();
+
+	if(m_dtype == decomp_t::LU) {
+
+		for(uint_t j = 0; j < nt; j++) {
+			m_ownStore.writePanel(j, 0, nt, a + j * nb * lda, lda);
+		} // j
+
+	} else if(mat.prop().isLower()) {
+
+		for(uint_t j = 0; j < nt; j++) {
+			m_ownStore.writePanel(j, j, nt, a + j * nb + j * nb * lda, lda);
+		} // j
+
+	} else {
+
+		std::vector<T_Scalar> tile(nb * nb);
+
+		for(uint_t j = 0; j < nt; j++) {
+			for(uint_t i = j; i < nt; i++) {
+				uint_t bi = m_ownStore.tileNrows(i);
+				uint_t bj = m_ownStore.tileNcols(j);
+				ooc_ctranspose(bi, bj, a + j * nb + i * nb * lda, lda, tile.data(), bi);
+				m_ownStore.write(i, j, tile.data(), bi);
+			} // i
+		} // j
+
+	} // dtype/uplo
+
+	m_store = &m_ownStore;
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::fdecompose()
+{
+	try {
+		if(m_dtype == decomp_t::LU) decomposeLU();
+		else                        decomposeLLt();
+	} catch(...) {
+		clear(); // the tiles hold a partial factorization
+		throw;
+	} // decompose
+}
+/*-------------------------------------------------*/
+//
+// Left-looking tiled Cholesky (lower)
+// Panel k (tile rows k,...,nt-1 of tile column k) is updated by the panels j < k,
+// panel k-1 is still in memory (its write-back is in flight), panels j < k-1 are streamed from the file
+//
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::decomposeLLt()
+{
+	io::TileStore<T_Scalar> *store = m_store;
+
+	const uint_t n = store->nrows();
+	const uint_t nb = store->tileSize();
+	const uint_t nt = store->tileCols();
+
+	std::vector<T_Scalar> panel[2];
+	std::future<void> wfut[2]; // declared after the buffers, pending writes are joined first
+
+	panel[0].resize(n * nb);
+	panel[1].resize(nt > 1 ? n * nb : 0);
+
+	for(uint_t k = 0; k < nt; k++) {
+
+		uint_t r0 = k * nb;
+		uint_t h = n - r0;
+		uint_t w = store->tileNcols(k);
+
+		if(wfut[k % 2].valid()) wfut[k % 2].get(); // buffer & tiles of panel k-2 are released
+
+		T_Scalar *P = panel[k % 2].data();
+
+		std::future<void> rfut = std::async(std::launch::async, [store, k, nt, P, h]() { 
+				store->readPanel(k, k, nt, P, h); 
+				});
+
+		ooc_stream(*store, (k ? k - 1 : 0), 
+				[k, nt](uint_t t, uint_t& j, uint_t& ibeg, uint_t& iend) { j = t; ibeg = k; iend = nt; }, 
+				[&](uint_t, const T_Scalar *L, uint_t ldl) {
+					if(rfut.valid()) rfut.get();
+					blas::gemm('N', 'C', h, w, nb, T_Scalar(-1), L, ldl, L, ldl, T_Scalar(1), P, h);
+				});
+
+		if(rfut.valid()) rfut.get();
+
+		if(k) {
+			const T_Scalar *L = panel[(k - 1) % 2].data() + nb;
+			uint_t ldl = h + nb;
+			blas::gemm('N', 'C', h, w, nb, T_Scalar(-1), L, ldl, L, ldl, T_Scalar(1), P, h);
+		} // previous panel
+
+		int_t info = lapack::potrf('L', w, P, h);
+
+		if(info > 0) info += r0;
+		lapack_info_check(info);
+
+		if(h > w) {
+			blas::trsm('R', 'L', 'C', 'N', h - w, w, T_Scalar(1), P, h, P + w, h);
+		} // off-diagonal tiles
+
+		wfut[k % 2] = std::async(std::launch::async, [store, k, nt, P, h]() { 
+				store->writePanel(k, k, nt, P, h); 
+				});
+
+	} // k
+
+	for(uint_t s = 0; s < 2; s++) {
+		if(wfut[s].valid()) wfut[s].get();
+	} // s
+}
+/*-------------------------------------------------*/
+//
+// Left-looking tiled LU with partial pivoting
+// Panel k (the whole tile column k) receives the interchanges & updates of the panels j < k in order, 
+// then the rows below the diagonal block are factorized (getrf)
+// The L part of each panel is kept in the row order of its own elimination step 
+// (later interchanges are not applied to it), the solution stage interleaves interchanges & panel sweeps accordingly
+//
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::decomposeLU()
+{
+	io::TileStore<T_Scalar> *store = m_store;
+
+	const uint_t n = store->nrows();
+	const uint_t nb = store->tileSize();
+	const uint_t nt = store->tileCols();
+
+	m_ipiv.resize(n);
+
+	int_t *ipiv = m_ipiv.data();
+
+	std::vector<T_Scalar> panel[2];
+	std::future<void> wfut[2]; // declared after the buffers, pending writes are joined first
+
+	panel[0].resize(n * nb);
+	panel[1].resize(nt > 1 ? n * nb : 0);
+
+	for(uint_t k = 0; k < nt; k++) {
+
+		uint_t r0 = k * nb;
+		uint_t w = store->tileNcols(k);
+
+		if(wfut[k % 2].valid()) wfut[k % 2].get(); // buffer & tiles of panel k-2 are released
+
+		T_Scalar *P = panel[k % 2].data();
+
+		std::future<void> rfut = std::async(std::launch::async, [store, k, nt, P, n]() { 
+				store->readPanel(k, 0, nt, P, n); 
+				});
+
+		//
+		// L holds rows j*nb,...,n-1 of the (full width) panel j
+		//
+		auto update = [&](uint_t j, const T_Scalar *L, uint_t ldl) {
+			uint_t rj = j * nb;
+			lapack::laswp(w, P, n, rj + 1, rj + nb, ipiv, 1);
+			blas::trsm('L', 'L', 'N', 'U', nb, w, T_Scalar(1), L, ldl, P + rj, n);
+			blas::gemm('N', 'N', n - rj - nb, w, nb, T_Scalar(-1), L + nb, ldl, P + rj, n, T_Scalar(1), P + rj + nb, n);
+		};
+
+		ooc_stream(*store, (k ? k - 1 : 0), 
+				[nt](uint_t t, uint_t& j, uint_t& ibeg, uint_t& iend) { j = t; ibeg = t; iend = nt; }, 
+				[&](uint_t t, const T_Scalar *L, uint_t ldl) {
+					if(rfut.valid()) rfut.get();
+					update(t, L, ldl);
+				});
+
+		if(rfut.valid()) rfut.get();
+
+		if(k) {
+			update(k - 1, panel[(k - 1) % 2].data() + r0 - nb, n);
+		} // previous panel
+
+		int_t info = lapack::getrf(n - r0, w, P + r0, n, ipiv + r0);
+
+		for(uint_t i = r0; i < r0 + w; i++) {
+			ipiv[i] += r0;
+		} // i
+
+		if(info > 0) info += r0;
+		lapack_info_check(info);
+
+		wfut[k % 2] = std::async(std::launch::async, [store, k, nt, P, n]() { 
+				store->writePanel(k, 0, nt, P, n); 
+				});
+
+	} // k
+
+	for(uint_t s = 0; s < 2; s++) {
+		if(wfut[s].valid()) wfut[s].get();
+	} // s
+}
+/*-------------------------------------------------*/
+//
+// Forward sweep with L, then backward sweep with L'
+// Both sweeps stream the panels of L, the prefetch continues across the sweeps
+//
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::solveLLt(T_Matrix& rhs) const
+{
+	const io::TileStore<T_Scalar>& store = *m_store;
+
+	const uint_t n = store.nrows();
+	const uint_t nb = store.tileSize();
+	const uint_t nt = store.tileCols();
+
+	uint_t nrhs = rhs.ncols();
+	uint_t ldb = rhs.ld();
+	T_Scalar *b = rhs.values();
+
+	ooc_stream(store, 2 * nt, 
+			[nt](uint_t t, uint_t& j, uint_t& ibeg, uint_t& iend) { 
+				j = (t < nt ? t : 2 * nt - 1 - t); ibeg = j; iend = nt; 
+			}, 
+			[&](uint_t t, const T_Scalar *L, uint_t ldl) {
+				uint_t j = (t < nt ? t : 2 * nt - 1 - t);
+				uint_t rj = j * nb;
+				uint_t bj = store.tileNcols(j);
+				uint_t hb = n - rj - bj;
+				if(t < nt) {
+					blas::trsm('L', 'L', 'N', 'N', bj, nrhs, T_Scalar(1), L, ldl, b + rj, ldb);
+					if(hb) blas::gemm('N', 'N', hb, nrhs, bj, T_Scalar(-1), L + bj, ldl, b + rj, ldb, T_Scalar(1), b + rj + bj, ldb);
+				} else {
+					if(hb) blas::gemm('C', 'N', bj, nrhs, hb, T_Scalar(-1), L + bj, ldl, b + rj + bj, ldb, T_Scalar(1), b + rj, ldb);
+					blas::trsm('L', 'L', 'C', 'N', bj, nrhs, T_Scalar(1), L, ldl, b + rj, ldb);
+				} // sweep
+			});
+}
+/*-------------------------------------------------*/
+//
+// Forward sweep with the interchanges & L, then backward sweep with U
+// The forward sweep streams the panels below the diagonal, the backward sweep the panels above it
+//
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::solveLU(T_Matrix& rhs) const
+{
+	const io::TileStore<T_Scalar>& store = *m_store;
+
+	const uint_t n = store.nrows();
+	const uint_t nb = store.tileSize();
+	const uint_t nt = store.tileCols();
+
+	uint_t nrhs = rhs.ncols();
+	uint_t ldb = rhs.ld();
+	T_Scalar *b = rhs.values();
+	const int_t *ipiv = m_ipiv.data();
+
+	ooc_stream(store, 2 * nt, 
+			[nt](uint_t t, uint_t& j, uint_t& ibeg, uint_t& iend) { 
+				if(t < nt) { j = t; ibeg = j; iend = nt; } 
+				else       { j = 2 * nt - 1 - t; ibeg = 0; iend = j + 1; }
+			}, 
+			[&](uint_t t, const T_Scalar *A, uint_t lda) {
+				uint_t j = (t < nt ? t : 2 * nt - 1 - t);
+				uint_t rj = j * nb;
+				uint_t bj = store.tileNcols(j);
+				if(t < nt) {
+					uint_t hb = n - rj - bj;
+					lapack::laswp(nrhs, b, ldb, rj + 1, rj + bj, ipiv, 1);
+					blas::trsm('L', 'L', 'N', 'U', bj, nrhs, T_Scalar(1), A, lda, b + rj, ldb);
+					if(hb) blas::gemm('N', 'N', hb, nrhs, bj, T_Scalar(-1), A + bj, lda, b + rj, ldb, T_Scalar(1), b + rj + bj, ldb);
+				} else {
+					blas::trsm('L', 'U', 'N', 'N', bj, nrhs, T_Scalar(1), A + rj, lda, b + rj, ldb);
+					if(rj) blas::gemm('N', 'N', rj, nrhs, bj, T_Scalar(-1), A, lda, b + rj, ldb, T_Scalar(1), b, ldb);
+				} // sweep
+			});
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(!m_store) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // m_store
+
+	default_solve_input_check(m_store->ncols(), rhs);
+
+	if(m_dtype == decomp_t::LU) solveLU(rhs);
+	else                        solveLLt(rhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverOutOfCore<T_Matrix>::solve(T_Vector& rhs) const
+{
+	T_Matrix tmp = rhs.rmatrix();
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+template class LSolverOutOfCore<RdMatrix>;
+template class LSolverOutOfCore<RfMatrix>;
+template class LSolverOutOfCore<CdMatrix>;
+template class LSolverOutOfCore<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_OOC_LSOLVER_HPP_
+#define CLA3P_DNS_OOC_LSOLVER_HPP_
+
+/**
+ * @file
+ * Out-of-core tiled dense linear solver
+ */
+
+#include <string>
+#include <vector>
+
+#include "cla3p/dense.hpp"
+#include "cla3p/io/tile_store.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The out-of-core linear solver for dense matrices.
+ *
+ * Factorizes (LU with partial pivoting or LL') a matrix kept in an io::TileStore, in place.@n
+ * The factorization is left-looking, one tile column panel is resident at a time 
+ * while the previously factorized panels are streamed from the file. 
+ * Panel reads are prefetched & panel write-backs are issued asynchronously so that I/O overlaps with the BLAS3 updates.
+ * The solution stage streams the factorized panels in the same way, the right hand side is kept in memory.@n
+ * The memory footprint is about 4 * n * nb values, n being the matrix dimension & nb the tile size.
+ */
+template <typename T_Matrix>
+class LSolverOutOfCore {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverOutOfCore(const LSolverOutOfCore&) = delete;
+		LSolverOutOfCore& operator=(const LSolverOutOfCore&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object with decomposition type dtype.
+		 */
+		LSolverOutOfCore(decomp_t dtype = decomp_t::LU);
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverOutOfCore();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the decomposition of a file-backed matrix.
+		 *
+		 * The factors overwrite the tiles of the store, 
+		 * the store must remain open while the solver is in use.
+		 *
+		 * @param[in,out] store The square matrix to be decomposed, 
+		 *                      for LL' only the lower triangular tiles are referenced.
+		 */
+		void decompose(io::TileStore<T_Scalar>& store);
+
+		/**
+		 * @brief Performs the decomposition of an in-memory matrix.
+		 *
+		 * The matrix is copied to a temporary tile store that is owned by the solver.
+		 *
+		 * @param[in] mat The matrix to be decomposed, 
+		 *                General for LU, Symmetric (real) or Hermitian (complex) positive definite for LL'.
+		 * @param[in] filename The location of the temporary backing file, 
+		 *                     the file is created next to it under a unique name & an existing file is left untouched.
+		 * @param[in] nb The tile size.
+		 */
+		void decompose(const T_Matrix& mat, const std::string& filename, uint_t nb);
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side matrix, General.
+		 */
+		void solve(T_Matrix& rhs) const;
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side vector.
+		 */
+		void solve(T_Vector& rhs) const;
+
+	private:
+		decomp_t m_dtype;
+		io::TileStore<T_Scalar> m_ownStore;
+		io::TileStore<T_Scalar> *m_store;
+		std::vector<int_t> m_ipiv;
+
+		void fdecompose();
+		void decomposeLLt();
+		void decomposeLU();
+		void solveLLt(T_Matrix& rhs) const;
+		void solveLU(T_Matrix& rhs) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_OOC_LSOLVER_HPP_
@@ -0,0 +1,390 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_qr_lsolver.hpp"
+
+// system
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/support/utils.hpp"
+
+#include "cla3p/checks/decomp_qr_checks.hpp"
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+//
+// Column block size of the compact-WY representation
+//
+static inline uint_t qr_block_size()
+{
+	return 32;
+}
+/*-------------------------------------------------*/
+//
+// TSQR is used for matrices with at least aspect * n rows, 
+// split in (at most one per thread) row blocks of at least max(min_block_rows, 2 * n) rows
+//
+static inline uint_t qr_tsqr_min_aspect()
+{
+	return 16;
+}
+/*-------------------------------------------------*/
+static inline uint_t qr_tsqr_min_block_rows()
+{
+	return 1024;
+}
+/*-------------------------------------------------*/
+static std::vector<uint_t> qr_tsqr_blocks(uint_t m, uint_t n)
+{
+	std::vector<uint_t> ret;
+
+	if(m < qr_tsqr_min_aspect() * n)
+		return ret;
+
+	uint_t minRows = std::max(qr_tsqr_min_block_rows(), 2 * n);
+	uint_t nblocks = std::min(static_cast<uint_t>(max_threads()), m / minRows);
+
+	if(nblocks < 2)
+		return ret;
+
+	ret.resize(nblocks + 1);
+
+	for(uint_t b = 0; b <= nblocks; b++) {
+		ret[b] = static_cast<uint_t>(static_cast<bulk_t>(m) * b / nblocks);
+	} // b
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverQR<T_Matrix>::LSolverQR(bool pivoting)
+	: m_pivoting(pivoting), m_rtol(0)
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverQR<T_Matrix>::LSolverQR(uint_t n, bool pivoting)
+	: m_pivoting(pivoting), m_rtol(0)
+{
+	defaults();
+	reserve(n);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverQR<T_Matrix>::~LSolverQR()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::defaults()
+{
+	m_rank = 0;
+	m_nb = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::reserve(uint_t n)
+{
+	this->reserveBuffer(n);
+	if(m_pivoting) {
+		this->reserveJpiv(n);
+	} // jpiv
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::clear()
+{
+	m_blocks.clear();
+	m_tfactor.clear();
+	m_top.clear();
+	this->clearAll();
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> void LSolverQR<T_Matrix>::setPivoting(bool pivoting) { m_pivoting = pivoting; }
+template <typename T_Matrix> void LSolverQR<T_Matrix>::setRankTolerance(T_RScalar tol) { m_rtol = tol; }
+template <typename T_Matrix> uint_t LSolverQR<T_Matrix>::rank() const { return m_rank; }
+template <typename T_Matrix> bool LSolverQR<T_Matrix>::tsqr() const { return !m_blocks.empty(); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::decompose(const T_Matrix& mat)
+{
+	clear();
+	qr_decomp_input_check(mat);
+	this->absorbInput(mat);
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::idecompose(T_Matrix& mat)
+{
+	clear();
+	qr_decomp_input_check(mat);
+	this->factor() = mat.move();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::fdecompose()
+{
+	this->factor().igeneral();
+
+	m_nb = std::min(this->factor().ncols(), qr_block_size());
+
+	if(m_pivoting) {
+
+		decomposePivoted();
+
+	} else {
+
+		m_blocks = qr_tsqr_blocks(this->factor().nrows(), this->factor().ncols());
+
+		if(m_blocks.empty()) decomposeBlocked();
+		else                 decomposeTsqr();
+
+		m_rank = this->factor().ncols();
+
+	} // pivoting
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::decomposeBlocked()
+{
+	T_Matrix& A = this->factor();
+
+	m_tfactor = T_Matrix::init(m_nb, A.ncols());
+
+	this->info() = lapack::geqrt(A.nrows(), A.ncols(), m_nb, A.values(), A.ld(), m_tfactor.values(), m_tfactor.ld());
+
+	lapack_info_check(this->info());
+}
+/*-------------------------------------------------*/
+//
+// Row blocks are factorized concurrently, their R factors are stacked in m_top & factorized once more
+// Block b keeps its compact-WY factors in place & its T factor in columns [b * n, (b + 1) * n) of m_tfactor
+//
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::decomposeTsqr()
+{
+	T_Matrix& A = this->factor();
+
+	uint_t n = A.ncols();
+	int_t nblocks = static_cast<int_t>(m_blocks.size() - 1);
+
+	m_tfactor = T_Matrix::init(m_nb, n * (nblocks + 1));
+	m_top = T_Matrix::init(nblocks * n, n);
+	m_top = 0;
+
+	int_t info = 0;
+
+	#pragma omp parallel for
+	for(int_t b = 0; b < nblocks; b++) {
+
+		uint_t r0 = m_blocks[b];
+		uint_t mb = m_blocks[b + 1] - r0;
+		T_Scalar *ab = A.values() + r0;
+
+		int_t binfo = lapack::geqrt(mb, n, m_nb, ab, A.ld(), m_tfactor.values() + b * n * m_tfactor.ld(), m_tfactor.ld());
+
+		lapack::lacpy('U', n, n, ab, A.ld(), m_top.values() + b * n, m_top.ld());
+
+		if(binfo) {
+			#pragma omp critical
+			info = binfo;
+		} // binfo
+
+	} // b
+
+	lapack_info_check(info);
+
+	this->info() = lapack::geqrt(m_top.nrows(), n, m_nb, m_top.values(), m_top.ld(), 
+			m_tfactor.values() + nblocks * n * m_tfactor.ld(), m_tfactor.ld());
+
+	lapack_info_check(this->info());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::decomposePivoted()
+{
+	T_Matrix& A = this->factor();
+
+	uint_t m = A.nrows();
+	uint_t n = A.ncols();
+
+	this->jpiv1().assign(n, 0);
+	m_tfactor = T_Matrix::init(n, 1);
+
+	this->info() = lapack::geqp3(m, n, A.values(), A.ld(), this->jpiv1().data(), m_tfactor.values());
+
+	lapack_info_check(this->info());
+
+	T_RScalar tol = (m_rtol > 0 ? m_rtol : static_cast<T_RScalar>(m) * std::numeric_limits<T_RScalar>::epsilon());
+	T_RScalar rmax = std::abs(A(0,0));
+
+	m_rank = 0;
+	while(m_rank < n && std::abs(A(m_rank,m_rank)) > tol * rmax) {
+		m_rank++;
+	} // m_rank
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(this->factor().empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty factor
+
+	default_solve_input_check(this->factor().nrows(), rhs);
+
+	if(!this->jpiv1().empty()) {
+		solvePivoted(rhs);
+	} else if(tsqr()) {
+		solveTsqr(rhs);
+	} else {
+		solveBlocked(rhs);
+	} // variant
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::solve(T_Vector& rhs) const
+{
+	LSolverBase<T_Matrix>::solve(rhs);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::solveBlocked(T_Matrix& rhs) const
+{
+	const T_Matrix& A = this->factor();
+
+	int_t info = lapack::gemqrt('L', 'C', A.nrows(), rhs.ncols(), A.ncols(), m_nb, 
+			A.values(), A.ld(), m_tfactor.values(), m_tfactor.ld(), rhs.values(), rhs.ld());
+
+	lapack_info_check(info);
+
+	info = lapack::trtrs('U', 'N', 'N', A.ncols(), rhs.ncols(), A.values(), A.ld(), rhs.values(), rhs.ld());
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+//
+// Q^H applied block by block (concurrently), the leading n rows of each block are gathered 
+// & the reduction factor is applied on the stacked result
+//
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::solveTsqr(T_Matrix& rhs) const
+{
+	const T_Matrix& A = this->factor();
+
+	uint_t n = A.ncols();
+	uint_t k = rhs.ncols();
+	int_t nblocks = static_cast<int_t>(m_blocks.size() - 1);
+
+	T_Matrix c = T_Matrix::init(m_top.nrows(), k);
+
+	int_t info = 0;
+
+	#pragma omp parallel for
+	for(int_t b = 0; b < nblocks; b++) {
+
+		uint_t r0 = m_blocks[b];
+		uint_t mb = m_blocks[b + 1] - r0;
+
+		int_t binfo = lapack::gemqrt('L', 'C', mb, k, n, m_nb, 
+				A.values() + r0, A.ld(), m_tfactor.values() + b * n * m_tfactor.ld(), m_tfactor.ld(), 
+				rhs.values() + r0, rhs.ld());
+
+		lapack::lacpy('A', n, k, rhs.values() + r0, rhs.ld(), c.values() + b * n, c.ld());
+
+		if(binfo) {
+			#pragma omp critical
+			info = binfo;
+		} // binfo
+
+	} // b
+
+	lapack_info_check(info);
+
+	info = lapack::gemqrt('L', 'C', c.nrows(), k, n, m_nb, 
+			m_top.values(), m_top.ld(), m_tfactor.values() + nblocks * n * m_tfactor.ld(), m_tfactor.ld(), 
+			c.values(), c.ld());
+
+	lapack_info_check(info);
+
+	info = lapack::trtrs('U', 'N', 'N', n, k, m_top.values(), m_top.ld(), c.values(), c.ld());
+
+	lapack_info_check(info);
+
+	lapack::lacpy('A', n, k, c.values(), c.ld(), rhs.values(), rhs.ld());
+}
+/*-------------------------------------------------*/
+//
+// Basic solution: R11 * y1 = (Q^H * b)(0:r), y2 = 0, x = P * y
+//
+template <typename T_Matrix>
+void LSolverQR<T_Matrix>::solvePivoted(T_Matrix& rhs) const
+{
+	const T_Matrix& A = this->factor();
+
+	uint_t n = A.ncols();
+	uint_t k = rhs.ncols();
+
+	int_t info = lapack::unmqr('L', 'C', A.nrows(), k, n, A.values(), A.ld(), m_tfactor.values(), rhs.values(), rhs.ld());
+
+	lapack_info_check(info);
+
+	if(m_rank) {
+		info = lapack::trtrs('U', 'N', 'N', m_rank, k, A.values(), A.ld(), rhs.values(), rhs.ld());
+		lapack_info_check(info);
+	} // m_rank
+
+	std::vector<T_Scalar> y(n);
+
+	for(uint_t j = 0; j < k; j++) {
+		T_Scalar *xj = rhs.values() + j * rhs.ld();
+		for(uint_t i = 0; i < n; i++) {
+			y[i] = (i < m_rank ? xj[i] : T_Scalar(0));
+		} // i
+		for(uint_t i = 0; i < n; i++) {
+			xj[this->jpiv1()[i] - 1] = y[i];
+		} // i
+	} // j
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class LSolverQR<RdMatrix>;
+template class LSolverQR<RfMatrix>;
+template class LSolverQR<CdMatrix>;
+template class LSolverQR<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
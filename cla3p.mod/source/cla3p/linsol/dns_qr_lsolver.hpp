@@ -0,0 +1,161 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_QR_LSOLVER_HPP_
+#define CLA3P_DNS_QR_LSOLVER_HPP_
+
+/**
+ * @file
+ * QR dense linear (least squares) solver
+ */
+
+#include "cla3p/linsol/dns_lsolver_base.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The QR linear solver for dense square or overdetermined matrices.
+ *
+ * Solves the linear least squares problem min ||A * X - B||<sub>2</sub> for (m x n) matrices with m >= n.@n
+ * The orthogonal factor is stored in compact-WY form & reused for every right hand side.@n
+ * Very tall-skinny matrices are factorized with a parallel communication-avoiding QR (TSQR), 
+ * row blocks are factorized concurrently & their triangular factors are reduced in a final QR.@n
+ * With column pivoting enabled, rank deficient matrices are supported & the basic solution is computed.
+ */
+template <typename T_Matrix>
+class LSolverQR : public LSolverBase<T_Matrix> {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverQR(const LSolverQR&) = delete;
+		LSolverQR& operator=(const LSolverQR&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 * @param[in] pivoting Enables column pivoting (rank revealing QR).
+		 */
+		LSolverQR(bool pivoting = false);
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs a preallocated solver object with n<sup>2</sup> buffered size.
+		 * @param[in] n The buffer dimension.
+		 * @param[in] pivoting Enables column pivoting (rank revealing QR).
+		 */
+		LSolverQR(uint_t n, bool pivoting = false);
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverQR();
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::reserve(uint_t n)
+		 */
+		void reserve(uint_t n) override;
+
+		/**
+		 * @copydoc cla3p::dns::LSolverBase::clear()
+		 */
+		void clear() override;
+
+		/**
+		 * @brief Performs matrix decomposition.
+		 * @param[in] mat The (m x n) matrix to be decomposed, m >= n.
+		 */
+		void decompose(const T_Matrix& mat) override;
+
+		/**
+		 * @brief Performs in-place matrix decomposition.
+		 * @param[in] mat The (m x n) matrix to be decomposed, m >= n, destroyed after the operation.
+		 */
+		void idecompose(T_Matrix& mat) override;
+
+		/**
+		 * @brief Performs in-place least squares solution.
+		 * @param[in] rhs The (m x k) right hand side matrix, 
+		 *                the first n rows are overwritten with the solution, the rest are destroyed.
+		 */
+		void solve(T_Matrix& rhs) const override;
+
+		/**
+		 * @brief Performs in-place least squares solution.
+		 * @param[in] rhs The right hand side vector (size m), 
+		 *                the first n entries are overwritten with the solution, the rest are destroyed.
+		 */
+		void solve(T_Vector& rhs) const override;
+
+		/**
+		 * @brief Enables/disables column pivoting for the subsequent decompositions.
+		 */
+		void setPivoting(bool pivoting);
+
+		/**
+		 * @brief Sets the relative tolerance of the numerical rank estimation (column pivoting only).
+		 *
+		 * Diagonal entries of R smaller than tol * |R(0,0)| are considered zero.@n
+		 * A non positive tolerance (default) selects max(m,n) * eps.
+		 */
+		void setRankTolerance(T_RScalar tol);
+
+		/**
+		 * @brief The numerical rank of the decomposed matrix.
+		 */
+		uint_t rank() const;
+
+		/**
+		 * @brief Whether the decomposition used the communication-avoiding (TSQR) variant.
+		 */
+		bool tsqr() const;
+
+	private:
+		bool m_pivoting;
+		T_RScalar m_rtol;
+		uint_t m_rank;
+		uint_t m_nb;
+		std::vector<uint_t> m_blocks;
+		T_Matrix m_tfactor;
+		T_Matrix m_top;
+
+		void defaults();
+		void fdecompose();
+		void decomposePivoted();
+		void decomposeBlocked();
+		void decomposeTsqr();
+		void solvePivoted(T_Matrix& rhs) const;
+		void solveBlocked(T_Matrix& rhs) const;
+		void solveTsqr(T_Matrix& rhs) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_QR_LSOLVER_HPP_
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_rfp_llt_lsolver.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverRfpLLt<T_Matrix>::LSolverRfpLLt()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverRfpLLt<T_Matrix>::~LSolverRfpLLt()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::clear()
+{
+	m_factor.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::decompose(const RfpMatrix<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.copy();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::idecompose(RfpMatrix<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.move();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::fdecompose()
+{
+	const Property& pr = m_factor.prop();
+
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Input matrix is empty");
+	} // empty
+
+	if(!pr.isSymmetric() && !pr.isHermitian()) {
+		clear();
+		throw err::InvalidOp("Only Symmetric (real) or Hermitian (complex) matrices are supported for LLt decomposition");
+	} // prop
+
+	int_t info = lapack::pftrf('N', pr.cuplo(), m_factor.ncols(), m_factor.values());
+
+	if(info) {
+		clear();
+		lapack_info_check(info);
+	} // info
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty
+
+	default_solve_input_check(m_factor.ncols(), rhs);
+
+	int_t info = lapack::pftrs('N', m_factor.prop().cuplo(), 
+			m_factor.ncols(), rhs.ncols(), 
+			m_factor.values(), 
+			rhs.values(), rhs.ld());
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverRfpLLt<T_Matrix>::solve(T_Vector& rhs) const
+{
+	T_Matrix tmp = rhs.rmatrix();
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+template class LSolverRfpLLt<RdMatrix>;
+template class LSolverRfpLLt<RfMatrix>;
+template class LSolverRfpLLt<CdMatrix>;
+template class LSolverRfpLLt<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
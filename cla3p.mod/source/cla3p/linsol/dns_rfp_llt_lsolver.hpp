@@ -0,0 +1,103 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_RFP_LLT_LSOLVER_HPP_
+#define CLA3P_DNS_RFP_LLT_LSOLVER_HPP_
+
+/**
+ * @file
+ * LLt linear solver for matrices in rectangular full packed storage
+ */
+
+#include "cla3p/dense.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The LL' linear solver for dense matrices in rectangular full packed storage.
+ *
+ * Factorizes a Symmetric (real) or Hermitian (complex) positive definite RfpMatrix using the lapack RFP Cholesky routines.@n
+ * The factor is kept in RFP storage, using half the memory of the LSolverLLt factor.
+ */
+template <typename T_Matrix>
+class LSolverRfpLLt {
+
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverRfpLLt(const LSolverRfpLLt&) = delete;
+		LSolverRfpLLt& operator=(const LSolverRfpLLt&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverRfpLLt();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverRfpLLt();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the matrix decomposition.
+		 * @param[in] mat The matrix to be decomposed, it is copied internally.
+		 */
+		void decompose(const RfpMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Performs the in-place matrix decomposition.
+		 * @param[in,out] mat The matrix to be decomposed, it is moved into the solver.
+		 */
+		void idecompose(RfpMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side matrix, General.
+		 */
+		void solve(T_Matrix& rhs) const;
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side vector.
+		 */
+		void solve(T_Vector& rhs) const;
+
+	private:
+		RfpMatrix<T_Matrix> m_factor;
+
+		void fdecompose();
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_RFP_LLT_LSOLVER_HPP_
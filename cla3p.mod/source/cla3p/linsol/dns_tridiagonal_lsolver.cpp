@@ -0,0 +1,270 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/linsol/dns_tridiagonal_lsolver.hpp"
+
+// system
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns_band.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+#include "cla3p/checks/solve_checks.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace dns {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverTridiagonal<T_Matrix>::LSolverTridiagonal()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverTridiagonal<T_Matrix>::~LSolverTridiagonal()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::clear()
+{
+	m_factor.clear();
+	m_du2.clear();
+	m_ipiv.clear();
+	m_dr.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::decompose(const TridiagonalMatrix<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.copy();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::idecompose(TridiagonalMatrix<T_Matrix>& mat)
+{
+	clear();
+	m_factor = mat.move();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::fdecompose()
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	} // empty
+
+	uint_t n = m_factor.ncols();
+
+	if(m_factor.prop().isGeneral()) {
+		m_du2.resize(n);
+		m_ipiv.resize(n);
+	} else {
+		m_dr.resize(n);
+	} // prop
+
+	int_t info = bulk::dns::tri_factor(m_factor.prop().type(), n, 
+			m_factor.subdiagonal(), m_factor.diagonal(), m_factor.superdiagonal(), 
+			m_du2.data(), m_ipiv.data(), m_dr.data());
+
+	if(info) {
+		clear();
+		lapack_info_check(info);
+	} // info
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::solve(T_Matrix& rhs) const
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty
+
+	default_solve_input_check(m_factor.ncols(), rhs);
+
+	int_t info = bulk::dns::tri_solve(m_factor.prop().type(), m_factor.ncols(), 
+			m_factor.subdiagonal(), m_factor.diagonal(), m_factor.superdiagonal(), 
+			m_du2.data(), m_ipiv.data(), m_dr.data(), 
+			rhs.ncols(), rhs.values(), rhs.ld());
+
+	lapack_info_check(info);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverTridiagonal<T_Matrix>::solve(T_Vector& rhs) const
+{
+	T_Matrix tmp = rhs.rmatrix();
+	solve(tmp);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBatchTridiagonal<T_Matrix>::LSolverBatchTridiagonal()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+LSolverBatchTridiagonal<T_Matrix>::~LSolverBatchTridiagonal()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchTridiagonal<T_Matrix>::clear()
+{
+	m_factor.clear();
+	m_du2.clear();
+	m_ipiv.clear();
+	m_dr.clear();
+	m_info.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchTridiagonal<T_Matrix>::decompose(const std::vector<TridiagonalMatrix<T_Matrix>>& mats)
+{
+	clear();
+
+	m_factor.reserve(mats.size());
+	for(const TridiagonalMatrix<T_Matrix>& mat : mats) {
+		m_factor.push_back(mat.copy());
+	} // mats
+
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchTridiagonal<T_Matrix>::idecompose(std::vector<TridiagonalMatrix<T_Matrix>>& mats)
+{
+	clear();
+	m_factor = std::move(mats);
+	mats.clear();
+	fdecompose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchTridiagonal<T_Matrix>::fdecompose()
+{
+	if(m_factor.empty() || m_factor.front().empty()) {
+		throw err::InvalidOp(msg::EmptyObject());
+	} // empty
+
+	uint_t n = m_factor.front().ncols();
+	uint_t count = static_cast<uint_t>(m_factor.size());
+
+	for(const TridiagonalMatrix<T_Matrix>& mat : m_factor) {
+		if(mat.ncols() != n) {
+			clear();
+			throw err::NoConsistency(msg::InvalidDimensions());
+		} // dims
+	} // mats
+
+	bulk_t size = static_cast<bulk_t>(n) * count;
+
+	m_du2.resize(size);
+	m_ipiv.resize(size);
+	m_dr.resize(size);
+	m_info.resize(count);
+
+	#pragma omp parallel for schedule(dynamic)
+	for(int_t kk = 0; kk < static_cast<int_t>(count); kk++) {
+		bulk_t off = static_cast<bulk_t>(kk) * n;
+		TridiagonalMatrix<T_Matrix>& mat = m_factor[kk];
+		m_info[kk] = bulk::dns::tri_factor(mat.prop().type(), n, 
+				mat.subdiagonal(), mat.diagonal(), mat.superdiagonal(), 
+				m_du2.data() + off, m_ipiv.data() + off, m_dr.data() + off);
+	} // k
+
+	for(uint_t k = 0; k < count; k++) {
+		if(m_info[k]) {
+			int_t info = m_info[k];
+			clear();
+			lapack_info_check(info);
+		} // info
+	} // k
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void LSolverBatchTridiagonal<T_Matrix>::solve(MatrixBatch<T_Matrix>& rhs) const
+{
+	if(m_factor.empty()) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // empty factor
+
+	uint_t n = m_factor.front().ncols();
+	uint_t count = static_cast<uint_t>(m_factor.size());
+
+	if(rhs.nrows() != n || rhs.size() != count) {
+		throw err::NoConsistency(msg::InvalidDimensions());
+	} // dims
+
+	std::vector<int_t> info(count);
+
+	#pragma omp parallel for schedule(dynamic)
+	for(int_t kk = 0; kk < static_cast<int_t>(count); kk++) {
+
+		bulk_t off = static_cast<bulk_t>(kk) * n;
+		const TridiagonalMatrix<T_Matrix>& mat = m_factor[kk];
+
+		if(rhs.layout() == layout_t::Strided) {
+
+			info[kk] = bulk::dns::tri_solve(mat.prop().type(), n, 
+					mat.subdiagonal(), mat.diagonal(), mat.superdiagonal(), 
+					m_du2.data() + off, m_ipiv.data() + off, m_dr.data() + off, 
+					rhs.ncols(), rhs.values() + static_cast<bulk_t>(kk) * rhs.stride(), rhs.ld());
+
+		} else {
+
+			T_Matrix tmp = rhs.get(kk);
+
+			info[kk] = bulk::dns::tri_solve(mat.prop().type(), n, 
+					mat.subdiagonal(), mat.diagonal(), mat.superdiagonal(), 
+					m_du2.data() + off, m_ipiv.data() + off, m_dr.data() + off, 
+					tmp.ncols(), tmp.values(), tmp.ld());
+
+			rhs.set(kk, tmp);
+
+		} // layout
+	} // k
+
+	for(uint_t k = 0; k < count; k++) {
+		lapack_info_check(info[k]);
+	} // k
+}
+/*-------------------------------------------------*/
+template class LSolverTridiagonal<RdMatrix>;
+template class LSolverTridiagonal<RfMatrix>;
+template class LSolverTridiagonal<CdMatrix>;
+template class LSolverTridiagonal<CfMatrix>;
+/*-------------------------------------------------*/
+template class LSolverBatchTridiagonal<RdMatrix>;
+template class LSolverBatchTridiagonal<RfMatrix>;
+template class LSolverBatchTridiagonal<CdMatrix>;
+template class LSolverBatchTridiagonal<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
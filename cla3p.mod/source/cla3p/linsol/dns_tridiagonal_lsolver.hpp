@@ -0,0 +1,175 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_DNS_TRIDIAGONAL_LSOLVER_HPP_
+#define CLA3P_DNS_TRIDIAGONAL_LSOLVER_HPP_
+
+/**
+ * @file
+ * Linear solvers for tridiagonal matrices
+ */
+
+#include <vector>
+
+#include "cla3p/dense.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace dns { 
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The linear solver for tridiagonal matrices.
+ *
+ * General matrices are factorized with partial pivoting LU, 
+ * Symmetric (real) & Hermitian (complex) positive definite matrices with LDL'.
+ */
+template <typename T_Matrix>
+class LSolverTridiagonal {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+	using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+
+	public:
+
+		// no copy
+		LSolverTridiagonal(const LSolverTridiagonal&) = delete;
+		LSolverTridiagonal& operator=(const LSolverTridiagonal&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverTridiagonal();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverTridiagonal();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the matrix decomposition.
+		 * @param[in] mat The matrix to be decomposed, it is copied internally.
+		 */
+		void decompose(const TridiagonalMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Performs the in-place matrix decomposition.
+		 * @param[in,out] mat The matrix to be decomposed, destroyed after the operation.
+		 */
+		void idecompose(TridiagonalMatrix<T_Matrix>& mat);
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side matrix, General.
+		 */
+		void solve(T_Matrix& rhs) const;
+
+		/**
+		 * @brief Overwrites rhs with the solution.
+		 * @param[in,out] rhs The right hand side vector.
+		 */
+		void solve(T_Vector& rhs) const;
+
+	private:
+		TridiagonalMatrix<T_Matrix> m_factor;
+		std::vector<T_Scalar> m_du2;
+		std::vector<int_t> m_ipiv;
+		std::vector<T_RScalar> m_dr;
+
+		void fdecompose();
+};
+
+/**
+ * @ingroup module_index_linsol_dense
+ * @nosubgrouping
+ * @brief The linear solver for batches of independent tridiagonal systems.
+ *
+ * All matrices of the batch have the same dimension, 
+ * the systems are factorized & solved in parallel across the batch (LU for General, LDL' for Symmetric/Hermitian matrices).
+ */
+template <typename T_Matrix>
+class LSolverBatchTridiagonal {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+
+	public:
+
+		// no copy
+		LSolverBatchTridiagonal(const LSolverBatchTridiagonal&) = delete;
+		LSolverBatchTridiagonal& operator=(const LSolverBatchTridiagonal&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty solver object.
+		 */
+		LSolverBatchTridiagonal();
+
+		/**
+		 * @brief Destroys the solver.
+		 */
+		~LSolverBatchTridiagonal();
+
+		/**
+		 * @brief Clears the solver internal data.
+		 */
+		void clear();
+
+		/**
+		 * @brief Performs the decomposition of all matrices of a batch.
+		 * @param[in] mats The matrices to be decomposed, they are copied internally.
+		 */
+		void decompose(const std::vector<TridiagonalMatrix<T_Matrix>>& mats);
+
+		/**
+		 * @brief Performs the in-place decomposition of all matrices of a batch.
+		 * @param[in,out] mats The matrices to be decomposed, mats is empty after the operation.
+		 */
+		void idecompose(std::vector<TridiagonalMatrix<T_Matrix>>& mats);
+
+		/**
+		 * @brief Performs the solution stage for all systems of the batch.
+		 * @param[in,out] rhs On entry, the right hand sides of each system, on exit the solutions.
+		 */
+		void solve(MatrixBatch<T_Matrix>& rhs) const;
+
+	private:
+		std::vector<TridiagonalMatrix<T_Matrix>> m_factor;
+		std::vector<T_Scalar> m_du2;
+		std::vector<int_t> m_ipiv;
+		std::vector<T_RScalar> m_dr;
+		std::vector<int_t> m_info;
+
+		void fdecompose();
+};
+
+/*-------------------------------------------------*/
+} // namespace dns
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_DNS_TRIDIAGONAL_LSOLVER_HPP_
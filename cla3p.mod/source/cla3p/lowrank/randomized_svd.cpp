@@ -0,0 +1,304 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/lowrank/randomized_svd.hpp"
+
+// system
+#include <algorithm>
+#include <utility>
+
+// 3rd
+
+// cla3p
+#include "cla3p/algebra/functional_multmm.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/proxies/lapack_proxy.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/checks/lapack_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace lowrank {
+/*-------------------------------------------------*/
+static inline uint_t rsvd_default_rank()
+{
+	return 10;
+}
+/*-------------------------------------------------*/
+static inline uint_t rsvd_default_oversampling()
+{
+	return 10;
+}
+/*-------------------------------------------------*/
+static inline uint_t rsvd_default_power_iterations()
+{
+	return 2;
+}
+/*-------------------------------------------------*/
+static inline uint_t rsvd_block_size()
+{
+	return 32;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static void rsvd_reserve(T_Matrix& mat, uint_t nr, uint_t nc)
+{
+	if(mat.nrows() != nr || mat.ncols() != nc) {
+		mat = T_Matrix::init(nr, nc);
+	} // realloc
+}
+/*-------------------------------------------------*/
+//
+// Y = opA(A) * X, the only access to the input matrix
+// A is General/Symmetric/Hermitian, complex symmetric adjoints are computed as conj(A * conj(X))
+//
+template <typename T_Scalar, typename T_Matrix>
+static void rsvd_mult(op_t opA, const dns::XxMatrix<T_Scalar,T_Matrix>& A, T_Matrix& X, T_Matrix& Y)
+{
+	bool conjSym = (opA == op_t::C && TypeTraits<T_Scalar>::is_complex() && A.prop().isSymmetric());
+
+	if(conjSym) X.iconjugate();
+
+	Y = T_Scalar(0);
+	ops::mult(T_Scalar(1), opA, A, op_t::N, X, Y);
+
+	if(conjSym) {
+		X.iconjugate();
+		Y.iconjugate();
+	} // complex symmetric
+}
+/*-------------------------------------------------*/
+template <typename T_Int, typename T_Scalar, typename T_CscMatrix, typename T_DnsMatrix>
+static void rsvd_mult(op_t opA, const csc::XxMatrix<T_Int,T_Scalar,T_CscMatrix>& A, T_DnsMatrix& X, T_DnsMatrix& Y)
+{
+	bool conjSym = (opA == op_t::C && TypeTraits<T_Scalar>::is_complex() && A.prop().isSymmetric());
+
+	if(conjSym) X.iconjugate();
+
+	Y = T_Scalar(0);
+	ops::mult(T_Scalar(1), opA, A, X, Y);
+
+	if(conjSym) {
+		X.iconjugate();
+		Y.iconjugate();
+	} // complex symmetric
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RandomizedSvd<T_Matrix>::RandomizedSvd()
+	: 
+		m_k(rsvd_default_rank()), 
+		m_p(rsvd_default_oversampling()), 
+		m_q(rsvd_default_power_iterations()), 
+		m_tol(0)
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RandomizedSvd<T_Matrix>::RandomizedSvd(uint_t k)
+	: RandomizedSvd()
+{
+	setRank(k);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+RandomizedSvd<T_Matrix>::~RandomizedSvd()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::defaults()
+{
+	m_rank = 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::clear()
+{
+	m_u.clear();
+	m_s.clear();
+	m_v.clear();
+	m_y.clear();
+	m_z.clear();
+	m_qy.clear();
+	m_qz.clear();
+	m_tfactor.clear();
+	m_w.clear();
+	m_vt.clear();
+	m_sigma.clear();
+	m_superb.clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::setRank(uint_t k)
+{
+	if(!k) {
+		throw err::InvalidOp("Target rank must be positive");
+	} // k
+
+	m_k = k;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> void RandomizedSvd<T_Matrix>::setOversampling(uint_t p) { m_p = p; }
+template <typename T_Matrix> void RandomizedSvd<T_Matrix>::setPowerIterations(uint_t q) { m_q = q; }
+template <typename T_Matrix> void RandomizedSvd<T_Matrix>::setTolerance(T_RScalar tol) { m_tol = tol; }
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t RandomizedSvd<T_Matrix>::rank() const { return m_rank; }
+template <typename T_Matrix> const typename RandomizedSvd<T_Matrix>::T_DnsMatrix& RandomizedSvd<T_Matrix>::U() const { return m_u; }
+template <typename T_Matrix> const typename RandomizedSvd<T_Matrix>::T_RVector& RandomizedSvd<T_Matrix>::S() const { return m_s; }
+template <typename T_Matrix> const typename RandomizedSvd<T_Matrix>::T_DnsMatrix& RandomizedSvd<T_Matrix>::V() const { return m_v; }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::reserve(uint_t m, uint_t n, uint_t l)
+{
+	uint_t nb = std::min(l, rsvd_block_size());
+
+	rsvd_reserve(m_y, m, l);
+	rsvd_reserve(m_z, n, l);
+	rsvd_reserve(m_qy, m, l);
+	rsvd_reserve(m_qz, n, l);
+	rsvd_reserve(m_tfactor, nb, l);
+	rsvd_reserve(m_w, n, l);
+	rsvd_reserve(m_vt, l, l);
+
+	if(m_sigma.size() != l) m_sigma = T_RVector::init(l);
+	if(m_superb.size() != l) m_superb = T_RVector::init(l);
+}
+/*-------------------------------------------------*/
+//
+// Y = orth(Y) via compact-WY QR, Q is a workspace of the same size
+//
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::orthonormalize(T_DnsMatrix& Y, T_DnsMatrix& Q)
+{
+	uint_t m = Y.nrows();
+	uint_t l = Y.ncols();
+	uint_t nb = m_tfactor.nrows();
+
+	int_t info = lapack::geqrt(m, l, nb, Y.values(), Y.ld(), m_tfactor.values(), m_tfactor.ld());
+	lapack_info_check(info);
+
+	lapack::laset('A', m, l, T_Scalar(0), T_Scalar(1), Q.values(), Q.ld());
+
+	info = lapack::gemqrt('L', 'N', m, l, l, nb, Y.values(), Y.ld(), m_tfactor.values(), m_tfactor.ld(), Q.values(), Q.ld());
+	lapack_info_check(info);
+
+	std::swap(Y, Q);
+}
+/*-------------------------------------------------*/
+//
+// Range finder: Y = orth((A * A^H)^q * A * Omega)
+// Projection:   B^H = A^H * Y = W * diag(S) * Vt  =>  A ~ (Y * Vt^H) * diag(S) * W^H
+//
+template <typename T_Matrix>
+void RandomizedSvd<T_Matrix>::compute(const T_Matrix& mat)
+{
+	if(mat.empty()) {
+		throw err::InvalidOp("Input matrix is empty");
+	} else if(!mat.prop().isGeneral() && !mat.prop().isSymmetric() && !mat.prop().isHermitian()) {
+		throw err::InvalidOp("Matrices with property " + mat.prop().name() + " not supported for randomized SVD");
+	} // valid prop
+
+	uint_t m = mat.nrows();
+	uint_t n = mat.ncols();
+	uint_t l = std::min(m_k + m_p, std::min(m, n));
+
+	m_rank = 0;
+
+	reserve(m, n, l);
+
+	bulk::dns::randn(uplo_t::Full, n, l, m_z.values(), m_z.ld(), T_RScalar(0), T_RScalar(1));
+
+	rsvd_mult(op_t::N, mat, m_z, m_y);
+	orthonormalize(m_y, m_qy);
+
+	for(uint_t it = 0; it < m_q; it++) {
+		rsvd_mult(op_t::C, mat, m_y, m_z);
+		orthonormalize(m_z, m_qz);
+		rsvd_mult(op_t::N, mat, m_z, m_y);
+		orthonormalize(m_y, m_qy);
+	} // it
+
+	rsvd_mult(op_t::C, mat, m_y, m_z);
+
+	int_t info = lapack::gesvd('S', 'S', n, l, m_z.values(), m_z.ld(), 
+			m_sigma.values(), m_w.values(), m_w.ld(), m_vt.values(), m_vt.ld(), m_superb.values());
+	lapack_info_check(info);
+
+	uint_t k = std::min(m_k, l);
+	while(k > 0 && (m_sigma(k - 1) <= m_tol * m_sigma(0) || m_sigma(k - 1) == T_RScalar(0))) {
+		k--;
+	} // truncate
+
+	m_rank = k;
+
+	if(!k) {
+		m_u.clear();
+		m_s.clear();
+		m_v.clear();
+		return;
+	} // zero matrix
+
+	rsvd_reserve(m_u, m, k);
+	m_u = T_Scalar(0);
+	ops::mult(T_Scalar(1), op_t::N, m_y, op_t::C, m_vt.rblock(0, 0, k, l), m_u);
+
+	if(m_s.size() != k) m_s = T_RVector::init(k);
+	rsvd_reserve(m_v, n, k);
+
+	bulk::dns::copy(uplo_t::Full, k, 1, m_sigma.values(), k, m_s.values(), k);
+	bulk::dns::copy(uplo_t::Full, n, k, m_w.values(), m_w.ld(), m_v.values(), m_v.ld());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename RandomizedSvd<T_Matrix>::T_DnsMatrix RandomizedSvd<T_Matrix>::approximation() const
+{
+	if(!m_rank) {
+		throw err::InvalidOp("Decomposition is not computed or has zero rank");
+	} // empty
+
+	T_DnsMatrix us = m_u.copy();
+
+	for(uint_t j = 0; j < m_rank; j++) {
+		us.rcolumn(j).iscale(T_Scalar(m_s(j)));
+	} // j
+
+	T_DnsMatrix ret = T_DnsMatrix::init(m_u.nrows(), m_v.nrows());
+	ret = T_Scalar(0);
+	ops::mult(T_Scalar(1), op_t::N, us, op_t::C, m_v, ret);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class RandomizedSvd<dns::RdMatrix>;
+template class RandomizedSvd<dns::RfMatrix>;
+template class RandomizedSvd<dns::CdMatrix>;
+template class RandomizedSvd<dns::CfMatrix>;
+template class RandomizedSvd<csc::RdMatrix>;
+template class RandomizedSvd<csc::RfMatrix>;
+template class RandomizedSvd<csc::CdMatrix>;
+template class RandomizedSvd<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace lowrank
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_LOWRANK_RANDOMIZED_SVD_HPP_
+#define CLA3P_LOWRANK_RANDOMIZED_SVD_HPP_
+
+/**
+ * @file
+ * Randomized truncated singular value decomposition
+ */
+
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace lowrank { 
+/*-------------------------------------------------*/
+
+template <typename T_Matrix> class LowRankTraits { public: using dns_type = T_Matrix; };
+
+template <typename T_Int, typename T_Scalar> class LowRankTraits<csc::RxMatrix<T_Int,T_Scalar>> { public: using dns_type = dns::RxMatrix<T_Scalar>; };
+template <typename T_Int, typename T_Scalar> class LowRankTraits<csc::CxMatrix<T_Int,T_Scalar>> { public: using dns_type = dns::CxMatrix<T_Scalar>; };
+
+/**
+ * @ingroup module_index_lowrank
+ * @nosubgrouping
+ * @brief The randomized truncated singular value decomposition.
+ *
+ * Computes the leading k singular triplets <b>A ~ U * diag(S) * V<sup>H</sup></b> of a dense (dns::XxMatrix) 
+ * or sparse (csc::XxMatrix) matrix with a randomized range finder: 
+ * a Gaussian sketch of k + p columns, q power iterations (re-orthonormalized by QR) & a small SVD of the projected matrix.@n
+ * The matrix is accessed only through matrix-matrix products (ops::mult()), 
+ * the cost is O(m * n * (k + p) * (2 * q + 2)) for dense matrices.@n
+ * The internal workspace is kept between calls & reused for matrices with the same dimensions.
+ */
+template <typename T_Matrix>
+class RandomizedSvd {
+
+	using T_Scalar = typename T_Matrix::value_type;
+	using T_RScalar = typename TypeTraits<T_Scalar>::real_type;
+	using T_DnsMatrix = typename LowRankTraits<T_Matrix>::dns_type;
+	using T_RVector = dns::RxVector<T_RScalar>;
+
+	public:
+
+		// no copy
+		RandomizedSvd(const RandomizedSvd&) = delete;
+		RandomizedSvd& operator=(const RandomizedSvd&) = delete;
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty decomposition object.
+		 */
+		RandomizedSvd();
+
+		/**
+		 * @brief The rank constructor.
+		 * @param[in] k The target rank.
+		 */
+		explicit RandomizedSvd(uint_t k);
+
+		/**
+		 * @brief Destroys the object.
+		 */
+		~RandomizedSvd();
+
+		/**
+		 * @brief Clears the factors & the workspace.
+		 */
+		void clear();
+
+		/**
+		 * @brief Sets the target (maximum) rank k (default 10).
+		 */
+		void setRank(uint_t k);
+
+		/**
+		 * @brief Sets the number of oversampling columns p of the sketch (default 10).
+		 */
+		void setOversampling(uint_t p);
+
+		/**
+		 * @brief Sets the number of power iterations q (default 2).
+		 *
+		 * Power iterations improve the accuracy for slowly decaying singular values.
+		 */
+		void setPowerIterations(uint_t q);
+
+		/**
+		 * @brief Sets the relative truncation tolerance (default 0).
+		 *
+		 * Singular values smaller than tol * S(0) are discarded, the rank never exceeds the target rank.
+		 */
+		void setTolerance(T_RScalar tol);
+
+		/**
+		 * @brief Computes the truncated decomposition.
+		 * @param[in] mat A General, Symmetric or Hermitian matrix.
+		 */
+		void compute(const T_Matrix& mat);
+
+		/**
+		 * @brief The rank of the computed decomposition.
+		 */
+		uint_t rank() const;
+
+		/**
+		 * @brief The left singular vectors (m x rank).
+		 */
+		const T_DnsMatrix& U() const;
+
+		/**
+		 * @brief The singular values (size rank) in descending order.
+		 */
+		const T_RVector& S() const;
+
+		/**
+		 * @brief The right singular vectors (n x rank).
+		 */
+		const T_DnsMatrix& V() const;
+
+		/**
+		 * @brief Creates the (m x n) dense low-rank approximation U * diag(S) * V<sup>H</sup>.
+		 */
+		T_DnsMatrix approximation() const;
+
+	private:
+		uint_t m_k;
+		uint_t m_p;
+		uint_t m_q;
+		T_RScalar m_tol;
+		uint_t m_rank;
+
+		T_DnsMatrix m_u;
+		T_RVector m_s;
+		T_DnsMatrix m_v;
+
+		T_DnsMatrix m_y;
+		T_DnsMatrix m_z;
+		T_DnsMatrix m_qy;
+		T_DnsMatrix m_qz;
+		T_DnsMatrix m_tfactor;
+		T_DnsMatrix m_w;
+		T_DnsMatrix m_vt;
+		T_RVector m_sigma;
+		T_RVector m_superb;
+
+		void defaults();
+		void reserve(uint_t m, uint_t n, uint_t l);
+		void orthonormalize(T_DnsMatrix& Y, T_DnsMatrix& Q);
+};
+
+/*-------------------------------------------------*/
+} // namespace lowrank
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_LOWRANK_RANDOMIZED_SVD_HPP_
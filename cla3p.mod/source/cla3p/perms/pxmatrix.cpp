@@ -185,6 +185,21 @@ PxMatrix<T_Int> PxMatrix<T_Int>::random(uint_t n)
 	return ret;
 }
 /*-------------------------------------------------*/
+template <typename T_Int>
+PxMatrix<T_Int> PxMatrix<T_Int>::wrap(uint_t n, T_Int *vals, bool bind)
+{
+	PxMatrix<T_Int> ret;
+	ret.wrapper(n, 1, n, vals, bind, defaultProperty());
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Int>
+Guard<PxMatrix<T_Int>> PxMatrix<T_Int>::wrap(uint_t n, const T_Int *vals)
+{
+	Guard<PxMatrix<T_Int>> ret(wrap(n, const_cast<T_Int*>(vals), false));
+	return ret;
+}
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template class PxMatrix<int_t>;
@@ -226,13 +226,37 @@ class PxMatrix : public Array2D<T_Int> {
 		/**
 		 * @brief Creates a random permutation matrix
 		 *
-		 * Creates an n-sized permutation matrix with randomly rearranged indexes.
+		 * Creates an n-sized permutation matrix with uniformly shuffled indexes.
+		 * The permutation is reproducible for a given seed, see setRandomSeed().
 		 *
 		 * @param[in] n The permutation matrix size.
 		 * @return The newly created permutation matrix.
 		 */
 		static PxMatrix random(uint_t n);
 
+		/**
+		 * @brief Creates a permutation matrix from aux data.
+		 *
+		 * Creates an n-sized permutation matrix from bulk data.
+		 *
+		 * @param[in] n The permutation matrix size.
+		 * @param[in] vals The array containing the permutation matrix values.
+		 * @param[in] bind Binds the data to the permutation matrix, the matrix will deallocate vals on destroy using i_free().
+		 * @return The newly created permutation matrix.
+		 */
+		static PxMatrix wrap(uint_t n, T_Int *vals, bool bind);
+
+		/**
+		 * @brief Creates a guard from aux data.
+		 *
+		 * Creates an n-sized guarded permutation matrix from bulk data.
+		 *
+		 * @param[in] n The permutation matrix size.
+		 * @param[in] vals The array containing the permutation matrix values.
+		 * @return The newly created guard.
+		 */
+		static Guard<PxMatrix> wrap(uint_t n, const T_Int *vals);
+
 		/** @} */
 };
 
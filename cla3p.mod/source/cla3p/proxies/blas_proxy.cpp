@@ -250,6 +250,41 @@ hemv_macro(complex_t , z)
 hemv_macro(complex8_t, c)
 #undef hemv_macro
 /*-------------------------------------------------*/
+#define gbmv_macro(typein, prefix) \
+void gbmv(char trans, int_t m, int_t n, int_t kl, int_t ku, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy) \
+{ \
+	prefix##gbmv(&trans, &m, &n, &kl, &ku, &alpha, a, &lda, x, &incx, &beta, y, &incy); \
+}
+gbmv_macro(real_t    , d)
+gbmv_macro(real4_t   , s)
+gbmv_macro(complex_t , z)
+gbmv_macro(complex8_t, c)
+#undef gbmv_macro
+/*-------------------------------------------------*/
+#define sbmv_macro(typein, prefix) \
+void sbmv(char uplo, int_t n, int_t k, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy) \
+{ \
+	prefix##sbmv(&uplo, &n, &k, &alpha, a, &lda, x, &incx, &beta, y, &incy); \
+}
+sbmv_macro(real_t    , d)
+sbmv_macro(real4_t   , s)
+#undef sbmv_macro
+/*-------------------------------------------------*/
+#define hbmv_macro(typein, prefix) \
+void hbmv(char uplo, int_t n, int_t k, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy) \
+{ \
+	prefix##hbmv(&uplo, &n, &k, &alpha, a, &lda, x, &incx, &beta, y, &incy); \
+}
+hbmv_macro(complex_t , z)
+hbmv_macro(complex8_t, c)
+#undef hbmv_macro
+/*-------------------------------------------------*/
 #define trmv_macro(typein, prefix) \
 void trmv(char uplo, char transa, char diag, int_t n, \
 		const typein *a, int_t lda, typein *b, int_t incx) \
@@ -287,6 +322,20 @@ gemm_macro(complex_t , z)
 gemm_macro(complex8_t, c)
 #undef gemm_macro
 /*-------------------------------------------------*/
+#define gemm_batch_strided_macro(typein, prefix) \
+void gemm_batch_strided(char transa, char transb, int_t m, int_t n, int_t k, \
+		typein alpha, const typein *a, int_t lda, int_t stridea, const typein *b, int_t ldb, int_t strideb, \
+		typein beta, typein *c, int_t ldc, int_t stridec, int_t batch_size) \
+{ \
+	prefix##gemm_batch_strided(&transa, &transb, &m, &n, &k, &alpha, a, &lda, &stridea, b, &ldb, &strideb, \
+			&beta, c, &ldc, &stridec, &batch_size); \
+}
+gemm_batch_strided_macro(real_t    , d)
+gemm_batch_strided_macro(real4_t   , s)
+gemm_batch_strided_macro(complex_t , z)
+gemm_batch_strided_macro(complex8_t, c)
+#undef gemm_batch_strided_macro
+/*-------------------------------------------------*/
 #define gemmt_macro(typein, prefix) \
 void gemmt(char uplo, char transa, char transb, int_t n, int_t k, \
 		typein alpha, const typein *a, int_t lda, const typein *b, int_t ldb, \
@@ -183,6 +183,32 @@ hemv_macro(complex_t);
 hemv_macro(complex8_t);
 #undef hemv_macro
 
+#define gbmv_macro(typein) \
+void gbmv(char trans, int_t m, int_t n, int_t kl, int_t ku, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy)
+gbmv_macro(real_t);
+gbmv_macro(real4_t);
+gbmv_macro(complex_t);
+gbmv_macro(complex8_t);
+#undef gbmv_macro
+
+#define sbmv_macro(typein) \
+void sbmv(char uplo, int_t n, int_t k, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy)
+sbmv_macro(real_t);
+sbmv_macro(real4_t);
+#undef sbmv_macro
+
+#define hbmv_macro(typein) \
+void hbmv(char uplo, int_t n, int_t k, typein alpha, \
+		const typein *a, int_t lda, const typein *x, int_t incx, \
+		typein beta, typein *y, int_t incy)
+hbmv_macro(complex_t);
+hbmv_macro(complex8_t);
+#undef hbmv_macro
+
 #define trmv_macro(typein) \
 void trmv(char uplo, char transa, char diag, int_t n, \
 		const typein *a, int_t lda, typein *b, int_t incx)
@@ -213,6 +239,16 @@ gemm_macro(complex_t);
 gemm_macro(complex8_t);
 #undef gemm_macro
 
+#define gemm_batch_strided_macro(typein) \
+void gemm_batch_strided(char transa, char transb, int_t m, int_t n, int_t k, \
+           typein alpha, const typein *a, int_t lda, int_t stridea, const typein *b, int_t ldb, int_t strideb, \
+           typein beta, typein *c, int_t ldc, int_t stridec, int_t batch_size)
+gemm_batch_strided_macro(real_t);
+gemm_batch_strided_macro(real4_t);
+gemm_batch_strided_macro(complex_t);
+gemm_batch_strided_macro(complex8_t);
+#undef gemm_batch_strided_macro
+
 #define gemmt_macro(typein) \
 void gemmt(char uplo, char transa, char transb, int_t n, int_t k, \
            typein alpha, const typein *a, int_t lda, const typein *b, int_t ldb, \
@@ -294,6 +294,145 @@ potrs_macro(complex_t , z)
 potrs_macro(complex8_t, c)
 #undef potrs_macro
 /*-------------------------------------------------*/
+#define pftrf_macro(typein, prefix) \
+int_t pftrf(char transr, char uplo, int_t n, typein *a) \
+{ \
+	return LAPACKE_##prefix##pftrf(LAPACK_COL_MAJOR, transr, uplo, n, a); \
+}
+pftrf_macro(real_t    , d)
+pftrf_macro(real4_t   , s)
+pftrf_macro(complex_t , z)
+pftrf_macro(complex8_t, c)
+#undef pftrf_macro
+/*-------------------------------------------------*/
+#define pftrs_macro(typein, prefix) \
+int_t pftrs(char transr, char uplo, int_t n, int_t nrhs, const typein *a, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##pftrs(LAPACK_COL_MAJOR, transr, uplo, n, nrhs, a, b, ldb); \
+}
+pftrs_macro(real_t    , d)
+pftrs_macro(real4_t   , s)
+pftrs_macro(complex_t , z)
+pftrs_macro(complex8_t, c)
+#undef pftrs_macro
+/*-------------------------------------------------*/
+#define trttf_macro(typein, prefix) \
+int_t trttf(char transr, char uplo, int_t n, const typein *a, int_t lda, typein *arf) \
+{ \
+	return LAPACKE_##prefix##trttf(LAPACK_COL_MAJOR, transr, uplo, n, a, lda, arf); \
+}
+trttf_macro(real_t    , d)
+trttf_macro(real4_t   , s)
+trttf_macro(complex_t , z)
+trttf_macro(complex8_t, c)
+#undef trttf_macro
+/*-------------------------------------------------*/
+#define tfttr_macro(typein, prefix) \
+int_t tfttr(char transr, char uplo, int_t n, const typein *arf, typein *a, int_t lda) \
+{ \
+	return LAPACKE_##prefix##tfttr(LAPACK_COL_MAJOR, transr, uplo, n, arf, a, lda); \
+}
+tfttr_macro(real_t    , d)
+tfttr_macro(real4_t   , s)
+tfttr_macro(complex_t , z)
+tfttr_macro(complex8_t, c)
+#undef tfttr_macro
+/*-------------------------------------------------*/
+#define gbtrf_macro(typein, prefix) \
+int_t gbtrf(int_t m, int_t n, int_t kl, int_t ku, typein *ab, int_t ldab, int_t *ipiv) \
+{ \
+	return LAPACKE_##prefix##gbtrf(LAPACK_COL_MAJOR, m, n, kl, ku, ab, ldab, ipiv); \
+}
+gbtrf_macro(real_t    , d)
+gbtrf_macro(real4_t   , s)
+gbtrf_macro(complex_t , z)
+gbtrf_macro(complex8_t, c)
+#undef gbtrf_macro
+/*-------------------------------------------------*/
+#define gbtrs_macro(typein, prefix) \
+int_t gbtrs(char trans, int_t n, int_t kl, int_t ku, int_t nrhs, const typein *ab, int_t ldab, const int_t *ipiv, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##gbtrs(LAPACK_COL_MAJOR, trans, n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb); \
+}
+gbtrs_macro(real_t    , d)
+gbtrs_macro(real4_t   , s)
+gbtrs_macro(complex_t , z)
+gbtrs_macro(complex8_t, c)
+#undef gbtrs_macro
+/*-------------------------------------------------*/
+#define pbtrf_macro(typein, prefix) \
+int_t pbtrf(char uplo, int_t n, int_t kd, typein *ab, int_t ldab) \
+{ \
+	return LAPACKE_##prefix##pbtrf(LAPACK_COL_MAJOR, uplo, n, kd, ab, ldab); \
+}
+pbtrf_macro(real_t    , d)
+pbtrf_macro(real4_t   , s)
+pbtrf_macro(complex_t , z)
+pbtrf_macro(complex8_t, c)
+#undef pbtrf_macro
+/*-------------------------------------------------*/
+#define pbtrs_macro(typein, prefix) \
+int_t pbtrs(char uplo, int_t n, int_t kd, int_t nrhs, const typein *ab, int_t ldab, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##pbtrs(LAPACK_COL_MAJOR, uplo, n, kd, nrhs, ab, ldab, b, ldb); \
+}
+pbtrs_macro(real_t    , d)
+pbtrs_macro(real4_t   , s)
+pbtrs_macro(complex_t , z)
+pbtrs_macro(complex8_t, c)
+#undef pbtrs_macro
+/*-------------------------------------------------*/
+#define gttrf_macro(typein, prefix) \
+int_t gttrf(int_t n, typein *dl, typein *d, typein *du, typein *du2, int_t *ipiv) \
+{ \
+	return LAPACKE_##prefix##gttrf(n, dl, d, du, du2, ipiv); \
+}
+gttrf_macro(real_t    , d)
+gttrf_macro(real4_t   , s)
+gttrf_macro(complex_t , z)
+gttrf_macro(complex8_t, c)
+#undef gttrf_macro
+/*-------------------------------------------------*/
+#define gttrs_macro(typein, prefix) \
+int_t gttrs(char trans, int_t n, int_t nrhs, const typein *dl, const typein *d, const typein *du, const typein *du2, const int_t *ipiv, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##gttrs(LAPACK_COL_MAJOR, trans, n, nrhs, dl, d, du, du2, ipiv, b, ldb); \
+}
+gttrs_macro(real_t    , d)
+gttrs_macro(real4_t   , s)
+gttrs_macro(complex_t , z)
+gttrs_macro(complex8_t, c)
+#undef gttrs_macro
+/*-------------------------------------------------*/
+#define pttrf_macro(typein, prefix) \
+int_t pttrf(int_t n, TypeTraits<typein>::real_type *d, typein *e) \
+{ \
+	return LAPACKE_##prefix##pttrf(n, d, e); \
+}
+pttrf_macro(real_t    , d)
+pttrf_macro(real4_t   , s)
+pttrf_macro(complex_t , z)
+pttrf_macro(complex8_t, c)
+#undef pttrf_macro
+/*-------------------------------------------------*/
+#define pttrs_macro(typein, prefix) \
+int_t pttrs(char /*uplo*/, int_t n, int_t nrhs, const TypeTraits<typein>::real_type *d, const typein *e, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##pttrs(LAPACK_COL_MAJOR, n, nrhs, d, e, b, ldb); \
+}
+pttrs_macro(real_t    , d)
+pttrs_macro(real4_t   , s)
+#undef pttrs_macro
+/*-------------------------------------------------*/
+#define pttrs_macro(typein, prefix) \
+int_t pttrs(char uplo, int_t n, int_t nrhs, const TypeTraits<typein>::real_type *d, const typein *e, typein *b, int_t ldb) \
+{ \
+	return LAPACKE_##prefix##pttrs(LAPACK_COL_MAJOR, uplo, n, nrhs, d, e, b, ldb); \
+}
+pttrs_macro(complex_t , z)
+pttrs_macro(complex8_t, c)
+#undef pttrs_macro
+/*-------------------------------------------------*/
 #define trtrs_macro(typein, prefix) \
 int_t trtrs(char uplo, char trans, char diag, int_t n, int_t nrhs, const typein *a, int_t lda, typein *b, int_t ldb) \
 { \
@@ -318,6 +457,54 @@ gesvd_macro(complex_t , z)
 gesvd_macro(complex8_t, c)
 #undef gesvd_macro
 /*-------------------------------------------------*/
+#define geqrt_macro(typein, prefix) \
+int_t geqrt(int_t m, int_t n, int_t nb, typein *a, int_t lda, typein *t, int_t ldt) \
+{ \
+	return LAPACKE_##prefix##geqrt(LAPACK_COL_MAJOR, m, n, nb, a, lda, t, ldt); \
+}
+geqrt_macro(real_t    , d)
+geqrt_macro(real4_t   , s)
+geqrt_macro(complex_t , z)
+geqrt_macro(complex8_t, c)
+#undef geqrt_macro
+/*-------------------------------------------------*/
+#define gemqrt_macro(typein, prefix, conjtrans) \
+int_t gemqrt(char side, char trans, int_t m, int_t n, int_t k, int_t nb, \
+		const typein *v, int_t ldv, const typein *t, int_t ldt, typein *c, int_t ldc) \
+{ \
+	if(trans == 'C' || trans == 'T') trans = conjtrans; \
+	return LAPACKE_##prefix##gemqrt(LAPACK_COL_MAJOR, side, trans, m, n, k, nb, v, ldv, t, ldt, c, ldc); \
+}
+gemqrt_macro(real_t    , d, 'T')
+gemqrt_macro(real4_t   , s, 'T')
+gemqrt_macro(complex_t , z, 'C')
+gemqrt_macro(complex8_t, c, 'C')
+#undef gemqrt_macro
+/*-------------------------------------------------*/
+#define geqp3_macro(typein, prefix) \
+int_t geqp3(int_t m, int_t n, typein *a, int_t lda, int_t *jpvt, typein *tau) \
+{ \
+	return LAPACKE_##prefix##geqp3(LAPACK_COL_MAJOR, m, n, a, lda, jpvt, tau); \
+}
+geqp3_macro(real_t    , d)
+geqp3_macro(real4_t   , s)
+geqp3_macro(complex_t , z)
+geqp3_macro(complex8_t, c)
+#undef geqp3_macro
+/*-------------------------------------------------*/
+#define unmqr_macro(typein, prefix, conjtrans) \
+int_t unmqr(char side, char trans, int_t m, int_t n, int_t k, \
+		const typein *a, int_t lda, const typein *tau, typein *c, int_t ldc) \
+{ \
+	if(trans == 'C' || trans == 'T') trans = conjtrans; \
+	return LAPACKE_##prefix(LAPACK_COL_MAJOR, side, trans, m, n, k, a, lda, tau, c, ldc); \
+}
+unmqr_macro(real_t    , dormqr, 'T')
+unmqr_macro(real4_t   , sormqr, 'T')
+unmqr_macro(complex_t , zunmqr, 'C')
+unmqr_macro(complex8_t, cunmqr, 'C')
+#undef unmqr_macro
+/*-------------------------------------------------*/
 } // namespace lapack
 } // namespace cla3p
 /*-------------------------------------------------*/
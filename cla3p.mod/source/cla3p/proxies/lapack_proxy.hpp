@@ -195,6 +195,102 @@ potrs_macro(complex_t);
 potrs_macro(complex8_t);
 #undef potrs_macro
 
+#define pftrf_macro(typein) \
+int_t pftrf(char transr, char uplo, int_t n, typein *a)
+pftrf_macro(real_t);
+pftrf_macro(real4_t);
+pftrf_macro(complex_t);
+pftrf_macro(complex8_t);
+#undef pftrf_macro
+
+#define pftrs_macro(typein) \
+int_t pftrs(char transr, char uplo, int_t n, int_t nrhs, const typein *a, typein *b, int_t ldb)
+pftrs_macro(real_t);
+pftrs_macro(real4_t);
+pftrs_macro(complex_t);
+pftrs_macro(complex8_t);
+#undef pftrs_macro
+
+#define trttf_macro(typein) \
+int_t trttf(char transr, char uplo, int_t n, const typein *a, int_t lda, typein *arf)
+trttf_macro(real_t);
+trttf_macro(real4_t);
+trttf_macro(complex_t);
+trttf_macro(complex8_t);
+#undef trttf_macro
+
+#define tfttr_macro(typein) \
+int_t tfttr(char transr, char uplo, int_t n, const typein *arf, typein *a, int_t lda)
+tfttr_macro(real_t);
+tfttr_macro(real4_t);
+tfttr_macro(complex_t);
+tfttr_macro(complex8_t);
+#undef tfttr_macro
+
+#define gbtrf_macro(typein) \
+int_t gbtrf(int_t m, int_t n, int_t kl, int_t ku, typein *ab, int_t ldab, int_t *ipiv)
+gbtrf_macro(real_t);
+gbtrf_macro(real4_t);
+gbtrf_macro(complex_t);
+gbtrf_macro(complex8_t);
+#undef gbtrf_macro
+
+#define gbtrs_macro(typein) \
+int_t gbtrs(char trans, int_t n, int_t kl, int_t ku, int_t nrhs, const typein *ab, int_t ldab, const int_t *ipiv, typein *b, int_t ldb)
+gbtrs_macro(real_t);
+gbtrs_macro(real4_t);
+gbtrs_macro(complex_t);
+gbtrs_macro(complex8_t);
+#undef gbtrs_macro
+
+#define pbtrf_macro(typein) \
+int_t pbtrf(char uplo, int_t n, int_t kd, typein *ab, int_t ldab)
+pbtrf_macro(real_t);
+pbtrf_macro(real4_t);
+pbtrf_macro(complex_t);
+pbtrf_macro(complex8_t);
+#undef pbtrf_macro
+
+#define pbtrs_macro(typein) \
+int_t pbtrs(char uplo, int_t n, int_t kd, int_t nrhs, const typein *ab, int_t ldab, typein *b, int_t ldb)
+pbtrs_macro(real_t);
+pbtrs_macro(real4_t);
+pbtrs_macro(complex_t);
+pbtrs_macro(complex8_t);
+#undef pbtrs_macro
+
+#define gttrf_macro(typein) \
+int_t gttrf(int_t n, typein *dl, typein *d, typein *du, typein *du2, int_t *ipiv)
+gttrf_macro(real_t);
+gttrf_macro(real4_t);
+gttrf_macro(complex_t);
+gttrf_macro(complex8_t);
+#undef gttrf_macro
+
+#define gttrs_macro(typein) \
+int_t gttrs(char trans, int_t n, int_t nrhs, const typein *dl, const typein *d, const typein *du, const typein *du2, const int_t *ipiv, typein *b, int_t ldb)
+gttrs_macro(real_t);
+gttrs_macro(real4_t);
+gttrs_macro(complex_t);
+gttrs_macro(complex8_t);
+#undef gttrs_macro
+
+#define pttrf_macro(typein) \
+int_t pttrf(int_t n, TypeTraits<typein>::real_type *d, typein *e)
+pttrf_macro(real_t);
+pttrf_macro(real4_t);
+pttrf_macro(complex_t);
+pttrf_macro(complex8_t);
+#undef pttrf_macro
+
+#define pttrs_macro(typein) \
+int_t pttrs(char uplo, int_t n, int_t nrhs, const TypeTraits<typein>::real_type *d, const typein *e, typein *b, int_t ldb)
+pttrs_macro(real_t);
+pttrs_macro(real4_t);
+pttrs_macro(complex_t);
+pttrs_macro(complex8_t);
+#undef pttrs_macro
+
 #define trtrs_macro(typein) \
 int_t trtrs(char uplo, char trans, char diag, int_t n, int_t nrhs, const typein *a, int_t lda, typein *b, int_t ldb)
 trtrs_macro(real_t);
@@ -213,6 +309,40 @@ gesvd_macro(complex_t);
 gesvd_macro(complex8_t);
 #undef gesvd_macro
 
+#define geqrt_macro(typein) \
+int_t geqrt(int_t m, int_t n, int_t nb, typein *a, int_t lda, typein *t, int_t ldt)
+geqrt_macro(real_t);
+geqrt_macro(real4_t);
+geqrt_macro(complex_t);
+geqrt_macro(complex8_t);
+#undef geqrt_macro
+
+#define gemqrt_macro(typein) \
+int_t gemqrt(char side, char trans, int_t m, int_t n, int_t k, int_t nb, \
+		const typein *v, int_t ldv, const typein *t, int_t ldt, typein *c, int_t ldc)
+gemqrt_macro(real_t);
+gemqrt_macro(real4_t);
+gemqrt_macro(complex_t);
+gemqrt_macro(complex8_t);
+#undef gemqrt_macro
+
+#define geqp3_macro(typein) \
+int_t geqp3(int_t m, int_t n, typein *a, int_t lda, int_t *jpvt, typein *tau)
+geqp3_macro(real_t);
+geqp3_macro(real4_t);
+geqp3_macro(complex_t);
+geqp3_macro(complex8_t);
+#undef geqp3_macro
+
+#define unmqr_macro(typein) \
+int_t unmqr(char side, char trans, int_t m, int_t n, int_t k, \
+		const typein *a, int_t lda, const typein *tau, typein *c, int_t ldc)
+unmqr_macro(real_t);
+unmqr_macro(real4_t);
+unmqr_macro(complex_t);
+unmqr_macro(complex8_t);
+#undef unmqr_macro
+
 /*-------------------------------------------------*/
 } // namespace lapack
 } // namespace cla3p
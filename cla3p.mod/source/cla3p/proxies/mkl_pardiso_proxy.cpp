@@ -0,0 +1,213 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/proxies/mkl_pardiso_proxy.hpp"
+
+// system
+#include <string>
+#include <type_traits>
+
+// 3rd
+#include <mkl.h>
+
+// cla3p
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace mkl {
+/*-------------------------------------------------*/
+static std::string pardiso_error_message(MKL_INT error)
+{
+	switch(error) {
+		case  -1: return "input inconsistent";
+		case  -2: return "not enough memory";
+		case  -3: return "reordering problem";
+		case  -4: return "zero pivot, numerical factorization or iterative refinement problem";
+		case  -5: return "unclassified (internal) error";
+		case  -6: return "reordering failed";
+		case  -7: return "diagonal matrix is singular";
+		case  -8: return "32-bit integer overflow problem";
+		case  -9: return "not enough memory for OOC";
+		case -10: return "error opening OOC files";
+		case -11: return "read/write error with OOC files";
+		default : return "unknown error";
+	} // error
+}
+/*-------------------------------------------------*/
+static void pardiso_error_check(MKL_INT error)
+{
+	if(error) {
+		throw err::Exception("Pardiso error " + std::to_string(error) + ": " + pardiso_error_message(error));
+	} // error
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static MKL_INT pardiso_mtype(prop_t ptype, bool definite)
+{
+	bool cmplx = TypeTraits<T_Scalar>::is_complex();
+
+	if(ptype == prop_t::General) return (cmplx ? 13 : 11);
+	if(ptype == prop_t::Hermitian && cmplx) return (definite ? 4 : -4);
+	if(ptype == prop_t::Symmetric && cmplx && !definite) return 6;
+	if(ptype == prop_t::Symmetric && !cmplx) return (definite ? 2 : -2);
+
+	throw err::Exception("Unreachable");
+	return 0;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+struct Pardiso<T_Scalar>::Impl {
+	void*   pt[64];
+	MKL_INT iparm[64];
+	MKL_INT mtype;
+	MKL_INT n;
+	bool    analyzed;
+	bool    factorized;
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void pardiso_call(void **pt, MKL_INT *iparm, MKL_INT mtype, MKL_INT phase, MKL_INT n, 
+		const int_t *rowptr, const int_t *colidx, const T_Scalar *values, 
+		MKL_INT nrhs, T_Scalar *b, T_Scalar *x)
+{
+	MKL_INT maxfct = 1;
+	MKL_INT mnum   = 1;
+	MKL_INT msglvl = 0;
+	MKL_INT idum   = 0;
+	MKL_INT error  = 0;
+
+	pardiso(pt, &maxfct, &mnum, &mtype, &phase, &n, 
+			values, rowptr, colidx, &idum, &nrhs, iparm, &msglvl, b, x, &error);
+
+	pardiso_error_check(error);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+Pardiso<T_Scalar>::Pardiso(prop_t ptype, bool definite)
+	: m_impl(new Impl)
+{
+	for(MKL_INT i = 0; i < 64; i++) {
+		m_impl->pt[i] = nullptr;
+	} // i
+
+	m_impl->mtype = pardiso_mtype<T_Scalar>(ptype, definite);
+	m_impl->n = 0;
+	m_impl->analyzed = false;
+	m_impl->factorized = false;
+
+	pardisoinit(m_impl->pt, &m_impl->mtype, m_impl->iparm);
+
+	m_impl->iparm[ 0] = 1;  // user settings
+	m_impl->iparm[ 1] = 3;  // parallel (OpenMP) nested dissection ordering
+	m_impl->iparm[ 5] = 0;  // solution in x, b is not overwritten
+	m_impl->iparm[17] = -1; // report the number of factor non zeros
+	m_impl->iparm[26] = 0;  // no matrix checker
+	m_impl->iparm[27] = (std::is_same<typename TypeTraits<T_Scalar>::real_type,real4_t>::value ? 1 : 0); // single precision
+	m_impl->iparm[34] = 1;  // zero-based indexing
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+Pardiso<T_Scalar>::~Pardiso()
+{
+	clear();
+	delete m_impl;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bool Pardiso<T_Scalar>::analyzed() const
+{
+	return m_impl->analyzed;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+bool Pardiso<T_Scalar>::factorized() const
+{
+	return m_impl->factorized;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+uint_t Pardiso<T_Scalar>::factorNnz() const
+{
+	return (m_impl->analyzed ? static_cast<uint_t>(m_impl->iparm[17]) : 0);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Pardiso<T_Scalar>::clear()
+{
+	if(m_impl->analyzed) {
+
+		MKL_INT maxfct = 1;
+		MKL_INT mnum   = 1;
+		MKL_INT msglvl = 0;
+		MKL_INT phase  = -1;
+		MKL_INT idum   = 0;
+		MKL_INT nrhs   = 0;
+		MKL_INT error  = 0;
+
+		pardiso(m_impl->pt, &maxfct, &mnum, &m_impl->mtype, &phase, &m_impl->n, 
+				nullptr, nullptr, nullptr, &idum, &nrhs, m_impl->iparm, &msglvl, nullptr, nullptr, &error);
+
+	} // release
+
+	m_impl->n = 0;
+	m_impl->analyzed = false;
+	m_impl->factorized = false;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Pardiso<T_Scalar>::analyze(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values)
+{
+	clear();
+
+	m_impl->n = n;
+	m_impl->iparm[17] = -1;
+	pardiso_call<T_Scalar>(m_impl->pt, m_impl->iparm, m_impl->mtype, 11, m_impl->n, rowptr, colidx, values, 0, nullptr, nullptr);
+	m_impl->analyzed = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Pardiso<T_Scalar>::factorize(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values)
+{
+	if(!m_impl->analyzed || static_cast<uint_t>(m_impl->n) != n) {
+		analyze(n, rowptr, colidx, values);
+	} // analysis
+
+	m_impl->factorized = false;
+	pardiso_call<T_Scalar>(m_impl->pt, m_impl->iparm, m_impl->mtype, 22, m_impl->n, rowptr, colidx, values, 0, nullptr, nullptr);
+	m_impl->factorized = true;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void Pardiso<T_Scalar>::solve(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values, 
+		uint_t nrhs, T_Scalar *b, T_Scalar *x) const
+{
+	if(!m_impl->factorized || static_cast<uint_t>(m_impl->n) != n) {
+		throw err::InvalidOp("Decomposition stage is not performed");
+	} // factorized
+
+	pardiso_call<T_Scalar>(m_impl->pt, m_impl->iparm, m_impl->mtype, 33, m_impl->n, rowptr, colidx, values, nrhs, b, x);
+}
+/*-------------------------------------------------*/
+template class Pardiso<real_t>;
+template class Pardiso<real4_t>;
+template class Pardiso<complex_t>;
+template class Pardiso<complex8_t>;
+/*-------------------------------------------------*/
+} // namespace mkl
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_MKL_PARDISO_PROXY_HPP_
+#define CLA3P_MKL_PARDISO_PROXY_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace mkl {
+/*-------------------------------------------------*/
+
+//
+// Sparse direct solver handle (PARDISO) for a square matrix in zero-based csr format
+// Symmetric/Hermitian types expect the upper triangle with all diagonal entries stored
+// The symbolic stage (fill-reducing ordering & symbolic factorization) runs in analyze()
+// and is reused by every factorize() until the next analyze() or clear()
+// Does not own the csr arrays, they must be passed to every stage
+//
+template <typename T_Scalar>
+class Pardiso {
+
+	public:
+		explicit Pardiso(prop_t ptype, bool definite);
+		~Pardiso();
+
+		Pardiso(const Pardiso<T_Scalar>&) = delete;
+		Pardiso<T_Scalar>& operator=(const Pardiso<T_Scalar>&) = delete;
+
+		bool analyzed() const;
+		bool factorized() const;
+		uint_t factorNnz() const;
+
+		void clear();
+
+		void analyze(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values);
+		void factorize(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values);
+		void solve(uint_t n, const int_t *rowptr, const int_t *colidx, const T_Scalar *values, 
+				uint_t nrhs, T_Scalar *b, T_Scalar *x) const;
+
+	private:
+		struct Impl;
+
+		Impl* m_impl;
+};
+
+/*-------------------------------------------------*/
+} // namespace mkl
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_MKL_PARDISO_PROXY_HPP_
@@ -231,13 +231,16 @@ class CsxMatrix {
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 CsxMatrix<T_Scalar>::CsxMatrix() 
+	: m_mat(nullptr)
 {
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 CsxMatrix<T_Scalar>::~CsxMatrix() 
 {
-	spcheck(mkl_sparse_destroy(mat()));
+	if(mat()) {
+		mkl_sparse_destroy(mat());
+	} // mat
 }
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -496,6 +499,201 @@ instantiate_csc_mm(real_t);
 instantiate_csc_mm(real4_t);
 instantiate_csc_mm(complex_t);
 instantiate_csc_mm(complex8_t);
+#undef instantiate_csc_mm
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+static void hint_check(sparse_status_t ierr)
+{
+	//
+	// Hints & optimization are advisory, unsupported combos fall back to the default kernels
+	//
+	if(ierr != SPARSE_STATUS_NOT_SUPPORTED) spcheck(ierr);
+}
+/*-------------------------------------------------*/
+static int op2hintbit(op_t op)
+{
+	if(op == op_t::N) return 1;
+	if(op == op_t::T) return 2;
+	if(op == op_t::C) return 4;
+
+	return 0;
+}
+/*-------------------------------------------------*/
+static bool same_descriptor(const struct matrix_descr& d1, const struct matrix_descr& d2)
+{
+	return (d1.type == d2.type && d1.mode == d2.mode && d1.diag == d2.diag);
+}
+/*-------------------------------------------------*/
+struct HintedMatrix {
+	sparse_matrix_t     mat;
+	struct matrix_descr descr;
+	int                 mvhints;
+	int                 mmhints;
+};
+/*-------------------------------------------------*/
+static void hinted_matrix_defaults(HintedMatrix& A)
+{
+	A.mat = nullptr;
+	A.mvhints = 0;
+	A.mmhints = 0;
+}
+/*-------------------------------------------------*/
+static void hinted_matrix_clear(HintedMatrix& A)
+{
+	if(A.mat) {
+		mkl_sparse_destroy(A.mat);
+	} // mat
+
+	hinted_matrix_defaults(A);
+}
+/*-------------------------------------------------*/
+static void hinted_mv_prepare(HintedMatrix& A, sparse_operation_t op, uint_t ncalls, int hintbit)
+{
+	if(A.mvhints & hintbit) return;
+
+	hint_check(mkl_sparse_set_mv_hint(A.mat, op, A.descr, ncalls));
+	hint_check(mkl_sparse_optimize(A.mat));
+
+	A.mvhints |= hintbit;
+}
+/*-------------------------------------------------*/
+static void hinted_mm_prepare(HintedMatrix& A, sparse_operation_t op, uint_t k, uint_t ncalls, int hintbit)
+{
+	if(A.mmhints & hintbit) return;
+
+	hint_check(mkl_sparse_set_mm_hint(A.mat, op, A.descr, SPARSE_LAYOUT_COLUMN_MAJOR, k, ncalls));
+	hint_check(mkl_sparse_optimize(A.mat));
+
+	A.mmhints |= hintbit;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+struct CscHandle<T_Scalar>::Impl {
+	HintedMatrix csc;
+	HintedMatrix csr; // transpose view, used for dense column ordering
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+CscHandle<T_Scalar>::CscHandle(uint_t ncalls)
+	: m_ncalls(ncalls), m_impl(new Impl)
+{
+	hinted_matrix_defaults(m_impl->csc);
+	hinted_matrix_defaults(m_impl->csr);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+CscHandle<T_Scalar>::~CscHandle()
+{
+	clear();
+	delete m_impl;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+uint_t CscHandle<T_Scalar>::ncalls() const
+{
+	return m_ncalls;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void CscHandle<T_Scalar>::clear()
+{
+	hinted_matrix_clear(m_impl->csc);
+	hinted_matrix_clear(m_impl->csr);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void hinted_csc_prepare(HintedMatrix& A, const Property& pr, uint_t m, uint_t n, 
+		const int_t* colptr, const int_t* rowidx, const T_Scalar* values)
+{
+	struct matrix_descr descr = create_descriptor(pr);
+
+	if(A.mat && same_descriptor(A.descr, descr)) return;
+
+	hinted_matrix_clear(A);
+	sparse_create_csc(&A.mat, m, n, const_cast<int_t*>(colptr), const_cast<int_t*>(rowidx), const_cast<T_Scalar*>(values));
+	A.descr = descr;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+static void hinted_csr_prepare(HintedMatrix& A, const Property& pr, uint_t m, uint_t n, 
+		const int_t* rowptr, const int_t* colidx, const T_Scalar* values)
+{
+	struct matrix_descr descr = create_descriptor(pr);
+
+	if(A.mat && same_descriptor(A.descr, descr)) return;
+
+	hinted_matrix_clear(A);
+	sparse_create_csr(&A.mat, m, n, const_cast<int_t*>(rowptr), const_cast<int_t*>(colidx), const_cast<T_Scalar*>(values));
+	A.descr = descr;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void CscHandle<T_Scalar>::mv(prop_t propA, uplo_t uploA, uint_t m, uint_t n, T_Scalar alpha, op_t opA,
+		const int_t* colptrA, const int_t* rowidxA, const T_Scalar* valuesA,
+		const T_Scalar* x, T_Scalar beta, T_Scalar *y)
+{
+	HintedMatrix& A = m_impl->csc;
+
+	Property prA(propA, uploA);
+	sparse_operation_t op = op2sparseop(opA);
+
+	hinted_csc_prepare(A, prA, m, n, colptrA, rowidxA, valuesA);
+	hinted_mv_prepare(A, op, ncalls(), op2hintbit(opA));
+
+	sparse_mv(op, alpha, A.mat, A.descr, x, beta, y);
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void CscHandle<T_Scalar>::mm(prop_t propA, uplo_t uploA, uint_t m, uint_t n, T_Scalar alpha, op_t opA,
+		const int_t* colptrA, const int_t* rowidxA, const T_Scalar* valuesA,
+		uint_t k, const T_Scalar* b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc)
+{
+	//
+	// Same dispatch as csc_mm(), with persistent handles
+	//
+
+	Property prA(propA, uploA);
+
+	if((prA.isGeneral() || prA.isTriangular()) && opA == op_t::C) {
+
+		HintedMatrix& A = m_impl->csc;
+		sparse_operation_t op = op2sparseop(opA);
+
+		hinted_csc_prepare(A, prA, m, n, colptrA, rowidxA, valuesA);
+		hinted_mv_prepare(A, op, ncalls() * k, op2hintbit(opA));
+
+		for(uint_t l = 0; l < k; l++) {
+			sparse_mv(op, alpha, A.mat, A.descr, bulk::dns::ptrmv(ldb,b,0,l), beta, bulk::dns::ptrmv(ldc,c,0,l));
+		} // l
+
+	} else {
+
+		HintedMatrix& A = m_impl->csr;
+
+		prA.switchUplo();
+
+		op_t opT = opA;
+		if(prA.isGeneral() || prA.isTriangular()) {
+			opT = (opA == op_t::N ? op_t::T : op_t::N);
+		} // general
+
+		sparse_operation_t op = op2sparseop(opT);
+
+		hinted_csr_prepare(A, prA, n, m, colptrA, rowidxA, valuesA);
+		hinted_mm_prepare(A, op, k, ncalls(), op2hintbit(opT));
+
+		sparse_mm(op, alpha, A.mat, A.descr, b, k, ldb, beta, c, ldc);
+
+	} // prop / op
+}
+/*-------------------------------------------------*/
+template class CscHandle<real_t>;
+template class CscHandle<real4_t>;
+template class CscHandle<complex_t>;
+template class CscHandle<complex8_t>;
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 template <typename T_Scalar>
 void csc_spmm(op_t opA,
@@ -58,6 +58,42 @@ void csc_sp2md(T_Scalar alpha,
     op_t opB, uint_t mB, uint_t nB, const int_t* colptrB, const int_t* rowidxB, const T_Scalar* valuesB,
     T_Scalar beta, T_Scalar* c, uint_t ldc);
 
+/*-------------------------------------------------*/
+
+//
+// Persistent inspector-executor handle for a csc matrix
+// Created lazily on first use, hinted for ncalls products & optimized
+// Does not own the csc arrays, they must outlive the handle
+//
+template <typename T_Scalar>
+class CscHandle {
+
+	public:
+		explicit CscHandle(uint_t ncalls);
+		~CscHandle();
+
+		CscHandle(const CscHandle<T_Scalar>&) = delete;
+		CscHandle<T_Scalar>& operator=(const CscHandle<T_Scalar>&) = delete;
+
+		uint_t ncalls() const;
+
+		void clear();
+
+		void mv(prop_t propA, uplo_t uploA, uint_t m, uint_t n, T_Scalar alpha, op_t opA,
+				const int_t* colptrA, const int_t* rowidxA, const T_Scalar* valuesA, 
+				const T_Scalar* x, T_Scalar beta, T_Scalar *y);
+
+		void mm(prop_t propA, uplo_t uploA, uint_t m, uint_t n, T_Scalar alpha, op_t opA,
+				const int_t* colptrA, const int_t* rowidxA, const T_Scalar* valuesA, 
+				uint_t k, const T_Scalar* b, uint_t ldb, T_Scalar beta, T_Scalar *c, uint_t ldc);
+
+	private:
+		struct Impl;
+
+		uint_t m_ncalls;
+		Impl*  m_impl;
+};
+
 /*-------------------------------------------------*/
 } // namespace mkl
 } // namespace cla3p
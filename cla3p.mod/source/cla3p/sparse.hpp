@@ -19,8 +19,14 @@
 
 #include "cla3p/sparse/csc_rxmatrix.hpp"
 #include "cla3p/sparse/csc_cxmatrix.hpp"
+#include "cla3p/sparse/csr_rxmatrix.hpp"
+#include "cla3p/sparse/csr_cxmatrix.hpp"
 #include "cla3p/sparse/coo_rxmatrix.hpp"
 #include "cla3p/sparse/coo_cxmatrix.hpp"
+#include "cla3p/sparse/bsr_rxmatrix.hpp"
+#include "cla3p/sparse/bsr_cxmatrix.hpp"
+#include "cla3p/sparse/csc_sell_matrix.hpp"
+#include "cla3p/sparse/csc_assembler.hpp"
 
 namespace cla3p {
 namespace csc {
@@ -49,10 +55,89 @@ using CdMatrix = CxMatrix<int_t,complex_t>;
  */
 using CfMatrix = CxMatrix<int_t,complex8_t>;
 
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision real matrix in SELL-C-sigma storage.
+ */
+using RdSellMatrix = SellMatrix<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision real matrix in SELL-C-sigma storage.
+ */
+using RfSellMatrix = SellMatrix<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision complex matrix in SELL-C-sigma storage.
+ */
+using CdSellMatrix = SellMatrix<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision complex matrix in SELL-C-sigma storage.
+ */
+using CfSellMatrix = SellMatrix<CfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision real finite element assembler.
+ */
+using RdAssembler = Assembler<RdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision real finite element assembler.
+ */
+using RfAssembler = Assembler<RfMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision complex finite element assembler.
+ */
+using CdAssembler = Assembler<CdMatrix>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision complex finite element assembler.
+ */
+using CfAssembler = Assembler<CfMatrix>;
+
 } // namespace csc
 } // namespace cla3p
 
 
+namespace cla3p {
+namespace csr {
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision real matrix.
+ */
+using RdMatrix = RxMatrix<int_t,real_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision real matrix.
+ */
+using RfMatrix = RxMatrix<int_t,real4_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision complex matrix.
+ */
+using CdMatrix = CxMatrix<int_t,complex_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision complex matrix.
+ */
+using CfMatrix = CxMatrix<int_t,complex8_t>;
+
+} // namespace csr
+} // namespace cla3p
+
+
 namespace cla3p {
 namespace coo {
 
@@ -83,4 +168,35 @@ using CfMatrix = CxMatrix<int_t,complex8_t>;
 } // namespace coo
 } // namespace cla3p
 
+
+namespace cla3p {
+namespace bsr {
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision real matrix.
+ */
+using RdMatrix = RxMatrix<int_t,real_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision real matrix.
+ */
+using RfMatrix = RxMatrix<int_t,real4_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Double precision complex matrix.
+ */
+using CdMatrix = CxMatrix<int_t,complex_t>;
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @brief Single precision complex matrix.
+ */
+using CfMatrix = CxMatrix<int_t,complex8_t>;
+
+} // namespace bsr
+} // namespace cla3p
+
 #endif // CLA3P_SPARSE_HPP_
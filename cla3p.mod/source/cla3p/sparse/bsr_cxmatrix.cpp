@@ -0,0 +1,110 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/bsr_cxmatrix.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/sparse/bsr_rxmatrix.hpp"
+#include "cla3p/error/exceptions.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bsr {
+/*-------------------------------------------------*/
+#define CxMatrixTmpl CxMatrix<T_Int,T_Scalar>
+#define CxMatrixTlst template <typename T_Int, typename T_Scalar>
+/*-------------------------------------------------*/
+CxMatrixTlst
+CxMatrixTmpl::CxMatrix()
+{
+}
+/*-------------------------------------------------*/
+CxMatrixTlst
+CxMatrixTmpl::CxMatrix(uint_t nr, uint_t nc, uint_t bs, uint_t nzb, const Property& pr)
+	: CxMatrixTmpl::XxMatrix(nr, nc, bs, nzb, pr)
+{
+}
+/*-------------------------------------------------*/
+CxMatrixTlst
+CxMatrixTmpl::~CxMatrix()
+{
+}
+/*-------------------------------------------------*/
+CxMatrixTlst
+const CxMatrixTmpl& CxMatrixTmpl::self() const
+{
+	return (*this);
+}
+/*-------------------------------------------------*/
+CxMatrixTlst
+typename CxMatrixTmpl::T_RMatrix CxMatrixTmpl::real() const
+{
+	if(this->empty()) return T_RMatrix();
+
+	Property ret_prop = (this->prop().isHermitian() ? Property(prop_t::Symmetric, this->prop().uplo()) : this->prop());
+
+	T_RMatrix ret(this->nrows(), this->ncols(), this->bsize(), this->nnzb(), ret_prop);
+
+	uint_t nr = this->nbrows() + 1;
+	uint_t nzb = this->nnzb();
+	uint_t nz = this->nnz();
+
+	bulk::dns::copy    (uplo_t::Full, nr , 1, this->rowptr(), nr , ret.rowptr(), nr );
+	bulk::dns::copy    (uplo_t::Full, nzb, 1, this->colidx(), nzb, ret.colidx(), nzb);
+	bulk::dns::get_real(uplo_t::Full, nz , 1, this->values(), nz , ret.values(), nz );
+
+	return ret;
+}
+/*-------------------------------------------------*/
+CxMatrixTlst
+typename CxMatrixTmpl::T_RMatrix CxMatrixTmpl::imag() const
+{
+	if(this->empty()) return T_RMatrix();
+
+	if(this->prop().isHermitian()) {
+		throw err::InvalidOp("The imaginary part of a Hermitian matrix is Skew, not supported for block sparse storage");
+	} // hermitian
+
+	T_RMatrix ret(this->nrows(), this->ncols(), this->bsize(), this->nnzb(), this->prop());
+
+	uint_t nr = this->nbrows() + 1;
+	uint_t nzb = this->nnzb();
+	uint_t nz = this->nnz();
+
+	bulk::dns::copy    (uplo_t::Full, nr , 1, this->rowptr(), nr , ret.rowptr(), nr );
+	bulk::dns::copy    (uplo_t::Full, nzb, 1, this->colidx(), nzb, ret.colidx(), nzb);
+	bulk::dns::get_imag(uplo_t::Full, nz , 1, this->values(), nz , ret.values(), nz );
+
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+#undef CxMatrixTmpl
+#undef CxMatrixTlst
+/*-------------------------------------------------*/
+template class CxMatrix<int_t,complex_t>;
+template class CxMatrix<int_t,complex8_t>;
+/*-------------------------------------------------*/
+} // namespace bsr
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,521 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// this file inc
+#include "cla3p/sparse/bsr_xxmatrix.hpp"
+
+// system
+#include <vector>
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/bsr.hpp"
+#include "cla3p/generic/tuple.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+#include "cla3p/checks/csc_checks.hpp"
+#include "cla3p/checks/hermitian_coeff_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace bsr {
+/*-------------------------------------------------*/
+static void bsr_block_size_check(uint_t nr, uint_t nc, uint_t bs)
+{
+	if(!bs || nr % bs || nc % bs) {
+		throw err::NoConsistency(msg::InvalidDimensions() + ", dimensions must be multiples of the block size");
+	} // bs
+}
+/*-------------------------------------------------*/
+static void bsr_property_check(const Property& pr)
+{
+	if(!pr.isGeneral() && !pr.isSymmetric() && !pr.isHermitian()) {
+		throw err::InvalidOp("Matrices with property " + pr.name() + " not supported for block sparse storage");
+	} // property
+}
+/*-------------------------------------------------*/
+#define XxMatrixTmpl XxMatrix<T_Int,T_Scalar,T_Matrix>
+#define XxMatrixTlst template <typename T_Int, typename T_Scalar, typename T_Matrix>
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix(uint_t nr, uint_t nc, uint_t bs, uint_t nzb, const Property& pr)
+{
+	defaults();
+
+	bsr_block_size_check(nr, nc, bs);
+
+	uint_t mb = nr / bs;
+
+	T_Int    *rptr = i_malloc<T_Int>(mb + 1);
+	T_Int    *cidx = i_malloc<T_Int>(nzb);
+	T_Scalar *vals = i_malloc<T_Scalar>(static_cast<bulk_t>(nzb) * bs * bs);
+
+	rptr[mb] = nzb;
+
+	wrapper(nr, nc, bs, rptr, cidx, vals, true, pr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix(XxMatrixTmpl&& other)
+{
+	defaults();
+	other.moveTo(*this);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::~XxMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl& XxMatrixTmpl::operator=(XxMatrixTmpl&& other)
+{
+	other.moveTo(*this);
+	return (*this);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::defaults()
+{
+	setBsize(0);
+	setRowptr(nullptr);
+	setColidx(nullptr);
+	setValues(nullptr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::clear()
+{
+	if(owner()) {
+		i_free(rowptr());
+		i_free(colidx());
+		i_free(values());
+	} // owner
+
+	MatrixMeta::clear();
+	Ownership::clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setBsize(uint_t bsize)
+{
+	m_bsize = bsize;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setRowptr(T_Int* rowptr)
+{
+	m_rowptr = rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setColidx(T_Int* colidx)
+{
+	m_colidx = colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setValues(T_Scalar* values)
+{
+	m_values = values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::bsize() const
+{
+	return m_bsize;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::nbrows() const
+{
+	return (bsize() ? nrows() / bsize() : 0);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::nbcols() const
+{
+	return (bsize() ? ncols() / bsize() : 0);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::nnzb() const
+{
+	if(!empty()) {
+		return rowptr()[nbrows()];
+	}
+	return 0;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::nnz() const
+{
+	return nnzb() * bsize() * bsize();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Int* XxMatrixTmpl::rowptr() const
+{
+	return m_rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Int* XxMatrixTmpl::rowptr()
+{
+	return m_rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Int* XxMatrixTmpl::colidx() const
+{
+	return m_colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Int* XxMatrixTmpl::colidx()
+{
+	return m_colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Scalar* XxMatrixTmpl::values() const
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Scalar* XxMatrixTmpl::values()
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+std::string XxMatrixTmpl::info(const std::string& msg) const
+{ 
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << TypeTraits<T_Matrix>::type_name() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Block size........... " << bsize() << "\n";
+	ss << "  Number of nz blocks.. " << nnzb() << "\n";
+	ss << "  Rowptr............... " << rowptr() << "\n";
+	ss << "  Colidx............... " << colidx() << "\n";
+	ss << "  Values............... " << values() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+	ss << "  Owner................ " << bool2yn(this->owner()) << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::copyTo(XxMatrixTmpl& trg) const
+{
+	if(empty()) {
+		trg.clear();
+		return;
+	} // empty
+
+	trg = init(nrows(), ncols(), bsize(), nnzb(), prop());
+
+	uint_t nr = nbrows() + 1;
+	uint_t nzb = nnzb();
+	uint_t nz = nnz();
+
+	bulk::dns::copy(uplo_t::Full, nr , 1, rowptr(), nr , trg.rowptr(), nr );
+	bulk::dns::copy(uplo_t::Full, nzb, 1, colidx(), nzb, trg.colidx(), nzb);
+	bulk::dns::copy(uplo_t::Full, nz , 1, values(), nz , trg.values(), nz );
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::shallowCopyTo(XxMatrixTmpl& trg)
+{
+	if(empty()) {
+		trg.clear();
+		return;
+	} // empty
+
+	trg.wrapper(nrows(), ncols(), bsize(), rowptr(), colidx(), values(), false, prop());
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::moveTo(XxMatrixTmpl& trg)
+{
+	if(empty()) {
+		trg.clear();
+		return;
+	} // empty
+
+	trg.wrapper(nrows(), ncols(), bsize(), rowptr(), colidx(), values(), owner(), prop());
+	unbind();
+	clear();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+std::string XxMatrixTmpl::toString(uint_t nsd) const
+{
+	return bulk::bsr::print_to_string(nbrows(), bsize(), rowptr(), colidx(), values(), nsd);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::copy() const
+{
+	T_Matrix ret;
+	copyTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::rcopy()
+{
+	T_Matrix ret;
+	shallowCopyTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<T_Matrix> XxMatrixTmpl::rcopy() const
+{
+	T_Matrix tmp = const_cast<XxMatrixTmpl&>(*this).rcopy();
+	Guard<T_Matrix> ret(tmp);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::move()
+{
+	T_Matrix ret;
+	moveTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::iscale(T_Scalar val)
+{
+	hermitian_coeff_check(prop(), val);
+	bulk::dns::scale(uplo_t::Full, nnz(), 1, values(), nnz(), val);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::iconjugate()
+{
+	bulk::dns::conjugate(uplo_t::Full, nnz(), 1, values(), nnz());
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::conjugate() const
+{
+	T_Matrix ret = copy();
+	ret.iconjugate();
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// For Symmetric/Hermitian matrices only the uplo part of the diagonal blocks is referenced
+//
+XxMatrixTlst
+typename XxMatrixTmpl::T_DnsMatrix XxMatrixTmpl::toDns() const
+{
+	T_DnsMatrix ret(nrows(), ncols(), prop());
+	ret = 0;
+
+	bool mirror = (prop().isSymmetric() || prop().isHermitian());
+	bool lower = prop().isLower();
+
+	uint_t bs = bsize();
+
+	for(uint_t I = 0; I < nbrows(); I++) {
+		for(T_Int jblk = rowptr()[I]; jblk < rowptr()[I+1]; jblk++) {
+
+			uint_t J = colidx()[jblk];
+			const T_Scalar *a = values() + jblk * bs * bs;
+
+			for(uint_t c = 0; c < bs; c++) {
+				for(uint_t r = 0; r < bs; r++) {
+					if(mirror && I == J && (lower ? r < c : r > c)) continue;
+					ret(I * bs + r, J * bs + c) = a[r + c * bs];
+				} // r
+			} // c
+
+		} // jblk
+	} // I
+
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// The blocks are expanded to the csr arrays of (*this), 
+// which are the csc arrays of (*this)^T, the csc transposition yields the csc arrays of (*this)
+//
+XxMatrixTlst
+typename XxMatrixTmpl::T_CscMatrix XxMatrixTmpl::toCsc() const
+{
+	if(empty()) return T_CscMatrix();
+
+	T_Int *rptr = i_malloc<T_Int>(nrows() + 1);
+
+	bulk::bsr::bsr2csr_rowptr(prop().type(), prop().uplo(), nbrows(), bsize(), rowptr(), colidx(), rptr);
+
+	uint_t nz = rptr[nrows()];
+
+	T_Int    *cidx = i_malloc<T_Int>(nz);
+	T_Scalar *vals = i_malloc<T_Scalar>(nz);
+
+	bulk::bsr::bsr2csr(prop().type(), prop().uplo(), nbrows(), bsize(), rowptr(), colidx(), values(), rptr, cidx, vals);
+
+	T_CscMatrix ret(nrows(), ncols(), nz, prop());
+
+	bulk::csc::transpose(
+			ncols(), nrows(), 
+			rptr, 
+			cidx, 
+			vals, 
+			ret.colptr(), 
+			ret.rowidx(), 
+			ret.values());
+
+	i_free(rptr);
+	i_free(cidx);
+	i_free(vals);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_CooMatrix XxMatrixTmpl::toCoo() const
+{
+	if(empty()) return T_CooMatrix();
+
+	T_CooMatrix ret(nrows(), ncols(), nnz(), prop());
+
+	bool mirror = (prop().isSymmetric() || prop().isHermitian());
+	bool lower = prop().isLower();
+
+	uint_t bs = bsize();
+
+	std::vector<Tuple<T_Int,T_Scalar>> tuples;
+	tuples.reserve(nnz());
+
+	for(uint_t I = 0; I < nbrows(); I++) {
+		for(T_Int jblk = rowptr()[I]; jblk < rowptr()[I+1]; jblk++) {
+
+			uint_t J = colidx()[jblk];
+			const T_Scalar *a = values() + jblk * bs * bs;
+
+			for(uint_t c = 0; c < bs; c++) {
+				for(uint_t r = 0; r < bs; r++) {
+					if(mirror && I == J && (lower ? r < c : r > c)) continue;
+					tuples.push_back(Tuple<T_Int,T_Scalar>(I * bs + r, J * bs + c, a[r + c * bs]));
+				} // r
+			} // c
+
+		} // jblk
+	} // I
+
+	ret.insert(tuples);
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::wrapper(uint_t nr, uint_t nc, uint_t bs, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr)
+{
+	clear();
+
+	Property pr2 = sanitizeProperty<T_Scalar>(pr);
+
+	bsr_block_size_check(nr, nc, bs);
+	bsr_property_check(pr2);
+	csc_consistency_check(pr2, nr, nc, (rptr ? rptr[nr / bs] : 0), rptr, cidx, vals);
+
+	MatrixMeta::wrapper(nr, nc, pr2);
+
+	setBsize(bs);
+	setRowptr(rptr);
+	setColidx(cidx);
+	setValues(vals);
+
+	setOwner(bind);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::init(uint_t nr, uint_t nc, uint_t bs, uint_t nzb, const Property& pr)
+{
+	T_Matrix ret(nr, nc, bs, nzb, pr);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::wrap(uint_t nr, uint_t nc, uint_t bs, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr)
+{
+	T_Matrix ret;
+	ret.wrapper(nr, nc, bs, rptr, cidx, vals, bind, pr);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<T_Matrix> XxMatrixTmpl::wrap(uint_t nr, uint_t nc, uint_t bs, const T_Int *rptr, const T_Int *cidx, const T_Scalar *vals, const Property& pr)
+{
+	Guard<T_Matrix> ret(wrap(nr, nc, bs, 
+				const_cast<T_Int   *>(rptr),
+				const_cast<T_Int   *>(cidx),
+				const_cast<T_Scalar*>(vals), false, pr));
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+#undef XxMatrixTmpl
+#undef XxMatrixTlst
+/*-------------------------------------------------*/
+template class XxMatrix<int_t,real_t,RdMatrix>;
+template class XxMatrix<int_t,real4_t,RfMatrix>;
+template class XxMatrix<int_t,complex_t,CdMatrix>;
+template class XxMatrix<int_t,complex8_t,CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace bsr
+} // namespace cla3p
+/*-------------------------------------------------*/
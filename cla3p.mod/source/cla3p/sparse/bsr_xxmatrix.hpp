@@ -0,0 +1,375 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_BSR_XXMATRIX_HPP_
+#define CLA3P_BSR_XXMATRIX_HPP_
+
+#include <ostream>
+#include <string>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/ownership.hpp"
+#include "cla3p/generic/matrix_meta.hpp"
+#include "cla3p/generic/guard.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace bsr {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The sparse matrix class (block compressed sparse row format).
+ *
+ * The matrix is partitioned in square (bs x bs) blocks and only the non-zero blocks are stored, 
+ * each one as a dense column-major array. A single column index is stored per block, 
+ * reducing the index storage & bandwidth by a factor of bs<sup>2</sup> compared to csc/csr storage.
+ *
+ * Symmetric & Hermitian matrices store the blocks of the lower or upper block triangle, the diagonal blocks are stored in full.
+ */
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+class XxMatrix : public Ownership, public MatrixMeta {
+
+	private:
+		using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+		using T_CscMatrix = typename TypeTraits<T_Matrix>::csc_type;
+		using T_CooMatrix = typename TypeTraits<T_Matrix>::coo_type;
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+
+	public:
+
+		// no copy
+		XxMatrix(const XxMatrix<T_Int,T_Scalar,T_Matrix>&) = delete;
+		XxMatrix<T_Int,T_Scalar,T_Matrix>& operator=(const XxMatrix<T_Int,T_Scalar,T_Matrix>&) = delete;
+
+		virtual const T_Matrix& self() const = 0;
+
+		/** 
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit XxMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs a (nr x nc) matrix with nzb non-zero (bs x bs) uninitialized blocks.
+		 *
+		 * @param[in] nr The number of matrix rows, must be a multiple of bs.
+		 * @param[in] nc The number of matrix columns, must be a multiple of bs.
+		 * @param[in] bs The block size.
+		 * @param[in] nzb The number of matrix non zero blocks.
+		 * @param[in] pr The matrix property.
+		 */
+		explicit XxMatrix(uint_t nr, uint_t nc, uint_t bs, uint_t nzb, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of `other`, `other` is destroyed.
+		 */
+		XxMatrix(XxMatrix<T_Int,T_Scalar,T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~XxMatrix();
+
+		/** @} */
+
+		/** 
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents of `(*this)` with those of `other`, `other` is destroyed.
+		 */
+		XxMatrix<T_Int,T_Scalar,T_Matrix>& operator=(XxMatrix<T_Int,T_Scalar,T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The matrix block size.
+		 * @return The number of rows (and columns) of each block of `(*this)`.
+		 */
+		uint_t bsize() const;
+
+		/**
+		 * @brief The number of matrix block rows.
+		 * @return The number of block rows of `(*this)`.
+		 */
+		uint_t nbrows() const;
+
+		/**
+		 * @brief The number of matrix block columns.
+		 * @return The number of block columns of `(*this)`.
+		 */
+		uint_t nbcols() const;
+
+		/**
+		 * @brief The number of matrix non-zero blocks.
+		 * @return The number of non-zero blocks in `(*this)`.
+		 */
+		uint_t nnzb() const;
+
+		/**
+		 * @brief The number of matrix non-zero elements.
+		 * @return The number of stored elements in `(*this)`, including the zeros of the stored blocks.
+		 */
+		uint_t nnz() const;
+
+		/**
+		 * @brief The matrix block row pointer array.
+		 * @return The array containing the number of non-zero blocks in each block row of `(*this)`.
+		 */
+		T_Int* rowptr();
+
+		/**
+		 * @copydoc rowptr()
+		 */
+		const T_Int* rowptr() const;
+
+		/**
+		 * @brief The matrix block column index array.
+		 * @return The array containing the non-zero block column index in each block row of `(*this)`.
+		 */
+		T_Int* colidx();
+
+		/**
+		 * @copydoc colidx()
+		 */
+		const T_Int* colidx() const;
+
+		/**
+		 * @brief The matrix values array.
+		 * @return The array containing the non-zero blocks of `(*this)`, each block in column-major order.
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Clears the object.
+		 *
+		 * Deallocates owned data and resets all members.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints matrix information.
+		 * @param[in] msg Set a header identifier.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies a matrix.
+		 * @return A deep copy of `(*this)`.
+		 *
+		 * @see rcopy() const, rcopy(), move()
+		 */
+		T_Matrix copy() const;
+
+		/**
+		 * @brief Shallow-copies a matrix.
+		 * @return A shallow copy of `(*this)`, `(*this)` is unchanged.
+		 *
+		 * @see copy(), rcopy() const, move()
+		 */
+		T_Matrix rcopy();
+
+		/**
+		 * @brief Shallow-copies an immutable matrix.
+		 * @return A guard shallow copy of `(*this)`.
+		 *
+		 * @see copy(), rcopy(), move()
+		 */
+		Guard<T_Matrix> rcopy() const;
+
+		/**
+		 * @brief Moves a matrix.
+		 * @return A shallow copy of `(*this)`, `(*this)` is destroyed.
+		 *
+		 * @see copy(), rcopy() const, rcopy()
+		 */
+		T_Matrix move();
+
+		/**
+		 * @brief Prints the contents of the object to a string.
+		 * @param[in] nsd The number of significant digits.
+		 * @return The string containing the formatted numerical values of the matrix.
+		 */
+		std::string toString(uint_t nsd = 3) const;
+
+		/**
+		 * @brief Multiplies the sparse matrix by a scalar.
+		 * @param[in] val The scaling coefficient.
+		 */
+		void iscale(T_Scalar val);
+
+		/**
+		 * @brief Conjugates a matrix in-place.
+		 */
+		void iconjugate();
+
+		/**
+		 * @brief Conjugates a matrix.
+		 */
+		T_Matrix conjugate() const;
+
+		/**
+		 * @brief Converts a matrix to dense.
+		 * @return A copy of `(*this)` as a dense matrix.
+		 */
+		T_DnsMatrix toDns() const;
+
+		/**
+		 * @brief Converts a matrix to csc format.
+		 *
+		 * All elements of the stored blocks are kept, including zeros. 
+		 * The conversion is multithreaded for large matrices.
+		 *
+		 * @return A copy of `(*this)` in csc format.
+		 */
+		T_CscMatrix toCsc() const;
+
+		/**
+		 * @brief Converts a matrix to coo format.
+		 *
+		 * All elements of the stored blocks are kept, including zeros.
+		 *
+		 * @return A copy of `(*this)` in coo format.
+		 */
+		T_CooMatrix toCoo() const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Creates a matrix.
+		 *
+		 * Creates a (nr x nc) matrix with uninitialized blocks.
+		 *
+		 * @param[in] nr The number of matrix rows, must be a multiple of bs.
+		 * @param[in] nc The number of matrix columns, must be a multiple of bs.
+		 * @param[in] bs The block size.
+		 * @param[in] nzb The number of matrix non zero blocks.
+		 * @param[in] pr The matrix property.
+		 * @return The newly created matrix.
+		 */
+		static T_Matrix init(uint_t nr, uint_t nc, uint_t bs, uint_t nzb, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief Creates a matrix from aux data.
+		 *
+		 * Creates a (nr x nc) matrix from bulk data.
+		 *
+		 * @param[in] nr The number of matrix rows, must be a multiple of bs.
+		 * @param[in] nc The number of matrix columns, must be a multiple of bs.
+		 * @param[in] bs The block size.
+		 * @param[in] rptr The array containing the matrix block row pointers.
+		 * @param[in] cidx The array containing the matrix block column indexes.
+		 * @param[in] vals The array containing the matrix blocks.
+		 * @param[in] bind Binds the data to the matrix, the matrix will deallocate all arrays on destroy using i_free().
+		 * @param[in] pr The matrix property.
+		 * @return The newly created matrix.
+		 */
+		static T_Matrix wrap(uint_t nr, uint_t nc, uint_t bs, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief Creates a matrix guard from aux data.
+		 *
+		 * Creates a (nr x nc) matrix from bulk data.
+		 *
+		 * @param[in] nr The number of matrix rows, must be a multiple of bs.
+		 * @param[in] nc The number of matrix columns, must be a multiple of bs.
+		 * @param[in] bs The block size.
+		 * @param[in] rptr The array containing the matrix block row pointers.
+		 * @param[in] cidx The array containing the matrix block column indexes.
+		 * @param[in] vals The array containing the matrix blocks.
+		 * @param[in] pr The matrix property.
+		 * @return The newly created guard.
+		 */
+		static Guard<T_Matrix> wrap(uint_t nr, uint_t nc, uint_t bs, const T_Int *rptr, const T_Int *cidx, const T_Scalar *vals, const Property& pr = defaultProperty());
+
+		/** @} */
+
+	private:
+		uint_t    m_bsize;
+		T_Int*    m_rowptr;
+		T_Int*    m_colidx;
+		T_Scalar* m_values;
+
+		void defaults();
+
+		void setBsize(uint_t);
+		void setRowptr(T_Int*);
+		void setColidx(T_Int*);
+		void setValues(T_Scalar*);
+
+		void copyTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&) const;
+		void shallowCopyTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&);
+		void moveTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&);
+		void wrapper(uint_t nr, uint_t nc, uint_t bs, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr);
+};
+
+/*-------------------------------------------------*/
+} // namespace bsr
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_stream_operators
+ * @brief Writes to os the contents of mat.
+ */
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+std::ostream& operator<<(std::ostream& os, const cla3p::bsr::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat)
+{
+	os << mat.toString();
+	return os;
+}
+
+#endif // CLA3P_BSR_XXMATRIX_HPP_
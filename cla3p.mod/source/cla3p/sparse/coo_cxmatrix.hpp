@@ -25,6 +25,7 @@ namespace cla3p {
 /*-------------------------------------------------*/
 
 namespace csc { template <typename T_Int, typename T_Scalar> class CxMatrix; }
+namespace bsr { template <typename T_Int, typename T_Scalar> class CxMatrix; }
 
 /*-------------------------------------------------*/
 namespace coo {
@@ -101,6 +102,7 @@ class TypeTraits<coo::CxMatrix<T_Int,T_Scalar>> {
 		static std::string type_name() { return msg::SparseCooMatrix(); }
 		using real_type = coo::RxMatrix<T_Int,T_RScalar>;
 		using csc_type = csc::CxMatrix<T_Int,T_Scalar>;
+		using bsr_type = bsr::CxMatrix<T_Int,T_Scalar>;
 };
 
 /*-------------------------------------------------*/
@@ -25,6 +25,7 @@ namespace cla3p {
 /*-------------------------------------------------*/
 
 namespace csc { template <typename T_Int, typename T_Scalar> class RxMatrix; }
+namespace bsr { template <typename T_Int, typename T_Scalar> class RxMatrix; }
 
 /*-------------------------------------------------*/
 namespace coo {
@@ -98,6 +99,7 @@ class TypeTraits<coo::RxMatrix<T_Int,T_Scalar>> {
 		static std::string type_name() { return msg::SparseCooMatrix(); }
 		using real_type = coo::RxMatrix<T_Int,T_Scalar>;
 		using csc_type = csc::RxMatrix<T_Int,T_Scalar>;
+		using bsr_type = bsr::RxMatrix<T_Int,T_Scalar>;
 };
 
 /*-------------------------------------------------*/
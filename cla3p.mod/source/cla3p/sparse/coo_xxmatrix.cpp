@@ -21,11 +21,15 @@
 #include <algorithm>
 
 // 3rd
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 // cla3p
 #include "cla3p/error.hpp"
 #include "cla3p/sparse.hpp"
 #include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/coo.hpp"
 #include "cla3p/support/imalloc.hpp"
 #include "cla3p/support/utils.hpp"
 
@@ -62,46 +66,120 @@ XxMatrixTlst
 void XxMatrixTmpl::clear()
 {
 	MatrixMeta::clear();
-	tupleVec().clear();
+	m_buckets.clear();
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 uint_t XxMatrixTmpl::nnz() const
 {
-	return tupleVec().size();
+	bulk_t ret = 0;
+
+	for(const Bucket& bucket : m_buckets) {
+		ret += bucket.rowidx.size();
+	} // bucket
+
+	return ret;
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
-typename XxMatrixTmpl::TupleVec& XxMatrixTmpl::tupleVec()
+typename XxMatrixTmpl::Bucket& XxMatrixTmpl::serialBucket()
 {
-	return m_tuples;
+	//
+	// One bucket per thread plus the shared (locked) bucket, 
+	// created by serial code only, concurrent insertion never reallocates the list
+	//
+	if(m_buckets.empty()) {
+		m_buckets.resize(max_threads() + 1);
+	} // init
+
+	return m_buckets[0];
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
-const typename XxMatrixTmpl::TupleVec& XxMatrixTmpl::tupleVec() const
+void XxMatrixTmpl::push(Bucket& bucket, T_Int i, T_Int j, T_Scalar v)
 {
-	return m_tuples;
+	bucket.rowidx.push_back(i);
+	bucket.colidx.push_back(j);
+	bucket.values.push_back(v);
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 void XxMatrixTmpl::reserve(uint_t nz)
 {
-	tupleVec().reserve(nz);
+	Bucket& bucket = serialBucket();
+
+	bucket.rowidx.reserve(nz);
+	bucket.colidx.reserve(nz);
+	bucket.values.reserve(nz);
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 void XxMatrixTmpl::insert(const Tuple<T_Int,T_Scalar>& tuple)
 {
-	coo_check_triplet(nrows(), ncols(), prop(), tuple.row(), tuple.col(), tuple.val());
-
-	tupleVec().push_back(tuple);
+	insert(tuple.row(), tuple.col(), tuple.val());
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 void XxMatrixTmpl::insert(T_Int i, T_Int j, T_Scalar v)
 {
-	Tuple<T_Int,T_Scalar> tuple(i, j, v);
-	insert(tuple);
+	coo_check_triplet(nrows(), ncols(), prop(), i, j, v);
+
+	push(serialBucket(), i, j, v);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::insert(const std::vector<Tuple<T_Int,T_Scalar>>& tuples)
+{
+	int_t nt = static_cast<int_t>(tuples.size());
+	int_t ibad = nt;
+
+	#pragma omp parallel for schedule(static) reduction(min:ibad) if(nt >= 65536)
+	for(int_t k = 0; k < nt; k++) {
+		try {
+			coo_check_triplet(nrows(), ncols(), prop(), tuples[k].row(), tuples[k].col(), tuples[k].val());
+		} catch(...) {
+			ibad = std::min(ibad, k);
+		} // check
+	} // k
+
+	if(ibad < nt) {
+		insert(tuples[ibad]); // throws the proper exception
+	} // ibad
+
+	Bucket& bucket = serialBucket();
+
+	bulk_t n0 = bucket.rowidx.size();
+
+	bucket.rowidx.resize(n0 + nt);
+	bucket.colidx.resize(n0 + nt);
+	bucket.values.resize(n0 + nt);
+
+	#pragma omp parallel for schedule(static) if(nt >= 65536)
+	for(int_t k = 0; k < nt; k++) {
+		bucket.rowidx[n0 + k] = tuples[k].row();
+		bucket.colidx[n0 + k] = tuples[k].col();
+		bucket.values[n0 + k] = tuples[k].val();
+	} // k
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::insertConcurrent(T_Int i, T_Int j, T_Scalar v)
+{
+	coo_check_triplet(nrows(), ncols(), prop(), i, j, v);
+
+	uint_t nb = m_buckets.size() - 1;
+	uint_t tid = 0;
+
+#if defined(_OPENMP)
+	tid = omp_get_thread_num();
+#endif
+
+	if(tid < nb) {
+		push(m_buckets[tid], i, j, v);
+	} else {
+		#pragma omp critical(cla3p_coo_insert)
+		push(m_buckets[nb], i, j, v);
+	} // tid
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
@@ -147,18 +225,24 @@ std::string XxMatrixTmpl::toString(uint_t nsd) const
 	ret.append (ndr + ndc + ndn + 8, '-');
 	ret.append ("\n");
 
-	for(uint_t cnt = 0; cnt < nnz(); cnt++) {
+	uint_t cnt = 0;
+
+	for(const Bucket& bucket : m_buckets) {
 
-			T_Int    i = tupleVec()[cnt].row();
-			T_Int    j = tupleVec()[cnt].col();
-			T_Scalar v = tupleVec()[cnt].val();
+		for(uint_t k = 0; k < bucket.rowidx.size(); k++, cnt++) {
+
+			T_Int    i = bucket.rowidx[k];
+			T_Int    j = bucket.colidx[k];
+			T_Scalar v = bucket.values[k];
 
 			val2char(cbuff, BUFFER_LEN, ndn, cnt); ret.append(cbuff); ret.append(" ");
 			val2char(cbuff, BUFFER_LEN, ndr, i  ); ret.append(cbuff); ret.append(" ");
 			val2char(cbuff, BUFFER_LEN, ndc, j  ); ret.append(cbuff); ret.append(" ");
 			val2char(cbuff, BUFFER_LEN, nsd, v  ); ret.append(cbuff); ret.append("\n");
 
-	} // cnt
+		} // k
+
+	} // bucket
 
 	return ret;
 
@@ -174,48 +258,40 @@ XxMatrixTmpl::operator typename XxMatrixTmpl::T_CscMatrix() const
 XxMatrixTlst
 typename XxMatrixTmpl::T_CscMatrix XxMatrixTmpl::toCsc(dup_t duplicatePolicy) const
 {
-	T_Int *colptr = static_cast<T_Int*>(i_calloc(ncols() + 1, sizeof(T_Int)));
+	uint_t nb = m_buckets.size();
 
-	std::for_each(tupleVec().begin(), tupleVec().end(), 
-			[&](const Tuple<T_Int,T_Scalar> &tuple) 
-			{ 
-			colptr[tuple.col() + 1]++;
-			});
+	std::vector<bulk_t> bsize(nb);
+	std::vector<const T_Int*> brow(nb);
+	std::vector<const T_Int*> bcol(nb);
+	std::vector<const T_Scalar*> bval(nb);
 
-	bulk::csc::roll(ncols(), colptr);
+	for(uint_t b = 0; b < nb; b++) {
+		bsize[b] = m_buckets[b].rowidx.size();
+		brow[b] = m_buckets[b].rowidx.data();
+		bcol[b] = m_buckets[b].colidx.data();
+		bval[b] = m_buckets[b].values.data();
+	} // b
 
-	T_Int nnz = colptr[ncols()];
+	T_Int *colptr = static_cast<T_Int*>(i_calloc(ncols() + 1, sizeof(T_Int)));
 
 	T_Int    *rowidx = nullptr;
 	T_Scalar *values = nullptr;
 
-	if(nnz) {
-
-		rowidx = static_cast<T_Int   *>(i_malloc(nnz, sizeof(T_Int   )));
-		values = static_cast<T_Scalar*>(i_malloc(nnz, sizeof(T_Scalar)));
-
-		std::for_each(tupleVec().begin(), tupleVec().end(), 
-				[&](const Tuple<T_Int,T_Scalar> &tuple) 
-				{ 
-				rowidx[colptr[tuple.col()]] = tuple.row();
-				values[colptr[tuple.col()]] = tuple.val();
-				colptr[tuple.col()]++;
-				});
-
-		bulk::csc::unroll(ncols(), colptr);
-		bulk::csc::sort(ncols(), colptr, rowidx, values);
-		bulk::csc::remove_duplicates(ncols(), colptr, rowidx, values, duplicatePolicy);
-
-		rowidx = static_cast<T_Int   *>(i_realloc(rowidx, colptr[ncols()], sizeof(T_Int   )));
-		values = static_cast<T_Scalar*>(i_realloc(values, colptr[ncols()], sizeof(T_Scalar)));
-
-	} // nnz
+	bulk::coo::coo2csc(nrows(), ncols(), nb, bsize.data(), 
+			brow.data(), bcol.data(), bval.data(), duplicatePolicy, 
+			colptr, &rowidx, &values);
 
 	T_CscMatrix ret = T_CscMatrix::wrap(nrows(), ncols(), colptr, rowidx, values, true, prop());
 
 	return ret;
 }
 /*-------------------------------------------------*/
+XxMatrixTlst
+typename TypeTraits<T_Matrix>::bsr_type XxMatrixTmpl::toBsr(uint_t bs, dup_t duplicatePolicy) const
+{
+	return toCsc(duplicatePolicy).toBsr(bs);
+}
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 XxMatrixTlst
@@ -33,6 +33,9 @@ namespace coo {
 /**
  * @nosubgrouping 
  * @brief The sparse matrix class (coordinate format).
+ *
+ * Triplets are kept in struct-of-arrays buckets, one per thread, 
+ * so that they can be inserted concurrently (insertConcurrent()).
  */
 template <typename T_Int, typename T_Scalar, typename T_Matrix>
 class XxMatrix : public MatrixMeta {
@@ -140,6 +143,9 @@ class XxMatrix : public MatrixMeta {
 
 		/**
 		 * @brief Reserve space for tuple insertion.
+		 *
+		 * The space is reserved for serial insertion, concurrent insertion buckets grow on demand.
+		 *
 		 * @param[in] nz The number of elements to be reserved.
 		 */
 		void reserve(uint_t nz);
@@ -164,6 +170,31 @@ class XxMatrix : public MatrixMeta {
 		 */
 		void insert(T_Int i, T_Int j, T_Scalar v);
 
+		/**
+		 * @brief Inserts a batch of triplets into the matrix.
+		 *
+		 * Triplets are validated in parallel & appended in the given order.
+		 *
+		 * @param[in] tuples The triplets to be inserted.
+		 */
+		void insert(const std::vector<Tuple<T_Int,T_Scalar>>& tuples);
+
+		/**
+		 * @brief Inserts a triplet into the matrix concurrently.
+		 *
+		 * Inserts the element v in position {i, j}, may be called by all threads of a (non-nested) OpenMP parallel region.@n
+		 * Every thread appends to its own bucket without synchronization, 
+		 * threads beyond omp_get_max_threads() at construction share a locked bucket.
+		 * Entries are ordered by bucket, which only affects the order duplicates are merged in.@n
+		 * Must not run concurrently with other member functions. 
+		 * Invalid triplets throw, the exception must be caught inside the parallel region.
+		 *
+		 * @param[in] i The row index of the entry.
+		 * @param[in] j The column index of the entry.
+		 * @param[in] v The value of the entry.
+		 */
+		void insertConcurrent(T_Int i, T_Int j, T_Scalar v);
+
 		/**
 		 * @brief Prints matrix information.
 		 * @param[in] msg Set a header identifier.
@@ -179,11 +210,25 @@ class XxMatrix : public MatrixMeta {
 
 		/**
 		 * @brief Converts matrix to Compressed Sparse Column format.
+		 *
+		 * Multithreaded bucket sort by column with the duplicate merging fused in.@n
+		 * Entries are bucketed directly in the output arrays, the extra storage is two bytes per entry 
+		 * plus a per-thread (row, value) buffer sized to the largest column block the thread sorts, 
+		 * which can hold all entries when the matrix has few columns.
+		 *
 		 * @param[in] duplicatePolicy Sets the policy for duplicated entries.
 		 * @return The csc-formatted matrix.
 		 */
 		typename TypeTraits<T_Matrix>::csc_type toCsc(dup_t duplicatePolicy = dup_t::Sum) const;
 
+		/**
+		 * @brief Converts matrix to Block Sparse Row format.
+		 * @param[in] bs The block size, must divide both matrix dimensions.
+		 * @param[in] duplicatePolicy Sets the policy for duplicated entries.
+		 * @return The bsr-formatted matrix.
+		 */
+		typename TypeTraits<T_Matrix>::bsr_type toBsr(uint_t bs, dup_t duplicatePolicy = dup_t::Sum) const;
+
 		/** @} */
 
 		/** 
@@ -208,12 +253,18 @@ class XxMatrix : public MatrixMeta {
 
 	private:
 
-		using TupleVec = std::vector<Tuple<T_Int,T_Scalar>>;
+		class Bucket {
+			public:
+				std::vector<T_Int> rowidx;
+				std::vector<T_Int> colidx;
+				std::vector<T_Scalar> values;
+				char pad[64]; // keeps the buckets of different threads in separate cache lines
+		};
 
-		TupleVec m_tuples;
+		std::vector<Bucket> m_buckets;
 
-		TupleVec& tupleVec();
-		const TupleVec& tupleVec() const;
+		Bucket& serialBucket();
+		void push(Bucket& bucket, T_Int i, T_Int j, T_Scalar v);
 };
 
 /*-------------------------------------------------*/
@@ -0,0 +1,339 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_assembler.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <exception>
+
+// 3rd
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// cla3p
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/fem.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+#include "cla3p/checks/coo_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Assembler<T_Matrix>::Assembler()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Assembler<T_Matrix>::Assembler(uint_t n, uint_t ne, const T_Int *eptr, const T_Int *eind, const Property& pr)
+{
+	defaults();
+
+	coo_consistency_check(pr, n, n);
+
+	if(pr.isSkew()) {
+		throw err::InvalidOp("Element assembly supports General, Triangular, Symmetric & Hermitian matrices only");
+	} // prop
+
+	if(!ne || !eptr || !eind) {
+		throw err::NoConsistency("Invalid element connectivity");
+	} // connectivity
+
+	if(eptr[0] != 0) {
+		throw err::InvalidOp("Element pointers must start at zero");
+	} // eptr[0]
+
+	for(uint_t e = 0; e < ne; e++) {
+		if(eptr[e+1] < eptr[e]) {
+			throw err::InvalidOp("Decreasing element pointers at element " + std::to_string(e));
+		} // decreasing
+		for(T_Int k = eptr[e]; k < eptr[e+1]; k++) {
+			if(eind[k] < 0 || eind[k] >= static_cast<T_Int>(n)) {
+				throw err::OutOfBounds("Element " + std::to_string(e) + " references dof " + std::to_string(eind[k]) + " out of range [0," + std::to_string(n) + ")");
+			} // out of range
+		} // k
+	} // e
+
+	m_n = n;
+	m_ne = ne;
+	m_prop = pr;
+
+	m_eptr = i_malloc<T_Int>(ne + 1);
+	std::copy(eptr, eptr + ne + 1, m_eptr);
+
+	//
+	// Symbolic phase: pattern, contribution map & coloring, all driven by the dof -> element adjacency
+	//
+	std::vector<T_Int> dptr(n + 1);
+	std::vector<T_Int> delem(eptr[ne]);
+
+	bulk::fem::dof2elem(n, ne, eptr, eind, dptr.data(), delem.data());
+
+	m_colptr = i_malloc<T_Int>(n + 1);
+	bulk::fem::elem2csc(pr.uplo(), n, eptr, eind, dptr.data(), delem.data(), m_colptr, &m_rowidx);
+
+	m_eoff = i_malloc<bulk_t>(ne + 1);
+	bulk::fem::elem_offsets(ne, eptr, m_eoff);
+
+	m_emap = i_malloc<T_Int>(nvals());
+	bulk::fem::elem2csc_map(pr.uplo(), ne, eptr, eind, m_eoff, m_colptr, m_rowidx, m_emap);
+
+	m_cptr = i_malloc<T_Int>(ne + 1);
+	m_celem = i_malloc<T_Int>(ne);
+	m_ncolors = bulk::fem::color(ne, eptr, eind, dptr.data(), delem.data(), m_cptr, m_celem);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Assembler<T_Matrix>::Assembler(Assembler<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Assembler<T_Matrix>::~Assembler()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+Assembler<T_Matrix>& Assembler<T_Matrix>::operator=(Assembler<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_n       = other.m_n;
+		m_ne      = other.m_ne;
+		m_ncolors = other.m_ncolors;
+		m_prop    = other.m_prop;
+		m_eptr    = other.m_eptr;
+		m_colptr  = other.m_colptr;
+		m_rowidx  = other.m_rowidx;
+		m_eoff    = other.m_eoff;
+		m_emap    = other.m_emap;
+		m_cptr    = other.m_cptr;
+		m_celem   = other.m_celem;
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::defaults()
+{
+	m_n = 0;
+	m_ne = 0;
+	m_ncolors = 0;
+	m_prop = Property();
+	m_eptr = nullptr;
+	m_colptr = nullptr;
+	m_rowidx = nullptr;
+	m_eoff = nullptr;
+	m_emap = nullptr;
+	m_cptr = nullptr;
+	m_celem = nullptr;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::clear()
+{
+	i_free(m_eptr);
+	i_free(m_colptr);
+	i_free(m_rowidx);
+	i_free(m_eoff);
+	i_free(m_emap);
+	i_free(m_cptr);
+	i_free(m_celem);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t Assembler<T_Matrix>::size() const { return m_n; }
+template <typename T_Matrix> uint_t Assembler<T_Matrix>::nelems() const { return m_ne; }
+template <typename T_Matrix> uint_t Assembler<T_Matrix>::nnz() const { return (m_colptr ? m_colptr[m_n] : 0); }
+template <typename T_Matrix> uint_t Assembler<T_Matrix>::ncolors() const { return m_ncolors; }
+template <typename T_Matrix> bulk_t Assembler<T_Matrix>::nvals() const { return (m_eoff ? m_eoff[m_ne] : 0); }
+template <typename T_Matrix> const Property& Assembler<T_Matrix>::prop() const { return m_prop; }
+template <typename T_Matrix> uint_t Assembler<T_Matrix>::elementSize(uint_t e) const { return m_eptr[e+1] - m_eptr[e]; }
+template <typename T_Matrix> bulk_t Assembler<T_Matrix>::elementOffset(uint_t e) const { return m_eoff[e]; }
+template <typename T_Matrix> const typename Assembler<T_Matrix>::T_Int* Assembler<T_Matrix>::colorptr() const { return m_cptr; }
+template <typename T_Matrix> const typename Assembler<T_Matrix>::T_Int* Assembler<T_Matrix>::colorelem() const { return m_celem; }
+template <typename T_Matrix> bool Assembler<T_Matrix>::empty() const { return (m_colptr == nullptr); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string Assembler<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::SparseCscAssembler() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of dofs....... " << size() << "\n";
+	ss << "  Number of elements... " << nelems() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Number of colors..... " << ncolors() << "\n";
+	ss << "  Element values....... " << nvals() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix Assembler<T_Matrix>::matrix() const
+{
+	if(empty())
+		return T_Matrix();
+
+	T_Matrix ret = T_Matrix::init(m_n, m_n, nnz(), m_prop);
+
+	std::copy(m_colptr, m_colptr + m_n + 1, ret.colptr());
+	std::copy(m_rowidx, m_rowidx + nnz(), ret.rowidx());
+	std::fill(ret.values(), ret.values() + nnz(), T_Scalar(0));
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::checkMatrix(const T_Matrix& A, bool fullPattern) const
+{
+	if(empty()) {
+		throw err::InvalidOp("Empty assembler");
+	} // empty
+
+	//
+	// The O(nnz) index comparison is skipped for single elements, it would make element-wise assembly quadratic
+	//
+	bool samePattern = (A.nrows() == m_n && A.ncols() == m_n && A.nnz() == nnz() && A.prop() == m_prop);
+
+	if(samePattern && fullPattern) {
+		samePattern = (std::equal(m_colptr, m_colptr + m_n + 1, A.colptr()) && std::equal(m_rowidx, m_rowidx + nnz(), A.rowidx()));
+	} // indices
+
+	if(!samePattern) {
+		throw err::NoConsistency("Matrix pattern does not match the assembler");
+	} // pattern
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::assemble(T_Matrix& A, const T_Scalar *evals) const
+{
+	checkMatrix(A, true);
+
+	std::fill(A.values(), A.values() + nnz(), T_Scalar(0));
+
+	bulk::fem::scatter_add(m_ncolors, m_cptr, m_celem, m_eoff, m_emap, evals, A.values());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::assemble(T_Matrix& A, const T_Function& func) const
+{
+	checkMatrix(A, true);
+
+	std::fill(A.values(), A.values() + nnz(), T_Scalar(0));
+
+	bulk_t maxvals = 0;
+	for(uint_t e = 0; e < m_ne; e++) {
+		maxvals = std::max(maxvals, m_eoff[e+1] - m_eoff[e]);
+	} // e
+
+	T_Scalar *values = A.values();
+
+	//
+	// Element buffers are allocated up front, nothing but the callback can throw inside the region
+	//
+	bool parallel = bulk::fem::use_parallel(m_eoff[m_ne]);
+	int nt = (parallel ? max_threads() : 1);
+	std::vector<T_Scalar> kbuf(maxvals * nt);
+
+	//
+	// Exceptions cannot leave the parallel region, 
+	// each thread keeps its first one & skips its remaining elements, the first caught is rethrown
+	//
+	std::exception_ptr error = nullptr;
+
+	#pragma omp parallel num_threads(nt) if(parallel)
+	{
+		bulk_t tid = 0;
+
+#if defined(_OPENMP)
+		tid = omp_get_thread_num();
+#endif
+
+		T_Scalar *ke = kbuf.data() + tid * maxvals;
+		std::exception_ptr terror = nullptr;
+
+		for(uint_t c = 0; c < m_ncolors; c++) {
+
+			#pragma omp for schedule(dynamic, 16)
+			for(int_t k = m_cptr[c]; k < m_cptr[c+1]; k++) {
+				if(terror) continue;
+				try {
+					T_Int e = m_celem[k];
+					func(static_cast<uint_t>(e), ke);
+					bulk::fem::add_element(m_eoff[e+1] - m_eoff[e], m_emap + m_eoff[e], ke, values);
+				} catch(...) {
+					terror = std::current_exception();
+				} // func
+			} // k
+
+		} // c
+
+		#pragma omp critical(cla3p_assembler_error)
+		if(terror && !error) error = terror;
+	}
+
+	if(error) {
+		std::rethrow_exception(error);
+	} // error
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void Assembler<T_Matrix>::addElement(T_Matrix& A, uint_t e, const T_Scalar *ke) const
+{
+	checkMatrix(A, false);
+
+	if(e >= m_ne) {
+		throw err::OutOfBounds(msg::IndexOutOfBounds(m_ne, e));
+	} // e
+
+	bulk::fem::add_element(m_eoff[e+1] - m_eoff[e], m_emap + m_eoff[e], ke, A.values());
+}
+/*-------------------------------------------------*/
+template class Assembler<RdMatrix>;
+template class Assembler<RfMatrix>;
+template class Assembler<CdMatrix>;
+template class Assembler<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_ASSEMBLER_HPP_
+#define CLA3P_CSC_ASSEMBLER_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+#include <functional>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @nosubgrouping 
+ * @brief A finite element assembler for sparse matrices with a fixed pattern.
+ *
+ * The assembler is created once from the element connectivity lists of an (n x n) system. 
+ * It builds the csc pattern of the sum of the element matrices directly from the lists, 
+ * maps every element-local (i,j) contribution to its position in the matrix values 
+ * and colors the elements so that elements of the same color share no degrees of freedom.@n
+ * Numeric assemblies are then plain scatter-adds into the values of a matrix created by matrix(), 
+ * the elements of each color are added in parallel without write conflicts.@n
+ * Element matrices are always given full, for Symmetric, Hermitian & Triangular properties 
+ * only the contributions in the stored part are added.
+ */
+template <typename T_Matrix>
+class Assembler {
+
+	private:
+		using T_Int = typename T_Matrix::index_type;
+		using T_Scalar = typename T_Matrix::value_type;
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+
+		/**
+		 * @brief The element matrix callback.
+		 *
+		 * Fills the column-major (nd x nd) matrix of element e, nd being elementSize(e).@n
+		 * It is called concurrently from several threads (for different elements of the same color), 
+		 * so it must be thread-safe.
+		 */
+		using T_Function = std::function<void(uint_t e, T_Scalar *ke)>;
+
+		// no copy
+		Assembler(const Assembler<T_Matrix>&) = delete;
+		Assembler<T_Matrix>& operator=(const Assembler<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty assembler.
+		 */
+		explicit Assembler();
+
+		/**
+		 * @brief The connectivity constructor.
+		 *
+		 * Constructs the pattern, the contribution map & the element coloring of an (n x n) system.
+		 *
+		 * @param[in] n The number of degrees of freedom.
+		 * @param[in] ne The number of elements.
+		 * @param[in] eptr The element pointers (size: ne + 1, eptr[0] = 0).
+		 * @param[in] eind The element degrees of freedom, eind[eptr[e] ... eptr[e+1]-1] for element e (size: eptr[ne]).
+		 * @param[in] pr The property of the assembled matrix.
+		 */
+		explicit Assembler(uint_t n, uint_t ne, const T_Int *eptr, const T_Int *eind, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs an assembler with the contents of other, other is destroyed.
+		 */
+		Assembler(Assembler<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the assembler.
+		 */
+		~Assembler();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		Assembler<T_Matrix>& operator=(Assembler<T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of degrees of freedom (matrix rows & columns).
+		 */
+		uint_t size() const;
+
+		/**
+		 * @brief The number of elements.
+		 */
+		uint_t nelems() const;
+
+		/**
+		 * @brief The number of non-zero entries of the assembled matrix.
+		 */
+		uint_t nnz() const;
+
+		/**
+		 * @brief The number of element colors.
+		 */
+		uint_t ncolors() const;
+
+		/**
+		 * @brief The size of the element values array, the sum of the squared element sizes.
+		 */
+		bulk_t nvals() const;
+
+		/**
+		 * @brief The property of the assembled matrix.
+		 */
+		const Property& prop() const;
+
+		/**
+		 * @brief The number of degrees of freedom of element e.
+		 */
+		uint_t elementSize(uint_t e) const;
+
+		/**
+		 * @brief The offset of the matrix of element e in the element values array.
+		 */
+		bulk_t elementOffset(uint_t e) const;
+
+		/**
+		 * @brief The color pointers array (size: ncolors() + 1).
+		 */
+		const T_Int* colorptr() const;
+
+		/**
+		 * @brief The elements sorted by color (size: nelems()).
+		 *
+		 * The elements of color c are colorelem()[colorptr()[c] ... colorptr()[c+1]-1].
+		 */
+		const T_Int* colorelem() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the assembler is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the assembler.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the assembler.
+		 * @param[in] msg Header message.
+		 * @return A string with the assembler information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Creates a matrix with the assembled pattern.
+		 * @return A (size() x size()) matrix with zero values.
+		 */
+		T_Matrix matrix() const;
+
+		/**
+		 * @brief Assembles the element matrices.
+		 *
+		 * The values of A are replaced by the sum of the element matrices.
+		 *
+		 * @param[in,out] A A matrix created by matrix().
+		 * @param[in] evals The column-major element matrices, element e starts at elementOffset(e) (size: nvals()).
+		 */
+		void assemble(T_Matrix& A, const T_Scalar *evals) const;
+
+		/**
+		 * @brief Assembles the element matrices.
+		 *
+		 * The values of A are replaced by the sum of the element matrices, 
+		 * each element matrix is created by func in a per-thread buffer right before it is added.@n
+		 * func runs concurrently on several threads and must be thread-safe. 
+		 * If it throws, the first exception caught is rethrown once all threads are done & the values of A are unspecified.
+		 *
+		 * @param[in,out] A A matrix created by matrix().
+		 * @param[in] func The element matrix callback.
+		 */
+		void assemble(T_Matrix& A, const T_Function& func) const;
+
+		/**
+		 * @brief Adds an element matrix.
+		 *
+		 * Concurrent calls are safe for elements of the same color.
+		 * Only the dimensions, nnz & property of A are verified, not its pattern.
+		 *
+		 * @param[in,out] A A matrix created by matrix().
+		 * @param[in] e The element.
+		 * @param[in] ke The column-major (elementSize(e) x elementSize(e)) element matrix.
+		 */
+		void addElement(T_Matrix& A, uint_t e, const T_Scalar *ke) const;
+
+		/** @} */
+
+	private:
+		uint_t m_n;
+		uint_t m_ne;
+		uint_t m_ncolors;
+		Property m_prop;
+		T_Int *m_eptr;
+		T_Int *m_colptr;
+		T_Int *m_rowidx;
+		bulk_t *m_eoff;
+		T_Int *m_emap;
+		T_Int *m_cptr;
+		T_Int *m_celem;
+
+		void defaults();
+		void checkMatrix(const T_Matrix& A, bool fullPattern) const;
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_ASSEMBLER_HPP_
@@ -25,6 +25,10 @@ namespace cla3p {
 /*-------------------------------------------------*/
 
 namespace dns { template <typename T_Scalar> class CxMatrix; }
+namespace dns { template <typename T_Scalar> class CxVector; }
+namespace csr { template <typename T_Int, typename T_Scalar> class CxMatrix; }
+namespace coo { template <typename T_Int, typename T_Scalar> class CxMatrix; }
+namespace bsr { template <typename T_Int, typename T_Scalar> class CxMatrix; }
 namespace csc { template <typename T_Int, typename T_Scalar> class RxMatrix; }
 
 /*-------------------------------------------------*/
@@ -126,6 +130,10 @@ class TypeTraits<csc::CxMatrix<T_Int,T_Scalar>> {
 		static std::string type_name() { return msg::SparseCscMatrix(); }
 		using real_type = csc::RxMatrix<T_Int,T_RScalar>;
 		using dns_type = dns::CxMatrix<T_Scalar>;
+		using vector_type = dns::CxVector<T_Scalar>;
+		using csr_type = csr::CxMatrix<T_Int,T_Scalar>;
+		using coo_type = coo::CxMatrix<T_Int,T_Scalar>;
+		using bsr_type = bsr::CxMatrix<T_Int,T_Scalar>;
 };
 
 /*-------------------------------------------------*/
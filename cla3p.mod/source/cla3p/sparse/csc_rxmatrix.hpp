@@ -25,6 +25,10 @@ namespace cla3p {
 /*-------------------------------------------------*/
 
 namespace dns { template <typename T_Scalar> class RxMatrix; }
+namespace dns { template <typename T_Scalar> class RxVector; }
+namespace csr { template <typename T_Int, typename T_Scalar> class RxMatrix; }
+namespace coo { template <typename T_Int, typename T_Scalar> class RxMatrix; }
+namespace bsr { template <typename T_Int, typename T_Scalar> class RxMatrix; }
 
 /*-------------------------------------------------*/
 namespace csc {
@@ -98,6 +102,10 @@ class TypeTraits<csc::RxMatrix<T_Int,T_Scalar>> {
 		static std::string type_name() { return msg::SparseCscMatrix(); }
 		using real_type = csc::RxMatrix<T_Int,T_Scalar>;
 		using dns_type = dns::RxMatrix<T_Scalar>;
+		using vector_type = dns::RxVector<T_Scalar>;
+		using csr_type = csr::RxMatrix<T_Int,T_Scalar>;
+		using coo_type = coo::RxMatrix<T_Int,T_Scalar>;
+		using bsr_type = bsr::RxMatrix<T_Int,T_Scalar>;
 };
 
 /*-------------------------------------------------*/
@@ -0,0 +1,241 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csc_sell_matrix.hpp"
+
+// system
+#include <algorithm>
+#include <sstream>
+
+// 3rd
+
+// cla3p
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/sell.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/error/exceptions.hpp"
+#include "cla3p/error/literals.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csc {
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix>::SellMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix>::SellMatrix(SellMatrix<T_Matrix>&& other)
+{
+	defaults();
+	*this = std::move(other);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix>::~SellMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix>& SellMatrix<T_Matrix>::operator=(SellMatrix<T_Matrix>&& other)
+{
+	if(this != &other) {
+		clear();
+		m_nr       = other.m_nr;
+		m_nc       = other.m_nc;
+		m_nnz      = other.m_nnz;
+		m_csize    = other.m_csize;
+		m_sigma    = other.m_sigma;
+		m_prop     = other.m_prop;
+		m_chunkptr = other.m_chunkptr;
+		m_colidx   = other.m_colidx;
+		m_values   = other.m_values;
+		m_rowidx   = other.m_rowidx;
+		m_perm     = std::move(other.m_perm);
+		other.defaults();
+	} // this != other
+
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void SellMatrix<T_Matrix>::defaults()
+{
+	m_nr = 0;
+	m_nc = 0;
+	m_nnz = 0;
+	m_csize = 0;
+	m_sigma = 0;
+	m_prop = Property();
+	m_chunkptr = nullptr;
+	m_colidx = nullptr;
+	m_values = nullptr;
+	m_rowidx = nullptr;
+	m_perm.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void SellMatrix<T_Matrix>::clear()
+{
+	i_free(m_chunkptr);
+	i_free(m_colidx);
+	i_free(m_values);
+	i_free(m_rowidx);
+	defaults();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::nrows() const { return m_nr; }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::ncols() const { return m_nc; }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::nnz() const { return m_nnz; }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::chunkSize() const { return m_csize; }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::sigma() const { return m_sigma; }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::nchunks() const { return (m_csize ? (m_nr + m_csize - 1) / m_csize : 0); }
+template <typename T_Matrix> uint_t SellMatrix<T_Matrix>::nvals() const { return (m_chunkptr ? m_chunkptr[nchunks()] : 0); }
+template <typename T_Matrix> const Property& SellMatrix<T_Matrix>::prop() const { return m_prop; }
+template <typename T_Matrix> const typename SellMatrix<T_Matrix>::T_Int* SellMatrix<T_Matrix>::chunkptr() const { return m_chunkptr; }
+template <typename T_Matrix> const typename SellMatrix<T_Matrix>::T_Int* SellMatrix<T_Matrix>::colidx() const { return m_colidx; }
+template <typename T_Matrix> const typename SellMatrix<T_Matrix>::T_Scalar* SellMatrix<T_Matrix>::values() const { return m_values; }
+template <typename T_Matrix> const typename SellMatrix<T_Matrix>::T_Int* SellMatrix<T_Matrix>::rowidx() const { return m_rowidx; }
+template <typename T_Matrix> const prm::PiMatrix& SellMatrix<T_Matrix>::rowPermutation() const { return m_perm; }
+template <typename T_Matrix> bool SellMatrix<T_Matrix>::empty() const { return (m_chunkptr == nullptr); }
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+std::string SellMatrix<T_Matrix>::info(const std::string& msg) const
+{
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << msg::SparseSellMatrix() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Chunk size........... " << chunkSize() << "\n";
+	ss << "  Sorting window....... " << sigma() << "\n";
+	ss << "  Number of chunks..... " << nchunks() << "\n";
+	ss << "  Stored values........ " << nvals() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix> SellMatrix<T_Matrix>::copy() const
+{
+	SellMatrix<T_Matrix> ret;
+
+	if(empty())
+		return ret;
+
+	ret.m_nr    = m_nr;
+	ret.m_nc    = m_nc;
+	ret.m_nnz   = m_nnz;
+	ret.m_csize = m_csize;
+	ret.m_sigma = m_sigma;
+	ret.m_prop  = m_prop;
+
+	ret.m_chunkptr = i_malloc<T_Int>(nchunks() + 1);
+	ret.m_colidx   = i_malloc<T_Int>(nvals());
+	ret.m_values   = i_malloc<T_Scalar>(nvals());
+	ret.m_rowidx   = i_malloc<T_Int>(nrows());
+
+	std::copy(m_chunkptr, m_chunkptr + nchunks() + 1, ret.m_chunkptr);
+	std::copy(m_colidx  , m_colidx   + nvals()      , ret.m_colidx  );
+	std::copy(m_values  , m_values   + nvals()      , ret.m_values  );
+	std::copy(m_rowidx  , m_rowidx   + nrows()      , ret.m_rowidx  );
+
+	ret.m_perm = m_perm.copy();
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix> SellMatrix<T_Matrix>::move()
+{
+	SellMatrix<T_Matrix> ret = std::move(*this);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+SellMatrix<T_Matrix> SellMatrix<T_Matrix>::fromCsc(const T_Matrix& mat, uint_t chunkSize, uint_t sigma)
+{
+	if(mat.prop().isSkew()) {
+		throw err::InvalidOp("SELL-C-sigma format supports General, Triangular, Symmetric & Hermitian matrices only");
+	} // prop
+
+	SellMatrix<T_Matrix> ret;
+
+	if(mat.empty())
+		return ret;
+
+	uint_t c = (chunkSize ? chunkSize : bulk::sell::default_chunk_size<T_Scalar>());
+	uint_t s = (sigma ? sigma : 32 * c);
+
+	uint_t m = mat.nrows();
+	uint_t nchunks = (m + c - 1) / c;
+
+	//
+	// Kernels are general, the stored triangle of Symmetric/Hermitian matrices is expanded
+	//
+	auto tmp = (mat.prop().isGeneral() || mat.prop().isTriangular() ? mat.toCsr() : mat.general().toCsr());
+
+	ret.m_nr    = m;
+	ret.m_nc    = mat.ncols();
+	ret.m_nnz   = tmp.nnz();
+	ret.m_csize = c;
+	ret.m_sigma = s;
+	ret.m_prop  = mat.prop();
+
+	ret.m_chunkptr = i_malloc<T_Int>(nchunks + 1);
+	ret.m_rowidx   = i_malloc<T_Int>(m);
+
+	bulk::sell::csr2sell_layout(m, c, s, tmp.rowptr(), ret.m_rowidx, ret.m_chunkptr);
+
+	ret.m_colidx = i_malloc<T_Int>(ret.nvals());
+	ret.m_values = i_malloc<T_Scalar>(ret.nvals());
+
+	bulk::sell::csr2sell(m, c, tmp.rowptr(), tmp.colidx(), tmp.values(), 
+			ret.m_rowidx, ret.m_chunkptr, ret.m_colidx, ret.m_values);
+
+	ret.m_perm = prm::PiMatrix(m);
+	for(uint_t k = 0; k < m; k++) {
+		ret.m_perm(ret.m_rowidx[k]) = static_cast<int_t>(k);
+	} // k
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template class SellMatrix<RdMatrix>;
+template class SellMatrix<RfMatrix>;
+template class SellMatrix<CdMatrix>;
+template class SellMatrix<CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace csc
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,260 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSC_SELL_MATRIX_HPP_
+#define CLA3P_CSC_SELL_MATRIX_HPP_
+
+/**
+ * @file
+ */
+
+#include <string>
+
+#include "cla3p/types.hpp"
+#include "cla3p/types/literals.hpp"
+#include "cla3p/perms.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csc {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_matrices_sparse
+ * @nosubgrouping 
+ * @brief A sparse matrix in sliced ELLPACK (SELL-C-sigma) storage.
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and grouped in chunks of C rows. 
+ * Each chunk is stored as a column-major (C x width) panel, width being the longest row of the chunk, 
+ * so that the product kernels process C rows with a single vector instruction per stored column.@n
+ * Symmetric & Hermitian matrices are stored expanded. 
+ * Products take and return vectors in the original row ordering, 
+ * the row sorting is available through rowPermutation().
+ */
+template <typename T_Matrix>
+class SellMatrix {
+
+	private:
+		using T_Int = typename T_Matrix::index_type;
+		using T_Scalar = typename T_Matrix::value_type;
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+
+		// no copy
+		SellMatrix(const SellMatrix<T_Matrix>&) = delete;
+		SellMatrix<T_Matrix>& operator=(const SellMatrix<T_Matrix>&) = delete;
+
+		/**
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit SellMatrix();
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of other, other is destroyed.
+		 */
+		SellMatrix(SellMatrix<T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~SellMatrix();
+
+		/** @} */
+
+		/**
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents with those of other, other is destroyed.
+		 */
+		SellMatrix<T_Matrix>& operator=(SellMatrix<T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of matrix rows.
+		 */
+		uint_t nrows() const;
+
+		/**
+		 * @brief The number of matrix columns.
+		 */
+		uint_t ncols() const;
+
+		/**
+		 * @brief The number of non-zero entries of the expanded matrix (padding excluded).
+		 */
+		uint_t nnz() const;
+
+		/**
+		 * @brief The chunk height C.
+		 */
+		uint_t chunkSize() const;
+
+		/**
+		 * @brief The sorting window sigma.
+		 */
+		uint_t sigma() const;
+
+		/**
+		 * @brief The number of chunks, ceil(nrows() / chunkSize()).
+		 */
+		uint_t nchunks() const;
+
+		/**
+		 * @brief The number of stored entries (padding included), chunkptr()[nchunks()].
+		 */
+		uint_t nvals() const;
+
+		/**
+		 * @brief The property of the matrix the storage was created from.
+		 */
+		const Property& prop() const;
+
+		/**
+		 * @brief The chunk offsets array (size: nchunks() + 1).
+		 */
+		const T_Int* chunkptr() const;
+
+		/**
+		 * @brief The column indices array (size: nvals()).
+		 */
+		const T_Int* colidx() const;
+
+		/**
+		 * @brief The values array (size: nvals()).
+		 */
+		const T_Scalar* values() const;
+
+		/**
+		 * @brief The original row of each stored row (size: nrows()).
+		 */
+		const T_Int* rowidx() const;
+
+		/**
+		 * @brief The row sorting permutation.
+		 *
+		 * P(i) is the stored position of row i, P * A is the row-sorted matrix.
+		 */
+		const prm::PiMatrix& rowPermutation() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Test whether the matrix is empty.
+		 */
+		bool empty() const;
+
+		/**
+		 * @brief Clears the matrix.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints information about the matrix.
+		 * @param[in] msg Header message.
+		 * @return A string with the matrix information.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies the matrix.
+		 * @return A deep copy of the matrix.
+		 */
+		SellMatrix<T_Matrix> copy() const;
+
+		/**
+		 * @brief Moves the matrix.
+		 * @return A matrix with the contents of (*this), (*this) is destroyed.
+		 */
+		SellMatrix<T_Matrix> move();
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Converts a csc matrix to SELL-C-sigma storage.
+		 *
+		 * @param[in] mat The input General, Triangular, Symmetric or Hermitian matrix.
+		 * @param[in] chunkSize The chunk height C, 0 selects one 512-bit vector register of values.
+		 * @param[in] sigma The sorting window in rows, 0 selects 32 * C, 1 disables sorting.
+		 * @return The matrix in SELL-C-sigma storage.
+		 */
+		static SellMatrix<T_Matrix> fromCsc(const T_Matrix& mat, uint_t chunkSize = 0, uint_t sigma = 0);
+
+		/** @} */
+
+	private:
+		uint_t m_nr;
+		uint_t m_nc;
+		uint_t m_nnz;
+		uint_t m_csize;
+		uint_t m_sigma;
+		Property m_prop;
+		T_Int *m_chunkptr;
+		T_Int *m_colidx;
+		T_Scalar *m_values;
+		T_Int *m_rowidx;
+		prm::PiMatrix m_perm;
+
+		void defaults();
+};
+
+/*-------------------------------------------------*/
+} // namespace csc
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+class TypeTraits<csc::SellMatrix<T_Matrix>> {
+	public:
+		static constexpr bool is_real() { return TypeTraits<T_Matrix>::is_real(); }
+		static constexpr bool is_complex() { return TypeTraits<T_Matrix>::is_complex(); }
+		static std::string type_name() { return msg::SparseSellMatrix(); }
+		using vector_type = typename TypeTraits<T_Matrix>::vector_type;
+};
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_CSC_SELL_MATRIX_HPP_
@@ -28,13 +28,14 @@
 #include "cla3p/bulk/dns.hpp"
 #include "cla3p/bulk/csc.hpp"
 #include "cla3p/bulk/csc_math.hpp"
+#include "cla3p/bulk/bsr.hpp"
+#include "cla3p/proxies/mkl_sparse_proxy.hpp"
 #include "cla3p/support/imalloc.hpp"
 #include "cla3p/support/utils.hpp"
 
 #include "cla3p/checks/basic_checks.hpp"
 #include "cla3p/checks/csc_checks.hpp"
 #include "cla3p/checks/block_ops_checks.hpp"
-#include "cla3p/checks/transp_checks.hpp"
 #include "cla3p/checks/perm_checks.hpp"
 #include "cla3p/checks/hermitian_coeff_checks.hpp"
 
@@ -54,6 +55,8 @@ XxMatrixTmpl::XxMatrix()
 XxMatrixTlst
 XxMatrixTmpl::XxMatrix(uint_t nr, uint_t nc, uint_t nz, const Property& pr)
 {
+	defaults();
+
 	T_Int    *cptr = static_cast<T_Int   *>(i_malloc(nc + 1, sizeof(T_Int   )));
 	T_Int    *ridx = static_cast<T_Int   *>(i_malloc(nz    , sizeof(T_Int   )));
 	T_Scalar *vals = static_cast<T_Scalar*>(i_malloc(nz    , sizeof(T_Scalar)));
@@ -66,6 +69,7 @@ XxMatrixTmpl::XxMatrix(uint_t nr, uint_t nc, uint_t nz, const Property& pr)
 XxMatrixTlst
 XxMatrixTmpl::XxMatrix(XxMatrixTmpl&& other)
 {
+	defaults();
 	other.moveTo(*this);
 }
 /*-------------------------------------------------*/
@@ -88,11 +92,16 @@ void XxMatrixTmpl::defaults()
 	setColptr(nullptr);
 	setRowidx(nullptr);
 	setValues(nullptr);
+
+	m_ncalls = 0;
+	m_handle = nullptr;
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 void XxMatrixTmpl::clear()
 {
+	releaseHandle();
+
 	if(owner()) {
 		i_free(colptr());
 		i_free(rowidx());
@@ -106,6 +115,13 @@ void XxMatrixTmpl::clear()
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
+void XxMatrixTmpl::releaseHandle()
+{
+	delete m_handle;
+	m_handle = nullptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
 void XxMatrixTmpl::setColptr(T_Int* colptr)
 {
 	m_colptr = colptr;
@@ -141,6 +157,7 @@ const T_Int* XxMatrixTmpl::colptr() const
 XxMatrixTlst
 T_Int* XxMatrixTmpl::colptr()
 {
+	releaseHandle();
 	return m_colptr;
 }
 /*-------------------------------------------------*/
@@ -153,6 +170,7 @@ const T_Int* XxMatrixTmpl::rowidx() const
 XxMatrixTlst
 T_Int* XxMatrixTmpl::rowidx()
 {
+	releaseHandle();
 	return m_rowidx;
 }
 /*-------------------------------------------------*/
@@ -165,6 +183,7 @@ const T_Scalar* XxMatrixTmpl::values() const
 XxMatrixTlst
 T_Scalar* XxMatrixTmpl::values()
 {
+	releaseHandle();
 	return m_values;
 }
 /*-------------------------------------------------*/
@@ -215,13 +234,20 @@ void XxMatrixTmpl::copyTo(XxMatrixTmpl& trg) const
 XxMatrixTlst
 void XxMatrixTmpl::shallowCopyTo(XxMatrixTmpl& trg)
 {
-	trg.wrapper(nrows(), ncols(), colptr(), rowidx(), values(), false, prop());
+	trg.wrapper(nrows(), ncols(), m_colptr, m_rowidx, m_values, false, prop());
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
 void XxMatrixTmpl::moveTo(XxMatrixTmpl& trg)
 {
-	trg.wrapper(nrows(), ncols(), colptr(), rowidx(), values(), owner(), prop());
+	uint_t ncalls = m_ncalls;
+	mkl::CscHandle<T_Scalar> *handle = m_handle;
+	m_handle = nullptr;
+
+	trg.wrapper(nrows(), ncols(), m_colptr, m_rowidx, m_values, owner(), prop());
+
+	trg.m_ncalls = ncalls;
+	trg.m_handle = handle;
 
 	unbind();
 	clear();
@@ -273,40 +299,18 @@ void XxMatrixTmpl::iscale(T_Scalar val)
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
-T_Matrix XxMatrixTmpl::transpose() const
+VirtualCscMatrix<T_Matrix> XxMatrixTmpl::transpose() const
 {
-	transp_op_consistency_check(prop().type(), false);
-
-	T_Matrix ret(ncols(), nrows(), nnz(), prop());
-
-	bulk::csc::transpose(
-			nrows(), ncols(), 
-			colptr(), 
-			rowidx(), 
-			values(), 
-			ret.colptr(), 
-			ret.rowidx(), 
-			ret.values());
-
+	VirtualCscMatrix<T_Matrix> ret(this->self());
+	ret.itranspose();
 	return ret;
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
-T_Matrix XxMatrixTmpl::ctranspose() const
+VirtualCscMatrix<T_Matrix> XxMatrixTmpl::ctranspose() const
 {
-	transp_op_consistency_check(prop().type(), true);
-
-	T_Matrix ret(ncols(), nrows(), nnz(), prop());
-
-	bulk::csc::conjugate_transpose(
-			nrows(), ncols(), 
-			colptr(), 
-			rowidx(), 
-			values(), 
-			ret.colptr(), 
-			ret.rowidx(), 
-			ret.values());
-
+	VirtualCscMatrix<T_Matrix> ret(this->self());
+	ret.ictranspose();
 	return ret;
 }
 /*-------------------------------------------------*/
@@ -320,9 +324,9 @@ void XxMatrixTmpl::iconjugate()
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
-T_Matrix XxMatrixTmpl::conjugate() const
+VirtualCscMatrix<T_Matrix> XxMatrixTmpl::conjugate() const
 {
-	T_Matrix ret = copy();
+	VirtualCscMatrix<T_Matrix> ret(this->self());
 	ret.iconjugate();
 	return ret;
 }
@@ -389,6 +393,74 @@ typename XxMatrixTmpl::T_DnsMatrix XxMatrixTmpl::toDns() const
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
+typename XxMatrixTmpl::T_CsrMatrix XxMatrixTmpl::toCsr() const
+{
+	T_CsrMatrix ret(nrows(), ncols(), nnz(), prop());
+
+	bulk::csc::transpose(
+			nrows(), ncols(), 
+			colptr(), 
+			rowidx(), 
+			values(), 
+			ret.rowptr(), 
+			ret.colidx(), 
+			ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_BsrMatrix XxMatrixTmpl::toBsr(uint_t bs) const
+{
+	if(!bs || nrows() % bs || ncols() % bs) {
+		throw err::InvalidOp("Matrix dimensions must be multiples of the block size");
+	} // bs
+
+	if(!(prop().isGeneral() || prop().isSymmetric() || prop().isHermitian())) {
+		throw err::InvalidOp("Block sparse format supports General, Symmetric & Hermitian matrices only");
+	} // prop
+
+	if(empty()) return T_BsrMatrix();
+
+	T_CsrMatrix tmp = toCsr();
+
+	uint_t mb = nrows() / bs;
+
+	T_Int *rptr = static_cast<T_Int*>(i_malloc(mb + 1, sizeof(T_Int)));
+
+	bulk::bsr::csr2bsr_rowptr(nrows(), ncols(), bs, tmp.rowptr(), tmp.colidx(), rptr);
+
+	uint_t nzb = rptr[mb];
+
+	T_Int    *cidx = static_cast<T_Int   *>(i_malloc(nzb          , sizeof(T_Int   )));
+	T_Scalar *vals = static_cast<T_Scalar*>(i_malloc(nzb * bs * bs, sizeof(T_Scalar)));
+
+	bulk::bsr::csr2bsr(prop().type(), prop().uplo(), nrows(), ncols(), bs, 
+			tmp.rowptr(), tmp.colidx(), tmp.values(), rptr, cidx, vals);
+
+	return T_BsrMatrix::wrap(nrows(), ncols(), bs, rptr, cidx, vals, true, prop());
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_CsrMatrix XxMatrixTmpl::rtranspose()
+{
+	if(empty()) return T_CsrMatrix();
+
+	Property pr = prop();
+	pr.switchUplo();
+
+	return T_CsrMatrix::wrap(ncols(), nrows(), m_colptr, m_rowidx, m_values, false, pr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<typename XxMatrixTmpl::T_CsrMatrix> XxMatrixTmpl::rtranspose() const
+{
+	T_CsrMatrix tmp = const_cast<XxMatrixTmpl&>(*this).rtranspose();
+	Guard<T_CsrMatrix> ret(tmp);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
 T_Matrix XxMatrixTmpl::permuteLeftRight(const prm::PiMatrix& P, const prm::PiMatrix& Q) const
 {
 	perm_ge_op_consistency_check(prop().type(), nrows(), ncols(), P.size(), Q.size());
@@ -501,6 +573,25 @@ T_Matrix XxMatrixTmpl::block(uint_t ibgn, uint_t jbgn, uint_t ni, uint_t nj) con
 }
 /*-------------------------------------------------*/
 XxMatrixTlst
+void XxMatrixTmpl::optimize(uint_t ncalls)
+{
+	releaseHandle();
+	m_ncalls = ncalls;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+mkl::CscHandle<T_Scalar>* XxMatrixTmpl::handle() const
+{
+	if(!m_ncalls || empty()) return nullptr;
+
+	if(!m_handle) {
+		m_handle = new mkl::CscHandle<T_Scalar>(m_ncalls);
+	} // create
+
+	return m_handle;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
 void XxMatrixTmpl::wrapper(uint_t nr, uint_t nc, T_Int *cptr, T_Int *ridx, T_Scalar *vals, bool bind, const Property& pr)
 {
 	clear();
@@ -24,13 +24,14 @@
 #include "cla3p/generic/ownership.hpp"
 #include "cla3p/generic/matrix_meta.hpp"
 #include "cla3p/generic/guard.hpp"
-//#include "cla3p/virtuals/virtual_object.hpp"
+#include "cla3p/virtuals/virtual_csc.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p { 
 /*-------------------------------------------------*/
 
 namespace prm { template <typename T_Int> class PxMatrix; }
+namespace mkl { template <typename T_Scalar> class CscHandle; }
 
 /*-------------------------------------------------*/
 namespace csc {
@@ -45,6 +46,8 @@ class XxMatrix : public Ownership, public MatrixMeta {
 
 	private:
 		using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+		using T_CsrMatrix = typename TypeTraits<T_Matrix>::csr_type;
+		using T_BsrMatrix = typename TypeTraits<T_Matrix>::bsr_type;
 
 	public:
 		using index_type = T_Int;
@@ -124,6 +127,8 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		/**
 		 * @brief The matrix column pointer array.
 		 * @return The array containing the number of non-zero elements in each column of `(*this)`.
+		 *
+		 * Mutable access discards the optimized product handle (if any), see optimize().
 		 */
 		T_Int* colptr();
 
@@ -135,6 +140,8 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		/**
 		 * @brief The matrix row index array.
 		 * @return The array containing the non-zero element row index in each column of `(*this)`.
+		 *
+		 * Mutable access discards the optimized product handle (if any), see optimize().
 		 */
 		T_Int* rowidx();
 
@@ -146,6 +153,8 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		/**
 		 * @brief The matrix values array.
 		 * @return The array containing the non-zero element values in each column of `(*this)`.
+		 *
+		 * Mutable access discards the optimized product handle (if any), see optimize().
 		 */
 		T_Scalar* values();
 
@@ -220,14 +229,14 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		void iscale(T_Scalar val);
 
 		/**
-		 * @brief Transposes a matrix.
+		 * @brief Virtually transposes a matrix.
 		 */
-		T_Matrix transpose() const;
+		VirtualCscMatrix<T_Matrix> transpose() const;
 
 		/**
-		 * @brief Conjugate-transposes a matrix.
+		 * @brief Virtually conjugate-transposes a matrix.
 		 */
-		T_Matrix ctranspose() const;
+		VirtualCscMatrix<T_Matrix> ctranspose() const;
 
 		/**
 		 * @brief Conjugates a matrix in-place.
@@ -235,9 +244,9 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		void iconjugate();
 
 		/**
-		 * @brief Conjugates a matrix.
+		 * @brief Virtually conjugates a matrix.
 		 */
-		T_Matrix conjugate() const;
+		VirtualCscMatrix<T_Matrix> conjugate() const;
 
 		/**
 		 * @brief Converts a matrix to general.
@@ -251,6 +260,52 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		 */
 		T_DnsMatrix toDns() const;
 
+		/**
+		 * @brief Converts a matrix to csr format.
+		 *
+		 * The conversion is multithreaded for large matrices.
+		 *
+		 * @return A copy of `(*this)` in csr format.
+		 *
+		 * @see rtranspose()
+		 */
+		T_CsrMatrix toCsr() const;
+
+		/**
+		 * @brief Converts a matrix to bsr format.
+		 *
+		 * Nonzero blocks are stored densely, so explicit zeros are added inside partially filled blocks.
+		 * Only General, Symmetric & Hermitian matrices are supported.
+		 *
+		 * @param[in] bs The block size, must divide both matrix dimensions.
+		 * @return A copy of `(*this)` in bsr format.
+		 */
+		T_BsrMatrix toBsr(uint_t bs) const;
+
+		/**
+		 * @brief Reinterprets a matrix as the csr matrix of its transpose.
+		 *
+		 * No data is copied, the result shares the arrays of `(*this)`.
+		 * If `(*this)` is symmetric, hermitian or triangular, the uplo of the result is switched.
+		 *
+		 * @return A shallow csr copy of `(*this)^T`, `(*this)` is unchanged.
+		 *
+		 * @see toCsr(), rtranspose() const
+		 */
+		T_CsrMatrix rtranspose();
+
+		/**
+		 * @brief Reinterprets an immutable matrix as the csr matrix of its transpose.
+		 *
+		 * No data is copied, the result shares the arrays of `(*this)`.
+		 * If `(*this)` is symmetric, hermitian or triangular, the uplo of the result is switched.
+		 *
+		 * @return A guard shallow csr copy of `(*this)^T`.
+		 *
+		 * @see toCsr(), rtranspose()
+		 */
+		Guard<T_CsrMatrix> rtranspose() const;
+
 		/**
 		 * @brief Permutes a general matrix.
 		 *
@@ -313,6 +368,26 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		 */
 		T_Matrix block(uint_t ibgn, uint_t jbgn, uint_t ni, uint_t nj) const;
 
+		/**
+		 * @brief Enables persistent optimized products.
+		 *
+		 * Matrix-vector and matrix-matrix products with `(*this)` reuse an analyzed & optimized backend handle
+		 * instead of rebuilding it on every call. The handle is created on the first product and discarded
+		 * whenever the contents of `(*this)` are accessed via colptr(), rowidx() or values().
+		 * Modifying the data through a shallow copy of `(*this)` is not tracked.
+		 *
+		 * @param[in] ncalls The expected number of products, used as an optimization hint. Use 0 to disable.
+		 */
+		void optimize(uint_t ncalls);
+
+		/**
+		 * @brief The optimized product handle.
+		 * @return The persistent product handle of `(*this)`, nullptr if optimize() is not enabled.
+		 *
+		 * For internal use, the handle is lazily created and not thread safe.
+		 */
+		mkl::CscHandle<T_Scalar>* handle() const;
+
 		/** @} */
 
 		/** 
@@ -371,7 +446,11 @@ class XxMatrix : public Ownership, public MatrixMeta {
 		T_Int*    m_rowidx;
 		T_Scalar* m_values;
 
+		uint_t m_ncalls;
+		mutable mkl::CscHandle<T_Scalar>* m_handle;
+
 		void defaults();
+		void releaseHandle();
 
 		void setColptr(T_Int*);
 		void setRowidx(T_Int*);
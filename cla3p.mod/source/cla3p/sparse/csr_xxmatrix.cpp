@@ -0,0 +1,433 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/sparse/csr_xxmatrix.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/bulk/csr.hpp"
+#include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/utils.hpp"
+
+#include "cla3p/checks/csc_checks.hpp"
+#include "cla3p/checks/transp_checks.hpp"
+#include "cla3p/checks/hermitian_coeff_checks.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace csr {
+/*-------------------------------------------------*/
+#define XxMatrixTmpl XxMatrix<T_Int,T_Scalar,T_Matrix>
+#define XxMatrixTlst template <typename T_Int, typename T_Scalar, typename T_Matrix>
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix()
+{
+	defaults();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix(uint_t nr, uint_t nc, uint_t nz, const Property& pr)
+{
+	defaults();
+
+	T_Int    *rptr = static_cast<T_Int   *>(i_malloc(nr + 1, sizeof(T_Int   )));
+	T_Int    *cidx = static_cast<T_Int   *>(i_malloc(nz    , sizeof(T_Int   )));
+	T_Scalar *vals = static_cast<T_Scalar*>(i_malloc(nz    , sizeof(T_Scalar)));
+
+	rptr[nr] = nz;
+
+	wrapper(nr, nc, rptr, cidx, vals, true, pr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::XxMatrix(XxMatrixTmpl&& other)
+{
+	defaults();
+	other.moveTo(*this);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl::~XxMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+XxMatrixTmpl& XxMatrixTmpl::operator=(XxMatrixTmpl&& other)
+{
+	other.moveTo(*this);
+	return (*this);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::defaults()
+{
+	setRowptr(nullptr);
+	setColidx(nullptr);
+	setValues(nullptr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::clear()
+{
+	if(owner()) {
+		i_free(rowptr());
+		i_free(colidx());
+		i_free(values());
+	} // owner
+
+	MatrixMeta::clear();
+	Ownership::clear();
+
+	defaults();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setRowptr(T_Int* rowptr)
+{
+	m_rowptr = rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setColidx(T_Int* colidx)
+{
+	m_colidx = colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::setValues(T_Scalar* values)
+{
+	m_values = values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+uint_t XxMatrixTmpl::nnz() const
+{
+	if(!empty()) {
+		return rowptr()[nrows()];
+	}
+	return 0;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Int* XxMatrixTmpl::rowptr() const
+{
+	return m_rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Int* XxMatrixTmpl::rowptr()
+{
+	return m_rowptr;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Int* XxMatrixTmpl::colidx() const
+{
+	return m_colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Int* XxMatrixTmpl::colidx()
+{
+	return m_colidx;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+const T_Scalar* XxMatrixTmpl::values() const
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Scalar* XxMatrixTmpl::values()
+{
+	return m_values;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+std::string XxMatrixTmpl::info(const std::string& msg) const
+{ 
+	std::string top;
+	std::string bottom;
+	fill_info_margins(msg, top, bottom);
+
+	std::ostringstream ss;
+
+	ss << top << "\n";
+
+	ss << "  Object Type.......... " << TypeTraits<T_Matrix>::type_name() << "\n";
+	ss << "  Datatype............. " << TypeTraits<T_Scalar>::type_name() << "\n";
+	ss << "  Precision............ " << TypeTraits<T_Scalar>::prec_name() << "\n";
+	ss << "  Number of rows....... " << nrows() << "\n";
+	ss << "  Number of columns.... " << ncols() << "\n";
+	ss << "  Number of non zeros.. " << nnz() << "\n";
+	ss << "  Rowptr............... " << rowptr() << "\n";
+	ss << "  Colidx............... " << colidx() << "\n";
+	ss << "  Values............... " << values() << "\n";
+	ss << "  Property............. " << prop() << "\n";
+	ss << "  Owner................ " << bool2yn(this->owner()) << "\n";
+
+	ss << bottom << "\n";
+
+	return ss.str();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::copyTo(XxMatrixTmpl& trg) const
+{
+	trg = init(nrows(), ncols(), nnz(), prop());
+
+	uint_t nr = nrows() + 1;
+	uint_t nz = nnz();
+
+	bulk::dns::copy(uplo_t::Full, nr, 1, rowptr(), nr, trg.rowptr(), nr);
+	bulk::dns::copy(uplo_t::Full, nz, 1, colidx(), nz, trg.colidx(), nz);
+	bulk::dns::copy(uplo_t::Full, nz, 1, values(), nz, trg.values(), nz);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::shallowCopyTo(XxMatrixTmpl& trg)
+{
+	trg.wrapper(nrows(), ncols(), rowptr(), colidx(), values(), false, prop());
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::moveTo(XxMatrixTmpl& trg)
+{
+	trg.wrapper(nrows(), ncols(), rowptr(), colidx(), values(), owner(), prop());
+	unbind();
+	clear();
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+std::string XxMatrixTmpl::toString(uint_t nsd) const
+{
+	return bulk::csr::print_to_string(nrows(), rowptr(), colidx(), values(), nsd);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::copy() const
+{
+	T_Matrix ret;
+	copyTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::rcopy()
+{
+	T_Matrix ret;
+	shallowCopyTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<T_Matrix> XxMatrixTmpl::rcopy() const
+{
+	T_Matrix tmp = const_cast<XxMatrixTmpl&>(*this).rcopy();
+	Guard<T_Matrix> ret(tmp);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::move()
+{
+	T_Matrix ret;
+	moveTo(ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::iscale(T_Scalar val)
+{
+	hermitian_coeff_check(prop(), val);
+	bulk::dns::scale(uplo_t::Full, nnz(), 1, values(), nnz(), val);
+}
+/*-------------------------------------------------*/
+//
+// The csr arrays of A are the csc arrays of A^T, 
+// so csc transposition of A^T (ncols x nrows) yields the csr arrays of A^T
+//
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::transpose() const
+{
+	transp_op_consistency_check(prop().type(), false);
+
+	T_Matrix ret(ncols(), nrows(), nnz(), prop());
+
+	bulk::csc::transpose(
+			ncols(), nrows(), 
+			rowptr(), 
+			colidx(), 
+			values(), 
+			ret.rowptr(), 
+			ret.colidx(), 
+			ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::ctranspose() const
+{
+	transp_op_consistency_check(prop().type(), true);
+
+	T_Matrix ret(ncols(), nrows(), nnz(), prop());
+
+	bulk::csc::conjugate_transpose(
+			ncols(), nrows(), 
+			rowptr(), 
+			colidx(), 
+			values(), 
+			ret.rowptr(), 
+			ret.colidx(), 
+			ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::iconjugate()
+{
+	bulk::dns::conjugate(uplo_t::Full, nnz(), 1, values(), nnz());
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::conjugate() const
+{
+	T_Matrix ret = copy();
+	ret.iconjugate();
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_DnsMatrix XxMatrixTmpl::toDns() const
+{
+	T_DnsMatrix ret(nrows(), ncols(), prop());
+	ret = 0;
+	for(uint_t i = 0; i < nrows(); i++) {
+		for(T_Int jcol = rowptr()[i]; jcol < rowptr()[i+1]; jcol++) {
+			ret(i,colidx()[jcol]) = values()[jcol];
+		} // jcol
+	} // i
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_CscMatrix XxMatrixTmpl::toCsc() const
+{
+	T_CscMatrix ret(nrows(), ncols(), nnz(), prop());
+
+	bulk::csc::transpose(
+			ncols(), nrows(), 
+			rowptr(), 
+			colidx(), 
+			values(), 
+			ret.colptr(), 
+			ret.rowidx(), 
+			ret.values());
+
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+typename XxMatrixTmpl::T_CscMatrix XxMatrixTmpl::rtranspose()
+{
+	if(empty()) return T_CscMatrix();
+
+	Property pr = prop();
+	pr.switchUplo();
+
+	return T_CscMatrix::wrap(ncols(), nrows(), rowptr(), colidx(), values(), false, pr);
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<typename XxMatrixTmpl::T_CscMatrix> XxMatrixTmpl::rtranspose() const
+{
+	T_CscMatrix tmp = const_cast<XxMatrixTmpl&>(*this).rtranspose();
+	Guard<T_CscMatrix> ret(tmp);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+void XxMatrixTmpl::wrapper(uint_t nr, uint_t nc, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr)
+{
+	clear();
+
+	Property pr2 = sanitizeProperty<T_Scalar>(pr);
+
+	csc_consistency_check(pr2, nr, nc, rptr[nr], rptr, cidx, vals);
+
+	MatrixMeta::wrapper(nr, nc, pr2);
+
+	setRowptr(rptr);
+	setColidx(cidx);
+	setValues(vals);
+
+	setOwner(bind);
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::init(uint_t nr, uint_t nc, uint_t nz, const Property& pr)
+{
+	T_Matrix ret(nr, nc, nz, pr);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+T_Matrix XxMatrixTmpl::wrap(uint_t nr, uint_t nc, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr)
+{
+	T_Matrix ret;
+	ret.wrapper(nr, nc, rptr, cidx, vals, bind, pr);
+	return ret;
+}
+/*-------------------------------------------------*/
+XxMatrixTlst
+Guard<T_Matrix> XxMatrixTmpl::wrap(uint_t nr, uint_t nc, const T_Int *rptr, const T_Int *cidx, const T_Scalar *vals, const Property& pr)
+{
+	Guard<T_Matrix> ret(wrap(nr, nc, 
+				const_cast<T_Int   *>(rptr),
+				const_cast<T_Int   *>(cidx),
+				const_cast<T_Scalar*>(vals), false, pr));
+	return ret;
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+#undef XxMatrixTmpl
+#undef XxMatrixTlst
+/*-------------------------------------------------*/
+template class XxMatrix<int_t,real_t,RdMatrix>;
+template class XxMatrix<int_t,real4_t,RfMatrix>;
+template class XxMatrix<int_t,complex_t,CdMatrix>;
+template class XxMatrix<int_t,complex8_t,CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace csr
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,368 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_CSR_XXMATRIX_HPP_
+#define CLA3P_CSR_XXMATRIX_HPP_
+
+#include <ostream>
+#include <string>
+
+#include "cla3p/types.hpp"
+#include "cla3p/generic/ownership.hpp"
+#include "cla3p/generic/matrix_meta.hpp"
+#include "cla3p/generic/guard.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+namespace csr {
+/*-------------------------------------------------*/
+
+/**
+ * @nosubgrouping 
+ * @brief The sparse matrix class (compressed sparse row format).
+ *
+ * The row pointer, column index & values arrays of a csr matrix are identical to the
+ * column pointer, row index & values arrays of its transpose in csc format.
+ * The two formats can be reinterpreted as one another without copying, see rtranspose().
+ */
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+class XxMatrix : public Ownership, public MatrixMeta {
+
+	private:
+		using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+		using T_CscMatrix = typename TypeTraits<T_Matrix>::csc_type;
+
+	public:
+		using index_type = T_Int;
+		using value_type = T_Scalar;
+
+	public:
+
+		// no copy
+		XxMatrix(const XxMatrix<T_Int,T_Scalar,T_Matrix>&) = delete;
+		XxMatrix<T_Int,T_Scalar,T_Matrix>& operator=(const XxMatrix<T_Int,T_Scalar,T_Matrix>&) = delete;
+
+		virtual const T_Matrix& self() const = 0;
+
+		/** 
+		 * @name Constructors
+		 * @{
+		 */
+
+		/**
+		 * @brief The default constructor.
+		 *
+		 * Constructs an empty matrix.
+		 */
+		explicit XxMatrix();
+
+		/**
+		 * @brief The dimensional constructor.
+		 *
+		 * Constructs a (nr x nc) matrix with nz non-zero uninitialized values.
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] nz The number of matrix non zeros.
+		 * @param[in] pr The matrix property.
+		 */
+		explicit XxMatrix(uint_t nr, uint_t nc, uint_t nz, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief The move constructor.
+		 *
+		 * Constructs a matrix with the contents of `other`, `other` is destroyed.
+		 */
+		XxMatrix(XxMatrix<T_Int,T_Scalar,T_Matrix>&& other);
+
+		/**
+		 * @brief Destroys the matrix.
+		 */
+		~XxMatrix();
+
+		/** @} */
+
+		/** 
+		 * @name Operators
+		 * @{
+		 */
+
+		/**
+		 * @brief The move assignment operator.
+		 *
+		 * Replaces the contents of `(*this)` with those of `other`, `other` is destroyed.
+		 */
+		XxMatrix<T_Int,T_Scalar,T_Matrix>& operator=(XxMatrix<T_Int,T_Scalar,T_Matrix>&& other);
+
+		/** @} */
+
+		/** 
+		 * @name Arguments
+		 * @{
+		 */
+
+		/**
+		 * @brief The number of matrix non-zero elements.
+		 * @return The number of non-zero elements in `(*this)`.
+		 */
+		uint_t nnz() const;
+
+		/**
+		 * @brief The matrix row pointer array.
+		 * @return The array containing the number of non-zero elements in each row of `(*this)`.
+		 */
+		T_Int* rowptr();
+
+		/**
+		 * @copydoc rowptr()
+		 */
+		const T_Int* rowptr() const;
+
+		/**
+		 * @brief The matrix column index array.
+		 * @return The array containing the non-zero element column index in each row of `(*this)`.
+		 */
+		T_Int* colidx();
+
+		/**
+		 * @copydoc colidx()
+		 */
+		const T_Int* colidx() const;
+
+		/**
+		 * @brief The matrix values array.
+		 * @return The array containing the non-zero element values in each row of `(*this)`.
+		 */
+		T_Scalar* values();
+
+		/**
+		 * @copydoc values()
+		 */
+		const T_Scalar* values() const;
+
+		/** @} */
+
+		/** 
+		 * @name Public Member Functions
+		 * @{
+		 */
+
+		/**
+		 * @brief Clears the object.
+		 *
+		 * Deallocates owned data and resets all members.
+		 */
+		void clear();
+
+		/**
+		 * @brief Prints matrix information.
+		 * @param[in] msg Set a header identifier.
+		 */
+		std::string info(const std::string& msg = "") const;
+
+		/**
+		 * @brief Copies a matrix.
+		 * @return A deep copy of `(*this)`.
+		 *
+		 * @see rcopy() const, rcopy(), move()
+		 */
+		T_Matrix copy() const;
+
+		/**
+		 * @brief Shallow-copies a matrix.
+		 * @return A shallow copy of `(*this)`, `(*this)` is unchanged.
+		 *
+		 * @see copy(), rcopy() const, move()
+		 */
+		T_Matrix rcopy();
+
+		/**
+		 * @brief Shallow-copies an immutable matrix.
+		 * @return A guard shallow copy of `(*this)`.
+		 *
+		 * @see copy(), rcopy(), move()
+		 */
+		Guard<T_Matrix> rcopy() const;
+
+		/**
+		 * @brief Moves a matrix.
+		 * @return A shallow copy of `(*this)`, `(*this)` is destroyed.
+		 *
+		 * @see copy(), rcopy() const, rcopy()
+		 */
+		T_Matrix move();
+
+		/**
+		 * @brief Prints the contents of the object to a string.
+		 * @param[in] nsd The number of significant digits.
+		 * @return The string containing the formatted numerical values of the matrix.
+		 */
+		std::string toString(uint_t nsd = 3) const;
+
+		/**
+		 * @brief Multiplies the sparse matrix by a scalar.
+		 * @param[in] val The scaling coefficient.
+		 */
+		void iscale(T_Scalar val);
+
+		/**
+		 * @brief Transposes a matrix.
+		 */
+		T_Matrix transpose() const;
+
+		/**
+		 * @brief Conjugate-transposes a matrix.
+		 */
+		T_Matrix ctranspose() const;
+
+		/**
+		 * @brief Conjugates a matrix in-place.
+		 */
+		void iconjugate();
+
+		/**
+		 * @brief Conjugates a matrix.
+		 */
+		T_Matrix conjugate() const;
+
+		/**
+		 * @brief Converts a matrix to dense.
+		 * @return A copy of `(*this)` as a dense matrix.
+		 */
+		T_DnsMatrix toDns() const;
+
+		/**
+		 * @brief Converts a matrix to csc format.
+		 *
+		 * The conversion is multithreaded for large matrices.
+		 *
+		 * @return A copy of `(*this)` in csc format.
+		 *
+		 * @see rtranspose()
+		 */
+		T_CscMatrix toCsc() const;
+
+		/**
+		 * @brief Reinterprets a matrix as the csc matrix of its transpose.
+		 *
+		 * No data is copied, the result shares the arrays of `(*this)`.
+		 * If `(*this)` is symmetric, hermitian or triangular, the uplo of the result is switched.
+		 *
+		 * @return A shallow csc copy of `(*this)^T`, `(*this)` is unchanged.
+		 *
+		 * @see toCsc(), rtranspose() const
+		 */
+		T_CscMatrix rtranspose();
+
+		/**
+		 * @brief Reinterprets an immutable matrix as the csc matrix of its transpose.
+		 *
+		 * No data is copied, the result shares the arrays of `(*this)`.
+		 * If `(*this)` is symmetric, hermitian or triangular, the uplo of the result is switched.
+		 *
+		 * @return A guard shallow csc copy of `(*this)^T`.
+		 *
+		 * @see toCsc(), rtranspose()
+		 */
+		Guard<T_CscMatrix> rtranspose() const;
+
+		/** @} */
+
+		/** 
+		 * @name Creators/Generators
+		 * @{
+		 */
+
+		/**
+		 * @brief Creates a matrix.
+		 *
+		 * Creates a (nr x nc) matrix with uninitialized values.
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] nz The number of matrix non zeros.
+		 * @param[in] pr The matrix property.
+		 * @return The newly created matrix.
+		 */
+		static T_Matrix init(uint_t nr, uint_t nc, uint_t nz, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief Creates a matrix from aux data.
+		 *
+		 * Creates a (nr x nc) matrix from bulk data.
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] rptr The array containing the matrix row pointers.
+		 * @param[in] cidx The array containing the matrix column indexes.
+		 * @param[in] vals The array containing the matrix values.
+		 * @param[in] bind Binds the data to the matrix, the matrix will deallocate all arrays on destroy using i_free().
+		 * @param[in] pr The matrix property.
+		 * @return The newly created matrix.
+		 */
+		static T_Matrix wrap(uint_t nr, uint_t nc, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr = defaultProperty());
+
+		/**
+		 * @brief Creates a matrix guard from aux data.
+		 *
+		 * Creates a (nr x nc) matrix from bulk data.
+		 *
+		 * @param[in] nr The number of matrix rows.
+		 * @param[in] nc The number of matrix columns.
+		 * @param[in] rptr The array containing the matrix row pointers.
+		 * @param[in] cidx The array containing the matrix column indexes.
+		 * @param[in] vals The array containing the matrix values.
+		 * @param[in] pr The matrix property.
+		 * @return The newly created guard.
+		 */
+		static Guard<T_Matrix> wrap(uint_t nr, uint_t nc, const T_Int *rptr, const T_Int *cidx, const T_Scalar *vals, const Property& pr = defaultProperty());
+
+		/** @} */
+
+	private:
+		T_Int*    m_rowptr;
+		T_Int*    m_colidx;
+		T_Scalar* m_values;
+
+		void defaults();
+
+		void setRowptr(T_Int*);
+		void setColidx(T_Int*);
+		void setValues(T_Scalar*);
+
+		void copyTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&) const;
+		void shallowCopyTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&);
+		void moveTo(XxMatrix<T_Int,T_Scalar,T_Matrix>&);
+		void wrapper(uint_t nr, uint_t nc, T_Int *rptr, T_Int *cidx, T_Scalar *vals, bool bind, const Property& pr);
+};
+
+/*-------------------------------------------------*/
+} // namespace csr
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_stream_operators
+ * @brief Writes to os the contents of mat.
+ */
+template <typename T_Int, typename T_Scalar, typename T_Matrix>
+std::ostream& operator<<(std::ostream& os, const cla3p::csr::XxMatrix<T_Int,T_Scalar,T_Matrix>& mat)
+{
+	os << mat.toString();
+	return os;
+}
+
+#endif // CLA3P_CSR_XXMATRIX_HPP_
@@ -18,5 +18,7 @@
 #define CLA3P_SUPPORT_HPP_
 
 #include "cla3p/support/imalloc.hpp"
+#include "cla3p/support/mempool.hpp"
+#include "cla3p/support/settings.hpp"
 
 #endif // CLA3P_SUPPORT_HPP_
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/support/file_io.hpp"
+
+// system
+#include <cerrno>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// 3rd
+
+// cla3p
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+int file_seek(std::FILE *fp, uint64_t offset, int whence)
+{
+#if defined(_WIN32)
+	return _fseeki64(fp, static_cast<__int64>(offset), whence);
+#else
+	return fseeko(fp, static_cast<off_t>(offset), whence);
+#endif
+}
+/*-------------------------------------------------*/
+uint64_t file_tell(std::FILE *fp)
+{
+#if defined(_WIN32)
+	return static_cast<uint64_t>(_ftelli64(fp));
+#else
+	return static_cast<uint64_t>(ftello(fp));
+#endif
+}
+/*-------------------------------------------------*/
+void *file_map(const std::string& filename, bulk_t& size)
+{
+	size = 0;
+
+#if defined(_WIN32)
+	HANDLE fh = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if(fh == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER fsize;
+	bulk_t len = (GetFileSizeEx(fh, &fsize) ? static_cast<bulk_t>(fsize.QuadPart) : 0);
+
+	HANDLE mh = (len ? CreateFileMappingA(fh, nullptr, PAGE_WRITECOPY, 0, 0, nullptr) : nullptr);
+	void *addr = (mh ? MapViewOfFile(mh, FILE_MAP_COPY, 0, 0, 0) : nullptr);
+
+	//
+	// The view keeps the mapping alive
+	//
+	if(mh) CloseHandle(mh);
+	CloseHandle(fh);
+#else
+	int fd = ::open(filename.c_str(), O_RDONLY);
+
+	if(fd < 0)
+		return nullptr;
+
+	struct stat st;
+	bulk_t len = (::fstat(fd, &st) ? 0 : static_cast<bulk_t>(st.st_size));
+
+	void *addr = (len ? ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED);
+
+	::close(fd);
+
+	if(addr == MAP_FAILED)
+		addr = nullptr;
+#endif
+
+	if(addr)
+		size = len;
+
+	return addr;
+}
+/*-------------------------------------------------*/
+void file_unmap(void *addr, bulk_t size)
+{
+	if(!addr)
+		return;
+
+#if defined(_WIN32)
+	(void)size;
+	UnmapViewOfFile(addr);
+#else
+	::munmap(addr, size);
+#endif
+}
+/*-------------------------------------------------*/
+file_handle_t file_open_rw(const std::string& filename, bool scratch)
+{
+#if defined(_WIN32)
+	if(!scratch) {
+		HANDLE fh = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		return reinterpret_cast<file_handle_t>(fh);
+	} // regular
+
+	//
+	// CREATE_NEW fails on existing files, so probe for a free name
+	//
+	std::string prefix = filename + "." + std::to_string(GetCurrentProcessId()) + ".";
+
+	for(unsigned k = 0; k < 1024; k++) {
+		std::string name = prefix + std::to_string(k);
+		HANDLE fh = CreateFileA(name.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+		if(fh != INVALID_HANDLE_VALUE || GetLastError() != ERROR_FILE_EXISTS)
+			return reinterpret_cast<file_handle_t>(fh);
+	} // k
+
+	return -1;
+#else
+	if(!scratch) {
+		return ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	} // regular
+
+	//
+	// The scratch file is unlinked right away, 
+	// the data are released by the system once the descriptor is closed
+	//
+	std::string tmpl = filename + ".XXXXXX";
+	std::vector<char> name(tmpl.begin(), tmpl.end());
+	name.push_back('\0');
+
+	int fd = ::mkstemp(name.data());
+
+	if(fd >= 0)
+		::unlink(name.data());
+
+	return fd;
+#endif
+}
+/*-------------------------------------------------*/
+void file_close(file_handle_t fh)
+{
+	if(fh == -1)
+		return;
+
+#if defined(_WIN32)
+	CloseHandle(reinterpret_cast<HANDLE>(fh));
+#else
+	::close(static_cast<int>(fh));
+#endif
+}
+/*-------------------------------------------------*/
+bool file_resize(file_handle_t fh, uint64_t size)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER pos;
+	pos.QuadPart = static_cast<long long>(size);
+	HANDLE h = reinterpret_cast<HANDLE>(fh);
+	return (SetFilePointerEx(h, pos, nullptr, FILE_BEGIN) && SetEndOfFile(h));
+#else
+	return (::ftruncate(static_cast<int>(fh), static_cast<off_t>(size)) == 0);
+#endif
+}
+/*-------------------------------------------------*/
+//
+// Windows transfers are issued in chunks that fit a DWORD
+//
+#if defined(_WIN32)
+static DWORD file_chunk(bulk_t nbytes)
+{
+	return static_cast<DWORD>(std::min(nbytes, static_cast<bulk_t>(1) << 30));
+}
+static OVERLAPPED file_overlapped(uint64_t offset)
+{
+	OVERLAPPED ov = {};
+	ov.Offset = static_cast<DWORD>(offset);
+	ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+	return ov;
+}
+#endif
+/*-------------------------------------------------*/
+bool file_read_at(file_handle_t fh, void *buf, bulk_t nbytes, uint64_t offset)
+{
+	char *p = static_cast<char*>(buf);
+
+	while(nbytes) {
+#if defined(_WIN32)
+		OVERLAPPED ov = file_overlapped(offset);
+		DWORD len = 0;
+		if(!ReadFile(reinterpret_cast<HANDLE>(fh), p, file_chunk(nbytes), &len, &ov) || !len)
+			return false;
+#else
+		ssize_t len = ::pread(static_cast<int>(fh), p, nbytes, static_cast<off_t>(offset));
+		if(len < 0 && errno == EINTR) continue;
+		if(len <= 0)
+			return false;
+#endif
+		p += len;
+		nbytes -= static_cast<bulk_t>(len);
+		offset += static_cast<uint64_t>(len);
+	} // nbytes
+
+	return true;
+}
+/*-------------------------------------------------*/
+bool file_write_at(file_handle_t fh, const void *buf, bulk_t nbytes, uint64_t offset)
+{
+	const char *p = static_cast<const char*>(buf);
+
+	while(nbytes) {
+#if defined(_WIN32)
+		OVERLAPPED ov = file_overlapped(offset);
+		DWORD len = 0;
+		if(!WriteFile(reinterpret_cast<HANDLE>(fh), p, file_chunk(nbytes), &len, &ov) || !len)
+			return false;
+#else
+		ssize_t len = ::pwrite(static_cast<int>(fh), p, nbytes, static_cast<off_t>(offset));
+		if(len < 0 && errno == EINTR) continue;
+		if(len <= 0)
+			return false;
+#endif
+		p += len;
+		nbytes -= static_cast<bulk_t>(len);
+		offset += static_cast<uint64_t>(len);
+	} // nbytes
+
+	return true;
+}
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
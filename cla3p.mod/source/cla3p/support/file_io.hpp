@@ -0,0 +1,65 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_FILE_IO_HPP_
+#define CLA3P_FILE_IO_HPP_
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+
+//
+// Stream positioning with 64-bit offsets (std::fseek/std::ftell use long, 32-bit on Windows)
+//
+int file_seek(std::FILE *fp, uint64_t offset, int whence);
+uint64_t file_tell(std::FILE *fp);
+
+//
+// Private (copy-on-write) mapping of a whole file, returns nullptr on failure or for empty files
+//
+void *file_map(const std::string& filename, bulk_t& size);
+void file_unmap(void *addr, bulk_t size);
+
+//
+// Read/write file handle for positional transfers (a descriptor or a Windows HANDLE), -1 when invalid
+//
+typedef std::intptr_t file_handle_t;
+
+//
+// Opens filename for reading & writing, an existing file is truncated
+// A scratch file is created next to filename under a unique name & is removed once closed, filename is left untouched
+//
+file_handle_t file_open_rw(const std::string& filename, bool scratch);
+void file_close(file_handle_t fh);
+bool file_resize(file_handle_t fh, uint64_t size);
+
+//
+// Positional transfers of exactly nbytes, safe to issue concurrently on the same handle
+//
+bool file_read_at(file_handle_t fh, void *buf, bulk_t nbytes, uint64_t offset);
+bool file_write_at(file_handle_t fh, const void *buf, bulk_t nbytes, uint64_t offset);
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_FILE_IO_HPP_
@@ -18,6 +18,9 @@
 #include "cla3p/support/imalloc.hpp"
 
 // system
+#include <cstring>
+#include <limits>
+#include <algorithm>
 
 // 3rd
 #include <mkl_service.h>
@@ -25,12 +28,29 @@
 // cla3p
 #include "cla3p/error/exceptions.hpp"
 #include "cla3p/support/utils.hpp"
+#include "cla3p/support/mempool_internal.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
 /*-------------------------------------------------*/
 #define MKL_ALLOC_ALIGNMENT 64
 /*-------------------------------------------------*/
+static_assert(MKL_ALLOC_ALIGNMENT == mem::alignment, "Block alignment mismatch");
+/*-------------------------------------------------*/
+namespace mem {
+/*-------------------------------------------------*/
+void* system_malloc(bulk_t nbytes)
+{
+	return mkl_malloc(nbytes, MKL_ALLOC_ALIGNMENT);
+}
+/*-------------------------------------------------*/
+void system_free(void *ptr)
+{
+	mkl_free(ptr);
+}
+/*-------------------------------------------------*/
+} // namespace mem
+/*-------------------------------------------------*/
 static void check_allocation(const void *ptr, bulk_t nmemb, bulk_t size)
 {
 	if(!ptr) {
@@ -39,9 +59,18 @@ static void check_allocation(const void *ptr, bulk_t nmemb, bulk_t size)
 	} // ptr
 }
 /*-------------------------------------------------*/
+static bulk_t checked_bytes(bulk_t nmemb, bulk_t size)
+{
+	if(size && nmemb > std::numeric_limits<bulk_t>::max() / size) {
+		throw err::OutOfMemory("Allocation of " + std::to_string(nmemb) + " x " + std::to_string(size) + " bytes overflows");
+	} // overflow
+
+	return nmemb * size;
+}
+/*-------------------------------------------------*/
 void* i_malloc(bulk_t nmemb, bulk_t size)
 {
-	return i_malloc(nmemb * size);
+	return i_malloc(checked_bytes(nmemb, size));
 }
 /*-------------------------------------------------*/
 void* i_malloc(bulk_t size)
@@ -50,7 +79,7 @@ void* i_malloc(bulk_t size)
 
 	if(!size) return ret;
 
-	ret = mkl_malloc(size, MKL_ALLOC_ALIGNMENT);
+	ret = mem::allocate(size);
 
 	check_allocation(ret, 1, size);
 
@@ -63,9 +92,13 @@ void* i_calloc(bulk_t nmemb, bulk_t size)
 
 	if(!nmemb || !size) return ret;
 
-	ret = mkl_calloc(nmemb, size, MKL_ALLOC_ALIGNMENT);
+	bulk_t nbytes = checked_bytes(nmemb, size);
+
+	ret = mem::allocate(nbytes);
+
+	check_allocation(ret, 1, nbytes);
 
-	check_allocation(ret, nmemb, size);
+	std::memset(ret, 0, nbytes);
 
 	return ret;
 }
@@ -79,23 +112,28 @@ void* i_realloc(void *ptr, bulk_t size)
 		return ret;
 	} // empty allocation
 
-	ret = mkl_realloc(ptr, size);
+	if(ptr && mem::resize_in_place(ptr, size)) return ptr;
+
+	ret = mem::allocate(size);
 
 	check_allocation(ret, 1, size);
 
+	if(ptr) {
+		std::memcpy(ret, ptr, std::min(size, mem::block_size(ptr)));
+		mem::deallocate(ptr);
+	} // copy & release
+
 	return ret;
 }
 /*-------------------------------------------------*/
 void* i_realloc(void *ptr, bulk_t nmemb, bulk_t size)
 {
-	return i_realloc(ptr, nmemb * size);
+	return i_realloc(ptr, checked_bytes(nmemb, size));
 }
 /*-------------------------------------------------*/
 void i_free(void *ptr)
 {
-	if(ptr) {
-		mkl_free(ptr);
-	} // ptr
+	mem::deallocate(ptr);
 }
 /*-------------------------------------------------*/
 #undef MKL_ALLOC_ALIGNMENT
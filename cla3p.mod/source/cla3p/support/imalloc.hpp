@@ -20,6 +20,9 @@
 /** 
  * @file
  * Basic allocation features. The behaviour of each function is similar to the ones found in the standard.
+ *
+ * All blocks are 64-byte aligned. The allocator behind the functions is selected via setAllocator(), 
+ * a ScopedArena overrides the selection for the thread that created it.
  */
 
 #include "cla3p/types.hpp"
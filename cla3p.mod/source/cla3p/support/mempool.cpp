@@ -0,0 +1,472 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/support/mempool.hpp"
+
+// system
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+#include "cla3p/support/settings.hpp"
+#include "cla3p/support/mempool_internal.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+namespace mem {
+/*-------------------------------------------------*/
+enum class origin_t : uint32_t {
+	System = 0,
+	Pool      ,
+	Arena
+};
+/*-------------------------------------------------*/
+struct BlockHeader {
+	bulk_t size;
+	origin_t origin;
+	uint32_t sclass;
+};
+/*-------------------------------------------------*/
+static_assert(sizeof(BlockHeader) <= alignment, "Block header exceeds the alignment");
+/*-------------------------------------------------*/
+//
+// Pool size classes are powers of two (header included) from 128 bytes to 16 MB
+// Larger requests bypass the pool
+//
+static const uint_t num_classes = 18;
+static const bulk_t min_class_bytes = 128;
+static const bulk_t max_class_bytes = min_class_bytes << (num_classes - 1);
+static const bulk_t thread_cache_bytes = 4194304;
+static const bulk_t depot_cache_bytes = 67108864;
+/*-------------------------------------------------*/
+static std::atomic<uint64_t> g_allocations(0);
+static std::atomic<uint64_t> g_deallocations(0);
+static std::atomic<uint64_t> g_system_allocations(0);
+static std::atomic<uint64_t> g_pool_hits(0);
+static std::atomic<uint64_t> g_arena_allocations(0);
+static std::atomic<bulk_t> g_bytes_in_use(0);
+static std::atomic<bulk_t> g_peak_bytes_in_use(0);
+static std::atomic<bulk_t> g_bytes_cached(0);
+/*-------------------------------------------------*/
+static inline bulk_t class_bytes(uint_t k)
+{
+	return (min_class_bytes << k);
+}
+/*-------------------------------------------------*/
+static inline uint_t size_class(bulk_t nbytes)
+{
+	uint_t k = 0;
+	while(class_bytes(k) < nbytes) k++;
+	return k;
+}
+/*-------------------------------------------------*/
+static inline uint_t class_capacity(uint_t k, bulk_t nbytes)
+{
+	return static_cast<uint_t>(std::max(nbytes / class_bytes(k), bulk_t(2)));
+}
+/*-------------------------------------------------*/
+static inline BlockHeader* header_of(const void *ptr)
+{
+	return reinterpret_cast<BlockHeader*>(const_cast<char*>(static_cast<const char*>(ptr)) - alignment);
+}
+/*-------------------------------------------------*/
+static void track_alloc(bulk_t nbytes)
+{
+	bulk_t cur = g_bytes_in_use.fetch_add(nbytes, std::memory_order_relaxed) + nbytes;
+	bulk_t peak = g_peak_bytes_in_use.load(std::memory_order_relaxed);
+	while(cur > peak && !g_peak_bytes_in_use.compare_exchange_weak(peak, cur, std::memory_order_relaxed));
+}
+/*-------------------------------------------------*/
+static void track_free(bulk_t nbytes)
+{
+	g_bytes_in_use.fetch_sub(nbytes, std::memory_order_relaxed);
+}
+/*-------------------------------------------------*/
+static void* counted_system_malloc(bulk_t nbytes)
+{
+	g_system_allocations.fetch_add(1, std::memory_order_relaxed);
+	return system_malloc(nbytes);
+}
+/*-------------------------------------------------*/
+//
+// Shared depot of free pool blocks, never destroyed so that 
+// thread caches can flush into it during program termination
+//
+struct Depot {
+	std::mutex mtx;
+	std::vector<void*> lists[num_classes];
+};
+/*-------------------------------------------------*/
+static Depot& depot()
+{
+	static Depot *ret = new Depot;
+	return *ret;
+}
+/*-------------------------------------------------*/
+static void depot_push(uint_t k, void **blocks, uint_t nblocks)
+{
+	Depot& dep = depot();
+	uint_t cap = class_capacity(k, depot_cache_bytes);
+	uint_t nfree = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(dep.mtx);
+		std::vector<void*>& lst = dep.lists[k];
+		uint_t nkeep = std::min(nblocks, cap - std::min(cap, static_cast<uint_t>(lst.size())));
+		lst.insert(lst.end(), blocks, blocks + nkeep);
+		nfree = nblocks - nkeep;
+	}
+
+	for(uint_t i = nblocks - nfree; i < nblocks; i++) {
+		system_free(blocks[i]);
+	} // i
+
+	g_bytes_cached.fetch_sub(nfree * class_bytes(k), std::memory_order_relaxed);
+}
+/*-------------------------------------------------*/
+static uint_t depot_pop(uint_t k, std::vector<void*>& blocks, uint_t nblocks)
+{
+	Depot& dep = depot();
+	std::lock_guard<std::mutex> lock(dep.mtx);
+	std::vector<void*>& lst = dep.lists[k];
+
+	uint_t ntake = std::min(nblocks, static_cast<uint_t>(lst.size()));
+	blocks.insert(blocks.end(), lst.end() - ntake, lst.end());
+	lst.resize(lst.size() - ntake);
+
+	return ntake;
+}
+/*-------------------------------------------------*/
+//
+// Per-thread free lists, flushed into the depot at thread exit
+// A block freed by a thread other than the allocating one joins the free lists of the freeing thread
+//
+static thread_local int t_cache_state = 0;
+/*-------------------------------------------------*/
+struct ThreadCache {
+
+	std::vector<void*> lists[num_classes];
+
+	ThreadCache() 
+	{
+		t_cache_state = 1;
+	}
+
+	~ThreadCache() 
+	{
+		t_cache_state = 2;
+		for(uint_t k = 0; k < num_classes; k++) {
+			if(!lists[k].empty()) {
+				depot_push(k, lists[k].data(), lists[k].size());
+			} // non-empty
+		} // k
+	}
+};
+/*-------------------------------------------------*/
+static thread_local ThreadCache t_cache;
+static thread_local ScopedArena *t_arena = nullptr;
+/*-------------------------------------------------*/
+static void* pool_malloc(uint_t k)
+{
+	void *ret = nullptr;
+
+	if(t_cache_state == 2) {
+
+		std::vector<void*> tmp;
+		if(depot_pop(k, tmp, 1)) ret = tmp.back();
+
+	} else {
+
+		std::vector<void*>& lst = t_cache.lists[k];
+		if(lst.empty()) depot_pop(k, lst, class_capacity(k, thread_cache_bytes) / 2);
+		if(!lst.empty()) {
+			ret = lst.back();
+			lst.pop_back();
+		} // hit
+
+	} // cache state
+
+	if(ret) {
+		g_pool_hits.fetch_add(1, std::memory_order_relaxed);
+		g_bytes_cached.fetch_sub(class_bytes(k), std::memory_order_relaxed);
+	} else {
+		ret = counted_system_malloc(class_bytes(k));
+	} // miss
+
+	return ret;
+}
+/*-------------------------------------------------*/
+static void pool_free(uint_t k, void *block)
+{
+	g_bytes_cached.fetch_add(class_bytes(k), std::memory_order_relaxed);
+
+	if(t_cache_state == 2) {
+		depot_push(k, &block, 1);
+		return;
+	} // thread is exiting
+
+	std::vector<void*>& lst = t_cache.lists[k];
+	lst.push_back(block);
+
+	uint_t cap = class_capacity(k, thread_cache_bytes);
+	if(lst.size() > cap) {
+		uint_t nmove = static_cast<uint_t>(lst.size()) / 2;
+		depot_push(k, lst.data() + lst.size() - nmove, nmove);
+		lst.resize(lst.size() - nmove);
+	} // overflow
+}
+/*-------------------------------------------------*/
+void* allocate(bulk_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	bulk_t nbytes = size + alignment;
+	void *base = nullptr;
+	origin_t origin = origin_t::System;
+	uint_t k = 0;
+
+	if(t_arena) {
+
+		base = t_arena->allocate(nbytes);
+		origin = origin_t::Arena;
+		if(base) g_arena_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	} else if(allocator() == alloc_t::Pool && nbytes <= max_class_bytes) {
+
+		k = size_class(nbytes);
+		base = pool_malloc(k);
+		origin = origin_t::Pool;
+		if(base) track_alloc(class_bytes(k));
+
+	} else {
+
+		base = counted_system_malloc(nbytes);
+		if(base) track_alloc(nbytes);
+
+	} // origin
+
+	if(!base) return nullptr;
+
+	BlockHeader *header = static_cast<BlockHeader*>(base);
+	header->size = size;
+	header->origin = origin;
+	header->sclass = k;
+
+	return static_cast<char*>(base) + alignment;
+}
+/*-------------------------------------------------*/
+void deallocate(void *ptr)
+{
+	if(!ptr) return;
+
+	g_deallocations.fetch_add(1, std::memory_order_relaxed);
+
+	BlockHeader *header = header_of(ptr);
+
+	if(header->origin == origin_t::Pool) {
+
+		track_free(class_bytes(header->sclass));
+		pool_free(header->sclass, header);
+
+	} else if(header->origin == origin_t::System) {
+
+		track_free(header->size + alignment);
+		system_free(header);
+
+	} // arena blocks are released with the arena
+}
+/*-------------------------------------------------*/
+bulk_t block_size(const void *ptr)
+{
+	return (ptr ? header_of(ptr)->size : 0);
+}
+/*-------------------------------------------------*/
+bool resize_in_place(void *ptr, bulk_t size)
+{
+	BlockHeader *header = header_of(ptr);
+
+	bulk_t capacity = header->size;
+	if(header->origin == origin_t::Pool) capacity = class_bytes(header->sclass) - alignment;
+
+	if(size > capacity) return false;
+
+	if(header->origin == origin_t::System) {
+		if(size < capacity / 2) return false;
+		track_free(header->size - size);
+	} // keep system blocks tight
+
+	header->size = size;
+
+	return true;
+}
+/*-------------------------------------------------*/
+} // namespace mem
+/*-------------------------------------------------*/
+AllocStats allocStats()
+{
+	AllocStats ret;
+
+	ret.allocations       = mem::g_allocations.load();
+	ret.deallocations     = mem::g_deallocations.load();
+	ret.systemAllocations = mem::g_system_allocations.load();
+	ret.poolHits          = mem::g_pool_hits.load();
+	ret.arenaAllocations  = mem::g_arena_allocations.load();
+	ret.bytesInUse        = mem::g_bytes_in_use.load();
+	ret.peakBytesInUse    = mem::g_peak_bytes_in_use.load();
+	ret.bytesCached       = mem::g_bytes_cached.load();
+
+	return ret;
+}
+/*-------------------------------------------------*/
+void resetAllocStats()
+{
+	mem::g_allocations = 0;
+	mem::g_deallocations = 0;
+	mem::g_system_allocations = 0;
+	mem::g_pool_hits = 0;
+	mem::g_arena_allocations = 0;
+	mem::g_peak_bytes_in_use = mem::g_bytes_in_use.load();
+}
+/*-------------------------------------------------*/
+void releasePoolMemory()
+{
+	for(uint_t k = 0; k < mem::num_classes; k++) {
+
+		std::vector<void*> blocks;
+
+		if(mem::t_cache_state != 2) {
+			blocks.swap(mem::t_cache.lists[k]);
+		} // thread cache
+
+		{
+			std::lock_guard<std::mutex> lock(mem::depot().mtx);
+			std::vector<void*>& lst = mem::depot().lists[k];
+			blocks.insert(blocks.end(), lst.begin(), lst.end());
+			lst.clear();
+			lst.shrink_to_fit();
+		}
+
+		for(void *block : blocks) {
+			mem::system_free(block);
+		} // block
+
+		mem::g_bytes_cached.fetch_sub(blocks.size() * mem::class_bytes(k), std::memory_order_relaxed);
+
+	} // k
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+ScopedArena::ScopedArena(bulk_t chunkSize)
+	: 
+		m_chunkSize(0),
+		m_offset(0),
+		m_used(0),
+		m_reserved(0),
+		m_previous(mem::t_arena)
+{
+	m_chunkSize = std::max(chunkSize, bulk_t(4096));
+	m_chunkSize = (m_chunkSize + mem::alignment - 1) / mem::alignment * mem::alignment;
+	mem::t_arena = this;
+}
+/*-------------------------------------------------*/
+ScopedArena::~ScopedArena()
+{
+	if(mem::t_arena == this) {
+		mem::t_arena = m_previous;
+	} // active
+
+	release(0);
+}
+/*-------------------------------------------------*/
+bulk_t ScopedArena::bytesUsed() const
+{
+	return m_used;
+}
+/*-------------------------------------------------*/
+bulk_t ScopedArena::bytesReserved() const
+{
+	return m_reserved;
+}
+/*-------------------------------------------------*/
+void ScopedArena::reset()
+{
+	release(1);
+}
+/*-------------------------------------------------*/
+void ScopedArena::release(bulk_t keep)
+{
+	for(char *chunk : m_large) {
+		mem::system_free(chunk);
+	} // chunk
+
+	for(bulk_t i = keep; i < m_chunks.size(); i++) {
+		mem::system_free(m_chunks[i]);
+	} // i
+
+	m_large.clear();
+	m_chunks.resize(std::min(keep, m_chunks.size()));
+
+	m_offset = 0;
+	m_used = 0;
+	m_reserved = m_chunks.size() * m_chunkSize;
+}
+/*-------------------------------------------------*/
+//
+// Requests larger than a quarter chunk get a dedicated chunk to limit waste
+//
+void* ScopedArena::allocate(bulk_t nbytes)
+{
+	nbytes = (std::max(nbytes, bulk_t(1)) + mem::alignment - 1) / mem::alignment * mem::alignment;
+
+	if(nbytes > m_chunkSize / 4) {
+
+		char *chunk = static_cast<char*>(mem::counted_system_malloc(nbytes));
+		if(!chunk) return nullptr;
+
+		m_large.push_back(chunk);
+		m_reserved += nbytes;
+		m_used += nbytes;
+
+		return chunk;
+
+	} // large
+
+	if(m_chunks.empty() || m_offset + nbytes > m_chunkSize) {
+
+		char *chunk = static_cast<char*>(mem::counted_system_malloc(m_chunkSize));
+		if(!chunk) return nullptr;
+
+		m_chunks.push_back(chunk);
+		m_reserved += m_chunkSize;
+		m_offset = 0;
+
+	} // new chunk
+
+	char *ret = m_chunks.back() + m_offset;
+	m_offset += nbytes;
+	m_used += nbytes;
+
+	return ret;
+}
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
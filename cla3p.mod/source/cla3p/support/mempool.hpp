@@ -0,0 +1,162 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_MEMPOOL_HPP_
+#define CLA3P_MEMPOOL_HPP_
+
+/** 
+ * @file
+ * Pooled & arena allocation features behind i_malloc().
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_allocators
+ * @brief Allocation statistics.
+ *
+ * Counters are global (all threads) & cumulative since program start or the last resetAllocStats().
+ */
+struct AllocStats {
+	uint64_t allocations;       /**< Number of allocation requests */
+	uint64_t deallocations;     /**< Number of deallocation requests */
+	uint64_t systemAllocations; /**< Number of requests that reached the system allocator */
+	uint64_t poolHits;          /**< Number of requests served from the pool free lists */
+	uint64_t arenaAllocations;  /**< Number of requests served from a scoped arena */
+	bulk_t bytesInUse;          /**< Bytes currently allocated by the system & pool allocators */
+	bulk_t peakBytesInUse;      /**< Peak value of bytesInUse */
+	bulk_t bytesCached;         /**< Bytes held in the pool free lists */
+};
+
+/**
+ * @ingroup module_index_allocators
+ * @brief The allocation statistics.
+ * @return A snapshot of the allocation counters.
+ */
+AllocStats allocStats();
+
+/**
+ * @ingroup module_index_allocators
+ * @brief Resets the cumulative allocation counters.
+ *
+ * The peak is reset to the current bytes in use, bytesInUse & bytesCached are not affected.
+ */
+void resetAllocStats();
+
+/**
+ * @ingroup module_index_allocators
+ * @brief Returns cached pool memory to the system.
+ *
+ * Releases the free lists of the calling thread & the shared pool depot.
+ * Free lists of other threads are released when the threads exit.
+ */
+void releasePoolMemory();
+
+/**
+ * @ingroup module_index_allocators
+ * @nosubgrouping
+ * @brief A scoped arena allocator.
+ *
+ * While an arena is alive, every i_malloc() request of the creating thread is served from the arena 
+ * by advancing a pointer inside large preallocated chunks, regardless of the allocator setting.
+ * Freeing an arena block is a no-op, all chunks are returned to the system when the arena is destroyed.
+ * Arenas nest, the most recently created one is active.
+ *
+ * Intended for hot loops that create & destroy temporaries. 
+ * Objects allocated while the arena is active must be destroyed before the arena.
+ *
+ * @code
+ * {
+ *   cla3p::ScopedArena arena;
+ *   for(...) {
+ *     cla3p::dns::RdVector Y = A * X; // temporaries allocated in the arena
+ *   }
+ * } // memory released here
+ * @endcode
+ */
+class ScopedArena {
+
+	public:
+
+		// no copy
+		ScopedArena(const ScopedArena&) = delete;
+		ScopedArena& operator=(const ScopedArena&) = delete;
+
+		/**
+		 * @brief Activates an arena for the calling thread.
+		 * @param[in] chunkSize The size of each preallocated chunk in bytes.
+		 */
+		explicit ScopedArena(bulk_t chunkSize = 16777216);
+
+		/**
+		 * @brief Deactivates the arena & releases its memory.
+		 */
+		~ScopedArena();
+
+		/**
+		 * @brief The arena usage.
+		 * @return The number of bytes handed out by the arena (including block headers).
+		 */
+		bulk_t bytesUsed() const;
+
+		/**
+		 * @brief The arena capacity.
+		 * @return The number of bytes reserved by the arena from the system.
+		 */
+		bulk_t bytesReserved() const;
+
+		/**
+		 * @brief Rewinds the arena.
+		 *
+		 * Makes the whole arena capacity available again, keeping the first chunk.
+		 * All objects allocated in the arena must be destroyed before calling reset().
+		 */
+		void reset();
+
+		/**
+		 * @brief Allocates raw storage from the arena.
+		 *
+		 * The returned block is aligned like the blocks returned by i_malloc() & must not be passed to i_free().
+		 *
+		 * @param[in] nbytes The requested size in bytes.
+		 * @return A pointer to the allocated space, a null pointer if the system is out of memory.
+		 */
+		void* allocate(bulk_t nbytes);
+
+	private:
+		bulk_t m_chunkSize;
+		bulk_t m_offset;
+		bulk_t m_used;
+		bulk_t m_reserved;
+		std::vector<char*> m_chunks;
+		std::vector<char*> m_large;
+		ScopedArena *m_previous;
+
+		void release(bulk_t keep);
+};
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_MEMPOOL_HPP_
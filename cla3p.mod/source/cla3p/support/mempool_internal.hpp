@@ -0,0 +1,55 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_MEMPOOL_INTERNAL_HPP_
+#define CLA3P_MEMPOOL_INTERNAL_HPP_
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace mem {
+/*-------------------------------------------------*/
+
+/*
+ * Alignment of all blocks, every block is preceded by a header of this size
+ */
+const bulk_t alignment = 64;
+
+/*
+ * Aligned system allocation (no header), returns null on failure
+ */
+void* system_malloc(bulk_t nbytes);
+void system_free(void *ptr);
+
+/*
+ * Allocation dispatch (arena/pool/system), returns null on failure
+ */
+void* allocate(bulk_t size);
+void deallocate(void *ptr);
+
+/*
+ * Requested size of a block & in-place resize if the block capacity suffices
+ */
+bulk_t block_size(const void *ptr);
+bool resize_in_place(void *ptr, bulk_t size);
+
+/*-------------------------------------------------*/
+} // namespace mem
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_MEMPOOL_INTERNAL_HPP_
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/support/random_engine.hpp"
+
+// system
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+
+// 3rd
+
+// cla3p
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace rng {
+/*-------------------------------------------------*/
+static std::atomic<uint64_t> g_seed(0);
+static std::atomic<uint64_t> g_stream(0);
+/*-------------------------------------------------*/
+void set_seed(uint64_t seed)
+{
+	g_seed = seed;
+	g_stream = 0;
+}
+/*-------------------------------------------------*/
+uint64_t seed()
+{
+	return g_seed;
+}
+/*-------------------------------------------------*/
+uint64_t next_stream()
+{
+	return g_stream.fetch_add(1);
+}
+/*-------------------------------------------------*/
+//
+// Counters are processed in batches (structure of arrays) so that the rounds vectorize
+//
+void philox4x32(uint64_t seed, uint64_t stream, uint64_t first, uint_t nblk, uint32_t *out)
+{
+	const uint32_t M0 = 0xD2511F53;
+	const uint32_t M1 = 0xCD9E8D57;
+	const uint32_t W0 = 0x9E3779B9;
+	const uint32_t W1 = 0xBB67AE85;
+
+	const uint_t nb = 16;
+
+	uint32_t c0[nb];
+	uint32_t c1[nb];
+	uint32_t c2[nb];
+	uint32_t c3[nb];
+
+	for(uint_t b0 = 0; b0 < nblk; b0 += nb) {
+
+		uint_t len = std::min(nb, nblk - b0);
+
+		for(uint_t i = 0; i < len; i++) {
+			uint64_t ctr = first + b0 + i;
+			c0[i] = static_cast<uint32_t>(ctr);
+			c1[i] = static_cast<uint32_t>(ctr >> 32);
+			c2[i] = static_cast<uint32_t>(stream);
+			c3[i] = static_cast<uint32_t>(stream >> 32);
+		} // i
+
+		uint32_t k0 = static_cast<uint32_t>(seed);
+		uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+
+		for(uint_t r = 0; r < 10; r++) {
+
+			for(uint_t i = 0; i < len; i++) {
+				uint64_t p0 = static_cast<uint64_t>(M0) * c0[i];
+				uint64_t p1 = static_cast<uint64_t>(M1) * c2[i];
+				uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1[i] ^ k0;
+				uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3[i] ^ k1;
+				c0[i] = n0;
+				c1[i] = static_cast<uint32_t>(p1);
+				c2[i] = n2;
+				c3[i] = static_cast<uint32_t>(p0);
+			} // i
+
+			k0 += W0;
+			k1 += W1;
+
+		} // r
+
+		for(uint_t i = 0; i < len; i++) {
+			out[4 * (b0 + i) + 0] = c0[i];
+			out[4 * (b0 + i) + 1] = c1[i];
+			out[4 * (b0 + i) + 2] = c2[i];
+			out[4 * (b0 + i) + 3] = c3[i];
+		} // i
+
+	} // b0
+}
+/*-------------------------------------------------*/
+//
+// Each counter block (128 bits) gives 2 double or 4 single precision uniforms in [0,1)
+// Each element consumes 1 (real) or 2 (complex) uniforms
+//
+template <typename T_Scalar> struct RandTraits {};
+template <> struct RandTraits<int_t     > { using real_type = real_t ; static const uint_t nrb = 2; static const uint_t nre = 1; };
+template <> struct RandTraits<uint_t    > { using real_type = real_t ; static const uint_t nrb = 2; static const uint_t nre = 1; };
+template <> struct RandTraits<real_t    > { using real_type = real_t ; static const uint_t nrb = 2; static const uint_t nre = 1; };
+template <> struct RandTraits<real4_t   > { using real_type = real4_t; static const uint_t nrb = 4; static const uint_t nre = 1; };
+template <> struct RandTraits<complex_t > { using real_type = real_t ; static const uint_t nrb = 2; static const uint_t nre = 2; };
+template <> struct RandTraits<complex8_t> { using real_type = real4_t; static const uint_t nrb = 4; static const uint_t nre = 2; };
+/*-------------------------------------------------*/
+static void to_unit(uint_t n, const uint32_t *w, real_t *u)
+{
+	for(uint_t k = 0; k < n; k++) {
+		uint64_t bits = (static_cast<uint64_t>(w[2*k+1]) << 21) ^ (w[2*k] >> 11);
+		u[k] = static_cast<real_t>(bits) * (1. / 9007199254740992.);
+	} // k
+}
+/*-------------------------------------------------*/
+static void to_unit(uint_t n, const uint32_t *w, real4_t *u)
+{
+	for(uint_t k = 0; k < n; k++) {
+		u[k] = static_cast<real4_t>(w[k] >> 8) * (1.f / 16777216.f);
+	} // k
+}
+/*-------------------------------------------------*/
+inline void assemble(const real_t  *r, int_t      & x) { x = static_cast<int_t >(std::floor(r[0])); }
+inline void assemble(const real_t  *r, uint_t     & x) { x = static_cast<uint_t>(std::floor(r[0])); }
+inline void assemble(const real_t  *r, real_t     & x) { x = r[0]; }
+inline void assemble(const real4_t *r, real4_t    & x) { x = r[0]; }
+inline void assemble(const real_t  *r, complex_t  & x) { x = complex_t (r[0], r[1]); }
+inline void assemble(const real4_t *r, complex8_t & x) { x = complex8_t(r[0], r[1]); }
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Transform>
+static void generate(uint64_t seed, uint64_t stream, uint64_t first, uint_t len, T_Scalar *x, T_Transform transform)
+{
+	using T_Real = typename RandTraits<T_Scalar>::real_type;
+
+	const uint_t nrb = RandTraits<T_Scalar>::nrb;
+	const uint_t nre = RandTraits<T_Scalar>::nre;
+	const uint64_t per = nrb / nre;
+	const uint_t nbatch = 64;
+
+	if(!len) return;
+
+	uint32_t words[4 * nbatch];
+	T_Real reals[nrb * nbatch];
+
+	uint64_t last = first + len;
+	uint64_t bcur = first / per;
+	uint64_t bend = (last + per - 1) / per;
+
+	while(bcur < bend) {
+
+		uint_t nb = static_cast<uint_t>(std::min(static_cast<uint64_t>(nbatch), bend - bcur));
+
+		philox4x32(seed, stream, bcur, nb, words);
+		to_unit(nb * nrb, words, reals);
+		transform(nb * nrb, reals);
+
+		uint64_t ebgn = std::max(first, bcur * per);
+		uint64_t eend = std::min(last, (bcur + static_cast<uint64_t>(nb)) * per);
+
+		for(uint64_t e = ebgn; e < eend; e++) {
+			assemble(reals + (e - bcur * per) * nre, x[e - first]);
+		} // e
+
+		bcur += nb;
+
+	} // bcur
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+void uniform(uint64_t seed, uint64_t stream, uint64_t first, uint_t len, T_Scalar *x, 
+		typename TypeTraits<T_Scalar>::real_type lo, 
+		typename TypeTraits<T_Scalar>::real_type hi)
+{
+	using T_Real = typename RandTraits<T_Scalar>::real_type;
+
+	T_Real rlo = static_cast<T_Real>(lo);
+	T_Real rdiff = static_cast<T_Real>(hi) - static_cast<T_Real>(lo);
+
+	generate(seed, stream, first, len, x, 
+			[rlo,rdiff](uint_t n, T_Real *u) {
+				for(uint_t k = 0; k < n; k++) {
+					u[k] = rlo + rdiff * u[k];
+				} // k
+			});
+}
+/*-------------------------------------------------*/
+//
+// Box-Muller transform on consecutive pairs of uniforms
+//
+template <typename T_Scalar>
+void normal(uint64_t seed, uint64_t stream, uint64_t first, uint_t len, T_Scalar *x, 
+		typename TypeTraits<T_Scalar>::real_type mu, 
+		typename TypeTraits<T_Scalar>::real_type sigma)
+{
+	using T_Real = typename RandTraits<T_Scalar>::real_type;
+
+	const T_Real twopi = static_cast<T_Real>(6.283185307179586476925286766559);
+
+	generate(seed, stream, first, len, x, 
+			[mu,sigma,twopi](uint_t n, T_Real *u) {
+				for(uint_t k = 0; k < n; k += 2) {
+					T_Real rad = std::sqrt(T_Real(-2) * std::log(T_Real(1) - u[k]));
+					T_Real theta = twopi * u[k+1];
+					u[k  ] = mu + sigma * rad * std::cos(theta);
+					u[k+1] = mu + sigma * rad * std::sin(theta);
+				} // k
+			});
+}
+/*-------------------------------------------------*/
+#define instantiate_uniform(T_Scl) \
+template void uniform(uint64_t, uint64_t, uint64_t, uint_t, T_Scl*, \
+		typename TypeTraits<T_Scl>::real_type, typename TypeTraits<T_Scl>::real_type)
+instantiate_uniform(int_t);
+instantiate_uniform(uint_t);
+instantiate_uniform(real_t);
+instantiate_uniform(real4_t);
+instantiate_uniform(complex_t);
+instantiate_uniform(complex8_t);
+#undef instantiate_uniform
+/*-------------------------------------------------*/
+#define instantiate_normal(T_Scl) \
+template void normal(uint64_t, uint64_t, uint64_t, uint_t, T_Scl*, \
+		typename TypeTraits<T_Scl>::real_type, typename TypeTraits<T_Scl>::real_type)
+instantiate_normal(real_t);
+instantiate_normal(real4_t);
+instantiate_normal(complex_t);
+instantiate_normal(complex8_t);
+#undef instantiate_normal
+/*-------------------------------------------------*/
+} // namespace rng
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_RANDOM_ENGINE_HPP_
+#define CLA3P_RANDOM_ENGINE_HPP_
+
+#include <cstdint>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+namespace rng {
+/*-------------------------------------------------*/
+
+/*
+ * Global seed & stream counter, every fill operation draws a new stream
+ * Setting the seed restarts the stream counter
+ */
+void set_seed(uint64_t seed);
+uint64_t seed();
+uint64_t next_stream();
+
+/*
+ * Philox4x32-10 counter-based generator
+ * Fills out[4*b:4*b+3] with the random words of counter (first + b, stream), b in [0, nblk)
+ */
+void philox4x32(uint64_t seed, uint64_t stream, uint64_t first, uint_t nblk, uint32_t *out);
+
+/*
+ * Fills x[0:len) with the values of linear element indexes [first, first + len)
+ * The value of each element depends only on (seed, stream, element index)
+ *
+ * uniform: values in [lo, hi), integer types are floored
+ * normal : real & imaginary parts with mean mu & standard deviation sigma
+ */
+template <typename T_Scalar>
+void uniform(uint64_t seed, uint64_t stream, uint64_t first, uint_t len, T_Scalar *x, 
+		typename TypeTraits<T_Scalar>::real_type lo, 
+		typename TypeTraits<T_Scalar>::real_type hi);
+
+template <typename T_Scalar>
+void normal(uint64_t seed, uint64_t stream, uint64_t first, uint_t len, T_Scalar *x, 
+		typename TypeTraits<T_Scalar>::real_type mu, 
+		typename TypeTraits<T_Scalar>::real_type sigma);
+
+/*-------------------------------------------------*/
+} // namespace rng
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_RANDOM_ENGINE_HPP_
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/support/settings.hpp"
+
+// system
+#include <atomic>
+
+// 3rd
+
+// cla3p
+#include "cla3p/support/random_engine.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+static std::atomic<kernel_t> g_sparse_kernel(kernel_t::Mkl);
+static std::atomic<alloc_t> g_allocator(alloc_t::System);
+/*-------------------------------------------------*/
+void setSparseKernel(kernel_t kernel)
+{
+	g_sparse_kernel = kernel;
+}
+/*-------------------------------------------------*/
+kernel_t sparseKernel()
+{
+	return g_sparse_kernel;
+}
+/*-------------------------------------------------*/
+void setAllocator(alloc_t alloc)
+{
+	g_allocator = alloc;
+}
+/*-------------------------------------------------*/
+alloc_t allocator()
+{
+	return g_allocator;
+}
+/*-------------------------------------------------*/
+void setRandomSeed(uint64_t seed)
+{
+	rng::set_seed(seed);
+}
+/*-------------------------------------------------*/
+uint64_t randomSeed()
+{
+	return rng::seed();
+}
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_SETTINGS_HPP_
+#define CLA3P_SETTINGS_HPP_
+
+/** 
+ * @file
+ * Global run-time settings.
+ */
+
+#include <cstdint>
+
+#include "cla3p/types.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+
+/**
+ * @ingroup module_index_settings
+ * @brief Sets the sparse kernel backend.
+ *
+ * Selects the implementation used in sparse (csc) matrix-vector & matrix-matrix products with dense operands.@n
+ * The default backend is kernel_t::Mkl.
+ *
+ * @param[in] kernel The kernel backend.
+ */
+void setSparseKernel(kernel_t kernel);
+
+/**
+ * @ingroup module_index_settings
+ * @brief The sparse kernel backend.
+ * @return The kernel backend currently used in sparse matrix products.
+ */
+kernel_t sparseKernel();
+
+/**
+ * @ingroup module_index_settings
+ * @brief Sets the allocator.
+ *
+ * Selects the allocator used by i_malloc() for subsequent allocations.@n
+ * Blocks remember their origin, so switching allocators does not affect memory that is already allocated.@n
+ * The default allocator is alloc_t::System.
+ *
+ * @param[in] alloc The allocator type.
+ */
+void setAllocator(alloc_t alloc);
+
+/**
+ * @ingroup module_index_settings
+ * @brief The allocator.
+ * @return The allocator type currently used by i_malloc().
+ */
+alloc_t allocator();
+
+/**
+ * @ingroup module_index_settings
+ * @brief Sets the random generator seed.
+ *
+ * Random values are produced by a counter-based generator, each value depends only on the seed, 
+ * the order of the random object creation calls & the element position.
+ * Setting the seed restarts the sequence, so the same sequence of calls reproduces the same objects 
+ * bit-for-bit, regardless of the number of threads.@n
+ * The default seed is 0.
+ *
+ * @param[in] seed The generator seed.
+ */
+void setRandomSeed(uint64_t seed);
+
+/**
+ * @ingroup module_index_settings
+ * @brief The random generator seed.
+ * @return The seed last set via setRandomSeed().
+ */
+uint64_t randomSeed();
+
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_SETTINGS_HPP_
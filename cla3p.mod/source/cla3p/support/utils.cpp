@@ -24,13 +24,26 @@
 #include <algorithm>
 
 // 3rd
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 // cla3p
 #include "cla3p/error/exceptions.hpp"
+#include "cla3p/support/random_engine.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
 /*-------------------------------------------------*/
+int max_threads()
+{
+#if defined(_OPENMP)
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+/*-------------------------------------------------*/
 #define SIZEKB 1024LLU 
 #define SIZEMB 1048576LLU
 #define SIZEGB 1073741824LLU
@@ -116,18 +129,6 @@ std::string bool2yn(bool flg)
 	return (flg ? "Yes" : "No");
 }
 /*-------------------------------------------------*/
-template <>
-complex_t rand<complex_t>(real_t low, real_t high)
-{
-  return complex_t(cla3p::rand<real_t>(low, high), cla3p::rand<real_t>(low, high));
-}
-/*-------------------------------------------------*/
-template <>
-complex8_t rand<complex8_t>(real4_t low, real4_t high)
-{
-  return complex8_t(cla3p::rand<real4_t>(low, high), cla3p::rand<real4_t>(low, high));
-}
-/*-------------------------------------------------*/
 void val2char(char *buff, bulk_t bufflen, uint_t nsd, int_t val)
 {
 	if(nsd) {
@@ -207,6 +208,9 @@ static void fill_identity_perm_tmpl(uint_t n, T_Int *P)
 void fill_identity_perm(uint_t n, uint_t *P){ fill_identity_perm_tmpl(n, P); }
 void fill_identity_perm(uint_t n,  int_t *P){ fill_identity_perm_tmpl(n, P); }
 /*-------------------------------------------------*/
+//
+// Fisher-Yates shuffle, draws are generated in chunks by the counter-based generator
+//
 template <typename T_Int>
 static void fill_random_perm_tmpl(uint_t n, T_Int *P)
 {
@@ -214,12 +218,24 @@ static void fill_random_perm_tmpl(uint_t n, T_Int *P)
 
 	fill_identity_perm(n, P);
 
-	uint_t ilen = n;
-	for(uint_t i = 0; i < n - 1; i++) {
-		uint_t k = rand<T_Int>(0, ilen-1);
-		std::swap(P[k], P[ilen-1]);
-		ilen--;
-	} // i
+	uint64_t seed = rng::seed();
+	uint64_t stream = rng::next_stream();
+
+	const uint_t chunk = 4096;
+	std::vector<real_t> u(std::min(chunk, n));
+
+	for(uint_t s0 = 0; s0 < n - 1; s0 += chunk) {
+
+		uint_t len = std::min(chunk, n - 1 - s0);
+		rng::uniform(seed, stream, s0, len, u.data(), 0., 1.);
+
+		for(uint_t s = 0; s < len; s++) {
+			uint_t ilen = n - s0 - s;
+			uint_t k = std::min(static_cast<uint_t>(u[s] * ilen), ilen - 1);
+			std::swap(P[k], P[ilen-1]);
+		} // s
+
+	} // s0
 }
 /*-------------------------------------------------*/
 void fill_random_perm(uint_t n, uint_t *P) { fill_random_perm_tmpl(n, P); }
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <vector>
+#include <functional>
 
 #include "cla3p/types.hpp"
 #include "cla3p/error.hpp"
@@ -32,6 +33,7 @@ void sanitize_nsd(uint_t& nsd);
 std::string bytes2human(bulk_t nbytes, uint_t nsd = 3);
 void fill_info_margins(const std::string& msg, std::string& top, std::string& bottom);
 std::string bool2yn(bool flg);
+int max_threads();
 
 /*-------------------------------------------------*/
 template <typename T_Scalar>
@@ -52,27 +54,6 @@ std::string coord2str(T_Int i, T_Int j)
 	return ret;
 }
 /*-------------------------------------------------*/
-template <typename T_Scalar>
-T_Scalar rand(
-		typename TypeTraits<T_Scalar>::real_type low, 
-		typename TypeTraits<T_Scalar>::real_type high)
-{
-  if(low > high) {
-    throw err::Exception("Need low <= high");
-  } // error
-
-	cla3p::real_t rval = static_cast<cla3p::real_t>(std::rand());
-	cla3p::real_t diff = static_cast<cla3p::real_t>(high - low);
-  cla3p::real_t inc = (rval * diff) / static_cast<cla3p::real_t>(RAND_MAX + 1U);
-
-  return (low + static_cast<T_Scalar>(inc));
-}
-/*-------------------------------------------------*/
-template <>
-complex_t rand<complex_t>(real_t low, real_t high); 
-template <>
-complex8_t rand<complex8_t>(real4_t low, real4_t high);
-/*-------------------------------------------------*/
 
 void val2char(char *buff, bulk_t bufflen, uint_t nsd, int_t val);
 void val2char(char *buff, bulk_t bufflen, uint_t nsd, uint_t val);
@@ -172,6 +153,41 @@ inline bool coord_in_range(uplo_t uplo, uint_t i, uint_t j)
 	return true;
 }
 /*-------------------------------------------------*/
+//
+// beta * y as in blas, a zero beta discards y (including Inf/NaN)
+//
+template <typename T_Scalar>
+inline T_Scalar beta_scaled(T_Scalar beta, T_Scalar y)
+{
+	return (beta == T_Scalar(0) ? T_Scalar(0) : beta * y);
+}
+/*-------------------------------------------------*/
+//
+// v, or its conjugate for conjugated operations
+//
+template <typename T_Scalar>
+inline T_Scalar opval(bool conjop, const T_Scalar& v)
+{
+	return (conjop ? arith::conj(v) : v);
+}
+/*-------------------------------------------------*/
+//
+// Whether the column-major storages of two dense objects (values/rsize/csize/lsize) overlap
+//
+template <typename T_Lhs, typename T_Rhs>
+inline bool overlapping(const T_Lhs& a, const T_Rhs& b)
+{
+	if(!a.rsize() || !a.csize() || !b.rsize() || !b.csize()) return false;
+
+	const void *abgn = a.values();
+	const void *bbgn = b.values();
+	const void *aend = a.values() + static_cast<bulk_t>(a.lsize()) * (a.csize() - 1) + a.rsize();
+	const void *bend = b.values() + static_cast<bulk_t>(b.lsize()) * (b.csize() - 1) + b.rsize();
+
+	std::less<const void*> lt;
+	return (lt(abgn, bend) && lt(bbgn, aend));
+}
+/*-------------------------------------------------*/
 } // namespace cla3p
 /*-------------------------------------------------*/
 
@@ -103,6 +103,50 @@ enum class dup_t {
 	Amin      /**< Keeps absolute minimum entry */
 };
 
+/**
+ * @ingroup module_index_datatypes
+ * @enum kernel_t
+ * @brief The kernel backend type.
+ *
+ * Selects the implementation of sparse matrix-vector & matrix-matrix products.
+ */
+enum class kernel_t {
+	Mkl    = 0, /**< Intel MKL sparse BLAS kernels */
+	Native      /**< Built-in multithreaded kernels */
+};
+
+/**
+ * @ingroup module_index_datatypes
+ * @enum alloc_t
+ * @brief The allocator type.
+ *
+ * Selects the allocator behind i_malloc() & the containers of cla3p objects.
+ */
+enum class alloc_t {
+	System = 0, /**< Aligned system allocator, every request reaches the system */
+	Pool        /**< Size-class pool with per-thread free lists */
+};
+
+/**
+ * @ingroup module_index_datatypes
+ * @enum layout_t
+ * @brief The storage layout of a matrix batch.
+ */
+enum class layout_t {
+	Strided = 0, /**< The matrices are stored one after the other */
+	Compact      /**< The matrices are interleaved in groups, same entries of a group are contiguous */
+};
+
+/**
+ * @ingroup module_index_datatypes
+ * @enum decomp_t
+ * @brief The decomposition type of a linear solver.
+ */
+enum class decomp_t {
+	LU  = 0, /**< Partial pivoting LU decomposition */
+	LLt      /**< Positive definite Cholesky (LL') decomposition */
+};
+
 /*-------------------------------------------------*/
 } // namespace cla3p
 /*-------------------------------------------------*/
@@ -74,11 +74,26 @@ std::string SparseCsc()
 	return "Sparse (csc)"; 
 }
 /*-------------------------------------------------*/
+std::string SparseCsr()
+{ 
+	return "Sparse (csr)"; 
+}
+/*-------------------------------------------------*/
 std::string SparseCoo()
 { 
 	return "Sparse (coo)"; 
 }
 /*-------------------------------------------------*/
+std::string SparseBsr()
+{ 
+	return "Sparse (bsr)"; 
+}
+/*-------------------------------------------------*/
+std::string SparseSell()
+{ 
+	return "Sparse (sell)"; 
+}
+/*-------------------------------------------------*/
 std::string Vector()
 { 
 	return "Vector"; 
@@ -104,16 +119,56 @@ std::string DenseMatrix ()
 	return Dense() + " " + Matrix(); 
 }
 /*-------------------------------------------------*/
+std::string DenseMatrixBatch()
+{ 
+	return DenseMatrix() + " Batch"; 
+}
+/*-------------------------------------------------*/
+std::string DenseRfpMatrix()
+{ 
+	return Dense() + " RFP " + Matrix(); 
+}
+/*-------------------------------------------------*/
+std::string DenseBandMatrix()
+{ 
+	return Dense() + " Band " + Matrix(); 
+}
+/*-------------------------------------------------*/
+std::string DenseTridiagonalMatrix()
+{ 
+	return Dense() + " Tridiagonal " + Matrix(); 
+}
+/*-------------------------------------------------*/
 std::string SparseCscMatrix()
 {
 	return SparseCsc() + " " + Matrix(); 
 }
 /*-------------------------------------------------*/
+std::string SparseCsrMatrix()
+{
+	return SparseCsr() + " " + Matrix(); 
+}
+/*-------------------------------------------------*/
 std::string SparseCooMatrix()
 {
 	return SparseCoo() + " " + Matrix(); 
 }
 /*-------------------------------------------------*/
+std::string SparseBsrMatrix()
+{
+	return SparseBsr() + " " + Matrix(); 
+}
+/*-------------------------------------------------*/
+std::string SparseSellMatrix()
+{
+	return SparseSell() + " " + Matrix(); 
+}
+/*-------------------------------------------------*/
+std::string SparseCscAssembler()
+{
+	return SparseCsc() + " element assembler"; 
+}
+/*-------------------------------------------------*/
 /*-------------------------------------------------*/
 /*-------------------------------------------------*/
 std::string NoOperation()
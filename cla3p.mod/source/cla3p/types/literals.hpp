@@ -35,7 +35,10 @@ std::string Double();
 
 std::string Dense();
 std::string SparseCsc();
+std::string SparseCsr();
 std::string SparseCoo();
+std::string SparseBsr();
+std::string SparseSell();
 
 std::string Vector();
 std::string Matrix();
@@ -43,8 +46,16 @@ std::string PermutationMatrix();
 
 std::string DenseVector();
 std::string DenseMatrix();
+std::string DenseMatrixBatch();
+std::string DenseRfpMatrix();
+std::string DenseBandMatrix();
+std::string DenseTridiagonalMatrix();
 std::string SparseCscMatrix();
+std::string SparseCsrMatrix();
 std::string SparseCooMatrix();
+std::string SparseBsrMatrix();
+std::string SparseSellMatrix();
+std::string SparseCscAssembler();
 
 std::string NoOperation();
 std::string TransposeOperation();
@@ -20,5 +20,7 @@
 #include "cla3p/virtuals/virtual_entity.hpp"
 #include "cla3p/virtuals/virtual_object.hpp"
 #include "cla3p/virtuals/virtual_prod.hpp"
+#include "cla3p/virtuals/virtual_sum.hpp"
+#include "cla3p/virtuals/virtual_csc.hpp"
 
 #endif // CLA3P_VIRTUALS_HPP_
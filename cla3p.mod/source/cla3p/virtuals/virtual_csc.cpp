@@ -0,0 +1,340 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/virtuals/virtual_csc.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/perms.hpp"
+#include "cla3p/bulk/csc.hpp"
+#include "cla3p/checks/transp_checks.hpp"
+#include "cla3p/checks/perm_checks.hpp"
+#include "cla3p/checks/matrix_math_checks.hpp"
+#include "cla3p/algebra/functional_multmv.hpp"
+#include "cla3p/algebra/functional_multmm.hpp"
+#include "cla3p/algebra/functional_update.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Matrix, typename T_Vector>
+static void prod_dim_check(op_t opA, const T_Matrix& A, 
+		const dns::XxVector<typename T_Vector::value_type,T_Vector>& X, 
+		const dns::XxVector<typename T_Vector::value_type,T_Vector>& Y)
+{
+	Operation _opA(opA);
+	mat_x_vec_mult_check(_opA, A.prop(), A.nrows(), A.ncols(), X.size(), Y.size());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix, typename T_DnsMatrix>
+static void prod_dim_check(op_t opA, const T_Matrix& A, 
+		const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& X, 
+		const dns::XxMatrix<typename T_DnsMatrix::value_type,T_DnsMatrix>& Y)
+{
+	Operation _opA(opA);
+	Operation _opX(op_t::N);
+	mult_dim_check(A.nrows(), A.ncols(), _opA, X.nrows(), X.ncols(), _opX, Y.nrows(), Y.ncols());
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_Vector>
+static T_Vector zeros_like(const dns::XxVector<T_Scalar,T_Vector>& Y)
+{
+	T_Vector ret = T_Vector::init(Y.size());
+	ret = 0;
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Scalar, typename T_DnsMatrix>
+static T_DnsMatrix zeros_like(const dns::XxMatrix<T_Scalar,T_DnsMatrix>& Y)
+{
+	T_DnsMatrix ret = T_DnsMatrix::init(Y.nrows(), Y.ncols());
+	ret = 0;
+	return ret;
+}
+/*-------------------------------------------------*/
+//
+// Y += alpha * P * conj(op(A)) * Q * X
+//
+// The permutations are applied on (copies of) the dense operands: 
+//   W = conj(op(A)) * (Q * X), Y += P * W
+// and the conjugation is moved to the dense operands as well: 
+//   conj(op(A)) * X = conj(op(A) * conj(X))
+//
+template <typename T_Matrix, typename T_Dense, typename T_Perm>
+static void update_prod(typename T_Matrix::value_type alpha, op_t opA, bool conjA, const T_Matrix& A, 
+		const T_Perm *P, const T_Perm *Q, const T_Dense& X, T_Dense& Y)
+{
+	prod_dim_check(opA, A, X, Y);
+
+	if(!P && !Q && !conjA) {
+		ops::mult(alpha, opA, A, X, Y);
+		return;
+	} // direct
+
+	T_Dense Xtmp;
+
+	if(Q) {
+		Xtmp = X.permuteLeft(*Q);
+	} // Q
+
+	if(conjA) {
+		if(!Q) Xtmp = X.copy();
+		Xtmp.iconjugate();
+		alpha = arith::conj(alpha);
+	} // conjA
+
+	const T_Dense& Xq = (Q || conjA ? Xtmp : X);
+
+	if(P) {
+
+		T_Dense W = zeros_like(Y);
+		ops::mult(alpha, opA, A, Xq, W);
+		if(conjA) W.iconjugate();
+		W.ipermuteLeft(*P);
+		ops::update(typename T_Matrix::value_type(1), W, Y);
+
+	} else {
+
+		//
+		// Y is restored if the product throws
+		//
+		if(conjA) Y.iconjugate();
+		try {
+			ops::mult(alpha, opA, A, Xq, Y);
+		} catch(...) {
+			if(conjA) Y.iconjugate();
+			throw;
+		} // restore
+		if(conjA) Y.iconjugate();
+
+	} // P
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix>::VirtualCscMatrix()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix>::VirtualCscMatrix(const T_Matrix& mat)
+	: VirtualObject<T_Matrix,VirtualCscMatrix<T_Matrix>>(mat)
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix>::~VirtualCscMatrix()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::clear()
+{
+	VirtualObject<T_Matrix,VirtualCscMatrix<T_Matrix>>::clear();
+	m_lperm.reset();
+	m_rperm.reset();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t VirtualCscMatrix<T_Matrix>::nrows() const
+{
+	return (this->transOp() == op_t::N ? this->obj().nrows() : this->obj().ncols());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+uint_t VirtualCscMatrix<T_Matrix>::ncols() const
+{
+	return (this->transOp() == op_t::N ? this->obj().ncols() : this->obj().nrows());
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const prm::PxMatrix<int_t>* VirtualCscMatrix<T_Matrix>::leftPerm() const
+{
+	return m_lperm.get();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const prm::PxMatrix<int_t>* VirtualCscMatrix<T_Matrix>::rightPerm() const
+{
+	return m_rperm.get();
+}
+/*-------------------------------------------------*/
+//
+// (P * op(A) * Q)^T = Q^T * op(A)^T * P^T
+//
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::itranspose()
+{
+	transp_op_consistency_check(this->obj().prop().type(), false);
+
+	std::shared_ptr<const T_Perm> lperm = (m_rperm ? std::shared_ptr<const T_Perm>(new T_Perm(m_rperm->inverse())) : nullptr);
+	std::shared_ptr<const T_Perm> rperm = (m_lperm ? std::shared_ptr<const T_Perm>(new T_Perm(m_lperm->inverse())) : nullptr);
+
+	m_lperm = lperm;
+	m_rperm = rperm;
+
+	VirtualObject<T_Matrix,VirtualCscMatrix<T_Matrix>>::itranspose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::ictranspose()
+{
+	this->iconjugate();
+	itranspose();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::ipermuteLeft(const T_Perm& P)
+{
+	perm_ge_op_consistency_check(this->obj().prop().type(), nrows(), ncols(), P.size(), ncols());
+
+	m_lperm = std::shared_ptr<const T_Perm>(new T_Perm(m_lperm ? m_lperm->permuteLeft(P) : P.copy()));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::ipermuteRight(const T_Perm& Q)
+{
+	perm_ge_op_consistency_check(this->obj().prop().type(), nrows(), ncols(), nrows(), Q.size());
+
+	m_rperm = std::shared_ptr<const T_Perm>(new T_Perm(m_rperm ? Q.permuteLeft(*m_rperm) : Q.copy()));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix> VirtualCscMatrix<T_Matrix>::permuteLeft(const T_Perm& P) const
+{
+	VirtualCscMatrix<T_Matrix> ret = *this;
+	ret.ipermuteLeft(P);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix> VirtualCscMatrix<T_Matrix>::permuteRight(const T_Perm& Q) const
+{
+	VirtualCscMatrix<T_Matrix> ret = *this;
+	ret.ipermuteRight(Q);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+const VirtualCscMatrix<T_Matrix>& VirtualCscMatrix<T_Matrix>::self() const
+{
+	return *this;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+T_Matrix VirtualCscMatrix<T_Matrix>::evaluate() const
+{
+	const T_Matrix& A = this->obj();
+
+	if(A.empty()) 
+		return T_Matrix();
+
+	T_Matrix ret;
+
+	if(this->transOp() == op_t::N) {
+
+		ret = A.copy();
+
+	} else {
+
+		bool conjop = (this->transOp() == op_t::C);
+
+		transp_op_consistency_check(A.prop().type(), conjop);
+
+		ret = T_Matrix(A.ncols(), A.nrows(), A.nnz(), A.prop());
+
+		if(conjop) {
+			bulk::csc::conjugate_transpose(A.nrows(), A.ncols(), A.colptr(), A.rowidx(), A.values(), 
+					ret.colptr(), ret.rowidx(), ret.values());
+		} else {
+			bulk::csc::transpose(A.nrows(), A.ncols(), A.colptr(), A.rowidx(), A.values(), 
+					ret.colptr(), ret.rowidx(), ret.values());
+		} // conjop
+
+	} // transOp
+
+	if(this->conjOp()) 
+		ret.iconjugate();
+
+	if(this->coeff() != T_Scalar(1)) 
+		ret.iscale(this->coeff());
+
+	if(m_lperm && m_rperm) {
+		ret = ret.permuteLeftRight(*m_lperm, *m_rperm);
+	} else if(m_lperm) {
+		ret = ret.permuteLeft(*m_lperm);
+	} else if(m_rperm) {
+		ret = ret.permuteRight(*m_rperm);
+	} // perms
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::update(T_Scalar c, T_Matrix& B) const
+{
+	ops::update(c, evaluate(), B);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+VirtualCscMatrix<T_Matrix>::operator T_Matrix() const
+{
+	return evaluate();
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::updateProd(T_Scalar c, const T_Vector& X, T_Vector& Y) const
+{
+	update_prod(c * this->coeff(), this->transOp(), this->conjOp(), this->obj(), leftPerm(), rightPerm(), X, Y);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+void VirtualCscMatrix<T_Matrix>::updateProd(T_Scalar c, const T_DnsMatrix& X, T_DnsMatrix& Y) const
+{
+	update_prod(c * this->coeff(), this->transOp(), this->conjOp(), this->obj(), leftPerm(), rightPerm(), X, Y);
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TypeTraits<T_Matrix>::vector_type VirtualCscMatrix<T_Matrix>::evaluateProd(const T_Vector& X) const
+{
+	T_Vector ret(nrows());
+	ret = 0;
+	updateProd(T_Scalar(1), X, ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+typename TypeTraits<T_Matrix>::dns_type VirtualCscMatrix<T_Matrix>::evaluateProd(const T_DnsMatrix& X) const
+{
+	T_DnsMatrix ret(nrows(), X.ncols());
+	ret = 0;
+	updateProd(T_Scalar(1), X, ret);
+	return ret;
+}
+/*-------------------------------------------------*/
+template class VirtualCscMatrix<csc::RdMatrix>;
+template class VirtualCscMatrix<csc::RfMatrix>;
+template class VirtualCscMatrix<csc::CdMatrix>;
+template class VirtualCscMatrix<csc::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_VIRTUAL_CSC_HPP_
+#define CLA3P_VIRTUAL_CSC_HPP_
+
+/**
+ * @file
+ */
+
+#include <memory>
+
+#include "cla3p/types.hpp"
+#include "cla3p/virtuals/virtual_object.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+namespace prm { template <typename T_Int> class PxMatrix; }
+/*-------------------------------------------------*/
+//
+// A lazy sparse matrix (csc) of the form coeff * P * op(A) * Q
+// Products with dense operands are applied using the transposition flag of the kernels 
+// and permuted copies of the (dense) operands, the sparse matrix is never materialized
+//
+template <typename T_Matrix>
+class VirtualCscMatrix : public VirtualObject<T_Matrix,VirtualCscMatrix<T_Matrix>> {
+
+	private:
+		using T_Scalar = typename T_Matrix::value_type;
+		using T_Vector = typename TypeTraits<T_Matrix>::vector_type;
+		using T_DnsMatrix = typename TypeTraits<T_Matrix>::dns_type;
+		using T_Perm = prm::PxMatrix<int_t>;
+
+	public:
+		using value_type = T_Matrix;
+
+		explicit VirtualCscMatrix();
+		explicit VirtualCscMatrix(const T_Matrix& mat);
+		~VirtualCscMatrix();
+
+		void clear();
+
+		uint_t nrows() const;
+		uint_t ncols() const;
+
+		void itranspose();
+		void ictranspose();
+		void ipermuteLeft(const T_Perm& P);
+		void ipermuteRight(const T_Perm& Q);
+
+		VirtualCscMatrix<T_Matrix> permuteLeft(const T_Perm& P) const;
+		VirtualCscMatrix<T_Matrix> permuteRight(const T_Perm& Q) const;
+
+		const T_Perm *leftPerm() const;
+		const T_Perm *rightPerm() const;
+
+		const VirtualCscMatrix<T_Matrix>& self() const override;
+		T_Matrix evaluate() const override;
+		void update(T_Scalar c, T_Matrix& B) const override;
+		operator T_Matrix() const;
+
+		void updateProd(T_Scalar c, const T_Vector& X, T_Vector& Y) const;
+		void updateProd(T_Scalar c, const T_DnsMatrix& X, T_DnsMatrix& Y) const;
+
+		T_Vector evaluateProd(const T_Vector& X) const;
+		T_DnsMatrix evaluateProd(const T_DnsMatrix& X) const;
+
+	private:
+		std::shared_ptr<const T_Perm> m_lperm;
+		std::shared_ptr<const T_Perm> m_rperm;
+};
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_VIRTUAL_CSC_HPP_
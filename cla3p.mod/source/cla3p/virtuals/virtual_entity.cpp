@@ -23,8 +23,11 @@
 
 // cla3p
 #include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
 #include "cla3p/virtuals/virtual_object.hpp"
 #include "cla3p/virtuals/virtual_prod.hpp"
+#include "cla3p/virtuals/virtual_sum.hpp"
+#include "cla3p/virtuals/virtual_csc.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
@@ -73,5 +76,20 @@ template class VirtualEntity<dns::RfMatrix, VirtualProdMm<dns::RfMatrix>>;
 template class VirtualEntity<dns::CdMatrix, VirtualProdMm<dns::CdMatrix>>;
 template class VirtualEntity<dns::CfMatrix, VirtualProdMm<dns::CfMatrix>>;
 /*-------------------------------------------------*/
+template class VirtualEntity<dns::RdVector, VirtualSum<dns::RdVector>>;
+template class VirtualEntity<dns::RfVector, VirtualSum<dns::RfVector>>;
+template class VirtualEntity<dns::CdVector, VirtualSum<dns::CdVector>>;
+template class VirtualEntity<dns::CfVector, VirtualSum<dns::CfVector>>;
+/*-------------------------------------------------*/
+template class VirtualEntity<dns::RdMatrix, VirtualSum<dns::RdMatrix>>;
+template class VirtualEntity<dns::RfMatrix, VirtualSum<dns::RfMatrix>>;
+template class VirtualEntity<dns::CdMatrix, VirtualSum<dns::CdMatrix>>;
+template class VirtualEntity<dns::CfMatrix, VirtualSum<dns::CfMatrix>>;
+/*-------------------------------------------------*/
+template class VirtualEntity<csc::RdMatrix, VirtualCscMatrix<csc::RdMatrix>>;
+template class VirtualEntity<csc::RfMatrix, VirtualCscMatrix<csc::RfMatrix>>;
+template class VirtualEntity<csc::CdMatrix, VirtualCscMatrix<csc::CdMatrix>>;
+template class VirtualEntity<csc::CfMatrix, VirtualCscMatrix<csc::CfMatrix>>;
+/*-------------------------------------------------*/
 } // namespace cla3p
 /*-------------------------------------------------*/
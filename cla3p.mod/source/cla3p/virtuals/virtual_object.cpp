@@ -23,9 +23,14 @@
 
 // cla3p
 #include "cla3p/dense.hpp"
+#include "cla3p/sparse.hpp"
+#include "cla3p/virtuals/virtual_csc.hpp"
 #include "cla3p/error/exceptions.hpp"
 #include "cla3p/bulk/dns.hpp"
+#include "cla3p/bulk/dns_math.hpp"
+#include "cla3p/checks/basic_checks.hpp"
 #include "cla3p/checks/transp_checks.hpp"
+#include "cla3p/support/utils.hpp"
 #include "cla3p/algebra/functional_inner.hpp"
 #include "cla3p/algebra/functional_outer.hpp"
 #include "cla3p/algebra/functional_update.hpp"
@@ -245,9 +250,19 @@ void VirtualVector<T_Vector>::update(T_Scalar c, T_Vector& Y) const
 	}
 
 	if(!this->conjOp()) {
+
 		ops::update(c * this->coeff(), this->obj(), Y);
+
 	} else {
-		ops::update(c, evaluate(), Y);
+
+		const T_Vector& X = this->obj();
+
+		similarity_check(
+				defaultProperty(), X.size(), 1,
+				defaultProperty(), Y.size(), 1);
+
+		bulk::dns::update_op(uplo_t::Full, op_t::N, true, X.size(), 1, c * this->coeff(), X.values(), X.size(), Y.values(), Y.size());
+
 	} // conjop
 }
 /*-------------------------------------------------*/
@@ -372,13 +387,40 @@ T_Matrix VirtualMatrix<T_Matrix>::evaluate() const
 template <typename T_Matrix>
 void VirtualMatrix<T_Matrix>::update(T_Scalar c, T_Matrix& B) const
 {
-	// FIXME: add transpose with no extra mem
+	const T_Matrix& A = this->obj();
 
 	if(this->transOp() == op_t::N && !this->conjOp()) {
-		ops::update(c * this->coeff(), this->obj(), B);
-	} else {
+
+		ops::update(c * this->coeff(), A, B);
+
+	} else if(this->transOp() != op_t::N && overlapping(A, B)) {
+
+		//
+		// B is also the source (e.g. A += A.transpose()), in-place would read overwritten values
+		//
 		ops::update(c, evaluate(), B);
-	} // conjop
+
+	} else if(this->transOp() == op_t::N) {
+
+		similarity_check(
+				A.prop(), A.nrows(), A.ncols(),
+				B.prop(), B.nrows(), B.ncols());
+
+		bulk::dns::update_op(A.prop().uplo(), op_t::N, true, A.nrows(), A.ncols(), 
+				c * this->coeff(), A.values(), A.ld(), B.values(), B.ld());
+
+	} else {
+
+		transp_op_consistency_check(A.prop().type(), this->transOp() == op_t::C);
+
+		similarity_check(
+				A.prop(), A.ncols(), A.nrows(),
+				B.prop(), B.nrows(), B.ncols());
+
+		bulk::dns::update_op(uplo_t::Full, this->transOp(), this->conjOp(), B.nrows(), B.ncols(), 
+				c * this->coeff(), A.values(), A.ld(), B.values(), B.ld());
+
+	} // op
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
@@ -399,6 +441,11 @@ template class VirtualObject<dns::RfMatrix, VirtualMatrix<dns::RfMatrix>>;
 template class VirtualObject<dns::CdMatrix, VirtualMatrix<dns::CdMatrix>>;
 template class VirtualObject<dns::CfMatrix, VirtualMatrix<dns::CfMatrix>>;
 /*-------------------------------------------------*/
+template class VirtualObject<csc::RdMatrix, VirtualCscMatrix<csc::RdMatrix>>;
+template class VirtualObject<csc::RfMatrix, VirtualCscMatrix<csc::RfMatrix>>;
+template class VirtualObject<csc::CdMatrix, VirtualCscMatrix<csc::CdMatrix>>;
+template class VirtualObject<csc::CfMatrix, VirtualCscMatrix<csc::CfMatrix>>;
+/*-------------------------------------------------*/
 template class VirtualVector<dns::RdVector>;
 template class VirtualVector<dns::RfVector>;
 template class VirtualVector<dns::CdVector>;
@@ -24,12 +24,76 @@
 // cla3p
 #include "cla3p/dense.hpp"
 #include "cla3p/error/exceptions.hpp"
+#include "cla3p/support/utils.hpp"
 #include "cla3p/algebra/functional_multmv.hpp"
 #include "cla3p/algebra/functional_multmm.hpp"
 
 /*-------------------------------------------------*/
 namespace cla3p {
 /*-------------------------------------------------*/
+//
+// A factor can be written as conj(op'(A)) with no extra memory if it is
+// conjugated, or if it is a transposed general matrix (T <-> C)
+//
+template <typename T_Matrix>
+static bool conj_foldable(const VirtualMatrix<T_Matrix>& v)
+{
+	return (v.conjOp() || (v.transOp() != op_t::N && v.obj().prop().isGeneral()));
+}
+/*-------------------------------------------------*/
+template <typename T_Matrix>
+static op_t conj_folded_op(const VirtualMatrix<T_Matrix>& v)
+{
+	if(v.conjOp()) return v.transOp();
+	return (v.transOp() == op_t::T ? op_t::C : op_t::T);
+}
+/*-------------------------------------------------*/
+//
+// Product of a conjugated factor & a factor that cannot be folded
+// The vector is materialized (either plain or conjugated), tmp holds the copy
+//
+template <typename T_Vector>
+static VirtualProdMv<T_Vector> materialize_operand(
+		const VirtualMatrix<typename TypeTraits<T_Vector>::matrix_type>& lhs, 
+		const VirtualVector<T_Vector>& rhs, T_Vector& tmp)
+{
+	if(rhs.conjOp()) {
+		tmp = rhs.evaluate();
+		return VirtualProdMv<T_Vector>(lhs, VirtualVector<T_Vector>(tmp));
+	} // rhs conjugated
+
+	tmp = rhs.conjugate().evaluate();
+	return VirtualProdMv<T_Vector>(lhs, VirtualVector<T_Vector>(tmp).conjugate());
+}
+/*-------------------------------------------------*/
+//
+// Product of a conjugated factor & a factor that cannot be folded
+// The smaller factor is materialized, tmp holds the copy
+//
+template <typename T_Matrix>
+static VirtualProdMm<T_Matrix> materialize_operand(
+		const VirtualMatrix<T_Matrix>& lhs, 
+		const VirtualMatrix<T_Matrix>& rhs, T_Matrix& tmp)
+{
+	bool lconj = lhs.conjOp();
+
+	const VirtualMatrix<T_Matrix>& F = (lconj ? rhs : lhs);
+	const VirtualMatrix<T_Matrix>& G = (lconj ? lhs : rhs);
+
+	bulk_t fsize = static_cast<bulk_t>(F.obj().nrows()) * static_cast<bulk_t>(F.obj().ncols());
+	bulk_t gsize = static_cast<bulk_t>(G.obj().nrows()) * static_cast<bulk_t>(G.obj().ncols());
+
+	if(F.transOp() == op_t::N && fsize < gsize) {
+		tmp = F.conjugate().evaluate();
+		VirtualMatrix<T_Matrix> vF = VirtualMatrix<T_Matrix>(tmp).conjugate();
+		return (lconj ? VirtualProdMm<T_Matrix>(G, vF) : VirtualProdMm<T_Matrix>(vF, G));
+	} // store conj(F), both factors become conjugated
+
+	tmp = G.evaluate();
+	VirtualMatrix<T_Matrix> vG(tmp);
+	return (lconj ? VirtualProdMm<T_Matrix>(vG, F) : VirtualProdMm<T_Matrix>(F, vG));
+}
+/*-------------------------------------------------*/
 template <typename T_Lhs, typename T_Rhs, typename T_Virtual>
 VirtualProdXx<T_Lhs,T_Rhs,T_Virtual>::VirtualProdXx()
 {
@@ -80,6 +144,12 @@ void VirtualProdXx<T_Lhs,T_Rhs,T_Virtual>::clear()
 }
 /*-------------------------------------------------*/
 template <typename T_Lhs, typename T_Rhs, typename T_Virtual>
+bool VirtualProdXx<T_Lhs,T_Rhs,T_Virtual>::references(const T_Object& Y) const
+{
+	return (overlapping(lhs().obj(), Y) || overlapping(rhs().obj(), Y));
+}
+/*-------------------------------------------------*/
+template <typename T_Lhs, typename T_Rhs, typename T_Virtual>
 void VirtualProdXx<T_Lhs,T_Rhs,T_Virtual>::iscale(T_Scalar val)
 {
 	lhs().iscale(val);
@@ -119,59 +189,66 @@ const VirtualProdMv<T_Vector>& VirtualProdMv<T_Vector>::self() const
 template <typename T_Vector>
 T_Vector VirtualProdMv<T_Vector>::evaluate() const
 {
-	if(this->rhs().transOp() != op_t::N) {
+	const VirtualMatrix<T_Matrix>& lhs = this->lhs();
+	const VirtualVector<T_Vector>& rhs = this->rhs();
+
+	if(rhs.transOp() != op_t::N) {
 		throw err::InvalidOp("Cannot multiply");
 	}
 
-	if(!this->lhs().conjOp() && !this->rhs().conjOp()) {
-
-		return ops::mult(this->rhs().coeff() * this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), this->rhs().obj());
-
-	} else if(this->lhs().conjOp() && !this->rhs().conjOp()) {
+	T_Scalar alpha = lhs.coeff() * rhs.coeff();
 
-		T_Matrix lhs = this->lhs().evaluate();
-		return ops::mult(this->rhs().coeff(), op_t::N, lhs, this->rhs().obj());
+	if(!lhs.conjOp() && !rhs.conjOp()) {
 
-	} else if(!this->lhs().conjOp() && this->rhs().conjOp()) {
+		return ops::mult(alpha, lhs.transOp(), lhs.obj(), rhs.obj());
 
-		T_Vector rhs = this->rhs().evaluate();
-		return ops::mult(this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), rhs);
+	} else if(rhs.conjOp() && conj_foldable(lhs)) {
 
-	} else {
-
-		T_Matrix lhs = this->lhs().evaluate();
-		T_Vector rhs = this->rhs().evaluate();
-		return ops::mult(T_Scalar(1), op_t::N, lhs, rhs);
+		T_Vector ret = ops::mult(arith::conj(alpha), conj_folded_op(lhs), lhs.obj(), rhs.obj());
+		ret.iconjugate();
+		return ret;
 
 	} // conjop
+
+	T_Vector tmp;
+	return materialize_operand(lhs, rhs, tmp).evaluate();
 }
 /*-------------------------------------------------*/
 template <typename T_Vector>
 void VirtualProdMv<T_Vector>::update(T_Scalar c, T_Vector& Y) const
 {
-	if(this->rhs().transOp() != op_t::N) {
+	const VirtualMatrix<T_Matrix>& lhs = this->lhs();
+	const VirtualVector<T_Vector>& rhs = this->rhs();
+
+	if(rhs.transOp() != op_t::N) {
 		throw err::InvalidOp("Cannot multiply");
 	}
 
-	if(!this->lhs().conjOp() && !this->rhs().conjOp()) {
-
-		ops::mult(c * this->rhs().coeff() * this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), this->rhs().obj(), Y);
+	T_Scalar alpha = c * lhs.coeff() * rhs.coeff();
 
-	} else if(this->lhs().conjOp() && !this->rhs().conjOp()) {
+	if(!lhs.conjOp() && !rhs.conjOp()) {
 
-		T_Matrix lhs = this->lhs().evaluate();
-		ops::mult(c * this->rhs().coeff(), op_t::N, lhs, this->rhs().obj(), Y);
+		ops::mult(alpha, lhs.transOp(), lhs.obj(), rhs.obj(), Y);
 
-	} else if(!this->lhs().conjOp() && this->rhs().conjOp()) {
+	} else if(rhs.conjOp() && conj_foldable(lhs)) {
 
-		T_Vector rhs = this->rhs().evaluate();
-		ops::mult(c * this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), rhs, Y);
+		//
+		// y += alpha * conj(op'(A) * x) <=> conj(y) += conj(alpha) * op'(A) * x
+		// Y is restored if the product throws
+		//
+		Y.iconjugate();
+		try {
+			ops::mult(arith::conj(alpha), conj_folded_op(lhs), lhs.obj(), rhs.obj(), Y);
+		} catch(...) {
+			Y.iconjugate();
+			throw;
+		} // restore
+		Y.iconjugate();
 
 	} else {
 
-		T_Matrix lhs = this->lhs().evaluate();
-		T_Vector rhs = this->rhs().evaluate();
-		ops::mult(c, op_t::N, lhs, rhs, Y);
+		T_Vector tmp;
+		materialize_operand(lhs, rhs, tmp).update(c, Y);
 
 	} // conjop
 }
@@ -209,58 +286,58 @@ const VirtualProdMm<T_Matrix>& VirtualProdMm<T_Matrix>::self() const
 template <typename T_Matrix>
 T_Matrix VirtualProdMm<T_Matrix>::evaluate() const
 {
-	if(!this->lhs().conjOp() && !this->rhs().conjOp()) {
+	const VirtualMatrix<T_Matrix>& lhs = this->lhs();
+	const VirtualMatrix<T_Matrix>& rhs = this->rhs();
 
-	return ops::mult(
-			this->rhs().coeff() * this->lhs().coeff(), 
-			this->lhs().transOp(), this->lhs().obj(), 
-			this->rhs().transOp(), this->rhs().obj());
+	T_Scalar alpha = lhs.coeff() * rhs.coeff();
 
-	} else if(this->lhs().conjOp() && !this->rhs().conjOp()) {
+	if(!lhs.conjOp() && !rhs.conjOp()) {
 
-		T_Matrix lhs = this->lhs().evaluate();
-		return ops::mult(this->rhs().coeff(), op_t::N, lhs, this->rhs().transOp(), this->rhs().obj());
+		return ops::mult(alpha, lhs.transOp(), lhs.obj(), rhs.transOp(), rhs.obj());
 
-	} else if(!this->lhs().conjOp() && this->rhs().conjOp()) {
+	} else if(conj_foldable(lhs) && conj_foldable(rhs)) {
 
-		T_Matrix rhs = this->rhs().evaluate();
-		return ops::mult(this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), op_t::N, rhs);
-
-	} else {
-
-		T_Matrix lhs = this->lhs().evaluate();
-		T_Matrix rhs = this->rhs().evaluate();
-		return ops::mult(T_Scalar(1), op_t::N, lhs, op_t::N, rhs);
+		T_Matrix ret = ops::mult(arith::conj(alpha), conj_folded_op(lhs), lhs.obj(), conj_folded_op(rhs), rhs.obj());
+		ret.iconjugate();
+		return ret;
 
 	} // conjop
+
+	T_Matrix tmp;
+	return materialize_operand(lhs, rhs, tmp).evaluate();
 }
 /*-------------------------------------------------*/
 template <typename T_Matrix>
 void VirtualProdMm<T_Matrix>::update(T_Scalar c, T_Matrix& B) const
 {
-	if(!this->lhs().conjOp() && !this->rhs().conjOp()) {
+	const VirtualMatrix<T_Matrix>& lhs = this->lhs();
+	const VirtualMatrix<T_Matrix>& rhs = this->rhs();
 
-		ops::mult(
-				c * this->rhs().coeff() * this->lhs().coeff(), 
-				this->lhs().transOp(), this->lhs().obj(), 
-				this->rhs().transOp(), this->rhs().obj(), 
-				B);
+	T_Scalar alpha = c * lhs.coeff() * rhs.coeff();
 
-	} else if(this->lhs().conjOp() && !this->rhs().conjOp()) {
+	if(!lhs.conjOp() && !rhs.conjOp()) {
 
-		T_Matrix lhs = this->lhs().evaluate();
-		ops::mult(c * this->rhs().coeff(), op_t::N, lhs, this->rhs().transOp(), this->rhs().obj(), B);
+		ops::mult(alpha, lhs.transOp(), lhs.obj(), rhs.transOp(), rhs.obj(), B);
 
-	} else if(!this->lhs().conjOp() && this->rhs().conjOp()) {
+	} else if(conj_foldable(lhs) && conj_foldable(rhs)) {
 
-		T_Matrix rhs = this->rhs().evaluate();
-		ops::mult(c * this->lhs().coeff(), this->lhs().transOp(), this->lhs().obj(), op_t::N, rhs, B);
+		//
+		// B += alpha * conj(op'(A1) * op'(A2)) <=> conj(B) += conj(alpha) * op'(A1) * op'(A2)
+		// B is restored if the product throws
+		//
+		B.iconjugate();
+		try {
+			ops::mult(arith::conj(alpha), conj_folded_op(lhs), lhs.obj(), conj_folded_op(rhs), rhs.obj(), B);
+		} catch(...) {
+			B.iconjugate();
+			throw;
+		} // restore
+		B.iconjugate();
 
 	} else {
 
-		T_Matrix lhs = this->lhs().evaluate();
-		T_Matrix rhs = this->rhs().evaluate();
-		ops::mult(c, op_t::N, lhs, op_t::N, rhs, B);
+		T_Matrix tmp;
+		materialize_operand(lhs, rhs, tmp).update(c, B);
 
 	} // conjop
 }
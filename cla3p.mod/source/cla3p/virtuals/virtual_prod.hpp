@@ -46,6 +46,8 @@ class VirtualProdXx : public VirtualEntity<typename T_Rhs::value_type,T_Virtual>
 		void iscale(T_Scalar val) override;
 		void iconjugate() override;
 
+		bool references(const T_Object& Y) const;
+
 	protected:
 		const T_Lhs& lhs() const;
 		const T_Rhs& rhs() const;
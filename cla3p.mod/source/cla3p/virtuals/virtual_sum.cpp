@@ -0,0 +1,173 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// this file inc
+#include "cla3p/virtuals/virtual_sum.hpp"
+
+// system
+
+// 3rd
+
+// cla3p
+#include "cla3p/dense.hpp"
+#include "cla3p/support/utils.hpp"
+#include "cla3p/algebra/functional_update.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p {
+/*-------------------------------------------------*/
+template <typename T_Object>
+VirtualSum<T_Object>::VirtualSum()
+{
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+VirtualSum<T_Object>::VirtualSum(const T_Leaf& term)
+{
+	append(term);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+VirtualSum<T_Object>::VirtualSum(const T_Prod& term)
+{
+	append(term);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+VirtualSum<T_Object>::~VirtualSum()
+{
+	clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::clear()
+{
+	m_terms.clear();
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::append(const T_Leaf& term)
+{
+	Term tmp;
+	tmp.isprod = false;
+	tmp.leaf = term;
+	m_terms.push_back(tmp);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::append(const T_Prod& term)
+{
+	Term tmp;
+	tmp.isprod = true;
+	tmp.prod = term;
+	m_terms.push_back(tmp);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::append(const VirtualSum<T_Object>& other)
+{
+	m_terms.insert(m_terms.end(), other.m_terms.begin(), other.m_terms.end());
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+uint_t VirtualSum<T_Object>::numTerms() const
+{
+	return static_cast<uint_t>(m_terms.size());
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+const VirtualSum<T_Object>& VirtualSum<T_Object>::self() const
+{
+	return (*this);
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+T_Object VirtualSum<T_Object>::evaluate() const
+{
+	if(m_terms.empty()) {
+		return T_Object();
+	} // empty
+
+	const Term& first = m_terms.front();
+
+	T_Object ret = (first.isprod ? first.prod.evaluate() : first.leaf.evaluate());
+
+	for(bulk_t k = 1; k < m_terms.size(); k++) {
+		if(m_terms[k].isprod) m_terms[k].prod.update(T_Scalar(1), ret);
+		else                  m_terms[k].leaf.update(T_Scalar(1), ret);
+	} // k
+
+	return ret;
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::update(T_Scalar c, T_Object& Y) const
+{
+	//
+	// Terms are accumulated into Y one by one, so a term that reads Y
+	// (X += D*E + X, X += A*X + B) needs the whole sum evaluated first
+	//
+	for(const Term& term : m_terms) {
+		if(term.isprod ? term.prod.references(Y) : overlapping(term.leaf.obj(), Y)) {
+			ops::update(c, evaluate(), Y);
+			return;
+		} // aliased
+	} // term
+
+	for(const Term& term : m_terms) {
+		if(term.isprod) term.prod.update(c, Y);
+		else            term.leaf.update(c, Y);
+	} // term
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+VirtualSum<T_Object>::operator T_Object() const
+{
+	return evaluate();
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::iscale(T_Scalar val)
+{
+	for(Term& term : m_terms) {
+		if(term.isprod) term.prod.iscale(val);
+		else            term.leaf.iscale(val);
+	} // term
+}
+/*-------------------------------------------------*/
+template <typename T_Object>
+void VirtualSum<T_Object>::iconjugate()
+{
+	for(Term& term : m_terms) {
+		if(term.isprod) term.prod.iconjugate();
+		else            term.leaf.iconjugate();
+	} // term
+}
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+/*-------------------------------------------------*/
+template class VirtualSum<dns::RdVector>;
+template class VirtualSum<dns::RfVector>;
+template class VirtualSum<dns::CdVector>;
+template class VirtualSum<dns::CfVector>;
+/*-------------------------------------------------*/
+template class VirtualSum<dns::RdMatrix>;
+template class VirtualSum<dns::RfMatrix>;
+template class VirtualSum<dns::CdMatrix>;
+template class VirtualSum<dns::CfMatrix>;
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
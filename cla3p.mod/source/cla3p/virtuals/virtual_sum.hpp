@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023-2024 Connor C. Kaufman (connor.kaufman.gh@outlook.com)
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLA3P_VIRTUAL_SUM_HPP_
+#define CLA3P_VIRTUAL_SUM_HPP_
+
+/**
+ * @file
+ */
+
+#include <vector>
+
+#include "cla3p/types.hpp"
+#include "cla3p/virtuals/virtual_entity.hpp"
+#include "cla3p/virtuals/virtual_object.hpp"
+#include "cla3p/virtuals/virtual_prod.hpp"
+
+/*-------------------------------------------------*/
+namespace cla3p { 
+/*-------------------------------------------------*/
+namespace dns { template <typename T_Scalar> class RxVector; }
+namespace dns { template <typename T_Scalar> class CxVector; }
+namespace dns { template <typename T_Scalar> class RxMatrix; }
+namespace dns { template <typename T_Scalar> class CxMatrix; }
+/*-------------------------------------------------*/
+template <typename T_Object> class VirtualSum;
+/*-------------------------------------------------*/
+//
+// Maps an object to the virtual types that can appear as terms of a sum
+// Objects without a specialization (sparse) do not form lazy sums
+//
+template <typename T_Object> class VirtualTerms {};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+class VirtualTerms<dns::RxVector<T_Scalar>> {
+	public:
+		using leaf_type = VirtualVector<dns::RxVector<T_Scalar>>;
+		using prod_type = VirtualProdMv<dns::RxVector<T_Scalar>>;
+		using sum_type = VirtualSum<dns::RxVector<T_Scalar>>;
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+class VirtualTerms<dns::CxVector<T_Scalar>> {
+	public:
+		using leaf_type = VirtualVector<dns::CxVector<T_Scalar>>;
+		using prod_type = VirtualProdMv<dns::CxVector<T_Scalar>>;
+		using sum_type = VirtualSum<dns::CxVector<T_Scalar>>;
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+class VirtualTerms<dns::RxMatrix<T_Scalar>> {
+	public:
+		using leaf_type = VirtualMatrix<dns::RxMatrix<T_Scalar>>;
+		using prod_type = VirtualProdMm<dns::RxMatrix<T_Scalar>>;
+		using sum_type = VirtualSum<dns::RxMatrix<T_Scalar>>;
+};
+/*-------------------------------------------------*/
+template <typename T_Scalar>
+class VirtualTerms<dns::CxMatrix<T_Scalar>> {
+	public:
+		using leaf_type = VirtualMatrix<dns::CxMatrix<T_Scalar>>;
+		using prod_type = VirtualProdMm<dns::CxMatrix<T_Scalar>>;
+		using sum_type = VirtualSum<dns::CxMatrix<T_Scalar>>;
+};
+/*-------------------------------------------------*/
+//
+// A lazy sum of (scaled/transposed/conjugated) objects & products
+// Evaluation creates the result from the first term & accumulates the rest in-place
+//
+template <typename T_Object>
+class VirtualSum : public VirtualEntity<T_Object,VirtualSum<T_Object>> {
+
+	private:
+		using T_Scalar = typename T_Object::value_type;
+		using T_Leaf = typename VirtualTerms<T_Object>::leaf_type;
+		using T_Prod = typename VirtualTerms<T_Object>::prod_type;
+
+	public:
+		explicit VirtualSum();
+		explicit VirtualSum(const T_Leaf& term);
+		explicit VirtualSum(const T_Prod& term);
+		~VirtualSum();
+
+		void clear();
+
+		void append(const T_Leaf& term);
+		void append(const T_Prod& term);
+		void append(const VirtualSum<T_Object>& other);
+
+		uint_t numTerms() const;
+
+		const VirtualSum<T_Object>& self() const override;
+		T_Object evaluate() const override;
+		void update(T_Scalar c, T_Object& Y) const override;
+		operator T_Object() const;
+
+		void iscale(T_Scalar val) override;
+		void iconjugate() override;
+
+	private:
+		struct Term {
+			bool isprod;
+			T_Leaf leaf;
+			T_Prod prod;
+		};
+
+		std::vector<Term> m_terms;
+};
+/*-------------------------------------------------*/
+} // namespace cla3p
+/*-------------------------------------------------*/
+
+#endif // CLA3P_VIRTUAL_SUM_HPP_